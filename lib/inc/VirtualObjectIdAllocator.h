@@ -0,0 +1,102 @@
+#pragma once
+
+extern "C" {
+#include "sai.h"
+}
+
+#include "swss/dbconnector.h"
+
+#include <string>
+#include <memory>
+
+namespace sairedis
+{
+    /**
+     * @brief Virtual object id allocator.
+     *
+     * Virtual object ids are composed from global counter held in redis
+     * database which is shared between sairedis and syncd. Instead of
+     * executing INCR on every object create, allocator reserves whole block
+     * of counter values using single INCRBY command and hands them out
+     * locally until block is exhausted.
+     *
+     * Since INCRBY is atomic, reserved ranges never overlap with ranges or
+     * single values obtained by other clients of the same counter. Unused
+     * values of reserved block are lost when allocator is reset, which is
+     * fine since counter is 48 bits wide.
+     */
+    class VirtualObjectIdAllocator
+    {
+        public:
+
+            static constexpr uint64_t DEFAULT_BLOCK_SIZE = 128;
+
+        public:
+
+            VirtualObjectIdAllocator(
+                    _In_ std::shared_ptr<swss::DBConnector> db,
+                    _In_ const std::string& counterName,
+                    _In_ uint64_t blockSize = DEFAULT_BLOCK_SIZE);
+
+            virtual ~VirtualObjectIdAllocator() = default;
+
+        public:
+
+            /**
+             * @brief Allocate single counter value.
+             *
+             * Value is taken from locally reserved block, new block is
+             * reserved in database when current one is exhausted.
+             */
+            uint64_t allocate();
+
+            /**
+             * @brief Allocate range of consecutive counter values.
+             *
+             * Range is reserved directly in database using single INCRBY
+             * command and local block is not touched.
+             *
+             * @return First value of reserved range [first, first + count).
+             */
+            uint64_t allocate(
+                    _In_ uint64_t count);
+
+            /**
+             * @brief Set block size used for future reservations.
+             *
+             * Block size 1 is equivalent of executing INCR on each allocation.
+             */
+            void setBlockSize(
+                    _In_ uint64_t blockSize);
+
+            uint64_t getBlockSize() const;
+
+            /**
+             * @brief Drop locally reserved block.
+             */
+            void reset();
+
+        private:
+
+            uint64_t reserve(
+                    _In_ uint64_t count);
+
+        private:
+
+            std::shared_ptr<swss::DBConnector> m_db;
+
+            std::string m_counterName;
+
+            uint64_t m_blockSize;
+
+            /**
+             * @brief Next value to hand out from local block.
+             */
+            uint64_t m_next;
+
+            /**
+             * @brief Last value of local block (inclusive).
+             */
+            uint64_t m_last;
+    };
+}
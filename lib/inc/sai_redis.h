@@ -26,6 +26,7 @@ extern "C" {
 #include "meta/sai_meta.h"
 
 #include "SwitchContainer.h"
+#include "VirtualObjectIdAllocator.h"
 
 /*
  * Switch index is encoded on 1 byte so we can have
@@ -62,6 +63,7 @@ extern volatile bool g_asicInitViewMode;
 extern volatile bool g_logrotate;
 extern volatile bool g_syncMode;
 extern volatile bool g_recordStats;
+extern volatile bool g_useBinaryAttributes;
 
 extern sai_service_method_table_t                   g_services;
 extern std::shared_ptr<swss::ProducerTable>         g_asicState;
@@ -70,6 +72,7 @@ extern std::shared_ptr<swss::NotificationConsumer>  g_redisNotifications;
 extern std::shared_ptr<swss::RedisClient>           g_redisClient;
 
 extern std::shared_ptr<sairedis::SwitchContainer>   g_switchContainer;
+extern std::shared_ptr<sairedis::VirtualObjectIdAllocator> g_virtualObjectIdAllocator;
 
 extern const sai_acl_api_t              redis_acl_api;
 extern const sai_bfd_api_t              redis_bfd_api;
@@ -125,6 +128,21 @@ const sai_attribute_t* redis_get_attribute_by_id(
         _In_ uint32_t attr_count,
         _In_ const sai_attribute_t *attr_list);
 
+void redis_check_virtual_object_type(
+        _In_ sai_object_type_t object_type);
+
+/**
+ * @brief Serialize attributes as single binary field when binary attributes
+ * were negotiated with syncd.
+ *
+ * @return False if text serialization must be used.
+ */
+bool redis_serialize_binary_attr_list(
+        _In_ sai_object_type_t object_type,
+        _In_ uint32_t attr_count,
+        _In_ const sai_attribute_t *attr_list,
+        _Out_ std::vector<swss::FieldValueTuple> &entry);
+
 sai_object_id_t redis_create_virtual_object_id(
         _In_ sai_object_type_t object_type);
 
@@ -125,6 +125,37 @@ typedef enum _sai_redis_switch_attr_t
      */
     SAI_REDIS_SWITCH_ATTR_RECORD_STATS,
 
+    /**
+     * @brief Virtual object id block size.
+     *
+     * Number of virtual object ids reserved in ASIC_DB counter by single
+     * database call when creating objects. Ids are handed out locally until
+     * block is exhausted. Setting this value to 1 will cause database call
+     * on each object create. Bulk create always reserves exactly object count
+     * ids in single call regardless of this value.
+     *
+     * @type sai_uint32_t
+     * @flags CREATE_AND_SET
+     * @default 128
+     */
+    SAI_REDIS_SWITCH_ATTR_VID_BLOCK_SIZE,
+
+    /**
+     * @brief Send attributes to syncd in binary form.
+     *
+     * Create and set attributes are sent as single binary field instead of
+     * one text field per attribute, when all attribute value types support
+     * that, otherwise text is sent. Syncd is asked whether it supports
+     * binary form, if not, set will fail and text will still be used.
+     * Syncd keeps attributes as text in ASIC_STATE, recording also stays
+     * in text form.
+     *
+     * @type bool
+     * @flags CREATE_AND_SET
+     * @default false
+     */
+    SAI_REDIS_SWITCH_ATTR_USE_BINARY_ATTRIBUTES,
+
 } sai_redis_switch_attr_t;
 
 #endif // __SAIREDIS__
@@ -6,9 +6,13 @@
 #define SYNCD_INIT_VIEW     "INIT_VIEW"
 #define SYNCD_APPLY_VIEW    "APPLY_VIEW"
 #define SYNCD_INSPECT_ASIC  "SYNCD_INSPECT_ASIC"
+#define SYNCD_ENABLE_BINARY_ATTRIBUTES "ENABLE_BINARY_ATTRIBUTES"
 #define ASIC_STATE_TABLE    "ASIC_STATE"
 #define TEMP_PREFIX         "TEMP_"
 
+// Field carrying all create/set attributes in binary form
+#define BINARY_ATTRIBUTES_FIELD "SAI_REDIS_BINARY_ATTRIBUTES"
+
 // Messages for processing queries from libsairedis to syncd
 #define STRING_ATTR_ENUM_VALUES_CAPABILITY_QUERY        "attr_enum_values_capability_query"
 #define STRING_ATTR_ENUM_VALUES_CAPABILITY_RESPONSE     "attr_enum_values_capability_response"
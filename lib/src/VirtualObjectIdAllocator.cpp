@@ -0,0 +1,117 @@
+#include "VirtualObjectIdAllocator.h"
+
+#include "swss/logger.h"
+#include "swss/rediscommand.h"
+#include "swss/redisreply.h"
+
+#include <inttypes.h>
+
+using namespace sairedis;
+
+constexpr uint64_t VirtualObjectIdAllocator::DEFAULT_BLOCK_SIZE;
+
+VirtualObjectIdAllocator::VirtualObjectIdAllocator(
+        _In_ std::shared_ptr<swss::DBConnector> db,
+        _In_ const std::string& counterName,
+        _In_ uint64_t blockSize):
+    m_db(db),
+    m_counterName(counterName),
+    m_blockSize(DEFAULT_BLOCK_SIZE),
+    m_next(1),
+    m_last(0)
+{
+    SWSS_LOG_ENTER();
+
+    setBlockSize(blockSize);
+}
+
+uint64_t VirtualObjectIdAllocator::allocate()
+{
+    SWSS_LOG_ENTER();
+
+    if (m_next > m_last)
+    {
+        m_next = reserve(m_blockSize);
+
+        m_last = m_next + m_blockSize - 1;
+
+        SWSS_LOG_INFO("reserved %s block 0x%" PRIx64 "..0x%" PRIx64,
+                m_counterName.c_str(),
+                m_next,
+                m_last);
+    }
+
+    return m_next++;
+}
+
+uint64_t VirtualObjectIdAllocator::allocate(
+        _In_ uint64_t count)
+{
+    SWSS_LOG_ENTER();
+
+    if (count == 0)
+    {
+        SWSS_LOG_THROW("can't allocate empty range of %s", m_counterName.c_str());
+    }
+
+    return reserve(count);
+}
+
+void VirtualObjectIdAllocator::setBlockSize(
+        _In_ uint64_t blockSize)
+{
+    SWSS_LOG_ENTER();
+
+    if (blockSize == 0)
+    {
+        SWSS_LOG_THROW("block size of %s must be non zero", m_counterName.c_str());
+    }
+
+    SWSS_LOG_NOTICE("setting %s block size to %" PRIu64, m_counterName.c_str(), blockSize);
+
+    m_blockSize = blockSize;
+}
+
+uint64_t VirtualObjectIdAllocator::getBlockSize() const
+{
+    SWSS_LOG_ENTER();
+
+    return m_blockSize;
+}
+
+void VirtualObjectIdAllocator::reset()
+{
+    SWSS_LOG_ENTER();
+
+    m_next = 1;
+    m_last = 0;
+}
+
+uint64_t VirtualObjectIdAllocator::reserve(
+        _In_ uint64_t count)
+{
+    SWSS_LOG_ENTER();
+
+    swss::RedisCommand incrby;
+
+    incrby.format("INCRBY %s %" PRIu64, m_counterName.c_str(), count);
+
+    swss::RedisReply r(m_db.get(), incrby, REDIS_REPLY_INTEGER);
+
+    long long int value = r.getContext()->integer;
+
+    if (value < 0 || (uint64_t)value < count)
+    {
+        SWSS_LOG_THROW("invalid %s value %lld after reserving %" PRIu64,
+                m_counterName.c_str(),
+                value,
+                count);
+    }
+
+    /*
+     * INCRBY returns value after increment, so reserved range is
+     * [value - count + 1, value].
+     */
+
+    return (uint64_t)value - count + 1;
+}
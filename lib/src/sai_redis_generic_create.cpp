@@ -1,10 +1,13 @@
 #include "sai_redis.h"
+#include "sairediscommon.h"
 #include "meta/sai_serialize.h"
 #include "meta/saiattributelist.h"
 #include <inttypes.h>
 
 bool switch_ids[MAX_SWITCHES] = {};
 
+volatile bool g_useBinaryAttributes = false;
+
 void redis_clear_switch_ids()
 {
     SWSS_LOG_ENTER();
@@ -152,17 +155,25 @@ int redis_get_switch_id_index(
             sai_serialize_object_type(switch_object_type).c_str());
 }
 
-sai_object_id_t redis_create_virtual_object_id(
-        _In_ sai_object_type_t object_type,
-        _In_ sai_object_id_t switch_id)
+void redis_check_virtual_object_type(
+        _In_ sai_object_type_t object_type)
 {
     SWSS_LOG_ENTER();
 
     if ((object_type <= SAI_OBJECT_TYPE_NULL) ||
             (object_type >= SAI_OBJECT_TYPE_EXTENSIONS_MAX))
     {
-        SWSS_LOG_THROW("invalid objct type: %d", object_type);
+        SWSS_LOG_THROW("invalid object type: %d", object_type);
     }
+}
+
+sai_object_id_t redis_create_virtual_object_id(
+        _In_ sai_object_type_t object_type,
+        _In_ sai_object_id_t switch_id)
+{
+    SWSS_LOG_ENTER();
+
+    redis_check_virtual_object_type(object_type);
 
     // object_id:
     // bits 63..56 - switch index
@@ -180,7 +191,7 @@ sai_object_id_t redis_create_virtual_object_id(
 
     int index = redis_get_switch_id_index(switch_id);
 
-    uint64_t virtual_id = g_redisClient->incr("VIDCOUNTER");
+    uint64_t virtual_id = g_virtualObjectIdAllocator->allocate();
 
     sai_object_id_t object_id = redis_construct_object_id(object_type, index, virtual_id);
 
@@ -200,6 +211,31 @@ void redis_free_virtual_object_id(
     }
 }
 
+bool redis_serialize_binary_attr_list(
+        _In_ sai_object_type_t object_type,
+        _In_ uint32_t attr_count,
+        _In_ const sai_attribute_t *attr_list,
+        _Out_ std::vector<swss::FieldValueTuple> &entry)
+{
+    SWSS_LOG_ENTER();
+
+    if (!g_useBinaryAttributes || attr_count == 0)
+    {
+        return false;
+    }
+
+    std::string binary;
+
+    if (!sai_serialize_attr_list_binary(object_type, attr_count, attr_list, binary))
+    {
+        return false;
+    }
+
+    entry.emplace_back(BINARY_ATTRIBUTES_FIELD, binary);
+
+    return true;
+}
+
 sai_status_t internal_redis_generic_create(
         _In_ sai_object_type_t object_type,
         _In_ const std::string &serialized_object_id,
@@ -208,19 +244,28 @@ sai_status_t internal_redis_generic_create(
 {
     SWSS_LOG_ENTER();
 
-    std::vector<swss::FieldValueTuple> entry = SaiAttributeList::serialize_attr_list(
-            object_type,
-            attr_count,
-            attr_list,
-            false);
+    std::vector<swss::FieldValueTuple> binaryEntry;
+
+    bool binary = redis_serialize_binary_attr_list(object_type, attr_count, attr_list, binaryEntry);
+
+    std::vector<swss::FieldValueTuple> entry;
 
-    if (entry.size() == 0)
+    if (!binary || g_record)
     {
-        // make sure that we put object into db
-        // even if there are no attributes set
-        swss::FieldValueTuple null("NULL", "NULL");
+        entry = SaiAttributeList::serialize_attr_list(
+                object_type,
+                attr_count,
+                attr_list,
+                false);
 
-        entry.push_back(null);
+        if (entry.size() == 0)
+        {
+            // make sure that we put object into db
+            // even if there are no attributes set
+            swss::FieldValueTuple null("NULL", "NULL");
+
+            entry.push_back(null);
+        }
     }
 
     std::string str_object_type = sai_serialize_object_type(object_type);
@@ -234,7 +279,7 @@ sai_status_t internal_redis_generic_create(
         recordLine("c|" + key + "|" + joinFieldValues(entry));
     }
 
-    g_asicState->set(key, entry, "create");
+    g_asicState->set(key, binary ? binaryEntry : entry, "create");
 
     return internal_api_wait_for_response(SAI_COMMON_API_CREATE);
 }
@@ -282,20 +327,33 @@ sai_status_t redis_bulk_generic_create(
 
     std::vector<std::string> serialized_object_ids;
 
+    if (object_type == SAI_OBJECT_TYPE_SWITCH)
+    {
+        SWSS_LOG_ERROR("bulk create of %s is not supported",
+                sai_serialize_object_type(object_type).c_str());
+
+        return SAI_STATUS_NOT_SUPPORTED;
+    }
+
+    redis_check_virtual_object_type(object_type);
+
+    int index = redis_get_switch_id_index(switch_id);
+
+    /*
+     * Reserve whole range of virtual ids using single database call instead
+     * of calling INCR for each object.
+     */
+
+    uint64_t first = object_count ? g_virtualObjectIdAllocator->allocate(object_count) : 0;
+
+    serialized_object_ids.reserve(object_count);
+
     // on create vid is put in db by syncd
     for (uint32_t idx = 0; idx < object_count; idx++)
     {
-        object_id[idx] = redis_create_virtual_object_id(object_type, switch_id);
-        if (object_id[idx] == SAI_NULL_OBJECT_ID)
-        {
-            SWSS_LOG_ERROR("failed to create %s, with switch id: %s",
-                    sai_serialize_object_type(object_type).c_str(),
-                    sai_serialize_object_id(switch_id).c_str());
+        object_id[idx] = redis_construct_object_id(object_type, index, first + idx);
 
-            return SAI_STATUS_INSUFFICIENT_RESOURCES;
-        }
-        std::string str_object_id = sai_serialize_object_id(object_id[idx]);
-        serialized_object_ids.push_back(str_object_id);
+        serialized_object_ids.push_back(sai_serialize_object_id(object_id[idx]));
     }
 
     return internal_redis_bulk_generic_create(
@@ -86,11 +86,20 @@ sai_status_t internal_redis_generic_set(
 {
     SWSS_LOG_ENTER();
 
-    std::vector<swss::FieldValueTuple> entry = SaiAttributeList::serialize_attr_list(
-            object_type,
-            1,
-            attr,
-            false);
+    std::vector<swss::FieldValueTuple> binaryEntry;
+
+    bool binary = redis_serialize_binary_attr_list(object_type, 1, attr, binaryEntry);
+
+    std::vector<swss::FieldValueTuple> entry;
+
+    if (!binary || g_record)
+    {
+        entry = SaiAttributeList::serialize_attr_list(
+                object_type,
+                1,
+                attr,
+                false);
+    }
 
     std::string str_object_type = sai_serialize_object_type(object_type);
 
@@ -103,7 +112,7 @@ sai_status_t internal_redis_generic_set(
         recordLine("s|" + key + "|" + joinFieldValues(entry));
     }
 
-    g_asicState->set(key, entry, "set");
+    g_asicState->set(key, binary ? binaryEntry : entry, "set");
 
     return internal_api_wait_for_response(SAI_COMMON_API_SET);
 }
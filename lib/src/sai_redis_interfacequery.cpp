@@ -28,6 +28,8 @@ std::shared_ptr<swss::RedisPipeline>        g_redisPipeline;
 // TODO must be per syncd instance
 std::shared_ptr<SwitchContainer>            g_switchContainer;
 
+std::shared_ptr<VirtualObjectIdAllocator>   g_virtualObjectIdAllocator;
+
 void clear_local_state()
 {
     SWSS_LOG_ENTER();
@@ -45,6 +47,12 @@ void clear_local_state()
 
     // Reset used switch ids.
     redis_clear_switch_ids();
+
+    // Drop reserved virtual id block, counter could be reset by syncd.
+    if (g_virtualObjectIdAllocator)
+    {
+        g_virtualObjectIdAllocator->reset();
+    }
 }
 
 void ntf_thread()
@@ -117,6 +125,8 @@ sai_status_t sai_api_initialize(
     g_redisNotifications = std::make_shared<swss::NotificationConsumer>(g_dbNtf.get(), "NOTIFICATIONS");
     g_redisClient        = std::make_shared<swss::RedisClient>(g_db.get());
 
+    g_virtualObjectIdAllocator = std::make_shared<VirtualObjectIdAllocator>(g_db, "VIDCOUNTER");
+
     clear_local_state();
 
     g_asicInitViewMode = false;
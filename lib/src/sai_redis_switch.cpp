@@ -82,6 +82,37 @@ sai_status_t sai_redis_internal_notify_syncd(
     return SAI_STATUS_FAILURE;
 }
 
+sai_status_t sai_redis_use_binary_attributes(
+        _In_ bool enable)
+{
+    SWSS_LOG_ENTER();
+
+    if (!enable)
+    {
+        g_useBinaryAttributes = false;
+
+        return SAI_STATUS_SUCCESS;
+    }
+
+    // syncd must confirm it can decode binary attributes before we use them
+
+    sai_status_t status = sai_redis_internal_notify_syncd(SYNCD_ENABLE_BINARY_ATTRIBUTES);
+
+    if (status != SAI_STATUS_SUCCESS)
+    {
+        SWSS_LOG_WARN("syncd refused binary attributes: %s, text will be used",
+                sai_serialize_status(status).c_str());
+
+        return status;
+    }
+
+    SWSS_LOG_NOTICE("attributes will be sent to syncd in binary form");
+
+    g_useBinaryAttributes = true;
+
+    return SAI_STATUS_SUCCESS;
+}
+
 sai_status_t sai_redis_notify_syncd(
         _In_ const sai_attribute_t *attr)
 {
@@ -308,6 +339,20 @@ sai_status_t redis_set_switch_attribute(
             case SAI_REDIS_SWITCH_ATTR_RECORDING_OUTPUT_DIR:
                 return setRecordingOutputDir(*attr);
 
+            case SAI_REDIS_SWITCH_ATTR_VID_BLOCK_SIZE:
+
+                if (attr->value.u32 == 0)
+                {
+                    SWSS_LOG_ERROR("vid block size must be non zero");
+                    return SAI_STATUS_INVALID_ATTR_VALUE_0;
+                }
+
+                g_virtualObjectIdAllocator->setBlockSize(attr->value.u32);
+                return SAI_STATUS_SUCCESS;
+
+            case SAI_REDIS_SWITCH_ATTR_USE_BINARY_ATTRIBUTES:
+                return sai_redis_use_binary_attributes(attr->value.booldata);
+
             default:
                 break;
         }
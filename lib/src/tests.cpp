@@ -0,0 +1,204 @@
+#include <memory>
+#include <string>
+
+#include <inttypes.h>
+
+#include "swss/logger.h"
+#include "swss/dbconnector.h"
+#include "swss/rediscommand.h"
+#include "swss/redisreply.h"
+
+#include "VirtualObjectIdAllocator.h"
+
+#define TEST_COUNTER "VIDCOUNTER_ALLOCATOR_TEST"
+
+#define ASSERT_EQ(a, b)\
+{\
+    uint64_t _a = (a);\
+    uint64_t _b = (b);\
+    if (_a != _b)\
+    {\
+        SWSS_LOG_THROW("assert failed %s == %s: 0x%" PRIx64 " != 0x%" PRIx64, #a, #b, _a, _b);\
+    }\
+}
+
+using namespace sairedis;
+
+std::shared_ptr<swss::DBConnector> g_db;
+
+uint64_t reply_integer(
+        _In_ const swss::RedisCommand &cmd)
+{
+    SWSS_LOG_ENTER();
+
+    swss::RedisReply r(g_db.get(), cmd, REDIS_REPLY_INTEGER);
+
+    return (uint64_t)r.getContext()->integer;
+}
+
+/**
+ * @brief Execute command on test counter, like INCR done by other client.
+ */
+uint64_t counter_command(
+        _In_ const char *command)
+{
+    SWSS_LOG_ENTER();
+
+    swss::RedisCommand cmd;
+
+    cmd.format("%s %s", command, TEST_COUNTER);
+
+    return reply_integer(cmd);
+}
+
+uint64_t get_counter()
+{
+    SWSS_LOG_ENTER();
+
+    swss::RedisCommand cmd;
+
+    // INCRBY 0 returns current value and creates counter if it's missing
+
+    cmd.format("INCRBY %s 0", TEST_COUNTER);
+
+    return reply_integer(cmd);
+}
+
+void reset_counter()
+{
+    SWSS_LOG_ENTER();
+
+    counter_command("DEL");
+}
+
+void test_allocator_block_refill()
+{
+    SWSS_LOG_ENTER();
+
+    reset_counter();
+
+    VirtualObjectIdAllocator allocator(g_db, TEST_COUNTER, 4);
+
+    // first allocation reserves whole block
+
+    ASSERT_EQ(allocator.allocate(), 1);
+    ASSERT_EQ(get_counter(), 4);
+
+    ASSERT_EQ(allocator.allocate(), 2);
+    ASSERT_EQ(allocator.allocate(), 3);
+
+    // last value of block is used without new reservation
+
+    ASSERT_EQ(allocator.allocate(), 4);
+    ASSERT_EQ(get_counter(), 4);
+
+    // block is exhausted, next block is reserved
+
+    ASSERT_EQ(allocator.allocate(), 5);
+    ASSERT_EQ(get_counter(), 8);
+
+    // other client takes value after our block
+
+    ASSERT_EQ(counter_command("INCR"), 9);
+
+    ASSERT_EQ(allocator.allocate(), 6);
+    ASSERT_EQ(allocator.allocate(), 7);
+    ASSERT_EQ(allocator.allocate(), 8);
+
+    // next block must start after value taken by other client
+
+    ASSERT_EQ(allocator.allocate(), 10);
+    ASSERT_EQ(get_counter(), 13);
+
+    // reset drops rest of local block
+
+    allocator.reset();
+
+    ASSERT_EQ(allocator.allocate(), 14);
+    ASSERT_EQ(get_counter(), 17);
+}
+
+void test_allocator_block_size_one()
+{
+    SWSS_LOG_ENTER();
+
+    reset_counter();
+
+    VirtualObjectIdAllocator allocator(g_db, TEST_COUNTER);
+
+    allocator.setBlockSize(1);
+
+    ASSERT_EQ(allocator.getBlockSize(), 1);
+
+    // each allocation behaves like INCR executed on each create
+
+    for (uint64_t idx = 1; idx <= 10; idx++)
+    {
+        ASSERT_EQ(allocator.allocate(), idx);
+        ASSERT_EQ(get_counter(), idx);
+    }
+
+    ASSERT_EQ(counter_command("INCR"), 11);
+
+    ASSERT_EQ(allocator.allocate(), 12);
+    ASSERT_EQ(get_counter(), 12);
+}
+
+void test_allocator_bulk_range()
+{
+    SWSS_LOG_ENTER();
+
+    reset_counter();
+
+    VirtualObjectIdAllocator allocator(g_db, TEST_COUNTER, 8);
+
+    // local block 1..8
+
+    ASSERT_EQ(allocator.allocate(), 1);
+
+    // bulk range is reserved after local block
+
+    ASSERT_EQ(allocator.allocate(16), 9);
+    ASSERT_EQ(get_counter(), 24);
+
+    // local block is not touched by bulk allocation
+
+    for (uint64_t idx = 2; idx <= 8; idx++)
+    {
+        ASSERT_EQ(allocator.allocate(), idx);
+    }
+
+    ASSERT_EQ(get_counter(), 24);
+
+    // next local block starts after bulk range [9, 24]
+
+    ASSERT_EQ(allocator.allocate(), 25);
+    ASSERT_EQ(get_counter(), 32);
+
+    // bulk range in the middle of local block
+
+    ASSERT_EQ(allocator.allocate(3), 33);
+    ASSERT_EQ(allocator.allocate(), 26);
+    ASSERT_EQ(get_counter(), 35);
+}
+
+int main()
+{
+    swss::Logger::getInstance().setMinPrio(swss::Logger::SWSS_DEBUG);
+
+    SWSS_LOG_ENTER();
+
+    swss::Logger::getInstance().setMinPrio(swss::Logger::SWSS_NOTICE);
+
+    g_db = std::make_shared<swss::DBConnector>("ASIC_DB", 0, true);
+
+    test_allocator_block_refill();
+
+    test_allocator_block_size_one();
+
+    test_allocator_bulk_range();
+
+    reset_counter();
+
+    return 0;
+}
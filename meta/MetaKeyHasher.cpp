@@ -0,0 +1,215 @@
+#include "MetaKeyHasher.h"
+
+#include "swss/logger.h"
+
+#include <string.h>
+
+#include <functional>
+
+using namespace saimeta;
+
+static inline void hash_combine(
+        _Inout_ std::size_t& seed,
+        _In_ uint64_t value)
+{
+    // SWSS_LOG_ENTER() disabled for performance reasons
+
+    seed ^= std::hash<uint64_t>()(value) + 0x9e3779b9 + (seed << 6) + (seed >> 2);
+}
+
+static inline void hash_combine_bytes(
+        _Inout_ std::size_t& seed,
+        _In_ const uint8_t* data,
+        _In_ size_t length)
+{
+    // SWSS_LOG_ENTER() disabled for performance reasons
+
+    for (size_t idx = 0; idx < length; idx++)
+    {
+        hash_combine(seed, data[idx]);
+    }
+}
+
+static void hash_ip_address(
+        _Inout_ std::size_t& seed,
+        _In_ const sai_ip_address_t& ip)
+{
+    // SWSS_LOG_ENTER() disabled for performance reasons
+
+    hash_combine(seed, ip.addr_family);
+
+    if (ip.addr_family == SAI_IP_ADDR_FAMILY_IPV4)
+    {
+        hash_combine(seed, ip.addr.ip4);
+    }
+    else
+    {
+        hash_combine_bytes(seed, ip.addr.ip6, sizeof(ip.addr.ip6));
+    }
+}
+
+static void hash_ip_prefix(
+        _Inout_ std::size_t& seed,
+        _In_ const sai_ip_prefix_t& prefix)
+{
+    // SWSS_LOG_ENTER() disabled for performance reasons
+
+    hash_combine(seed, prefix.addr_family);
+
+    if (prefix.addr_family == SAI_IP_ADDR_FAMILY_IPV4)
+    {
+        hash_combine(seed, prefix.addr.ip4);
+        hash_combine(seed, prefix.mask.ip4);
+    }
+    else
+    {
+        hash_combine_bytes(seed, prefix.addr.ip6, sizeof(prefix.addr.ip6));
+        hash_combine_bytes(seed, prefix.mask.ip6, sizeof(prefix.mask.ip6));
+    }
+}
+
+static bool equal_ip_address(
+        _In_ const sai_ip_address_t& a,
+        _In_ const sai_ip_address_t& b)
+{
+    // SWSS_LOG_ENTER() disabled for performance reasons
+
+    if (a.addr_family != b.addr_family)
+        return false;
+
+    if (a.addr_family == SAI_IP_ADDR_FAMILY_IPV4)
+        return a.addr.ip4 == b.addr.ip4;
+
+    return memcmp(a.addr.ip6, b.addr.ip6, sizeof(a.addr.ip6)) == 0;
+}
+
+static bool equal_ip_prefix(
+        _In_ const sai_ip_prefix_t& a,
+        _In_ const sai_ip_prefix_t& b)
+{
+    // SWSS_LOG_ENTER() disabled for performance reasons
+
+    if (a.addr_family != b.addr_family)
+        return false;
+
+    if (a.addr_family == SAI_IP_ADDR_FAMILY_IPV4)
+        return a.addr.ip4 == b.addr.ip4 && a.mask.ip4 == b.mask.ip4;
+
+    return memcmp(a.addr.ip6, b.addr.ip6, sizeof(a.addr.ip6)) == 0 &&
+        memcmp(a.mask.ip6, b.mask.ip6, sizeof(a.mask.ip6)) == 0;
+}
+
+std::size_t MetaKeyHasher::operator()(
+        _In_ const sai_object_meta_key_t& k) const
+{
+    // SWSS_LOG_ENTER() disabled for performance reasons
+
+    std::size_t seed = (std::size_t)k.objecttype;
+
+    const auto& key = k.objectkey.key;
+
+    switch (k.objecttype)
+    {
+        case SAI_OBJECT_TYPE_FDB_ENTRY:
+
+            hash_combine(seed, key.fdb_entry.switch_id);
+            hash_combine(seed, key.fdb_entry.bv_id);
+            hash_combine_bytes(seed, key.fdb_entry.mac_address, sizeof(sai_mac_t));
+            break;
+
+        case SAI_OBJECT_TYPE_ROUTE_ENTRY:
+
+            hash_combine(seed, key.route_entry.switch_id);
+            hash_combine(seed, key.route_entry.vr_id);
+            hash_ip_prefix(seed, key.route_entry.destination);
+            break;
+
+        case SAI_OBJECT_TYPE_NEIGHBOR_ENTRY:
+
+            hash_combine(seed, key.neighbor_entry.switch_id);
+            hash_combine(seed, key.neighbor_entry.rif_id);
+            hash_ip_address(seed, key.neighbor_entry.ip_address);
+            break;
+
+        case SAI_OBJECT_TYPE_NAT_ENTRY:
+
+            /*
+             * NAT type is not part of serialized key, so it's not hashed
+             * here either.
+             */
+
+            hash_combine(seed, key.nat_entry.switch_id);
+            hash_combine(seed, key.nat_entry.vr_id);
+            hash_combine(seed, key.nat_entry.data.key.src_ip);
+            hash_combine(seed, key.nat_entry.data.key.dst_ip);
+            hash_combine(seed, key.nat_entry.data.key.proto);
+            hash_combine(seed, key.nat_entry.data.key.l4_src_port);
+            hash_combine(seed, key.nat_entry.data.key.l4_dst_port);
+            hash_combine(seed, key.nat_entry.data.mask.src_ip);
+            hash_combine(seed, key.nat_entry.data.mask.dst_ip);
+            hash_combine(seed, key.nat_entry.data.mask.proto);
+            hash_combine(seed, key.nat_entry.data.mask.l4_src_port);
+            hash_combine(seed, key.nat_entry.data.mask.l4_dst_port);
+            break;
+
+        default:
+
+            hash_combine(seed, key.object_id);
+            break;
+    }
+
+    return seed;
+}
+
+bool MetaKeyHasher::operator()(
+        _In_ const sai_object_meta_key_t& a,
+        _In_ const sai_object_meta_key_t& b) const
+{
+    // SWSS_LOG_ENTER() disabled for performance reasons
+
+    if (a.objecttype != b.objecttype)
+        return false;
+
+    const auto& ka = a.objectkey.key;
+    const auto& kb = b.objectkey.key;
+
+    switch (a.objecttype)
+    {
+        case SAI_OBJECT_TYPE_FDB_ENTRY:
+
+            return ka.fdb_entry.switch_id == kb.fdb_entry.switch_id &&
+                ka.fdb_entry.bv_id == kb.fdb_entry.bv_id &&
+                memcmp(ka.fdb_entry.mac_address, kb.fdb_entry.mac_address, sizeof(sai_mac_t)) == 0;
+
+        case SAI_OBJECT_TYPE_ROUTE_ENTRY:
+
+            return ka.route_entry.switch_id == kb.route_entry.switch_id &&
+                ka.route_entry.vr_id == kb.route_entry.vr_id &&
+                equal_ip_prefix(ka.route_entry.destination, kb.route_entry.destination);
+
+        case SAI_OBJECT_TYPE_NEIGHBOR_ENTRY:
+
+            return ka.neighbor_entry.switch_id == kb.neighbor_entry.switch_id &&
+                ka.neighbor_entry.rif_id == kb.neighbor_entry.rif_id &&
+                equal_ip_address(ka.neighbor_entry.ip_address, kb.neighbor_entry.ip_address);
+
+        case SAI_OBJECT_TYPE_NAT_ENTRY:
+
+            return ka.nat_entry.switch_id == kb.nat_entry.switch_id &&
+                ka.nat_entry.vr_id == kb.nat_entry.vr_id &&
+                ka.nat_entry.data.key.src_ip == kb.nat_entry.data.key.src_ip &&
+                ka.nat_entry.data.key.dst_ip == kb.nat_entry.data.key.dst_ip &&
+                ka.nat_entry.data.key.proto == kb.nat_entry.data.key.proto &&
+                ka.nat_entry.data.key.l4_src_port == kb.nat_entry.data.key.l4_src_port &&
+                ka.nat_entry.data.key.l4_dst_port == kb.nat_entry.data.key.l4_dst_port &&
+                ka.nat_entry.data.mask.src_ip == kb.nat_entry.data.mask.src_ip &&
+                ka.nat_entry.data.mask.dst_ip == kb.nat_entry.data.mask.dst_ip &&
+                ka.nat_entry.data.mask.proto == kb.nat_entry.data.mask.proto &&
+                ka.nat_entry.data.mask.l4_src_port == kb.nat_entry.data.mask.l4_src_port &&
+                ka.nat_entry.data.mask.l4_dst_port == kb.nat_entry.data.mask.l4_dst_port;
+
+        default:
+
+            return ka.object_id == kb.object_id;
+    }
+}
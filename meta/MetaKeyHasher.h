@@ -0,0 +1,32 @@
+#pragma once
+
+extern "C" {
+#include "sai.h"
+}
+
+#include <cstddef>
+
+namespace saimeta
+{
+    /**
+     * @brief Hash and equality functor for object meta key.
+     *
+     * Allows to use sai_object_meta_key_t directly as key in unordered
+     * containers without serializing it to string first. Object ids are
+     * hashed by value, non object id entries (FDB, neighbor, route, NAT) are
+     * hashed and compared field by field, so unused bytes of unions and
+     * structure padding are never taken into account.
+     *
+     * Only fields that are part of serialized meta key are considered, so
+     * two keys are equal exactly when their serialized forms are equal.
+     */
+    struct MetaKeyHasher
+    {
+        std::size_t operator()(
+                _In_ const sai_object_meta_key_t& k) const;
+
+        bool operator()(
+                _In_ const sai_object_meta_key_t& a,
+                _In_ const sai_object_meta_key_t& b) const;
+    };
+}
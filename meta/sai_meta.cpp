@@ -1,6 +1,7 @@
 #include "sai_meta.h"
 #include "sai_extra.h"
 #include "sai_serialize.h"
+#include "MetaKeyHasher.h"
 
 #include <inttypes.h>
 #include <string.h>
@@ -10,6 +11,7 @@
 #include <iostream>
 #include <vector>
 #include <unordered_map>
+#include <unordered_set>
 #include <set>
 #include <memory>
 #include <map>
@@ -258,8 +260,151 @@ std::string get_attr_info(const sai_attr_metadata_t& md)
  */
 
 static std::unordered_map<sai_object_id_t,int32_t> ObjectReferences;
-static std::unordered_map<std::string,std::string> AttributeKeys;
-std::unordered_map<std::string,std::unordered_map<sai_attr_id_t,std::shared_ptr<SaiAttrWrapper>>> ObjectAttrHash;
+
+typedef std::unordered_map<sai_attr_id_t,std::shared_ptr<SaiAttrWrapper>> AttrHash;
+
+/*
+ * Objects are kept in separate hash per object type and are indexed by meta
+ * key directly, so there is no need to serialize key on each lookup and
+ * objects of single type can be iterated without touching other types.
+ */
+
+typedef std::unordered_map<sai_object_meta_key_t,AttrHash,saimeta::MetaKeyHasher,saimeta::MetaKeyHasher> ObjectAttrHash;
+
+static ObjectAttrHash ObjectAttrHashPerType[SAI_OBJECT_TYPE_EXTENSIONS_MAX];
+
+/*
+ * Attribute keys constructed from KEY attributes of created objects, indexed
+ * both ways, so checking whether key is already used when creating new
+ * object is single lookup instead of scanning all existing keys.
+ */
+
+static std::unordered_map<sai_object_meta_key_t,std::string,saimeta::MetaKeyHasher,saimeta::MetaKeyHasher> AttributeKeys;
+static std::unordered_map<std::string,sai_object_meta_key_t> AttributeKeysReverse;
+
+/*
+ * Secondary indexes of fdb entries by bv_id, bridge port and entry type,
+ * used by consolidated fdb flush to visit only matching entries. They are
+ * maintained in create_object, set_object and remove_object.
+ */
+
+typedef std::unordered_set<sai_object_meta_key_t,saimeta::MetaKeyHasher,saimeta::MetaKeyHasher> MetaKeySet;
+
+static std::unordered_map<sai_object_id_t,MetaKeySet> FdbByBvId;
+static std::unordered_map<sai_object_id_t,MetaKeySet> FdbByBridgePort;
+static std::unordered_map<int32_t,MetaKeySet> FdbByType;
+
+template <typename K>
+static void fdb_index_insert(
+        _Inout_ std::unordered_map<K,MetaKeySet>& index,
+        _In_ K k,
+        _In_ const sai_object_meta_key_t& meta_key)
+{
+    SWSS_LOG_ENTER();
+
+    index[k].insert(meta_key);
+}
+
+template <typename K>
+static void fdb_index_remove(
+        _Inout_ std::unordered_map<K,MetaKeySet>& index,
+        _In_ K k,
+        _In_ const sai_object_meta_key_t& meta_key)
+{
+    SWSS_LOG_ENTER();
+
+    auto it = index.find(k);
+
+    if (it == index.end())
+    {
+        return;
+    }
+
+    it->second.erase(meta_key);
+
+    if (it->second.empty())
+    {
+        index.erase(it);
+    }
+}
+
+template <typename K>
+static const MetaKeySet* fdb_index_get(
+        _In_ const std::unordered_map<K,MetaKeySet>& index,
+        _In_ K k)
+{
+    SWSS_LOG_ENTER();
+
+    static const MetaKeySet empty;
+
+    auto it = index.find(k);
+
+    return (it == index.end()) ? &empty : &it->second;
+}
+
+static void fdb_index_update_attr(
+        _In_ const sai_object_meta_key_t& meta_key,
+        _In_ const sai_attribute_t* attr,
+        _In_ bool insert)
+{
+    SWSS_LOG_ENTER();
+
+    switch (attr->id)
+    {
+        case SAI_FDB_ENTRY_ATTR_TYPE:
+
+            if (insert)
+                fdb_index_insert(FdbByType, attr->value.s32, meta_key);
+            else
+                fdb_index_remove(FdbByType, attr->value.s32, meta_key);
+
+            break;
+
+        case SAI_FDB_ENTRY_ATTR_BRIDGE_PORT_ID:
+
+            if (insert)
+                fdb_index_insert(FdbByBridgePort, attr->value.oid, meta_key);
+            else
+                fdb_index_remove(FdbByBridgePort, attr->value.oid, meta_key);
+
+            break;
+
+        default:
+            break;
+    }
+}
+
+static ObjectAttrHash& get_object_attr_hash(
+        _In_ sai_object_type_t objecttype)
+{
+    SWSS_LOG_ENTER();
+
+    if (objecttype <= SAI_OBJECT_TYPE_NULL || objecttype >= SAI_OBJECT_TYPE_EXTENSIONS_MAX)
+    {
+        SWSS_LOG_THROW("invalid object type value %d", objecttype);
+    }
+
+    switch (objecttype)
+    {
+        case SAI_OBJECT_TYPE_FDB_ENTRY:
+        case SAI_OBJECT_TYPE_ROUTE_ENTRY:
+        case SAI_OBJECT_TYPE_NEIGHBOR_ENTRY:
+        case SAI_OBJECT_TYPE_NAT_ENTRY:
+            break;
+
+        default:
+
+            if (sai_metadata_get_object_type_info(objecttype)->isnonobjectid)
+            {
+                SWSS_LOG_THROW("object %s is non object id, not supported yet, FIXME",
+                        sai_serialize_object_type(objecttype).c_str());
+            }
+
+            break;
+    }
+
+    return ObjectAttrHashPerType[objecttype];
+}
 
 void dump_object_reference()
 {
@@ -437,26 +582,14 @@ void object_reference_remove(
     ObjectReferences.erase(oid);
 }
 
-bool object_exists(
-        _In_ const std::string& key)
-{
-    SWSS_LOG_ENTER();
-
-    bool exists = ObjectAttrHash.find(key) != ObjectAttrHash.end();
-
-    SWSS_LOG_DEBUG("%s %s", key.c_str(), exists ? "exists" : "missing");
-
-    return exists;
-}
-
 bool object_exists(
         _In_ const sai_object_meta_key_t& meta_key)
 {
     SWSS_LOG_ENTER();
 
-    std::string key = sai_serialize_object_meta_key(meta_key);
+    const auto& hash = get_object_attr_hash(meta_key.objecttype);
 
-    return object_exists(key);
+    return hash.find(meta_key) != hash.end();
 }
 
 sai_status_t meta_init_db()
@@ -468,8 +601,17 @@ sai_status_t meta_init_db()
      */
 
     ObjectReferences.clear();
-    ObjectAttrHash.clear();
     AttributeKeys.clear();
+    AttributeKeysReverse.clear();
+
+    FdbByBvId.clear();
+    FdbByBridgePort.clear();
+    FdbByType.clear();
+
+    for (auto& hash: ObjectAttrHashPerType)
+    {
+        hash.clear();
+    }
 
     map_port_to_related_set.clear();
 
@@ -482,13 +624,14 @@ const sai_attribute_t* get_object_previous_attr(
 {
     SWSS_LOG_ENTER();
 
-    std::string key = sai_serialize_object_meta_key(meta_key);
+    const auto& hash = get_object_attr_hash(meta_key.objecttype);
 
-    auto it = ObjectAttrHash.find(key);
+    auto it = hash.find(meta_key);
 
-    if (it == ObjectAttrHash.end())
+    if (it == hash.end())
     {
-        SWSS_LOG_ERROR("object key %s not found", key.c_str());
+        SWSS_LOG_ERROR("object key %s not found",
+                sai_serialize_object_meta_key(meta_key).c_str());
 
         return NULL;
     }
@@ -519,16 +662,33 @@ void set_object(
 {
     SWSS_LOG_ENTER();
 
-    std::string key = sai_serialize_object_meta_key(meta_key);
+    auto& hash = get_object_attr_hash(meta_key.objecttype);
 
-    if (!object_exists(key))
+    auto it = hash.find(meta_key);
+
+    if (it == hash.end())
     {
-        SWSS_LOG_THROW("FATAL: object %s doesn't exist", key.c_str());
+        SWSS_LOG_THROW("FATAL: object %s doesn't exist",
+                sai_serialize_object_meta_key(meta_key).c_str());
     }
 
-    META_LOG_DEBUG(md, "set attribute %d on %s", attr->id, key.c_str());
+    META_LOG_DEBUG(md, "set attribute %d", attr->id);
+
+    auto wrapper = std::make_shared<SaiAttrWrapper>(&md, *attr);
 
-    ObjectAttrHash[key][attr->id] = std::make_shared<SaiAttrWrapper>(&md, *attr);
+    auto& prev = it->second[attr->id];
+
+    if (meta_key.objecttype == SAI_OBJECT_TYPE_FDB_ENTRY)
+    {
+        if (prev)
+        {
+            fdb_index_update_attr(meta_key, prev->getattr(), false);
+        }
+
+        fdb_index_update_attr(meta_key, attr, true);
+    }
+
+    prev = wrapper;
 }
 
 const std::vector<std::shared_ptr<SaiAttrWrapper>> get_object_attributes(
@@ -536,20 +696,23 @@ const std::vector<std::shared_ptr<SaiAttrWrapper>> get_object_attributes(
 {
     SWSS_LOG_ENTER();
 
-    std::string key = sai_serialize_object_meta_key(meta_key);
+    const auto& hash = get_object_attr_hash(meta_key.objecttype);
 
-    if (!object_exists(key))
+    auto it = hash.find(meta_key);
+
+    if (it == hash.end())
     {
-        SWSS_LOG_THROW("FATAL: object %s doesn't exist", key.c_str());
+        SWSS_LOG_THROW("FATAL: object %s doesn't exist",
+                sai_serialize_object_meta_key(meta_key).c_str());
     }
 
     std::vector<std::shared_ptr<SaiAttrWrapper>> attrs;
 
-    const auto& hash = ObjectAttrHash[key];
+    attrs.reserve(it->second.size());
 
-    for (auto it = hash.begin(); it != hash.end(); ++it)
+    for (auto ita = it->second.begin(); ita != it->second.end(); ++ita)
     {
-        attrs.push_back(it->second);
+        attrs.push_back(ita->second);
     }
 
     return attrs;
@@ -560,16 +723,27 @@ void remove_object(
 {
     SWSS_LOG_ENTER();
 
-    std::string key = sai_serialize_object_meta_key(meta_key);
+    auto& hash = get_object_attr_hash(meta_key.objecttype);
 
-    if (!object_exists(key))
+    auto it = hash.find(meta_key);
+
+    if (it == hash.end())
     {
-        SWSS_LOG_THROW("FATAL: object %s doesn't exist", key.c_str());
+        SWSS_LOG_THROW("FATAL: object %s doesn't exist",
+                sai_serialize_object_meta_key(meta_key).c_str());
     }
 
-    SWSS_LOG_DEBUG("removing object %s", key.c_str());
+    if (meta_key.objecttype == SAI_OBJECT_TYPE_FDB_ENTRY)
+    {
+        fdb_index_remove(FdbByBvId, meta_key.objectkey.key.fdb_entry.bv_id, meta_key);
 
-    ObjectAttrHash.erase(key);
+        for (const auto& attr: it->second)
+        {
+            fdb_index_update_attr(meta_key, attr.second->getattr(), false);
+        }
+    }
+
+    hash.erase(it);
 }
 
 void create_object(
@@ -577,16 +751,18 @@ void create_object(
 {
     SWSS_LOG_ENTER();
 
-    std::string key = sai_serialize_object_meta_key(meta_key);
+    auto& hash = get_object_attr_hash(meta_key.objecttype);
 
-    if (object_exists(key))
+    if (!hash.emplace(meta_key, AttrHash()).second)
     {
-        SWSS_LOG_THROW("FATAL: object %s already exists", key.c_str());
+        SWSS_LOG_THROW("FATAL: object %s already exists",
+                sai_serialize_object_meta_key(meta_key).c_str());
     }
 
-    SWSS_LOG_DEBUG("creating object %s", key.c_str());
-
-    ObjectAttrHash[key] = {};
+    if (meta_key.objecttype == SAI_OBJECT_TYPE_FDB_ENTRY)
+    {
+        fdb_index_insert(FdbByBvId, meta_key.objectkey.key.fdb_entry.bv_id, meta_key);
+    }
 }
 
 sai_status_t meta_generic_validation_objlist(
@@ -1482,11 +1658,9 @@ sai_status_t meta_generic_validation_create(
     if (info->isnonobjectid)
     {
         // just sanity check if object already exists
-        std::string key = sai_serialize_object_meta_key(meta_key);
-
-        if (object_exists(key))
+        if (object_exists(meta_key))
         {
-            SWSS_LOG_ERROR("object key %s already exists", key.c_str());
+            SWSS_LOG_ERROR("object key %s already exists", sai_serialize_object_meta_key(meta_key).c_str());
 
             return SAI_STATUS_ITEM_ALREADY_EXISTS;
         }
@@ -1709,16 +1883,13 @@ sai_status_t meta_generic_validation_create(
     {
         std::string key = construct_key(meta_key, attr_count, attr_list);
 
-        for (auto& it: AttributeKeys)
-        {
-            // since we didn't created oid yet, we don't know if attribute key exists, check all
+        // since we didn't created oid yet, we can only check if key is used by other object
 
-            if (it.second == key)
-            {
-                SWSS_LOG_ERROR("attribute key %s already exists, can't create", key.c_str());
+        if (AttributeKeysReverse.find(key) != AttributeKeysReverse.end())
+        {
+            SWSS_LOG_ERROR("attribute key %s already exists, can't create", key.c_str());
 
-                return SAI_STATUS_INVALID_PARAMETER;
-            }
+            return SAI_STATUS_INVALID_PARAMETER;
         }
     }
 
@@ -1745,16 +1916,14 @@ bool meta_is_object_in_default_state(
     meta_key.objecttype = sai_object_type_query(oid);
     meta_key.objectkey.key.object_id = oid;
 
-    std::string key = sai_serialize_object_meta_key(meta_key);
-
-    if (!object_exists(key))
+    if (!object_exists(meta_key))
     {
         SWSS_LOG_WARN("object %s don't exists in local database, bug!",
                 sai_serialize_object_id(oid).c_str());
         return false;
     }
 
-    auto& attrs =  ObjectAttrHash[key];
+    auto& attrs =  get_object_attr_hash(meta_key.objecttype).at(meta_key);
 
     for (const auto& attr: attrs)
     {
@@ -1871,11 +2040,9 @@ sai_status_t meta_generic_validation_remove(
 {
     SWSS_LOG_ENTER();
 
-    std::string key = sai_serialize_object_meta_key(meta_key);
-
-    if (!object_exists(key))
+    if (!object_exists(meta_key))
     {
-        SWSS_LOG_ERROR("object key %s doesn't exist", key.c_str());
+        SWSS_LOG_ERROR("object key %s doesn't exist", sai_serialize_object_meta_key(meta_key).c_str());
 
         return SAI_STATUS_INVALID_PARAMETER;
     }
@@ -2359,11 +2526,9 @@ sai_status_t meta_generic_validation_set(
 
     // check if object on which we perform operation exists
 
-    std::string key = sai_serialize_object_meta_key(meta_key);
-
-    if (!object_exists(key))
+    if (!object_exists(meta_key))
     {
-        META_LOG_ERROR(md, "object key %s doesn't exist", key.c_str());
+        META_LOG_ERROR(md, "object key %s doesn't exist", sai_serialize_object_meta_key(meta_key).c_str());
 
         return SAI_STATUS_INVALID_PARAMETER;
     }
@@ -2372,7 +2537,7 @@ sai_status_t meta_generic_validation_set(
 
     if (info->isnonobjectid)
     {
-        SWSS_LOG_DEBUG("object key exists: %s", key.c_str());
+        SWSS_LOG_DEBUG("object key exists: %s", info->objecttypename);
     }
     else
     {
@@ -2652,11 +2817,9 @@ sai_status_t meta_generic_validation_get(
         }
     }
 
-    std::string key = sai_serialize_object_meta_key(meta_key);
-
-    if (!object_exists(key))
+    if (!object_exists(meta_key))
     {
-        SWSS_LOG_ERROR("object key %s doesn't exist", key.c_str());
+        SWSS_LOG_ERROR("object key %s doesn't exist", sai_serialize_object_meta_key(meta_key).c_str());
 
         return SAI_STATUS_INVALID_PARAMETER;
     }
@@ -2665,7 +2828,7 @@ sai_status_t meta_generic_validation_get(
 
     if (info->isnonobjectid)
     {
-        SWSS_LOG_DEBUG("object key exists: %s", key.c_str());
+        SWSS_LOG_DEBUG("object key exists: %s", info->objecttypename);
     }
     else
     {
@@ -2717,9 +2880,7 @@ void meta_generic_validation_post_create(
 {
     SWSS_LOG_ENTER();
 
-    std::string key = sai_serialize_object_meta_key(meta_key);
-
-    if (object_exists(key))
+    if (object_exists(meta_key))
     {
         if (warmBoot && meta_key.objecttype == SAI_OBJECT_TYPE_SWITCH)
         {
@@ -2727,7 +2888,7 @@ void meta_generic_validation_post_create(
         }
         else
         {
-            SWSS_LOG_ERROR("object key %s already exists (vendor bug?)", key.c_str());
+            SWSS_LOG_ERROR("object key %s already exists (vendor bug?)", sai_serialize_object_meta_key(meta_key).c_str());
 
             // this may produce inconsistency
         }
@@ -2976,9 +3137,32 @@ void meta_generic_validation_post_create(
 
     if (haskeys)
     {
-        std::string ok = sai_serialize_object_meta_key(meta_key);
+        std::string key = construct_key(meta_key, attr_count, attr_list);
+
+        auto it = AttributeKeysReverse.find(key);
 
-        AttributeKeys[ok] = construct_key(meta_key, attr_count, attr_list);
+        if (it != AttributeKeysReverse.end() && !saimeta::MetaKeyHasher()(it->second, meta_key))
+        {
+            SWSS_LOG_ERROR("attribute key %s already used by %s (vendor bug?)",
+                    key.c_str(),
+                    sai_serialize_object_meta_key(it->second).c_str());
+
+            // this may produce inconsistency
+
+            AttributeKeys.erase(it->second);
+        }
+
+        auto ak = AttributeKeys.find(meta_key);
+
+        if (ak != AttributeKeys.end() && ak->second != key)
+        {
+            // object was created again with different key (warm boot)
+
+            AttributeKeysReverse.erase(ak->second);
+        }
+
+        AttributeKeys[meta_key] = key;
+        AttributeKeysReverse[key] = meta_key;
     }
 }
 
@@ -3195,13 +3379,15 @@ void meta_generic_validation_post_remove(
 
     remove_object(meta_key);
 
-    std::string ok = sai_serialize_object_meta_key(meta_key);
+    auto ak = AttributeKeys.find(meta_key);
 
-    if (AttributeKeys.find(ok) != AttributeKeys.end())
+    if (ak != AttributeKeys.end())
     {
-        SWSS_LOG_DEBUG("erasing attributes key %s", AttributeKeys[ok].c_str());
+        SWSS_LOG_DEBUG("erasing attributes key %s", ak->second.c_str());
+
+        AttributeKeysReverse.erase(ak->second);
 
-        AttributeKeys.erase(ok);
+        AttributeKeys.erase(ak);
     }
 
     if (meta_key.objecttype == SAI_OBJECT_TYPE_PORT)
@@ -3237,10 +3423,8 @@ void meta_generic_validation_post_set(
              * If default value type will be internal then we should warn.
              */
 
-            std::string key = sai_serialize_object_meta_key(meta_key);
-
             // XXX produces too much noise
-            // META_LOG_WARN(md, "post set, not in local db, FIX snoop!: %s", key.c_str());
+            // META_LOG_WARN(md, "post set, not in local db, FIX snoop!: %s", sai_serialize_object_meta_key(meta_key).c_str());
         }
     }
 
@@ -3888,13 +4072,11 @@ sai_status_t meta_sai_validate_fdb_entry(
 
     sai_object_meta_key_t meta_key_fdb = { .objecttype = SAI_OBJECT_TYPE_FDB_ENTRY, .objectkey = { .key = { .fdb_entry = *fdb_entry } } };
 
-    std::string key_fdb = sai_serialize_object_meta_key(meta_key_fdb);
-
     if (create)
     {
-        if (object_exists(key_fdb))
+        if (object_exists(meta_key_fdb))
         {
-            SWSS_LOG_ERROR("object key %s already exists", key_fdb.c_str());
+            SWSS_LOG_ERROR("object key %s already exists", sai_serialize_object_meta_key(meta_key_fdb).c_str());
 
             return SAI_STATUS_ITEM_ALREADY_EXISTS;
         }
@@ -3904,9 +4086,9 @@ sai_status_t meta_sai_validate_fdb_entry(
 
     // set, get, remove
 
-    if (!object_exists(key_fdb) && !get)
+    if (!object_exists(meta_key_fdb) && !get)
     {
-        SWSS_LOG_ERROR("object key %s doesn't exist", key_fdb.c_str());
+        SWSS_LOG_ERROR("object key %s doesn't exist", sai_serialize_object_meta_key(meta_key_fdb).c_str());
 
         return SAI_STATUS_INVALID_PARAMETER;
     }
@@ -4153,11 +4335,9 @@ sai_status_t meta_sai_validate_mcast_fdb_entry(
 
     sai_object_meta_key_t meta_key_bv = { .objecttype = object_type, .objectkey = { .key = { .object_id = bv_id } } };
 
-    std::string key_bv = sai_serialize_object_meta_key(meta_key_bv);
-
-    if (!object_exists(key_bv))
+    if (!object_exists(meta_key_bv))
     {
-        SWSS_LOG_ERROR("object key %s doesn't exist", key_bv.c_str());
+        SWSS_LOG_ERROR("object key %s doesn't exist", sai_serialize_object_meta_key(meta_key_bv).c_str());
 
         return SAI_STATUS_INVALID_PARAMETER;
     }
@@ -4166,13 +4346,11 @@ sai_status_t meta_sai_validate_mcast_fdb_entry(
 
     sai_object_meta_key_t meta_key_fdb = { .objecttype = SAI_OBJECT_TYPE_MCAST_FDB_ENTRY, .objectkey = { .key = { .mcast_fdb_entry = *mcast_fdb_entry } } };
 
-    std::string key_fdb = sai_serialize_object_meta_key(meta_key_fdb);
-
     if (create)
     {
-        if (object_exists(key_fdb))
+        if (object_exists(meta_key_fdb))
         {
-            SWSS_LOG_ERROR("object key %s already exists", key_fdb.c_str());
+            SWSS_LOG_ERROR("object key %s already exists", sai_serialize_object_meta_key(meta_key_fdb).c_str());
 
             return SAI_STATUS_ITEM_ALREADY_EXISTS;
         }
@@ -4182,9 +4360,9 @@ sai_status_t meta_sai_validate_mcast_fdb_entry(
 
     // set, get, remove
 
-    if (!object_exists(key_fdb) && !get)
+    if (!object_exists(meta_key_fdb) && !get)
     {
-        SWSS_LOG_ERROR("object key %s doesn't exist", key_fdb.c_str());
+        SWSS_LOG_ERROR("object key %s doesn't exist", sai_serialize_object_meta_key(meta_key_fdb).c_str());
 
         return SAI_STATUS_INVALID_PARAMETER;
     }
@@ -4445,24 +4623,20 @@ sai_status_t meta_sai_validate_neighbor_entry(
 
     sai_object_meta_key_t meta_key_rif = { .objecttype = expected, .objectkey = { .key = { .object_id = rif } } };
 
-    std::string key_rif = sai_serialize_object_meta_key(meta_key_rif);
-
-    if (!object_exists(key_rif))
+    if (!object_exists(meta_key_rif))
     {
-        SWSS_LOG_ERROR("object key %s doesn't exist", key_rif.c_str());
+        SWSS_LOG_ERROR("object key %s doesn't exist", sai_serialize_object_meta_key(meta_key_rif).c_str());
 
         return SAI_STATUS_INVALID_PARAMETER;
     }
 
     sai_object_meta_key_t meta_key_neighbor = { .objecttype = SAI_OBJECT_TYPE_NEIGHBOR_ENTRY, .objectkey = { .key = { .neighbor_entry = *neighbor_entry } } };
 
-    std::string key_neighbor = sai_serialize_object_meta_key(meta_key_neighbor);
-
     if (create)
     {
-        if (object_exists(key_neighbor))
+        if (object_exists(meta_key_neighbor))
         {
-            SWSS_LOG_ERROR("object key %s already exists", key_neighbor.c_str());
+            SWSS_LOG_ERROR("object key %s already exists", sai_serialize_object_meta_key(meta_key_neighbor).c_str());
 
             return SAI_STATUS_ITEM_ALREADY_EXISTS;
         }
@@ -4472,9 +4646,9 @@ sai_status_t meta_sai_validate_neighbor_entry(
 
     // set, get, remove
 
-    if (!object_exists(key_neighbor))
+    if (!object_exists(meta_key_neighbor))
     {
-        SWSS_LOG_ERROR("object key %s doesn't exist", key_neighbor.c_str());
+        SWSS_LOG_ERROR("object key %s doesn't exist", sai_serialize_object_meta_key(meta_key_neighbor).c_str());
 
         return SAI_STATUS_INVALID_PARAMETER;
     }
@@ -4745,11 +4919,9 @@ sai_status_t meta_sai_validate_route_entry(
 
     sai_object_meta_key_t meta_key_vr = { .objecttype = expected, .objectkey = { .key = { .object_id = vr } } };
 
-    std::string key_vr = sai_serialize_object_meta_key(meta_key_vr);
-
-    if (!object_exists(key_vr))
+    if (!object_exists(meta_key_vr))
     {
-        SWSS_LOG_ERROR("object key %s doesn't exist", key_vr.c_str());
+        SWSS_LOG_ERROR("object key %s doesn't exist", sai_serialize_object_meta_key(meta_key_vr).c_str());
 
         return SAI_STATUS_INVALID_PARAMETER;
     }
@@ -4758,13 +4930,11 @@ sai_status_t meta_sai_validate_route_entry(
 
     sai_object_meta_key_t meta_key_route = { .objecttype = SAI_OBJECT_TYPE_ROUTE_ENTRY, .objectkey = { .key = { .route_entry = *route_entry } } };
 
-    std::string key_route = sai_serialize_object_meta_key(meta_key_route);
-
     if (create)
     {
-        if (object_exists(key_route))
+        if (object_exists(meta_key_route))
         {
-            SWSS_LOG_ERROR("object key %s already exists", key_route.c_str());
+            SWSS_LOG_ERROR("object key %s already exists", sai_serialize_object_meta_key(meta_key_route).c_str());
 
             return SAI_STATUS_ITEM_ALREADY_EXISTS;
         }
@@ -4774,9 +4944,9 @@ sai_status_t meta_sai_validate_route_entry(
 
     // set, get, remove
 
-    if (!object_exists(key_route))
+    if (!object_exists(meta_key_route))
     {
-        SWSS_LOG_ERROR("object key %s doesn't exist", key_route.c_str());
+        SWSS_LOG_ERROR("object key %s doesn't exist", sai_serialize_object_meta_key(meta_key_route).c_str());
 
         return SAI_STATUS_INVALID_PARAMETER;
     }
@@ -5061,11 +5231,9 @@ sai_status_t meta_sai_validate_l2mc_entry(
 
     sai_object_meta_key_t meta_key_bv = { .objecttype = object_type, .objectkey = { .key = { .object_id = bv_id } } };
 
-    std::string key_bv = sai_serialize_object_meta_key(meta_key_bv);
-
-    if (!object_exists(key_bv))
+    if (!object_exists(meta_key_bv))
     {
-        SWSS_LOG_ERROR("object key %s doesn't exist", key_bv.c_str());
+        SWSS_LOG_ERROR("object key %s doesn't exist", sai_serialize_object_meta_key(meta_key_bv).c_str());
 
         return SAI_STATUS_INVALID_PARAMETER;
     }
@@ -5074,13 +5242,11 @@ sai_status_t meta_sai_validate_l2mc_entry(
 
     sai_object_meta_key_t meta_key_route = { .objecttype = SAI_OBJECT_TYPE_L2MC_ENTRY, .objectkey = { .key = { .l2mc_entry = *l2mc_entry } } };
 
-    std::string key_route = sai_serialize_object_meta_key(meta_key_route);
-
     if (create)
     {
-        if (object_exists(key_route))
+        if (object_exists(meta_key_route))
         {
-            SWSS_LOG_ERROR("object key %s already exists", key_route.c_str());
+            SWSS_LOG_ERROR("object key %s already exists", sai_serialize_object_meta_key(meta_key_route).c_str());
 
             return SAI_STATUS_ITEM_ALREADY_EXISTS;
         }
@@ -5090,9 +5256,9 @@ sai_status_t meta_sai_validate_l2mc_entry(
 
     // set, get, remove
 
-    if (!object_exists(key_route))
+    if (!object_exists(meta_key_route))
     {
-        SWSS_LOG_ERROR("object key %s doesn't exist", key_route.c_str());
+        SWSS_LOG_ERROR("object key %s doesn't exist", sai_serialize_object_meta_key(meta_key_route).c_str());
 
         return SAI_STATUS_INVALID_PARAMETER;
     }
@@ -5377,11 +5543,9 @@ sai_status_t meta_sai_validate_ipmc_entry(
 
     sai_object_meta_key_t meta_key_bv = { .objecttype = object_type, .objectkey = { .key = { .object_id = vr_id } } };
 
-    std::string key_bv = sai_serialize_object_meta_key(meta_key_bv);
-
-    if (!object_exists(key_bv))
+    if (!object_exists(meta_key_bv))
     {
-        SWSS_LOG_ERROR("object key %s doesn't exist", key_bv.c_str());
+        SWSS_LOG_ERROR("object key %s doesn't exist", sai_serialize_object_meta_key(meta_key_bv).c_str());
 
         return SAI_STATUS_INVALID_PARAMETER;
     }
@@ -5390,13 +5554,11 @@ sai_status_t meta_sai_validate_ipmc_entry(
 
     sai_object_meta_key_t meta_key_route = { .objecttype = SAI_OBJECT_TYPE_IPMC_ENTRY, .objectkey = { .key = { .ipmc_entry = *ipmc_entry } } };
 
-    std::string key_route = sai_serialize_object_meta_key(meta_key_route);
-
     if (create)
     {
-        if (object_exists(key_route))
+        if (object_exists(meta_key_route))
         {
-            SWSS_LOG_ERROR("object key %s already exists", key_route.c_str());
+            SWSS_LOG_ERROR("object key %s already exists", sai_serialize_object_meta_key(meta_key_route).c_str());
 
             return SAI_STATUS_ITEM_ALREADY_EXISTS;
         }
@@ -5406,9 +5568,9 @@ sai_status_t meta_sai_validate_ipmc_entry(
 
     // set, get, remove
 
-    if (!object_exists(key_route))
+    if (!object_exists(meta_key_route))
     {
-        SWSS_LOG_ERROR("object key %s doesn't exist", key_route.c_str());
+        SWSS_LOG_ERROR("object key %s doesn't exist", sai_serialize_object_meta_key(meta_key_route).c_str());
 
         return SAI_STATUS_INVALID_PARAMETER;
     }
@@ -5887,11 +6049,9 @@ sai_status_t meta_sai_validate_oid(
 
     sai_object_meta_key_t meta_key_oid = { .objecttype = expected, .objectkey = { .key = { .object_id = oid } } };
 
-    std::string key_oid = sai_serialize_object_meta_key(meta_key_oid);
-
-    if (!object_exists(key_oid))
+    if (!object_exists(meta_key_oid))
     {
-        SWSS_LOG_ERROR("object key %s doesn't exist", key_oid.c_str());
+        SWSS_LOG_ERROR("object key %s doesn't exist", sai_serialize_object_meta_key(meta_key_oid).c_str());
 
         return SAI_STATUS_INVALID_PARAMETER;
     }
@@ -6332,39 +6492,88 @@ sai_status_t meta_sai_clear_stats_oid(
 
 static sai_mac_t zero_mac = { 0, 0, 0, 0, 0, 0 };
 
+/*
+ * Use smallest of secondary indexes matching flush criteria as candidate set,
+ * remaining criteria are checked on each candidate. Null bridge port or bv_id
+ * matches any value.
+ */
+static const MetaKeySet* fdb_flush_get_candidates(
+        _In_ int32_t type,
+        _In_ sai_object_id_t bridgePortId,
+        _In_ sai_object_id_t bvId)
+{
+    SWSS_LOG_ENTER();
+
+    const MetaKeySet* candidates = fdb_index_get(FdbByType, type);
+
+    if (bridgePortId != SAI_NULL_OBJECT_ID)
+    {
+        const MetaKeySet* byPort = fdb_index_get(FdbByBridgePort, bridgePortId);
+
+        if (byPort->size() < candidates->size())
+        {
+            candidates = byPort;
+        }
+    }
+
+    if (bvId != SAI_NULL_OBJECT_ID)
+    {
+        const MetaKeySet* byBvId = fdb_index_get(FdbByBvId, bvId);
+
+        if (byBvId->size() < candidates->size())
+        {
+            candidates = byBvId;
+        }
+    }
+
+    return candidates;
+}
+
+size_t fdb_flush_candidates_count(
+        _In_ int32_t type,
+        _In_ sai_object_id_t bridgePortId,
+        _In_ sai_object_id_t bvId)
+{
+    SWSS_LOG_ENTER();
+
+    return fdb_flush_get_candidates(type, bridgePortId, bvId)->size();
+}
+
 void meta_sai_on_fdb_flush_event_consolidated(
         _In_ const sai_fdb_event_notification_data_t& data)
 {
     SWSS_LOG_ENTER();
 
-    // since we don't keep objects by type, we need to scan via all objects
-    // and find fdb entries
-
     auto bpid = sai_metadata_get_attr_by_id(SAI_FDB_ENTRY_ATTR_BRIDGE_PORT_ID, data.attr_count, data.attr);
     auto type = sai_metadata_get_attr_by_id(SAI_FDB_ENTRY_ATTR_TYPE, data.attr_count, data.attr);
 
     SWSS_LOG_NOTICE("processing consolidated fdb flush event of type: %s",
             sai_metadata_get_fdb_entry_type_name((sai_fdb_entry_type_t)type->value.s32));
 
+    const MetaKeySet* candidates = fdb_flush_get_candidates(
+            type->value.s32,
+            (bpid == NULL) ? SAI_NULL_OBJECT_ID : bpid->value.oid,
+            data.fdb_entry.bv_id);
+
+    SWSS_LOG_INFO("checking %zu fdb entry candidates", candidates->size());
+
     std::vector<sai_object_meta_key_t> toremove;
 
-    for (auto it = ObjectAttrHash.begin(); it != ObjectAttrHash.end(); ++it)
+    const auto& fdbs = get_object_attr_hash(SAI_OBJECT_TYPE_FDB_ENTRY);
+
+    for (const auto& meta_key_fdb: *candidates)
     {
-        const std::string &key_fdb = it->first;
+        auto it = fdbs.find(meta_key_fdb);
 
-        if (strstr(key_fdb.c_str(), "bvid") == NULL)
+        if (it == fdbs.end())
         {
-            // this is not fdb_entry key
-            continue;
+            SWSS_LOG_THROW("FATAL: fdb index contains %s which is not in local db",
+                    sai_serialize_object_meta_key(meta_key_fdb).c_str());
         }
 
-        sai_object_meta_key_t meta_key_fdb;
-
-        meta_key_fdb.objecttype = SAI_OBJECT_TYPE_FDB_ENTRY;
-
-        sai_deserialize_object_meta_key(key_fdb, meta_key_fdb);
+        auto ita = it->second.find(SAI_FDB_ENTRY_ATTR_TYPE);
 
-        if (it->second.at(SAI_FDB_ENTRY_ATTR_TYPE)->getattr()->value.s32 != type->value.s32)
+        if (ita == it->second.end() || ita->second->getattr()->value.s32 != type->value.s32)
         {
             // entry type is not matching on this fdb entry
             continue;
@@ -6398,10 +6607,10 @@ void meta_sai_on_fdb_flush_event_consolidated(
 
         // this fdb entry is matching, removing
 
-        SWSS_LOG_INFO("removing %s", key_fdb.c_str());
+        SWSS_LOG_INFO("removing %s", sai_serialize_object_meta_key(meta_key_fdb).c_str());
 
-        // since meta_generic_validation_post_remove also modifies ObjectAttrHash
-        // we need to push this to a vector and remove in next loop
+        // since meta_generic_validation_post_remove also modifies fdb hash
+        // and indexes we need to push this to a vector and remove in next loop
         toremove.push_back(meta_key_fdb);
     }
 
@@ -6458,8 +6667,6 @@ void meta_sai_on_fdb_event_single(
 
     const sai_object_meta_key_t meta_key_fdb = { .objecttype = SAI_OBJECT_TYPE_FDB_ENTRY, .objectkey = { .key = { .fdb_entry = data.fdb_entry } } };
 
-    std::string key_fdb = sai_serialize_object_meta_key(meta_key_fdb);
-
     /*
      * Because we could receive fdb event's before orch agent will query or
      * create bridge/vlan/bridge port we should snoop here new OIDs and put
@@ -6493,9 +6700,9 @@ void meta_sai_on_fdb_event_single(
     {
         case SAI_FDB_EVENT_LEARNED:
 
-            if (object_exists(key_fdb))
+            if (object_exists(meta_key_fdb))
             {
-                SWSS_LOG_WARN("object key %s alearedy exists, but received LEARNED event", key_fdb.c_str());
+                SWSS_LOG_WARN("object key %s alearedy exists, but received LEARNED event", sai_serialize_object_meta_key(meta_key_fdb).c_str());
                 break;
             }
 
@@ -6525,7 +6732,7 @@ void meta_sai_on_fdb_event_single(
                 }
                 else
                 {
-                    SWSS_LOG_ERROR("failed to insert %s received in notification: %s", key_fdb.c_str(), sai_serialize_status(status).c_str());
+                    SWSS_LOG_ERROR("failed to insert %s received in notification: %s", sai_serialize_object_meta_key(meta_key_fdb).c_str(), sai_serialize_status(status).c_str());
                 }
             }
 
@@ -6533,9 +6740,9 @@ void meta_sai_on_fdb_event_single(
 
         case SAI_FDB_EVENT_AGED:
 
-            if (!object_exists(key_fdb))
+            if (!object_exists(meta_key_fdb))
             {
-                SWSS_LOG_WARN("object key %s doesn't exist but received AGED event", key_fdb.c_str());
+                SWSS_LOG_WARN("object key %s doesn't exist but received AGED event", sai_serialize_object_meta_key(meta_key_fdb).c_str());
                 break;
             }
 
@@ -6551,9 +6758,9 @@ void meta_sai_on_fdb_event_single(
                 break;
             }
 
-            if (!object_exists(key_fdb))
+            if (!object_exists(meta_key_fdb))
             {
-                SWSS_LOG_WARN("object key %s doesn't exist but received FLUSHED event", key_fdb.c_str());
+                SWSS_LOG_WARN("object key %s doesn't exist but received FLUSHED event", sai_serialize_object_meta_key(meta_key_fdb).c_str());
                 break;
             }
 
@@ -6563,9 +6770,9 @@ void meta_sai_on_fdb_event_single(
 
         case SAI_FDB_EVENT_MOVE:
 
-            if (!object_exists(key_fdb))
+            if (!object_exists(meta_key_fdb))
             {
-                SWSS_LOG_WARN("object key %s doesn't exist but received FDB MOVE event", key_fdb.c_str());
+                SWSS_LOG_WARN("object key %s doesn't exist but received FDB MOVE event", sai_serialize_object_meta_key(meta_key_fdb).c_str());
                 break;
             }
 
@@ -6579,7 +6786,7 @@ void meta_sai_on_fdb_event_single(
 
                 if (status != SAI_STATUS_SUCCESS)
                 {
-                    SWSS_LOG_ERROR("object key %s FDB MOVE event, SET validateion failed on attr.id = %d", key_fdb.c_str(), attr.id);
+                    SWSS_LOG_ERROR("object key %s FDB MOVE event, SET validateion failed on attr.id = %d", sai_serialize_object_meta_key(meta_key_fdb).c_str(), attr.id);
                     continue;
                 }
 
@@ -6805,11 +7012,9 @@ sai_status_t meta_sai_validate_nat_entry(
     // check if virtual router exists
     sai_object_meta_key_t meta_key_vr = { .objecttype = expected, .objectkey = { .key = { .object_id = vr } } };
 
-    std::string key_vr = sai_serialize_object_meta_key(meta_key_vr);
-
-    if (!object_exists(key_vr))
+    if (!object_exists(meta_key_vr))
     {
-        SWSS_LOG_ERROR("object key %s doesn't exist", key_vr.c_str());
+        SWSS_LOG_ERROR("object key %s doesn't exist", sai_serialize_object_meta_key(meta_key_vr).c_str());
 
         return SAI_STATUS_INVALID_PARAMETER;
     }
@@ -6817,13 +7022,11 @@ sai_status_t meta_sai_validate_nat_entry(
     // check if NAT entry exists
     sai_object_meta_key_t meta_key_nat = { .objecttype = SAI_OBJECT_TYPE_NAT_ENTRY, .objectkey = { .key = { .nat_entry = *nat_entry } } };
 
-    std::string key_nat = sai_serialize_object_meta_key(meta_key_nat);
-
     if (create)
     {
-        if (object_exists(key_nat))
+        if (object_exists(meta_key_nat))
         {
-            SWSS_LOG_ERROR("object key %s already exists", key_nat.c_str());
+            SWSS_LOG_ERROR("object key %s already exists", sai_serialize_object_meta_key(meta_key_nat).c_str());
 
             return SAI_STATUS_ITEM_ALREADY_EXISTS;
         }
@@ -6832,9 +7035,9 @@ sai_status_t meta_sai_validate_nat_entry(
     }
 
     // set, get, remove
-    if (!object_exists(key_nat))
+    if (!object_exists(meta_key_nat))
     {
-        SWSS_LOG_ERROR("object key %s doesn't exist", key_nat.c_str());
+        SWSS_LOG_ERROR("object key %s doesn't exist", sai_serialize_object_meta_key(meta_key_nat).c_str());
 
         return SAI_STATUS_INVALID_PARAMETER;
     }
@@ -12,6 +12,7 @@ extern "C" {
 #include <streambuf>
 #include <iomanip>
 #include <map>
+#include <vector>
 #include <tuple>
 #include <string.h>
 #include "swss/logger.h"
@@ -269,6 +270,35 @@ void sai_deserialize_queue_deadlock_ntf(
         _Out_ uint32_t &count,
         _Out_ sai_queue_deadlock_notification_data_t** deadlock_data);
 
+// binary attributes
+
+/**
+ * @brief Serialize attribute list to compact binary form.
+ *
+ * Values are copied as they are in memory without conversion to text, binary
+ * data is hex encoded so it can be carried as redis message field.
+ *
+ * @return False if some attribute value type is not supported in binary form
+ * and text serialization must be used instead.
+ */
+bool sai_serialize_attr_list_binary(
+        _In_ sai_object_type_t object_type,
+        _In_ uint32_t attr_count,
+        _In_ const sai_attribute_t *attr_list,
+        _Out_ std::string &s);
+
+/**
+ * @brief Deserialize attribute list from binary form.
+ *
+ * Lists are allocated and must be released by
+ * sai_deserialize_free_attribute_value.
+ */
+void sai_deserialize_attr_list_binary(
+        _In_ const std::string &s,
+        _In_ sai_object_type_t object_type,
+        _Out_ std::vector<sai_attribute_t> &attr_list,
+        _Out_ std::vector<sai_attr_value_type_t> &attr_value_type_list);
+
 // free methods
 
 void sai_deserialize_free_attribute_value(
@@ -72,6 +72,13 @@ SaiAttributeList::SaiAttributeList(
     }
 }
 
+SaiAttributeList::SaiAttributeList(
+        _In_ const sai_object_type_t object_type,
+        _In_ const std::string &binary)
+{
+    sai_deserialize_attr_list_binary(binary, object_type, m_attr_list, m_attr_value_type_list);
+}
+
 SaiAttributeList::~SaiAttributeList()
 {
     size_t attr_count = m_attr_list.size();
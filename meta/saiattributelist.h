@@ -27,6 +27,14 @@ class SaiAttributeList
                 _In_ const std::unordered_map<std::string, std::string>& hash,
                 _In_ bool countOnly);
 
+        /**
+         * @brief Create attribute list from binary form produced by
+         * sai_serialize_attr_list_binary.
+         */
+        SaiAttributeList(
+                _In_ const sai_object_type_t object_type,
+                _In_ const std::string &binary);
+
         ~SaiAttributeList();
 
         sai_attribute_t* get_attr_list();
@@ -10,6 +10,7 @@
 #include <inttypes.h>
 #include <vector>
 #include <climits>
+#include <initializer_list>
 
 #include <arpa/inet.h>
 #include <errno.h>
@@ -695,32 +696,125 @@ std::string sai_serialize_vlan_id(
     return sai_serialize_number(vlan_id);
 }
 
-std::string sai_serialize_neighbor_entry(
-        _In_ const sai_neighbor_entry_t &ne)
+/**
+ * @brief Serialize string fields as JSON object.
+ *
+ * Output is exactly the same as json::dump() of object holding those string
+ * fields, as long as fields are given in sorted order (json object is
+ * std::map) and values don't require escaping, which holds for object ids,
+ * MAC and IP addresses. This avoids building json object on hot path of
+ * entry keys serialization.
+ */
+static std::string sai_serialize_json_fields(
+        _In_ std::initializer_list<std::pair<const char*, std::string>> fields)
 {
     SWSS_LOG_ENTER();
 
-    json j;
+    std::string s;
 
-    j["switch_id"] = sai_serialize_object_id(ne.switch_id);
-    j["rif"] = sai_serialize_object_id(ne.rif_id);
-    j["ip"] = sai_serialize_ip_address(ne.ip_address);
+    s.reserve(128);
 
-    return j.dump();
+    s += "{";
+
+    for (const auto& field: fields)
+    {
+        if (s.size() > 1)
+        {
+            s += ",";
+        }
+
+        s += "\"";
+        s += field.first;
+        s += "\":\"";
+        s += field.second;
+        s += "\"";
+    }
+
+    s += "}";
+
+    return s;
 }
 
-std::string sai_serialize_route_entry(
-        _In_ const sai_route_entry_t& route_entry)
+/**
+ * @brief Deserialize JSON object produced by sai_serialize_json_fields.
+ *
+ * Only exact canonical form is accepted: given fields in given order and
+ * values without escape sequences. For anything else false is returned and
+ * caller should fall back to json parser.
+ */
+static bool sai_deserialize_json_fields(
+        _In_ const std::string& s,
+        _In_ const char* const names[],
+        _In_ size_t count,
+        _Out_ std::string values[])
 {
     SWSS_LOG_ENTER();
 
-    json j;
+    size_t pos = 0;
 
-    j["switch_id"] = sai_serialize_object_id(route_entry.switch_id);
-    j["vr"] = sai_serialize_object_id(route_entry.vr_id);
-    j["dest"] = sai_serialize_ip_prefix(route_entry.destination);
+    if (s.compare(pos, 1, "{") != 0)
+        return false;
 
-    return j.dump();
+    pos++;
+
+    for (size_t idx = 0; idx < count; idx++)
+    {
+        if (idx > 0)
+        {
+            if (s.compare(pos, 1, ",") != 0)
+                return false;
+
+            pos++;
+        }
+
+        size_t len = strlen(names[idx]);
+
+        if (pos + len + 4 > s.size())
+            return false;
+
+        if (s.compare(pos, 1, "\"") != 0 ||
+                s.compare(pos + 1, len, names[idx]) != 0 ||
+                s.compare(pos + 1 + len, 3, "\":\"") != 0)
+            return false;
+
+        pos += len + 4;
+
+        size_t end = s.find('"', pos);
+
+        if (end == std::string::npos)
+            return false;
+
+        values[idx] = s.substr(pos, end - pos);
+
+        if (values[idx].find('\\') != std::string::npos)
+            return false;
+
+        pos = end + 1;
+    }
+
+    return s.compare(pos, std::string::npos, "}") == 0;
+}
+
+std::string sai_serialize_neighbor_entry(
+        _In_ const sai_neighbor_entry_t &ne)
+{
+    SWSS_LOG_ENTER();
+
+    return sai_serialize_json_fields({
+            { "ip", sai_serialize_ip_address(ne.ip_address) },
+            { "rif", sai_serialize_object_id(ne.rif_id) },
+            { "switch_id", sai_serialize_object_id(ne.switch_id) } });
+}
+
+std::string sai_serialize_route_entry(
+        _In_ const sai_route_entry_t& route_entry)
+{
+    SWSS_LOG_ENTER();
+
+    return sai_serialize_json_fields({
+            { "dest", sai_serialize_ip_prefix(route_entry.destination) },
+            { "switch_id", sai_serialize_object_id(route_entry.switch_id) },
+            { "vr", sai_serialize_object_id(route_entry.vr_id) } });
 }
 
 std::string sai_serialize_ipmc_entry(
@@ -787,13 +881,10 @@ std::string sai_serialize_fdb_entry(
 {
     SWSS_LOG_ENTER();
 
-    json j;
-
-    j["switch_id"] = sai_serialize_object_id(fdb_entry.switch_id);
-    j["mac"] = sai_serialize_mac(fdb_entry.mac_address);
-    j["bvid"] = sai_serialize_object_id(fdb_entry.bv_id);
-
-    return j.dump();
+    return sai_serialize_json_fields({
+            { "bvid", sai_serialize_object_id(fdb_entry.bv_id) },
+            { "mac", sai_serialize_mac(fdb_entry.mac_address) },
+            { "switch_id", sai_serialize_object_id(fdb_entry.switch_id) } });
 }
 
 std::string sai_serialize_l2mc_entry_type(
@@ -2687,6 +2778,18 @@ void sai_deserialize_fdb_entry(
 {
     SWSS_LOG_ENTER();
 
+    static const char* const names[] = { "bvid", "mac", "switch_id" };
+
+    std::string values[3];
+
+    if (sai_deserialize_json_fields(s, names, 3, values))
+    {
+        sai_deserialize_object_id(values[0], fdb_entry.bv_id);
+        sai_deserialize_mac(values[1], fdb_entry.mac_address);
+        sai_deserialize_object_id(values[2], fdb_entry.switch_id);
+        return;
+    }
+
     json j = json::parse(s);
 
     sai_deserialize_object_id(j["switch_id"], fdb_entry.switch_id);
@@ -2700,6 +2803,18 @@ void sai_deserialize_neighbor_entry(
 {
     SWSS_LOG_ENTER();
 
+    static const char* const names[] = { "ip", "rif", "switch_id" };
+
+    std::string values[3];
+
+    if (sai_deserialize_json_fields(s, names, 3, values))
+    {
+        sai_deserialize_ip_address(values[0], ne.ip_address);
+        sai_deserialize_object_id(values[1], ne.rif_id);
+        sai_deserialize_object_id(values[2], ne.switch_id);
+        return;
+    }
+
     json j = json::parse(s);
 
     sai_deserialize_object_id(j["switch_id"], ne.switch_id);
@@ -2713,6 +2828,18 @@ void sai_deserialize_route_entry(
 {
     SWSS_LOG_ENTER();
 
+    static const char* const names[] = { "dest", "switch_id", "vr" };
+
+    std::string values[3];
+
+    if (sai_deserialize_json_fields(s, names, 3, values))
+    {
+        sai_deserialize_ip_prefix(values[0], route_entry.destination);
+        sai_deserialize_object_id(values[1], route_entry.switch_id);
+        sai_deserialize_object_id(values[2], route_entry.vr_id);
+        return;
+    }
+
     json j = json::parse(s);
 
     sai_deserialize_object_id(j["switch_id"], route_entry.switch_id);
@@ -2950,6 +3077,452 @@ void sai_deserialize_queue_deadlock_ntf(
     *deadlock_data = data;
 }
 
+// binary attributes
+
+/*
+ * Binary attribute list layout, all numbers in host byte order since both
+ * sides are running on the same machine:
+ *
+ * uint8_t version, uint32_t object type, uint32_t attribute count, and for
+ * each attribute: uint32_t attribute id, uint32_t value size in bytes, value
+ * bytes. Primitive values are copied as attribute value union member, lists
+ * as array of list elements.
+ */
+
+#define SAI_BINARY_ATTR_LIST_VERSION ((uint8_t)1)
+
+static std::string sai_binary_to_hex(
+        _In_ const std::string &buf)
+{
+    SWSS_LOG_ENTER();
+
+    static const char hex[] = "0123456789abcdef";
+
+    std::string s;
+
+    s.reserve(buf.size() * 2);
+
+    for (unsigned char c: buf)
+    {
+        s += hex[c >> 4];
+        s += hex[c & 0xf];
+    }
+
+    return s;
+}
+
+static std::string sai_binary_from_hex(
+        _In_ const std::string &s)
+{
+    SWSS_LOG_ENTER();
+
+    if (s.size() % 2)
+    {
+        SWSS_LOG_THROW("invalid binary attributes hex length %zu", s.size());
+    }
+
+    std::string buf;
+
+    buf.reserve(s.size() / 2);
+
+    for (size_t idx = 0; idx < s.size(); idx += 2)
+    {
+        buf += (char)(char_to_int(s[idx]) << 4 | char_to_int(s[idx + 1]));
+    }
+
+    return buf;
+}
+
+/**
+ * @brief Get size of primitive attribute value union member.
+ *
+ * @return Size of value or zero if value type is not primitive.
+ */
+static size_t sai_binary_primitive_size(
+        _In_ sai_attr_value_type_t type)
+{
+    SWSS_LOG_ENTER();
+
+    sai_attribute_value_t value;
+
+    switch (type)
+    {
+        case SAI_ATTR_VALUE_TYPE_BOOL:
+            return sizeof(value.booldata);
+
+        case SAI_ATTR_VALUE_TYPE_CHARDATA:
+            return sizeof(value.chardata);
+
+        case SAI_ATTR_VALUE_TYPE_UINT8:
+            return sizeof(value.u8);
+
+        case SAI_ATTR_VALUE_TYPE_INT8:
+            return sizeof(value.s8);
+
+        case SAI_ATTR_VALUE_TYPE_UINT16:
+            return sizeof(value.u16);
+
+        case SAI_ATTR_VALUE_TYPE_INT16:
+            return sizeof(value.s16);
+
+        case SAI_ATTR_VALUE_TYPE_UINT32:
+            return sizeof(value.u32);
+
+        case SAI_ATTR_VALUE_TYPE_INT32:
+            return sizeof(value.s32);
+
+        case SAI_ATTR_VALUE_TYPE_UINT64:
+            return sizeof(value.u64);
+
+        case SAI_ATTR_VALUE_TYPE_INT64:
+            return sizeof(value.s64);
+
+        case SAI_ATTR_VALUE_TYPE_MAC:
+            return sizeof(value.mac);
+
+        case SAI_ATTR_VALUE_TYPE_IPV4:
+            return sizeof(value.ip4);
+
+        case SAI_ATTR_VALUE_TYPE_IPV6:
+            return sizeof(value.ip6);
+
+        case SAI_ATTR_VALUE_TYPE_POINTER:
+            return sizeof(value.ptr);
+
+        case SAI_ATTR_VALUE_TYPE_IP_ADDRESS:
+            return sizeof(value.ipaddr);
+
+        case SAI_ATTR_VALUE_TYPE_IP_PREFIX:
+            return sizeof(value.ipprefix);
+
+        case SAI_ATTR_VALUE_TYPE_OBJECT_ID:
+            return sizeof(value.oid);
+
+        case SAI_ATTR_VALUE_TYPE_UINT32_RANGE:
+            return sizeof(value.u32range);
+
+        case SAI_ATTR_VALUE_TYPE_INT32_RANGE:
+            return sizeof(value.s32range);
+
+        default:
+            return 0;
+    }
+}
+
+template<typename T>
+static void sai_binary_append_number(
+        _Inout_ std::string &buf,
+        _In_ T number)
+{
+    SWSS_LOG_ENTER();
+
+    buf.append((const char*)&number, sizeof(number));
+}
+
+static void sai_binary_append_value(
+        _Inout_ std::string &buf,
+        _In_ sai_attr_id_t id,
+        _In_ const void *data,
+        _In_ size_t size)
+{
+    SWSS_LOG_ENTER();
+
+    sai_binary_append_number(buf, id);
+    sai_binary_append_number(buf, (uint32_t)size);
+
+    if (size)
+    {
+        buf.append((const char*)data, size);
+    }
+}
+
+template<typename T>
+static bool sai_binary_append_list(
+        _Inout_ std::string &buf,
+        _In_ sai_attr_id_t id,
+        _In_ const T &list)
+{
+    SWSS_LOG_ENTER();
+
+    if (list.list == NULL && list.count)
+    {
+        // count only list, there are no elements to copy
+
+        return false;
+    }
+
+    sai_binary_append_value(buf, id, list.list, list.count * sizeof(*list.list));
+
+    return true;
+}
+
+static bool sai_binary_append_attr(
+        _Inout_ std::string &buf,
+        _In_ const sai_attr_metadata_t &meta,
+        _In_ const sai_attribute_t &attr)
+{
+    SWSS_LOG_ENTER();
+
+    size_t size = sai_binary_primitive_size(meta.attrvaluetype);
+
+    if (size)
+    {
+        // all union members start at union address
+
+        sai_binary_append_value(buf, attr.id, &attr.value, size);
+
+        return true;
+    }
+
+    switch (meta.attrvaluetype)
+    {
+        case SAI_ATTR_VALUE_TYPE_OBJECT_LIST:
+            return sai_binary_append_list(buf, attr.id, attr.value.objlist);
+
+        case SAI_ATTR_VALUE_TYPE_UINT8_LIST:
+            return sai_binary_append_list(buf, attr.id, attr.value.u8list);
+
+        case SAI_ATTR_VALUE_TYPE_INT8_LIST:
+            return sai_binary_append_list(buf, attr.id, attr.value.s8list);
+
+        case SAI_ATTR_VALUE_TYPE_UINT16_LIST:
+            return sai_binary_append_list(buf, attr.id, attr.value.u16list);
+
+        case SAI_ATTR_VALUE_TYPE_INT16_LIST:
+            return sai_binary_append_list(buf, attr.id, attr.value.s16list);
+
+        case SAI_ATTR_VALUE_TYPE_UINT32_LIST:
+            return sai_binary_append_list(buf, attr.id, attr.value.u32list);
+
+        case SAI_ATTR_VALUE_TYPE_INT32_LIST:
+            return sai_binary_append_list(buf, attr.id, attr.value.s32list);
+
+        case SAI_ATTR_VALUE_TYPE_VLAN_LIST:
+            return sai_binary_append_list(buf, attr.id, attr.value.vlanlist);
+
+        case SAI_ATTR_VALUE_TYPE_QOS_MAP_LIST:
+            return sai_binary_append_list(buf, attr.id, attr.value.qosmap);
+
+        case SAI_ATTR_VALUE_TYPE_IP_ADDRESS_LIST:
+            return sai_binary_append_list(buf, attr.id, attr.value.ipaddrlist);
+
+        default:
+
+            // ACL field and action data and capability are sent as text
+
+            return false;
+    }
+}
+
+bool sai_serialize_attr_list_binary(
+        _In_ sai_object_type_t object_type,
+        _In_ uint32_t attr_count,
+        _In_ const sai_attribute_t *attr_list,
+        _Out_ std::string &s)
+{
+    SWSS_LOG_ENTER();
+
+    std::string buf;
+
+    sai_binary_append_number(buf, SAI_BINARY_ATTR_LIST_VERSION);
+    sai_binary_append_number(buf, (uint32_t)object_type);
+    sai_binary_append_number(buf, attr_count);
+
+    for (uint32_t idx = 0; idx < attr_count; idx++)
+    {
+        const sai_attribute_t &attr = attr_list[idx];
+
+        auto meta = sai_metadata_get_attr_metadata(object_type, attr.id);
+
+        if (meta == NULL)
+        {
+            SWSS_LOG_THROW("FATAL: failed to find metadata for object type %d and attr id %d", object_type, attr.id);
+        }
+
+        if (!sai_binary_append_attr(buf, *meta, attr))
+        {
+            return false;
+        }
+    }
+
+    s = sai_binary_to_hex(buf);
+
+    return true;
+}
+
+static void sai_binary_read(
+        _In_ const std::string &buf,
+        _Inout_ size_t &offset,
+        _Out_ void *data,
+        _In_ size_t size)
+{
+    SWSS_LOG_ENTER();
+
+    if (buf.size() - offset < size)
+    {
+        SWSS_LOG_THROW("binary attributes truncated, need %zu bytes at offset %zu, size is %zu", size, offset, buf.size());
+    }
+
+    if (size)
+    {
+        memcpy(data, buf.data() + offset, size);
+    }
+
+    offset += size;
+}
+
+template<typename T>
+static T sai_binary_read_number(
+        _In_ const std::string &buf,
+        _Inout_ size_t &offset)
+{
+    SWSS_LOG_ENTER();
+
+    T number;
+
+    sai_binary_read(buf, offset, &number, sizeof(number));
+
+    return number;
+}
+
+template<typename T>
+static void sai_binary_read_list(
+        _In_ const std::string &buf,
+        _Inout_ size_t &offset,
+        _In_ size_t size,
+        _Out_ T &list)
+{
+    SWSS_LOG_ENTER();
+
+    if (size % sizeof(*list.list))
+    {
+        SWSS_LOG_THROW("binary list size %zu is not multiple of element size %zu", size, sizeof(*list.list));
+    }
+
+    sai_alloc_list((uint32_t)(size / sizeof(*list.list)), list);
+
+    sai_binary_read(buf, offset, list.list, size);
+}
+
+static void sai_binary_read_attr(
+        _In_ const std::string &buf,
+        _Inout_ size_t &offset,
+        _In_ size_t size,
+        _In_ const sai_attr_metadata_t &meta,
+        _Inout_ sai_attribute_t &attr)
+{
+    SWSS_LOG_ENTER();
+
+    size_t primitiveSize = sai_binary_primitive_size(meta.attrvaluetype);
+
+    if (primitiveSize)
+    {
+        if (size != primitiveSize)
+        {
+            SWSS_LOG_THROW("binary value size %zu of %s is different than expected %zu", size, meta.attridname, primitiveSize);
+        }
+
+        sai_binary_read(buf, offset, &attr.value, size);
+
+        return;
+    }
+
+    switch (meta.attrvaluetype)
+    {
+        case SAI_ATTR_VALUE_TYPE_OBJECT_LIST:
+            return sai_binary_read_list(buf, offset, size, attr.value.objlist);
+
+        case SAI_ATTR_VALUE_TYPE_UINT8_LIST:
+            return sai_binary_read_list(buf, offset, size, attr.value.u8list);
+
+        case SAI_ATTR_VALUE_TYPE_INT8_LIST:
+            return sai_binary_read_list(buf, offset, size, attr.value.s8list);
+
+        case SAI_ATTR_VALUE_TYPE_UINT16_LIST:
+            return sai_binary_read_list(buf, offset, size, attr.value.u16list);
+
+        case SAI_ATTR_VALUE_TYPE_INT16_LIST:
+            return sai_binary_read_list(buf, offset, size, attr.value.s16list);
+
+        case SAI_ATTR_VALUE_TYPE_UINT32_LIST:
+            return sai_binary_read_list(buf, offset, size, attr.value.u32list);
+
+        case SAI_ATTR_VALUE_TYPE_INT32_LIST:
+            return sai_binary_read_list(buf, offset, size, attr.value.s32list);
+
+        case SAI_ATTR_VALUE_TYPE_VLAN_LIST:
+            return sai_binary_read_list(buf, offset, size, attr.value.vlanlist);
+
+        case SAI_ATTR_VALUE_TYPE_QOS_MAP_LIST:
+            return sai_binary_read_list(buf, offset, size, attr.value.qosmap);
+
+        case SAI_ATTR_VALUE_TYPE_IP_ADDRESS_LIST:
+            return sai_binary_read_list(buf, offset, size, attr.value.ipaddrlist);
+
+        default:
+            SWSS_LOG_THROW("binary value of %s is not supported", meta.attridname);
+    }
+}
+
+void sai_deserialize_attr_list_binary(
+        _In_ const std::string &s,
+        _In_ sai_object_type_t object_type,
+        _Out_ std::vector<sai_attribute_t> &attr_list,
+        _Out_ std::vector<sai_attr_value_type_t> &attr_value_type_list)
+{
+    SWSS_LOG_ENTER();
+
+    std::string buf = sai_binary_from_hex(s);
+
+    size_t offset = 0;
+
+    uint8_t version = sai_binary_read_number<uint8_t>(buf, offset);
+
+    if (version != SAI_BINARY_ATTR_LIST_VERSION)
+    {
+        SWSS_LOG_THROW("unsupported binary attributes version %u", version);
+    }
+
+    uint32_t ot = sai_binary_read_number<uint32_t>(buf, offset);
+
+    if (ot != (uint32_t)object_type)
+    {
+        SWSS_LOG_THROW("binary attributes object type %u is different than %s",
+                ot,
+                sai_serialize_object_type(object_type).c_str());
+    }
+
+    uint32_t attr_count = sai_binary_read_number<uint32_t>(buf, offset);
+
+    for (uint32_t idx = 0; idx < attr_count; idx++)
+    {
+        sai_attribute_t attr;
+
+        memset(&attr, 0, sizeof(attr));
+
+        attr.id = sai_binary_read_number<sai_attr_id_t>(buf, offset);
+
+        uint32_t size = sai_binary_read_number<uint32_t>(buf, offset);
+
+        auto meta = sai_metadata_get_attr_metadata(object_type, attr.id);
+
+        if (meta == NULL)
+        {
+            SWSS_LOG_THROW("FATAL: failed to find metadata for object type %d and attr id %d", object_type, attr.id);
+        }
+
+        sai_binary_read_attr(buf, offset, size, *meta, attr);
+
+        attr_list.push_back(attr);
+        attr_value_type_list.push_back(meta->attrvaluetype);
+    }
+
+    if (offset != buf.size())
+    {
+        SWSS_LOG_THROW("binary attributes have %zu trailing bytes", buf.size() - offset);
+    }
+}
+
 // deserialize free
 
 void sai_deserialize_free_attribute_value(
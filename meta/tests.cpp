@@ -11,17 +11,19 @@
 #include <unordered_map>
 #include <memory>
 #include <vector>
+#include <chrono>
+#include <iostream>
 
-class SaiAttrWrapper;
-extern std::unordered_map<std::string,std::unordered_map<sai_attr_id_t,std::shared_ptr<SaiAttrWrapper>>> ObjectAttrHash;
 extern bool is_ipv6_mask_valid(const uint8_t* mask);
-extern bool object_exists(const std::string& key);
+extern bool object_exists(const sai_object_meta_key_t& meta_key);
+extern void create_object(const sai_object_meta_key_t& meta_key);
 extern bool object_reference_exists(sai_object_id_t oid);
 extern void object_reference_inc(sai_object_id_t oid);
 extern void object_reference_dec(sai_object_id_t oid);
 extern void object_reference_dec(const sai_object_list_t& list);
 extern void object_reference_insert(sai_object_id_t oid);
 extern int32_t object_reference_count(sai_object_id_t oid);
+extern size_t fdb_flush_candidates_count(int32_t type, sai_object_id_t bridgePortId, sai_object_id_t bvId);
 
 std::string construct_key(
         _In_ const sai_object_meta_key_t& meta_key,
@@ -898,15 +900,13 @@ void test_fdb_entry_remove()
 
     sai_object_meta_key_t meta = { .objecttype = SAI_OBJECT_TYPE_FDB_ENTRY, .objectkey = { .key = { .fdb_entry = fdb_entry } } };
 
-    std::string key = sai_serialize_object_meta_key(meta);
-
-    META_ASSERT_TRUE(object_exists(key));
+    META_ASSERT_TRUE(object_exists(meta));
 
     SWSS_LOG_NOTICE("success");
     status = meta_sai_remove_fdb_entry(&fdb_entry, &dummy_success_sai_remove_fdb_entry);
     META_ASSERT_SUCCESS(status);
 
-    META_ASSERT_TRUE(!object_exists(key));
+    META_ASSERT_TRUE(!object_exists(meta));
 }
 
 void test_fdb_entry_set()
@@ -930,8 +930,7 @@ void test_fdb_entry_set()
 
     // TODO we should use CREATE for this
     sai_object_meta_key_t meta_key_fdb = { .objecttype = SAI_OBJECT_TYPE_FDB_ENTRY, .objectkey = { .key = { .fdb_entry = fdb_entry } } };
-    std::string fdb_key = sai_serialize_object_meta_key(meta_key_fdb);
-    ObjectAttrHash[fdb_key] = { };
+    create_object(meta_key_fdb);
 
     SWSS_LOG_NOTICE("attr is null");
     status = meta_sai_set_fdb_entry(&fdb_entry, NULL, &dummy_success_sai_set_fdb_entry);
@@ -999,8 +998,7 @@ void test_fdb_entry_get()
 
     // TODO we should use CREATE for this
     sai_object_meta_key_t meta_key_fdb = { .objecttype = SAI_OBJECT_TYPE_FDB_ENTRY, .objectkey = { .key = { .fdb_entry = fdb_entry } } };
-    std::string fdb_key = sai_serialize_object_meta_key(meta_key_fdb);
-    ObjectAttrHash[fdb_key] = { };
+    create_object(meta_key_fdb);
 
     attr.id = SAI_FDB_ENTRY_ATTR_TYPE;
     attr.value.s32 = SAI_FDB_ENTRY_TYPE_STATIC;
@@ -1127,6 +1125,122 @@ void test_fdb_entry_flow()
     META_ASSERT_FAIL(status);
 }
 
+void fdb_flush_candidates(
+        _In_ uint32_t routeCount,
+        _In_ uint32_t vlanCount)
+{
+    SWSS_LOG_ENTER();
+
+    clear_local();
+    meta_init_db();
+
+    const uint32_t fdbPerVlan = 100;
+
+    sai_object_id_t switch_id = create_switch();
+
+    sai_object_id_t vr = create_dummy_object_id(SAI_OBJECT_TYPE_VIRTUAL_ROUTER, switch_id);
+
+    // routes are only put into local db, they are not validated
+
+    for (uint32_t i = 0; i < routeCount; ++i)
+    {
+        sai_route_entry_t route_entry;
+
+        route_entry.switch_id = switch_id;
+        route_entry.vr_id = vr;
+        route_entry.destination.addr_family = SAI_IP_ADDR_FAMILY_IPV4;
+        route_entry.destination.addr.ip4 = htonl(0x0a000000 | i);
+        route_entry.destination.mask.ip4 = htonl(0xffffffff);
+
+        sai_object_meta_key_t meta_key_route = { .objecttype = SAI_OBJECT_TYPE_ROUTE_ENTRY, .objectkey = { .key = { .route_entry = route_entry } } };
+        create_object(meta_key_route);
+    }
+
+    sai_object_id_t port = create_dummy_object_id(SAI_OBJECT_TYPE_BRIDGE_PORT, switch_id);
+
+    std::vector<sai_object_id_t> vlans;
+
+    for (uint32_t v = 0; v < vlanCount; ++v)
+    {
+        vlans.push_back(create_dummy_object_id(SAI_OBJECT_TYPE_VLAN, switch_id));
+    }
+
+    sai_attribute_t attrs[2];
+
+    attrs[0].id = SAI_FDB_ENTRY_ATTR_BRIDGE_PORT_ID;
+    attrs[0].value.oid = port;
+
+    attrs[1].id = SAI_FDB_ENTRY_ATTR_TYPE;
+    attrs[1].value.s32 = SAI_FDB_ENTRY_TYPE_DYNAMIC;
+
+    sai_fdb_event_notification_data_t data;
+
+    data.event_type = SAI_FDB_EVENT_LEARNED;
+    data.fdb_entry.switch_id = switch_id;
+    data.attr_count = 2;
+    data.attr = attrs;
+
+    for (auto vlan: vlans)
+    {
+        data.fdb_entry.bv_id = vlan;
+
+        for (uint32_t i = 0; i < fdbPerVlan; ++i)
+        {
+            sai_mac_t mac = { 0x00, 0x11, 0x22, (uint8_t)(i >> 16), (uint8_t)(i >> 8), (uint8_t)i };
+
+            memcpy(data.fdb_entry.mac_address, mac, sizeof(sai_mac_t));
+
+            meta_sai_on_fdb_event(1, &data);
+        }
+    }
+
+    // flush all dynamic entries on first vlan
+
+    attrs[0].value.oid = SAI_NULL_OBJECT_ID;
+
+    data.event_type = SAI_FDB_EVENT_FLUSHED;
+    data.fdb_entry.bv_id = vlans[0];
+
+    memset(data.fdb_entry.mac_address, 0, sizeof(sai_mac_t));
+
+    /*
+     * Flush must visit only entries of flushed vlan, regardless of number of
+     * routes and fdb entries on other vlans.
+     */
+
+    META_ASSERT_TRUE(fdb_flush_candidates_count(SAI_FDB_ENTRY_TYPE_DYNAMIC, SAI_NULL_OBJECT_ID, vlans[0]) == fdbPerVlan);
+
+    meta_sai_on_fdb_event(1, &data);
+
+    META_ASSERT_TRUE(fdb_flush_candidates_count(SAI_FDB_ENTRY_TYPE_DYNAMIC, SAI_NULL_OBJECT_ID, vlans[0]) == 0);
+    META_ASSERT_TRUE(fdb_flush_candidates_count(SAI_FDB_ENTRY_TYPE_DYNAMIC, SAI_NULL_OBJECT_ID, vlans[1]) == fdbPerVlan);
+    META_ASSERT_TRUE(fdb_flush_candidates_count(SAI_FDB_ENTRY_TYPE_DYNAMIC, port, SAI_NULL_OBJECT_ID) == fdbPerVlan * (vlanCount - 1));
+
+    sai_fdb_entry_t fdb_entry = data.fdb_entry;
+
+    sai_mac_t mac = { 0x00, 0x11, 0x22, 0x00, 0x00, 0x01 };
+
+    memcpy(fdb_entry.mac_address, mac, sizeof(sai_mac_t));
+
+    sai_object_meta_key_t meta_key_flushed = { .objecttype = SAI_OBJECT_TYPE_FDB_ENTRY, .objectkey = { .key = { .fdb_entry = fdb_entry } } };
+
+    META_ASSERT_TRUE(!object_exists(meta_key_flushed));
+
+    fdb_entry.bv_id = vlans[1];
+
+    sai_object_meta_key_t meta_key_kept = { .objecttype = SAI_OBJECT_TYPE_FDB_ENTRY, .objectkey = { .key = { .fdb_entry = fdb_entry } } };
+
+    META_ASSERT_TRUE(object_exists(meta_key_kept));
+}
+
+void test_fdb_flush_candidates()
+{
+    SWSS_LOG_ENTER();
+
+    fdb_flush_candidates(0, 2);
+    fdb_flush_candidates(1000, 10);
+}
+
 // NEIGHBOR TESTS
 
 void test_neighbor_entry_create()
@@ -1148,8 +1262,7 @@ void test_neighbor_entry_create()
     sai_object_id_t rif = create_dummy_object_id(SAI_OBJECT_TYPE_ROUTER_INTERFACE,switch_id);
     object_reference_insert(rif);
     sai_object_meta_key_t meta_key_rif = { .objecttype = SAI_OBJECT_TYPE_ROUTER_INTERFACE, .objectkey = { .key = { .object_id = rif } } };
-    std::string rif_key = sai_serialize_object_meta_key(meta_key_rif);
-    ObjectAttrHash[rif_key] = { };
+    create_object(meta_key_rif);
 
     neighbor_entry.ip_address.addr_family = SAI_IP_ADDR_FAMILY_IPV4;
     neighbor_entry.ip_address.addr.ip4 = htonl(0x0a00000f);
@@ -1251,8 +1364,7 @@ void test_neighbor_entry_remove()
     sai_object_id_t rif = create_dummy_object_id(SAI_OBJECT_TYPE_ROUTER_INTERFACE,switch_id);
     object_reference_insert(rif);
     sai_object_meta_key_t meta_key_rif = { .objecttype = SAI_OBJECT_TYPE_ROUTER_INTERFACE, .objectkey = { .key = { .object_id = rif } } };
-    std::string rif_key = sai_serialize_object_meta_key(meta_key_rif);
-    ObjectAttrHash[rif_key] = { };
+    create_object(meta_key_rif);
 
     neighbor_entry.ip_address.addr_family = SAI_IP_ADDR_FAMILY_IPV4;
     neighbor_entry.ip_address.addr.ip4 = htonl(0x0a00000f);
@@ -1301,15 +1413,13 @@ void test_neighbor_entry_remove()
 
     sai_object_meta_key_t meta = { .objecttype = SAI_OBJECT_TYPE_NEIGHBOR_ENTRY, .objectkey = { .key = { .neighbor_entry = neighbor_entry } } };
 
-    std::string key = sai_serialize_object_meta_key(meta);
-
-    META_ASSERT_TRUE(object_exists(key));
+    META_ASSERT_TRUE(object_exists(meta));
 
     SWSS_LOG_NOTICE("success");
     status = meta_sai_remove_neighbor_entry(&neighbor_entry, &dummy_success_sai_remove_neighbor_entry);
     META_ASSERT_SUCCESS(status);
 
-    META_ASSERT_TRUE(!object_exists(key));
+    META_ASSERT_TRUE(!object_exists(meta));
 }
 
 void test_neighbor_entry_set()
@@ -1343,8 +1453,7 @@ void test_neighbor_entry_set()
     sai_object_id_t rif = create_dummy_object_id(SAI_OBJECT_TYPE_ROUTER_INTERFACE,switch_id);
     object_reference_insert(rif);
     sai_object_meta_key_t meta_key_rif = { .objecttype = SAI_OBJECT_TYPE_ROUTER_INTERFACE, .objectkey = { .key = { .object_id = rif } } };
-    std::string rif_key = sai_serialize_object_meta_key(meta_key_rif);
-    ObjectAttrHash[rif_key] = { };
+    create_object(meta_key_rif);
 
     neighbor_entry.ip_address.addr_family = SAI_IP_ADDR_FAMILY_IPV4;
     neighbor_entry.ip_address.addr.ip4 = htonl(0x0a00000f);
@@ -1424,8 +1533,7 @@ void test_neighbor_entry_get()
     sai_object_id_t rif = create_dummy_object_id(SAI_OBJECT_TYPE_ROUTER_INTERFACE,switch_id);
     object_reference_insert(rif);
     sai_object_meta_key_t meta_key_rif = { .objecttype = SAI_OBJECT_TYPE_ROUTER_INTERFACE, .objectkey = { .key = { .object_id = rif } } };
-    std::string rif_key = sai_serialize_object_meta_key(meta_key_rif);
-    ObjectAttrHash[rif_key] = { };
+    create_object(meta_key_rif);
 
     neighbor_entry.ip_address.addr_family = SAI_IP_ADDR_FAMILY_IPV4;
     neighbor_entry.ip_address.addr.ip4 = htonl(0x0a00000f);
@@ -1525,8 +1633,7 @@ void test_neighbor_entry_flow()
     sai_object_id_t rif = create_dummy_object_id(SAI_OBJECT_TYPE_ROUTER_INTERFACE,switch_id);
     object_reference_insert(rif);
     sai_object_meta_key_t meta_key_rif = { .objecttype = SAI_OBJECT_TYPE_ROUTER_INTERFACE, .objectkey = { .key = { .object_id = rif } } };
-    std::string rif_key = sai_serialize_object_meta_key(meta_key_rif);
-    ObjectAttrHash[rif_key] = { };
+    create_object(meta_key_rif);
 
     neighbor_entry.ip_address.addr_family = SAI_IP_ADDR_FAMILY_IPV4;
     neighbor_entry.ip_address.addr.ip4 = htonl(0x0a00000f);
@@ -1600,8 +1707,7 @@ void test_vlan_create()
     sai_object_id_t stp = create_dummy_object_id(SAI_OBJECT_TYPE_STP,switch_id);
     object_reference_insert(stp);
     sai_object_meta_key_t meta_key_stp = { .objecttype = SAI_OBJECT_TYPE_STP, .objectkey = { .key = { .object_id = stp } } };
-    std::string stp_key = sai_serialize_object_meta_key(meta_key_stp);
-    ObjectAttrHash[stp_key] = { };
+    create_object(meta_key_stp);
 
     SWSS_LOG_NOTICE("create tests");
 
@@ -1650,8 +1756,7 @@ void test_vlan_remove()
     sai_object_id_t stp = create_dummy_object_id(SAI_OBJECT_TYPE_STP,switch_id);
     object_reference_insert(stp);
     sai_object_meta_key_t meta_key_stp = { .objecttype = SAI_OBJECT_TYPE_STP, .objectkey = { .key = { .object_id = stp } } };
-    std::string stp_key = sai_serialize_object_meta_key(meta_key_stp);
-    ObjectAttrHash[stp_key] = { };
+    create_object(meta_key_stp);
 
     SWSS_LOG_NOTICE("create");
 
@@ -1713,8 +1818,7 @@ void test_vlan_set()
     sai_object_id_t stp = create_dummy_object_id(SAI_OBJECT_TYPE_STP,switch_id);
     object_reference_insert(stp);
     sai_object_meta_key_t meta_key_stp = { .objecttype = SAI_OBJECT_TYPE_STP, .objectkey = { .key = { .object_id = stp } } };
-    std::string stp_key = sai_serialize_object_meta_key(meta_key_stp);
-    ObjectAttrHash[stp_key] = { };
+    create_object(meta_key_stp);
 
     SWSS_LOG_NOTICE("create");
 
@@ -1822,8 +1926,7 @@ void test_vlan_get()
     sai_object_id_t stp = create_dummy_object_id(SAI_OBJECT_TYPE_STP,switch_id);
     object_reference_insert(stp);
     sai_object_meta_key_t meta_key_stp = { .objecttype = SAI_OBJECT_TYPE_STP, .objectkey = { .key = { .object_id = stp } } };
-    std::string stp_key = sai_serialize_object_meta_key(meta_key_stp);
-    ObjectAttrHash[stp_key] = { };
+    create_object(meta_key_stp);
 
     SWSS_LOG_NOTICE("create");
 
@@ -1951,8 +2054,7 @@ void test_vlan_flow()
     sai_object_id_t stp = create_dummy_object_id(SAI_OBJECT_TYPE_STP,switch_id);
     object_reference_insert(stp);
     sai_object_meta_key_t meta_key_stp = { .objecttype = SAI_OBJECT_TYPE_STP, .objectkey = { .key = { .object_id = stp } } };
-    std::string stp_key = sai_serialize_object_meta_key(meta_key_stp);
-    ObjectAttrHash[stp_key] = { };
+    create_object(meta_key_stp);
 
     SWSS_LOG_NOTICE("create");
 
@@ -2077,14 +2179,12 @@ void test_route_entry_create()
     sai_object_id_t vr = create_dummy_object_id(SAI_OBJECT_TYPE_VIRTUAL_ROUTER,switch_id);
     object_reference_insert(vr);
     sai_object_meta_key_t meta_key_vr = { .objecttype = SAI_OBJECT_TYPE_VIRTUAL_ROUTER, .objectkey = { .key = { .object_id = vr } } };
-    std::string vr_key = sai_serialize_object_meta_key(meta_key_vr);
-    ObjectAttrHash[vr_key] = { };
+    create_object(meta_key_vr);
 
     sai_object_id_t hop = create_dummy_object_id(SAI_OBJECT_TYPE_NEXT_HOP,switch_id);
     object_reference_insert(hop);
     sai_object_meta_key_t meta_key_hop = { .objecttype = SAI_OBJECT_TYPE_NEXT_HOP, .objectkey = { .key = { .object_id = hop } } };
-    std::string hop_key = sai_serialize_object_meta_key(meta_key_hop);
-    ObjectAttrHash[hop_key] = { };
+    create_object(meta_key_hop);
 
     route_entry.destination.addr_family = SAI_IP_ADDR_FAMILY_IPV4;
     route_entry.destination.addr.ip4 = htonl(0x0a00000f);
@@ -2209,14 +2309,12 @@ void test_route_entry_remove()
     sai_object_id_t vr = create_dummy_object_id(SAI_OBJECT_TYPE_VIRTUAL_ROUTER,switch_id);
     object_reference_insert(vr);
     sai_object_meta_key_t meta_key_vr = { .objecttype = SAI_OBJECT_TYPE_VIRTUAL_ROUTER, .objectkey = { .key = { .object_id = vr } } };
-    std::string vr_key = sai_serialize_object_meta_key(meta_key_vr);
-    ObjectAttrHash[vr_key] = { };
+    create_object(meta_key_vr);
 
     sai_object_id_t hop = create_dummy_object_id(SAI_OBJECT_TYPE_NEXT_HOP,switch_id);
     object_reference_insert(hop);
     sai_object_meta_key_t meta_key_hop = { .objecttype = SAI_OBJECT_TYPE_NEXT_HOP, .objectkey = { .key = { .object_id = hop } } };
-    std::string hop_key = sai_serialize_object_meta_key(meta_key_hop);
-    ObjectAttrHash[hop_key] = { };
+    create_object(meta_key_hop);
 
     route_entry.destination.addr_family = SAI_IP_ADDR_FAMILY_IPV4;
     route_entry.destination.addr.ip4 = htonl(0x0a00000f);
@@ -2281,15 +2379,13 @@ void test_route_entry_remove()
 
     sai_object_meta_key_t meta = { .objecttype = SAI_OBJECT_TYPE_ROUTE_ENTRY, .objectkey = { .key = { .route_entry = route_entry } } };
 
-    std::string key = sai_serialize_object_meta_key(meta);
-
-    META_ASSERT_TRUE(object_exists(key));
+    META_ASSERT_TRUE(object_exists(meta));
 
     SWSS_LOG_NOTICE("success");
     status = meta_sai_remove_route_entry(&route_entry, &dummy_success_sai_remove_route_entry);
     META_ASSERT_SUCCESS(status);
 
-    META_ASSERT_TRUE(!object_exists(key));
+    META_ASSERT_TRUE(!object_exists(meta));
 
     route_entry.destination.addr_family = SAI_IP_ADDR_FAMILY_IPV4;
     route_entry.destination.addr.ip4 = htonl(0x0a00000f);
@@ -2317,14 +2413,12 @@ void test_route_entry_set()
     sai_object_id_t vr = create_dummy_object_id(SAI_OBJECT_TYPE_VIRTUAL_ROUTER,switch_id);
     object_reference_insert(vr);
     sai_object_meta_key_t meta_key_vr = { .objecttype = SAI_OBJECT_TYPE_VIRTUAL_ROUTER, .objectkey = { .key = { .object_id = vr } } };
-    std::string vr_key = sai_serialize_object_meta_key(meta_key_vr);
-    ObjectAttrHash[vr_key] = { };
+    create_object(meta_key_vr);
 
     sai_object_id_t hop = create_dummy_object_id(SAI_OBJECT_TYPE_NEXT_HOP,switch_id);
     object_reference_insert(hop);
     sai_object_meta_key_t meta_key_hop = { .objecttype = SAI_OBJECT_TYPE_NEXT_HOP, .objectkey = { .key = { .object_id = hop } } };
-    std::string hop_key = sai_serialize_object_meta_key(meta_key_hop);
-    ObjectAttrHash[hop_key] = { };
+    create_object(meta_key_hop);
 
     route_entry.destination.addr_family = SAI_IP_ADDR_FAMILY_IPV4;
     route_entry.destination.addr.ip4 = htonl(0x0a00000f);
@@ -2418,14 +2512,12 @@ void test_route_entry_get()
     sai_object_id_t vr = create_dummy_object_id(SAI_OBJECT_TYPE_VIRTUAL_ROUTER,switch_id);
     object_reference_insert(vr);
     sai_object_meta_key_t meta_key_vr = { .objecttype = SAI_OBJECT_TYPE_VIRTUAL_ROUTER, .objectkey = { .key = { .object_id = vr } } };
-    std::string vr_key = sai_serialize_object_meta_key(meta_key_vr);
-    ObjectAttrHash[vr_key] = { };
+    create_object(meta_key_vr);
 
     sai_object_id_t hop = create_dummy_object_id(SAI_OBJECT_TYPE_NEXT_HOP,switch_id);
     object_reference_insert(hop);
     sai_object_meta_key_t meta_key_hop = { .objecttype = SAI_OBJECT_TYPE_NEXT_HOP, .objectkey = { .key = { .object_id = hop } } };
-    std::string hop_key = sai_serialize_object_meta_key(meta_key_hop);
-    ObjectAttrHash[hop_key] = { };
+    create_object(meta_key_hop);
 
     route_entry.destination.addr_family = SAI_IP_ADDR_FAMILY_IPV4;
     route_entry.destination.addr.ip4 = htonl(0x0a00000f);
@@ -2517,14 +2609,12 @@ void test_route_entry_flow()
     sai_object_id_t vr = create_dummy_object_id(SAI_OBJECT_TYPE_VIRTUAL_ROUTER,switch_id);
     object_reference_insert(vr);
     sai_object_meta_key_t meta_key_vr = { .objecttype = SAI_OBJECT_TYPE_VIRTUAL_ROUTER, .objectkey = { .key = { .object_id = vr } } };
-    std::string vr_key = sai_serialize_object_meta_key(meta_key_vr);
-    ObjectAttrHash[vr_key] = { };
+    create_object(meta_key_vr);
 
     sai_object_id_t hop = create_dummy_object_id(SAI_OBJECT_TYPE_NEXT_HOP,switch_id);
     object_reference_insert(hop);
     sai_object_meta_key_t meta_key_hop = { .objecttype = SAI_OBJECT_TYPE_NEXT_HOP, .objectkey = { .key = { .object_id = hop } } };
-    std::string hop_key = sai_serialize_object_meta_key(meta_key_hop);
-    ObjectAttrHash[hop_key] = { };
+    create_object(meta_key_hop);
 
     route_entry.destination.addr_family = SAI_IP_ADDR_FAMILY_IPV4;
     route_entry.destination.addr.ip4 = htonl(0x0a00000f);
@@ -2740,8 +2830,7 @@ void test_serialization_type_char()
     sai_object_id_t rif = create_dummy_object_id(SAI_OBJECT_TYPE_PORT,switch_id);
     object_reference_insert(rif);
     sai_object_meta_key_t meta_key_rif = { .objecttype = SAI_OBJECT_TYPE_ROUTER_INTERFACE, .objectkey = { .key = { .object_id = rif } } };
-    std::string rif_key = sai_serialize_object_meta_key(meta_key_rif);
-    ObjectAttrHash[rif_key] = { };
+    create_object(meta_key_rif);
 
     sai_attribute_t attr, attr2, attr3;
 
@@ -2933,8 +3022,7 @@ sai_object_id_t insert_dummy_object(
     sai_object_id_t oid = create_dummy_object_id(ot,switch_id);
     object_reference_insert(oid);
     sai_object_meta_key_t meta_key_oid = { .objecttype = ot, .objectkey = { .key = { .object_id = oid } } };
-    std::string oid_key = sai_serialize_object_meta_key(meta_key_oid);
-    ObjectAttrHash[oid_key] = { };
+    create_object(meta_key_oid);
 
     return oid;
 }
@@ -3196,6 +3284,105 @@ void test_queue_create()
     META_ASSERT_SUCCESS(status);
 }
 
+void test_keyed_object_create_perf()
+{
+    SWSS_LOG_ENTER();
+
+    clear_local();
+    meta_init_db();
+
+    /*
+     * Create large number of objects with KEY attributes, each create must
+     * check whether key is not already used by other object.
+     */
+
+    const uint32_t count = 50000;
+    const uint8_t queuesPerPort = 8;
+
+    sai_object_id_t switch_id = create_switch();
+
+    sai_object_id_t scheduler_group = create_dummy_object_id(SAI_OBJECT_TYPE_SCHEDULER_GROUP, switch_id);
+
+    object_reference_insert(scheduler_group);
+
+    sai_object_id_t port = SAI_NULL_OBJECT_ID;
+
+    sai_object_id_t firstQueue = SAI_NULL_OBJECT_ID;
+
+    sai_attribute_t firstList[4];
+
+    // avoid measuring debug logging
+    swss::Logger::getInstance().setMinPrio(swss::Logger::SWSS_NOTICE);
+
+    auto start = std::chrono::high_resolution_clock::now();
+
+    for (uint32_t i = 0; i < count; ++i)
+    {
+        if (i % queuesPerPort == 0)
+        {
+            port = create_dummy_object_id(SAI_OBJECT_TYPE_PORT, switch_id);
+
+            object_reference_insert(port);
+        }
+
+        sai_attribute_t list[4];
+
+        list[0].id = SAI_QUEUE_ATTR_TYPE;
+        list[0].value.s32 = SAI_QUEUE_TYPE_UNICAST;
+
+        list[1].id = SAI_QUEUE_ATTR_INDEX;
+        list[1].value.u8 = (uint8_t)(i % queuesPerPort);
+
+        list[2].id = SAI_QUEUE_ATTR_PORT;
+        list[2].value.oid = port;
+
+        list[3].id = SAI_QUEUE_ATTR_PARENT_SCHEDULER_NODE;
+        list[3].value.oid = scheduler_group;
+
+        sai_object_id_t queue;
+
+        sai_status_t status = meta_sai_create_oid(SAI_OBJECT_TYPE_QUEUE, &queue, switch_id, 4, list, &dummy_success_sai_create_oid);
+
+        META_ASSERT_SUCCESS(status);
+
+        if (i == 0)
+        {
+            firstQueue = queue;
+
+            memcpy(firstList, list, sizeof(list));
+        }
+    }
+
+    auto end = std::chrono::high_resolution_clock::now();
+
+    swss::Logger::getInstance().setMinPrio(swss::Logger::SWSS_DEBUG);
+
+    auto us = std::chrono::duration_cast<std::chrono::microseconds>(end - start).count();
+
+    std::cout << "created " << count << " keyed objects in " << us / 1000 << " ms ("
+        << (double)us / count << " us per object)" << std::endl;
+
+    // key index must still reject duplicates and release keys on remove
+
+    sai_object_id_t queue;
+
+    sai_status_t status = meta_sai_create_oid(SAI_OBJECT_TYPE_QUEUE, &queue, switch_id, 4, firstList, &dummy_success_sai_create_oid);
+
+    META_ASSERT_TRUE(status == SAI_STATUS_INVALID_PARAMETER);
+
+    status = meta_sai_remove_oid(SAI_OBJECT_TYPE_QUEUE, firstQueue, &dummy_success_sai_remove_oid);
+
+    META_ASSERT_SUCCESS(status);
+
+    status = meta_sai_create_oid(SAI_OBJECT_TYPE_QUEUE, &queue, switch_id, 4, firstList, &dummy_success_sai_create_oid);
+
+    META_ASSERT_SUCCESS(status);
+
+    status = meta_sai_create_oid(SAI_OBJECT_TYPE_QUEUE, &queue, switch_id, 4, firstList, &dummy_success_sai_create_oid);
+
+    META_ASSERT_TRUE(status == SAI_STATUS_INVALID_PARAMETER);
+}
+
 void test_null_list()
 {
     SWSS_LOG_ENTER();
@@ -3256,6 +3443,84 @@ void test_priority_group()
 #define ASSERT_FAIL(msg) \
     { std::cout << "assert failed: " << msg << std::endl; throw; }
 
+void test_serialize_entry_keys()
+{
+    SWSS_LOG_ENTER();
+
+    std::string s;
+
+    // route entry, must match json dump output
+
+    sai_route_entry_t re;
+
+    memset(&re, 0, sizeof(re));
+
+    re.switch_id = 0x21000000000000;
+    re.vr_id = 0x3000000000022;
+    re.destination.addr_family = SAI_IP_ADDR_FAMILY_IPV4;
+    inet_pton(AF_INET, "10.1.0.0", &re.destination.addr.ip4);
+    inet_pton(AF_INET, "255.255.0.0", &re.destination.mask.ip4);
+
+    s = sai_serialize_route_entry(re);
+
+    ASSERT_TRUE(s, "{\"dest\":\"10.1.0.0/16\",\"switch_id\":\"oid:0x21000000000000\",\"vr\":\"oid:0x3000000000022\"}");
+
+    sai_route_entry_t re2;
+
+    memset(&re2, 0, sizeof(re2));
+
+    sai_deserialize_route_entry(s, re2);
+
+    ASSERT_TRUE(s, sai_serialize_route_entry(re2));
+
+    // non canonical form falls back to json parser
+
+    sai_deserialize_route_entry("{ \"vr\": \"oid:0x3000000000022\", \"switch_id\": \"oid:0x21000000000000\", \"dest\": \"fc00::/7\" }", re2);
+
+    ASSERT_TRUE(sai_serialize_route_entry(re2), "{\"dest\":\"fc00::/7\",\"switch_id\":\"oid:0x21000000000000\",\"vr\":\"oid:0x3000000000022\"}");
+
+    // fdb entry
+
+    sai_fdb_entry_t fe;
+
+    fe.switch_id = 0x21000000000000;
+    fe.bv_id = 0x26000000000001;
+    memcpy(fe.mac_address, "\x00\x11\x22\xaa\xbb\xcc", 6);
+
+    s = sai_serialize_fdb_entry(fe);
+
+    ASSERT_TRUE(s, "{\"bvid\":\"oid:0x26000000000001\",\"mac\":\"00:11:22:AA:BB:CC\",\"switch_id\":\"oid:0x21000000000000\"}");
+
+    sai_fdb_entry_t fe2;
+
+    sai_deserialize_fdb_entry(s, fe2);
+
+    ASSERT_TRUE(s, sai_serialize_fdb_entry(fe2));
+
+    // neighbor entry
+
+    sai_neighbor_entry_t ne;
+
+    memset(&ne, 0, sizeof(ne));
+
+    ne.switch_id = 0x21000000000000;
+    ne.rif_id = 0x6000000000001;
+    ne.ip_address.addr_family = SAI_IP_ADDR_FAMILY_IPV6;
+    inet_pton(AF_INET6, "fe80::1", ne.ip_address.addr.ip6);
+
+    s = sai_serialize_neighbor_entry(ne);
+
+    ASSERT_TRUE(s, "{\"ip\":\"fe80::1\",\"rif\":\"oid:0x6000000000001\",\"switch_id\":\"oid:0x21000000000000\"}");
+
+    sai_neighbor_entry_t ne2;
+
+    memset(&ne2, 0, sizeof(ne2));
+
+    sai_deserialize_neighbor_entry(s, ne2);
+
+    ASSERT_TRUE(s, sai_serialize_neighbor_entry(ne2));
+}
+
 void test_serialize_bool()
 {
     SWSS_LOG_ENTER();
@@ -3986,6 +4251,84 @@ void test_serialize_qos_map()
     ASSERT_TRUE(l.value.color, SAI_PACKET_COLOR_GREEN);
 }
 
+void test_serialize_attr_list_binary()
+{
+    SWSS_LOG_ENTER();
+
+    clear_local();
+    meta_init_db();
+
+    uint32_t lanes[] = { 1, 2, 3, 4 };
+
+    sai_attribute_t attrs[4];
+
+    attrs[0].id = SAI_PORT_ATTR_HW_LANE_LIST;
+    attrs[0].value.u32list.count = 4;
+    attrs[0].value.u32list.list = lanes;
+
+    attrs[1].id = SAI_PORT_ATTR_SPEED;
+    attrs[1].value.u32 = 100000;
+
+    attrs[2].id = SAI_PORT_ATTR_ADMIN_STATE;
+    attrs[2].value.booldata = true;
+
+    attrs[3].id = SAI_PORT_ATTR_FEC_MODE;
+    attrs[3].value.s32 = SAI_PORT_FEC_MODE_RS;
+
+    std::string s;
+
+    if (!sai_serialize_attr_list_binary(SAI_OBJECT_TYPE_PORT, 4, attrs, s))
+    {
+        ASSERT_FAIL("binary serialize failed");
+    }
+
+    std::vector<sai_attribute_t> list;
+    std::vector<sai_attr_value_type_t> types;
+
+    sai_deserialize_attr_list_binary(s, SAI_OBJECT_TYPE_PORT, list, types);
+
+    ASSERT_TRUE(list.size(), 4);
+
+    for (size_t idx = 0; idx < list.size(); idx++)
+    {
+        auto meta = sai_metadata_get_attr_metadata(SAI_OBJECT_TYPE_PORT, attrs[idx].id);
+
+        ASSERT_TRUE(list[idx].id, attrs[idx].id);
+        ASSERT_TRUE(types[idx], meta->attrvaluetype);
+
+        // text form must be the same as if attribute was sent as text
+
+        ASSERT_TRUE(sai_serialize_attr_value(*meta, list[idx]), sai_serialize_attr_value(*meta, attrs[idx]));
+
+        sai_deserialize_free_attribute_value(types[idx], list[idx]);
+    }
+
+    // object type must match
+
+    try
+    {
+        list.clear();
+        types.clear();
+
+        sai_deserialize_attr_list_binary(s, SAI_OBJECT_TYPE_VLAN, list, types);
+
+        ASSERT_FAIL("object type mismatch was not detected");
+    }
+    catch (const std::runtime_error&)
+    {
+        // ok
+    }
+
+    // count only list can't be sent in binary form
+
+    attrs[0].value.u32list.list = NULL;
+
+    if (sai_serialize_attr_list_binary(SAI_OBJECT_TYPE_PORT, 4, attrs, s))
+    {
+        ASSERT_FAIL("count only list serialized in binary form");
+    }
+}
+
 template<typename T>
 void deserialize_number(
         _In_ const std::string& s,
@@ -4090,6 +4433,8 @@ int main()
     test_serialize_oid_list();
     test_serialize_acl_action();
     test_serialize_qos_map();
+    test_serialize_entry_keys();
+    test_serialize_attr_list_binary();
 
     // attributes tests
 
@@ -4101,6 +4446,7 @@ int main()
     test_fdb_entry_set();
     test_fdb_entry_get();
     test_fdb_entry_flow();
+    test_fdb_flush_candidates();
 
     test_neighbor_entry_create();
     test_neighbor_entry_remove();
@@ -4130,6 +4476,7 @@ int main()
     test_acl_entry_field_and_action();
     test_construct_key();
     test_queue_create();
+    test_keyed_object_create_perf();
     test_null_list();
 
     test_numbers();
@@ -824,6 +824,11 @@ void performNotifySyncd(const std::string& request, const std::string response)
     {
         attr.value.s32 = SAI_REDIS_NOTIFY_SYNCD_APPLY_VIEW;
     }
+    else if (requestAction == SYNCD_ENABLE_BINARY_ATTRIBUTES)
+    {
+        attr.id = SAI_REDIS_SWITCH_ATTR_USE_BINARY_ATTRIBUTES;
+        attr.value.booldata = true;
+    }
     else
     {
         SWSS_LOG_THROW("invalid syncd notify request: %s", request.c_str());
@@ -0,0 +1,181 @@
+#pragma once
+
+extern "C" {
+#include <sai.h>
+}
+
+#include "swss/logger.h"
+
+#include <atomic>
+#include <memory>
+#include <cstdint>
+
+/**
+ * @brief Bounded lock free queue.
+ *
+ * Queue can be used by many producers and many consumers at the same time.
+ * Each cell holds sequence number, cell is free for position pos when its
+ * sequence equals pos and it holds item for position pos when its sequence
+ * is pos + 1, so producers and consumers only synchronize on position
+ * counters and cell sequence.
+ *
+ * Capacity is rounded up to power of two.
+ */
+template <typename T>
+class BoundedQueue
+{
+    public:
+
+        BoundedQueue(
+                _In_ size_t size):
+            m_enqueuePos(0),
+            m_dequeuePos(0)
+        {
+            SWSS_LOG_ENTER();
+
+            size_t capacity = 1;
+
+            while (capacity < size)
+            {
+                capacity <<= 1;
+            }
+
+            m_cells.reset(new Cell[capacity]);
+
+            for (size_t idx = 0; idx < capacity; idx++)
+            {
+                m_cells[idx].sequence.store(idx, std::memory_order_relaxed);
+            }
+
+            m_mask = capacity - 1;
+        }
+
+        virtual ~BoundedQueue() = default;
+
+    public:
+
+        /**
+         * @brief Push item to queue.
+         *
+         * @return False if queue is full.
+         */
+        bool push(
+                _In_ const T& item)
+        {
+            SWSS_LOG_ENTER();
+
+            size_t pos = m_enqueuePos.load(std::memory_order_relaxed);
+
+            Cell* cell;
+
+            while (true)
+            {
+                cell = &m_cells[pos & m_mask];
+
+                size_t seq = cell->sequence.load(std::memory_order_acquire);
+
+                intptr_t diff = (intptr_t)seq - (intptr_t)pos;
+
+                if (diff == 0)
+                {
+                    if (m_enqueuePos.compare_exchange_weak(pos, pos + 1, std::memory_order_relaxed))
+                    {
+                        break;
+                    }
+                }
+                else if (diff < 0)
+                {
+                    return false;
+                }
+                else
+                {
+                    pos = m_enqueuePos.load(std::memory_order_relaxed);
+                }
+            }
+
+            cell->item = item;
+
+            cell->sequence.store(pos + 1, std::memory_order_release);
+
+            return true;
+        }
+
+        /**
+         * @brief Pop item from queue.
+         *
+         * @return False if queue is empty.
+         */
+        bool pop(
+                _Out_ T& item)
+        {
+            SWSS_LOG_ENTER();
+
+            size_t pos = m_dequeuePos.load(std::memory_order_relaxed);
+
+            Cell* cell;
+
+            while (true)
+            {
+                cell = &m_cells[pos & m_mask];
+
+                size_t seq = cell->sequence.load(std::memory_order_acquire);
+
+                intptr_t diff = (intptr_t)seq - (intptr_t)(pos + 1);
+
+                if (diff == 0)
+                {
+                    if (m_dequeuePos.compare_exchange_weak(pos, pos + 1, std::memory_order_relaxed))
+                    {
+                        break;
+                    }
+                }
+                else if (diff < 0)
+                {
+                    return false;
+                }
+                else
+                {
+                    pos = m_dequeuePos.load(std::memory_order_relaxed);
+                }
+            }
+
+            item = cell->item;
+
+            cell->sequence.store(pos + m_mask + 1, std::memory_order_release);
+
+            return true;
+        }
+
+        /**
+         * @brief Number of claimed positions not yet consumed.
+         *
+         * Includes items which producers are still writing, so when this
+         * returns zero, all pushed items were consumed.
+         */
+        size_t size() const
+        {
+            SWSS_LOG_ENTER();
+
+            size_t dequeuePos = m_dequeuePos.load(std::memory_order_acquire);
+            size_t enqueuePos = m_enqueuePos.load(std::memory_order_acquire);
+
+            return (enqueuePos >= dequeuePos) ? (enqueuePos - dequeuePos) : 0;
+        }
+
+    private:
+
+        struct Cell
+        {
+            std::atomic<size_t> sequence;
+
+            T item;
+        };
+
+        std::unique_ptr<Cell[]> m_cells;
+
+        size_t m_mask;
+
+        std::atomic<size_t> m_enqueuePos;
+
+        std::atomic<size_t> m_dequeuePos;
+};
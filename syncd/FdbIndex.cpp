@@ -0,0 +1,245 @@
+#include "FdbIndex.h"
+
+#include "swss/logger.h"
+
+void FdbIndex::insert(
+        _In_ const std::string& key,
+        _In_ sai_object_id_t bvId,
+        _In_ uint32_t attr_count,
+        _In_ const sai_attribute_t *attr_list)
+{
+    SWSS_LOG_ENTER();
+
+    auto it = m_entries.find(key);
+
+    if (it == m_entries.end())
+    {
+        Entry entry;
+
+        entry.bvId = bvId;
+        entry.bridgePortId = SAI_NULL_OBJECT_ID;
+
+        int unknown = -1;
+        entry.type = (sai_fdb_entry_type_t)unknown;
+
+        it = m_entries.emplace(key, entry).first;
+
+        indexInsert(m_byBvId, bvId, key);
+    }
+    else if (it->second.bvId != bvId)
+    {
+        indexRemove(m_byBvId, it->second.bvId, key);
+
+        it->second.bvId = bvId;
+
+        indexInsert(m_byBvId, bvId, key);
+    }
+
+    for (uint32_t idx = 0; idx < attr_count; idx++)
+    {
+        applyAttribute(key, it->second, attr_list[idx]);
+    }
+}
+
+void FdbIndex::set(
+        _In_ const std::string& key,
+        _In_ const sai_attribute_t& attr)
+{
+    SWSS_LOG_ENTER();
+
+    auto it = m_entries.find(key);
+
+    if (it == m_entries.end())
+    {
+        SWSS_LOG_WARN("fdb entry %s is not indexed", key.c_str());
+        return;
+    }
+
+    applyAttribute(key, it->second, attr);
+}
+
+void FdbIndex::remove(
+        _In_ const std::string& key)
+{
+    SWSS_LOG_ENTER();
+
+    auto it = m_entries.find(key);
+
+    if (it == m_entries.end())
+    {
+        return;
+    }
+
+    indexRemove(m_byBvId, it->second.bvId, key);
+    indexRemove(m_byBridgePort, it->second.bridgePortId, key);
+
+    m_entries.erase(it);
+}
+
+void FdbIndex::clear()
+{
+    SWSS_LOG_ENTER();
+
+    m_entries.clear();
+    m_byBvId.clear();
+    m_byBridgePort.clear();
+}
+
+size_t FdbIndex::size() const
+{
+    SWSS_LOG_ENTER();
+
+    return m_entries.size();
+}
+
+std::vector<std::string> FdbIndex::getFlushKeys(
+        _In_ sai_object_id_t bvId,
+        _In_ sai_object_id_t bridgePortId,
+        _In_ bool flushStatic) const
+{
+    SWSS_LOG_ENTER();
+
+    std::vector<std::string> keys;
+
+    if (bvId == SAI_NULL_OBJECT_ID && bridgePortId == SAI_NULL_OBJECT_ID)
+    {
+        for (const auto& kvp: m_entries)
+        {
+            if (matches(kvp.second, bvId, bridgePortId, flushStatic))
+            {
+                keys.push_back(kvp.first);
+            }
+        }
+
+        return keys;
+    }
+
+    /*
+     * Start from the smallest index matching flush event, remaining
+     * conditions are checked on each candidate.
+     */
+
+    const KeySet* candidates = nullptr;
+
+    if (bridgePortId != SAI_NULL_OBJECT_ID)
+    {
+        candidates = &indexGet(m_byBridgePort, bridgePortId);
+    }
+
+    if (bvId != SAI_NULL_OBJECT_ID)
+    {
+        const KeySet& byBvId = indexGet(m_byBvId, bvId);
+
+        if (candidates == nullptr || byBvId.size() < candidates->size())
+        {
+            candidates = &byBvId;
+        }
+    }
+
+    for (const auto& key: *candidates)
+    {
+        if (matches(m_entries.at(key), bvId, bridgePortId, flushStatic))
+        {
+            keys.push_back(key);
+        }
+    }
+
+    return keys;
+}
+
+void FdbIndex::applyAttribute(
+        _In_ const std::string& key,
+        _Inout_ Entry& entry,
+        _In_ const sai_attribute_t& attr)
+{
+    SWSS_LOG_ENTER();
+
+    switch (attr.id)
+    {
+        case SAI_FDB_ENTRY_ATTR_BRIDGE_PORT_ID:
+
+            if (entry.bridgePortId != attr.value.oid)
+            {
+                indexRemove(m_byBridgePort, entry.bridgePortId, key);
+
+                entry.bridgePortId = attr.value.oid;
+
+                indexInsert(m_byBridgePort, entry.bridgePortId, key);
+            }
+
+            break;
+
+        case SAI_FDB_ENTRY_ATTR_TYPE:
+
+            entry.type = (sai_fdb_entry_type_t)attr.value.s32;
+            break;
+
+        default:
+            break;
+    }
+}
+
+void FdbIndex::indexInsert(
+        _Inout_ KeyIndex& index,
+        _In_ sai_object_id_t id,
+        _In_ const std::string& key)
+{
+    SWSS_LOG_ENTER();
+
+    if (id != SAI_NULL_OBJECT_ID)
+    {
+        index[id].insert(key);
+    }
+}
+
+void FdbIndex::indexRemove(
+        _Inout_ KeyIndex& index,
+        _In_ sai_object_id_t id,
+        _In_ const std::string& key)
+{
+    SWSS_LOG_ENTER();
+
+    auto it = index.find(id);
+
+    if (it == index.end())
+    {
+        return;
+    }
+
+    it->second.erase(key);
+
+    if (it->second.empty())
+    {
+        index.erase(it);
+    }
+}
+
+const FdbIndex::KeySet& FdbIndex::indexGet(
+        _In_ const KeyIndex& index,
+        _In_ sai_object_id_t id)
+{
+    SWSS_LOG_ENTER();
+
+    static const KeySet empty;
+
+    auto it = index.find(id);
+
+    return (it == index.end()) ? empty : it->second;
+}
+
+bool FdbIndex::matches(
+        _In_ const Entry& entry,
+        _In_ sai_object_id_t bvId,
+        _In_ sai_object_id_t bridgePortId,
+        _In_ bool flushStatic) const
+{
+    SWSS_LOG_ENTER();
+
+    if (bvId != SAI_NULL_OBJECT_ID && entry.bvId != bvId)
+        return false;
+
+    if (bridgePortId != SAI_NULL_OBJECT_ID && entry.bridgePortId != bridgePortId)
+        return false;
+
+    return flushStatic || entry.type == SAI_FDB_ENTRY_TYPE_DYNAMIC;
+}
@@ -0,0 +1,121 @@
+#pragma once
+
+extern "C" {
+#include <sai.h>
+}
+
+#include <string>
+#include <vector>
+#include <unordered_map>
+#include <unordered_set>
+
+/**
+ * @brief In memory index of FDB entries present in ASIC_STATE.
+ *
+ * Entries are indexed by redis key and additionally grouped by bv_id and by
+ * bridge port, so FDB flush event can compute exact set of keys to remove
+ * without scanning whole ASIC view in redis.
+ *
+ * All OIDs held by index are VIDs. Class is not thread safe, all callers are
+ * expected to hold g_mutex.
+ */
+class FdbIndex
+{
+    public:
+
+        FdbIndex() = default;
+
+        virtual ~FdbIndex() = default;
+
+    public:
+
+        /**
+         * @brief Insert or update FDB entry.
+         *
+         * When entry already exists, its bv_id is updated and only
+         * attributes present on the list are applied.
+         */
+        void insert(
+                _In_ const std::string& key,
+                _In_ sai_object_id_t bvId,
+                _In_ uint32_t attr_count,
+                _In_ const sai_attribute_t *attr_list);
+
+        /**
+         * @brief Apply attribute to existing FDB entry.
+         *
+         * Does nothing if entry is not present in index.
+         */
+        void set(
+                _In_ const std::string& key,
+                _In_ const sai_attribute_t& attr);
+
+        void remove(
+                _In_ const std::string& key);
+
+        void clear();
+
+        size_t size() const;
+
+        /**
+         * @brief Get keys of FDB entries matching flush event.
+         *
+         * Null bv_id or bridge port matches any value. When static entries
+         * are not flushed only dynamic entries are returned, otherwise all
+         * matching entries are returned (same semantics as former fdb_flush.lua).
+         */
+        std::vector<std::string> getFlushKeys(
+                _In_ sai_object_id_t bvId,
+                _In_ sai_object_id_t bridgePortId,
+                _In_ bool flushStatic) const;
+
+    private:
+
+        typedef std::unordered_set<std::string> KeySet;
+
+        typedef std::unordered_map<sai_object_id_t, KeySet> KeyIndex;
+
+        struct Entry
+        {
+            sai_object_id_t bvId;
+
+            sai_object_id_t bridgePortId;
+
+            sai_fdb_entry_type_t type;
+        };
+
+        typedef std::unordered_map<std::string, Entry> EntryMap;
+
+        void applyAttribute(
+                _In_ const std::string& key,
+                _Inout_ Entry& entry,
+                _In_ const sai_attribute_t& attr);
+
+        static void indexInsert(
+                _Inout_ KeyIndex& index,
+                _In_ sai_object_id_t id,
+                _In_ const std::string& key);
+
+        static void indexRemove(
+                _Inout_ KeyIndex& index,
+                _In_ sai_object_id_t id,
+                _In_ const std::string& key);
+
+        static const KeySet& indexGet(
+                _In_ const KeyIndex& index,
+                _In_ sai_object_id_t id);
+
+        bool matches(
+                _In_ const Entry& entry,
+                _In_ sai_object_id_t bvId,
+                _In_ sai_object_id_t bridgePortId,
+                _In_ bool flushStatic) const;
+
+    private:
+
+        EntryMap m_entries;
+
+        KeyIndex m_byBvId;
+
+        KeyIndex m_byBridgePort;
+};
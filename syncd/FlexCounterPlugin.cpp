@@ -0,0 +1,18 @@
+#include "FlexCounterPlugin.h"
+#include "PortRatesPlugin.h"
+
+#include "swss/logger.h"
+
+std::shared_ptr<FlexCounterPlugin> FlexCounterPlugin::create(
+        _In_ const std::string& name,
+        _In_ sai_object_type_t objectType)
+{
+    SWSS_LOG_ENTER();
+
+    if (name == PORT_RATES_PLUGIN_NAME && objectType == SAI_OBJECT_TYPE_PORT)
+    {
+        return std::make_shared<PortRatesPlugin>();
+    }
+
+    return nullptr;
+}
@@ -0,0 +1,79 @@
+#pragma once
+
+extern "C" {
+#include <sai.h>
+}
+
+#include "swss/dbconnector.h"
+#include "swss/redispipeline.h"
+#include "swss/table.h"
+
+#include <string>
+#include <vector>
+#include <memory>
+
+/**
+ * @brief Counters of single object collected in current poll cycle.
+ */
+typedef struct _flex_counter_values_t
+{
+    // Serialized VID, key of object in counters table
+    const std::string *vid;
+
+    // Counter names and serialized values
+    const std::vector<swss::FieldValueTuple> *values;
+
+    // Counter values, in the same order as values
+    const std::vector<uint64_t> *stats;
+
+} flex_counter_values_t;
+
+/**
+ * @brief Counter plugin executed inside syncd.
+ *
+ * Native plugins are alternative to Lua plugins executed by redis. They are
+ * registered by name using the same group plugin fields as Lua scripts SHA,
+ * and they work on counters already collected in memory, so they don't read
+ * counters back from redis.
+ *
+ * Plugin is executed by flex counter thread after all counters of the cycle
+ * were collected, only for objects successfully polled in that cycle.
+ */
+class FlexCounterPlugin
+{
+    public:
+
+        FlexCounterPlugin() = default;
+
+        virtual ~FlexCounterPlugin() = default;
+
+    public:
+
+        /**
+         * @brief Create native plugin.
+         *
+         * @param name Plugin name, as passed in plugin group field.
+         * @param objectType Object type of the plugin group field.
+         *
+         * @return Plugin instance or nullptr when there is no native plugin
+         * with given name for given object type.
+         */
+        static std::shared_ptr<FlexCounterPlugin> create(
+                _In_ const std::string& name,
+                _In_ sai_object_type_t objectType);
+
+    public:
+
+        virtual sai_object_type_t getObjectType() const = 0;
+
+        /**
+         * @brief Process counters of objects polled in current cycle.
+         *
+         * Results are expected to be written through given pipeline, which is
+         * flushed after all plugins were executed.
+         */
+        virtual void run(
+                _In_ const std::vector<flex_counter_values_t>& objects,
+                _In_ swss::DBConnector& db,
+                _In_ swss::RedisPipeline& pipeline) = 0;
+};
@@ -0,0 +1,100 @@
+#include "Notification.h"
+
+#include "meta/sai_serialize.h"
+
+#include "swss/logger.h"
+
+void Notification::clear()
+{
+    SWSS_LOG_ENTER();
+
+    m_name.clear();
+    m_data.clear();
+    m_fdbEvents.clear();
+    m_fdbAttrs.clear();
+    m_portStates.clear();
+}
+
+void Notification::setSerialized(
+        _In_ const std::string& name,
+        _In_ const std::string& data)
+{
+    SWSS_LOG_ENTER();
+
+    clear();
+
+    m_name = name;
+    m_data = data;
+}
+
+void Notification::setFdbEvent(
+        _In_ uint32_t count,
+        _In_ const sai_fdb_event_notification_data_t* data)
+{
+    SWSS_LOG_ENTER();
+
+    if (data == NULL && count)
+    {
+        SWSS_LOG_THROW("fdb event data pointer is null");
+    }
+
+    clear();
+
+    m_name = "fdb_event";
+
+    m_fdbEvents.assign(data, data + count);
+
+    for (uint32_t idx = 0; idx < count; idx++)
+    {
+        if (data[idx].attr_count)
+        {
+            m_fdbAttrs.insert(m_fdbAttrs.end(), data[idx].attr, data[idx].attr + data[idx].attr_count);
+        }
+    }
+
+    // attributes are in place now, so vector will not be reallocated
+
+    size_t offset = 0;
+
+    for (auto& fdb: m_fdbEvents)
+    {
+        fdb.attr = fdb.attr_count ? &m_fdbAttrs[offset] : NULL;
+
+        offset += fdb.attr_count;
+    }
+}
+
+void Notification::setPortStateChange(
+        _In_ uint32_t count,
+        _In_ const sai_port_oper_status_notification_t* data)
+{
+    SWSS_LOG_ENTER();
+
+    if (data == NULL && count)
+    {
+        SWSS_LOG_THROW("port oper status data pointer is null");
+    }
+
+    clear();
+
+    m_name = "port_state_change";
+
+    m_portStates.assign(data, data + count);
+}
+
+std::string Notification::getData() const
+{
+    SWSS_LOG_ENTER();
+
+    if (m_fdbEvents.size())
+    {
+        return sai_serialize_fdb_event_ntf((uint32_t)m_fdbEvents.size(), m_fdbEvents.data());
+    }
+
+    if (m_portStates.size())
+    {
+        return sai_serialize_port_oper_status_ntf((uint32_t)m_portStates.size(), m_portStates.data());
+    }
+
+    return m_data;
+}
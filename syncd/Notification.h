@@ -0,0 +1,73 @@
+#pragma once
+
+extern "C" {
+#include <sai.h>
+}
+
+#include <string>
+#include <vector>
+
+/**
+ * @brief Notification received from SAI, waiting for processing.
+ *
+ * FDB events and port state changes are copied from SAI callback in binary
+ * form and serialized only once, after RID to VID translation, when they are
+ * sent to notifications channel. Other notifications carry data serialized
+ * in callback.
+ *
+ * Objects are reused by notification queue, so buffers keep their capacity
+ * between notifications.
+ */
+class Notification
+{
+    public:
+
+        Notification() = default;
+
+        virtual ~Notification() = default;
+
+        // FDB event data points to attributes owned by this object
+
+        Notification(const Notification&) = delete;
+
+        Notification& operator=(const Notification&) = delete;
+
+    public:
+
+        void clear();
+
+        void setSerialized(
+                _In_ const std::string& name,
+                _In_ const std::string& data);
+
+        /**
+         * @brief Copy FDB event data including attributes.
+         *
+         * FDB entry attributes don't contain lists, so attributes are copied
+         * by value.
+         */
+        void setFdbEvent(
+                _In_ uint32_t count,
+                _In_ const sai_fdb_event_notification_data_t* data);
+
+        void setPortStateChange(
+                _In_ uint32_t count,
+                _In_ const sai_port_oper_status_notification_t* data);
+
+        /**
+         * @brief Serialize notification data, for logging.
+         */
+        std::string getData() const;
+
+    public:
+
+        std::string m_name;
+
+        std::string m_data;
+
+        std::vector<sai_fdb_event_notification_data_t> m_fdbEvents;
+
+        std::vector<sai_attribute_t> m_fdbAttrs;
+
+        std::vector<sai_port_oper_status_notification_t> m_portStates;
+};
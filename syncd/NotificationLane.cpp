@@ -0,0 +1,161 @@
+#include "NotificationLane.h"
+
+#include "swss/logger.h"
+
+NotificationLane::NotificationLane(
+        _In_ const char *name,
+        _In_ size_t queueLimit,
+        _In_ ProcessFunction process):
+    m_name(name),
+    m_queue(std::make_shared<NotificationQueue>(queueLimit)),
+    m_process(process),
+    m_sleeping(false),
+    m_run(false)
+{
+    SWSS_LOG_ENTER();
+
+    // empty
+}
+
+NotificationLane::~NotificationLane()
+{
+    SWSS_LOG_ENTER();
+
+    stop();
+}
+
+Notification* NotificationLane::allocate()
+{
+    SWSS_LOG_ENTER();
+
+    return m_queue->allocate();
+}
+
+void NotificationLane::enqueue(
+        _In_ Notification *ntf)
+{
+    SWSS_LOG_ENTER();
+
+    if (!m_queue->enqueue(ntf))
+    {
+        return;
+    }
+
+    // queue push must be visible before sleeping flag is checked, processing
+    // thread does the opposite, so at least one of us sees the other
+
+    std::atomic_thread_fence(std::memory_order_seq_cst);
+
+    if (m_sleeping.load(std::memory_order_relaxed))
+    {
+        // processing thread checks queue under mutex before it waits, so
+        // taking the mutex here guarantees it either sees the item or is
+        // already waiting
+
+        std::lock_guard<std::mutex> lock(m_mutex);
+
+        m_cv.notify_all();
+    }
+}
+
+void NotificationLane::start()
+{
+    SWSS_LOG_ENTER();
+
+    std::lock_guard<std::mutex> lock(m_mutex);
+
+    if (m_thread != nullptr)
+    {
+        return;
+    }
+
+    m_run = true;
+
+    m_thread = std::make_shared<std::thread>(&NotificationLane::processingThread, this);
+}
+
+void NotificationLane::stop()
+{
+    SWSS_LOG_ENTER();
+
+    std::shared_ptr<std::thread> thread;
+
+    {
+        std::lock_guard<std::mutex> lock(m_mutex);
+
+        m_run = false;
+
+        m_cv.notify_all();
+
+        thread = std::move(m_thread);
+    }
+
+    if (thread != nullptr)
+    {
+        thread->join();
+    }
+}
+
+void NotificationLane::processingThread()
+{
+    SWSS_LOG_ENTER();
+
+    SWSS_LOG_NOTICE("starting %s notification lane", m_name);
+
+    std::vector<Notification*> batch;
+
+    batch.reserve(NOTIFICATION_PROCESSING_BATCH_SIZE);
+
+    while (true)
+    {
+        {
+            std::unique_lock<std::mutex> ulock(m_mutex);
+
+            m_sleeping.store(true, std::memory_order_relaxed);
+
+            std::atomic_thread_fence(std::memory_order_seq_cst);
+
+            m_cv.wait(ulock, [&] { return !m_run || m_queue->getQueueSize(); });
+
+            m_sleeping.store(false, std::memory_order_relaxed);
+
+            if (!m_run)
+            {
+                break;
+            }
+        }
+
+        // this is notifications processing thread context, which is different
+        // from SAI notifications context, lane processing function takes
+        // g_mutex only for RID to VID translation and ASIC view updates, which
+        // are shared with processing main events, counters and reinit; lane
+        // mutex is not held, so callbacks are not blocked by processing
+
+        do
+        {
+            batch.clear();
+
+            Notification *item;
+
+            while (batch.size() < NOTIFICATION_PROCESSING_BATCH_SIZE && m_queue->tryDequeue(item))
+            {
+                batch.push_back(item);
+            }
+
+            if (batch.empty())
+            {
+                break;
+            }
+
+            m_process(batch);
+
+            for (auto ntf: batch)
+            {
+                m_queue->release(ntf);
+            }
+        }
+        while (batch.size() == NOTIFICATION_PROCESSING_BATCH_SIZE);
+    }
+
+    SWSS_LOG_NOTICE("%s notification lane ended", m_name);
+}
@@ -0,0 +1,93 @@
+#pragma once
+
+extern "C" {
+#include <sai.h>
+}
+
+#include "NotificationQueue.h"
+
+#include <vector>
+#include <memory>
+#include <thread>
+#include <mutex>
+#include <atomic>
+#include <condition_variable>
+
+/**
+ * @brief Number of notifications taken from lane queue at once.
+ *
+ * FDB events of whole batch are translated under single g_mutex hold, and
+ * their ASIC view writes are flushed before g_mutex is released.
+ */
+#define NOTIFICATION_PROCESSING_BATCH_SIZE (1024)
+
+/**
+ * @brief Notification processing lane.
+ *
+ * Each lane has its own queue and single processing thread, so notifications
+ * of the same lane are processed in the order they arrived, which keeps order
+ * of notifications of each switch. Port and switch state notifications use
+ * fast lane, so they are not delayed by FDB event bursts processed in bulk
+ * lane.
+ */
+class NotificationLane
+{
+    public:
+
+        typedef void (*ProcessFunction)(const std::vector<Notification*>&);
+
+        NotificationLane(
+                _In_ const char *name,
+                _In_ size_t queueLimit,
+                _In_ ProcessFunction process);
+
+        virtual ~NotificationLane();
+
+    public:
+
+        /**
+         * @brief Get empty notification object from lane queue pool.
+         */
+        Notification* allocate();
+
+        /**
+         * @brief Enqueue notification and wake up processing thread if it's
+         * sleeping, queue push itself is lock free.
+         */
+        void enqueue(
+                _In_ Notification *ntf);
+
+        void start();
+
+        /**
+         * @brief Stop processing thread, notifications still queued are not
+         * processed.
+         */
+        void stop();
+
+    private:
+
+        void processingThread();
+
+    private:
+
+        const char *m_name;
+
+        std::shared_ptr<NotificationQueue> m_queue;
+
+        ProcessFunction m_process;
+
+        // condition variable will be used to notify processing thread
+        // that some notification arrived; callbacks push to queue without
+        // lock and take mutex only when processing thread is sleeping
+
+        std::mutex m_mutex;
+
+        std::condition_variable m_cv;
+
+        std::atomic<bool> m_sleeping;
+
+        bool m_run;
+
+        std::shared_ptr<std::thread> m_thread;
+};
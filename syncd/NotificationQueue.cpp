@@ -1,73 +1,163 @@
 #include "NotificationQueue.h"
 
+#include "meta/sai_serialize.h"
+
 #define NOTIFICATION_QUEUE_DROP_COUNT_INDICATOR (1000)
 
+#define NOTIFICATION_QUEUE_COALESCED_COUNT_INDICATOR (10000)
+
 NotificationQueue::NotificationQueue(
         _In_ size_t queueLimit):
+    m_queue(queueLimit + NOTIFICATION_QUEUE_RESERVED_SIZE),
+    m_pool(NOTIFICATION_POOL_SIZE),
     m_queueSizeLimit(queueLimit),
-    m_dropCount(0)
+    m_dropCount(0),
+    m_coalescedSize(0),
+    m_coalescedCount(0)
 {
     SWSS_LOG_ENTER();
 
-    // empty;
+    // empty
 }
 
 NotificationQueue::~NotificationQueue()
 {
     SWSS_LOG_ENTER();
 
-    // empty
+    Notification* item;
+
+    while (m_queue.pop(item))
+    {
+        delete item;
+    }
+
+    while (m_pool.pop(item))
+    {
+        delete item;
+    }
+
+    for (auto ptr: m_coalesced)
+    {
+        delete ptr;
+    }
+
+    for (auto ptr: m_pending)
+    {
+        delete ptr;
+    }
+}
+
+Notification* NotificationQueue::allocate()
+{
+    SWSS_LOG_ENTER();
+
+    Notification* item;
+
+    if (m_pool.pop(item))
+    {
+        return item;
+    }
+
+    return new Notification();
+}
+
+void NotificationQueue::release(
+        _In_ Notification* item)
+{
+    SWSS_LOG_ENTER();
+
+    if (item == nullptr)
+    {
+        return;
+    }
+
+    item->clear();
+
+    if (!m_pool.push(item))
+    {
+        delete item;
+    }
 }
 
 bool NotificationQueue::enqueue(
-        _In_ const swss::KeyOpFieldsValuesTuple& item)
+        _In_ Notification* item)
 {
     SWSS_LOG_ENTER();
 
+    bool isFdbEvent = item->m_name == "fdb_event"; // TODO use enum instead of strings
+
     /*
-     * If the queue exceeds the limit, then drop all further FDB events This is
-     * a temporary solution to handle high memory usage by syncd and the
-     * notification queue keeps growing. The permanent solution would be to
-     * make this stateful so that only the *latest* event is published.
+     * If the queue exceeds the limit, then FDB events are coalesced, so only
+     * the latest event of each FDB entry is kept. Once coalescing started,
+     * all FDB events are coalesced until consumer takes them, so events of
+     * the same FDB entry are not reordered.
      */
 
-    if (getQueueSize() < m_queueSizeLimit || kfvOp(item) != "fdb_event") // TODO use enum instead of strings
+    if (isFdbEvent && (m_coalescedSize > 0 || getQueueSize() >= m_queueSizeLimit))
     {
-        std::lock_guard<std::mutex> lock(m_mutex);
-
-        m_queue.push(item);
+        return coalesceFdbEvent(item);
+    }
 
+    if (m_queue.push(item))
+    {
         return true;
     }
 
-    m_dropCount++;
-
-    if (!(m_dropCount % NOTIFICATION_QUEUE_DROP_COUNT_INDICATOR))
+    if (isFdbEvent)
     {
-        SWSS_LOG_NOTICE(
-                "Too many messages in queue (%zu), dropped %zu FDB events!",
-                getQueueSize(),
-                m_dropCount);
+        return coalesceFdbEvent(item);
     }
 
+    drop(item);
+
     return false;
 }
 
 bool NotificationQueue::tryDequeue(
-        _Out_ swss::KeyOpFieldsValuesTuple& item)
+        _Out_ Notification*& item)
 {
     SWSS_LOG_ENTER();
 
-    std::lock_guard<std::mutex> lock(m_mutex);
-
-    if (m_queue.empty())
+    if (m_pending.empty())
     {
-        return false;
+        if (m_queue.pop(item))
+        {
+            return true;
+        }
+
+        if (m_coalescedSize == 0)
+        {
+            return false;
+        }
+
+        if (m_queue.size())
+        {
+            // some producer claimed slot but did not publish item yet, it
+            // will notify consumer after publishing
+
+            return false;
+        }
+
+        // queue is empty, so all events queued before coalesced ones were
+        // already processed
+
+        std::lock_guard<std::mutex> lock(m_mutex);
+
+        m_pending.swap(m_coalesced);
+
+        m_coalescedIndex.clear();
+
+        m_coalescedSize = 0;
+
+        if (m_pending.empty())
+        {
+            return false;
+        }
     }
 
-    item = m_queue.front();
+    item = m_pending.front();
 
-    m_queue.pop();
+    m_pending.pop_front();
 
     return true;
 }
@@ -76,8 +166,103 @@ size_t NotificationQueue::getQueueSize()
 {
     SWSS_LOG_ENTER();
 
+    return m_queue.size() + m_coalescedSize;
+}
+
+size_t NotificationQueue::getCoalescedCount() const
+{
+    SWSS_LOG_ENTER();
+
+    return m_coalescedCount;
+}
+
+bool NotificationQueue::coalesceFdbEvent(
+        _In_ Notification* item)
+{
+    SWSS_LOG_ENTER();
+
     std::lock_guard<std::mutex> lock(m_mutex);
 
-    return m_queue.size();
+    size_t count = item->m_fdbEvents.size();
+
+    for (size_t idx = 0; idx < count; idx++)
+    {
+        const sai_fdb_event_notification_data_t& fdb = item->m_fdbEvents[idx];
+
+        Notification* entry = item;
+
+        if (count > 1)
+        {
+            // each entry is coalesced separately
+
+            entry = allocate();
+
+            entry->setFdbEvent(1, &fdb);
+        }
+
+        if (fdb.event_type == SAI_FDB_EVENT_FLUSHED)
+        {
+            // flush may apply to many entries, events after flush can't be
+            // merged with events before it
+
+            m_coalesced.push_back(entry);
+
+            m_coalescedIndex.clear();
+
+            continue;
+        }
+
+        FdbKey key(fdb.fdb_entry.bv_id, sai_serialize_mac(fdb.fdb_entry.mac_address));
+
+        auto it = m_coalescedIndex.find(key);
+
+        if (it == m_coalescedIndex.end())
+        {
+            m_coalescedIndex[key] = m_coalesced.size();
+
+            m_coalesced.push_back(entry);
+
+            continue;
+        }
+
+        release(m_coalesced[it->second]);
+
+        m_coalesced[it->second] = entry;
+
+        if (!(++m_coalescedCount % NOTIFICATION_QUEUE_COALESCED_COUNT_INDICATOR))
+        {
+            SWSS_LOG_NOTICE(
+                    "Too many messages in queue (%zu), coalesced %zu FDB events",
+                    getQueueSize(),
+                    m_coalescedCount.load());
+        }
+    }
+
+    if (count != 1)
+    {
+        release(item);
+    }
+
+    m_coalescedSize = m_coalesced.size();
+
+    return true;
 }
 
+void NotificationQueue::drop(
+        _In_ Notification* item)
+{
+    SWSS_LOG_ENTER();
+
+    size_t dropCount = ++m_dropCount;
+
+    if (!(dropCount % NOTIFICATION_QUEUE_DROP_COUNT_INDICATOR) || dropCount == 1)
+    {
+        SWSS_LOG_NOTICE(
+                "Too many messages in queue (%zu), dropped %zu events, last %s",
+                getQueueSize(),
+                dropCount,
+                item->m_name.c_str());
+    }
+
+    release(item);
+}
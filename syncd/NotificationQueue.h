@@ -4,10 +4,14 @@ extern "C" {
 #include <sai.h>
 }
 
-#include "swss/table.h"
+#include "Notification.h"
+#include "BoundedQueue.h"
 
-#include <queue>
+#include <map>
+#include <deque>
 #include <mutex>
+#include <atomic>
+#include <utility>
 
 /**
  * @brief Default notification queue size limit.
@@ -19,6 +23,31 @@ extern "C" {
  */
 #define DEFAULT_NOTIFICATION_QUEUE_SIZE_LIMIT (300000)
 
+/**
+ * @brief Number of queue slots available only to non FDB notifications.
+ */
+#define NOTIFICATION_QUEUE_RESERVED_SIZE (0x10000)
+
+/**
+ * @brief Number of released notification objects kept for reuse.
+ */
+#define NOTIFICATION_POOL_SIZE (1024)
+
+/**
+ * @brief Notification queue between SAI callbacks and processing thread.
+ *
+ * Notifications are stored in bounded lock free queue, which can be used by
+ * many producers (SAI callbacks) and single consumer (notification
+ * processing thread). Notification objects are taken from pool by
+ * allocate() and returned by release(), so callbacks normally don't need
+ * to allocate memory.
+ *
+ * When number of queued notifications reaches the limit, FDB events are not
+ * dropped but moved to coalescing stage, where only latest event of each
+ * (bv_id, mac) is kept. Coalesced events are delivered after all events
+ * queued before them. Flush events are never merged and following events are
+ * not merged with events before the flush, so flush order is preserved.
+ */
 class NotificationQueue
 {
     public:
@@ -30,22 +59,74 @@ class NotificationQueue
 
     public:
 
+        /**
+         * @brief Get empty notification object.
+         */
+        Notification* allocate();
+
+        /**
+         * @brief Return notification object for reuse.
+         */
+        void release(
+                _In_ Notification* item);
+
+        /**
+         * @brief Enqueue notification, queue takes ownership of item.
+         *
+         * @return True if notification was queued, false if it was dropped.
+         */
         bool enqueue(
-                _In_ const swss::KeyOpFieldsValuesTuple& msg);
-
+                _In_ Notification* item);
+
+        /**
+         * @brief Take next notification from queue.
+         *
+         * Must be called only from single thread. Caller must return item by
+         * release() after processing.
+         */
         bool tryDequeue(
-                _Out_ swss::KeyOpFieldsValuesTuple& msg);
+                _Out_ Notification*& item);
 
         size_t getQueueSize();
 
+        size_t getCoalescedCount() const;
+
     private:
 
-        std::mutex m_mutex;
+        typedef std::pair<sai_object_id_t, std::string> FdbKey;
+
+        bool coalesceFdbEvent(
+                _In_ Notification* item);
 
-        std::queue<swss::KeyOpFieldsValuesTuple> m_queue;
+        void drop(
+                _In_ Notification* item);
+
+    private:
+
+        BoundedQueue<Notification*> m_queue;
+
+        BoundedQueue<Notification*> m_pool;
 
         size_t m_queueSizeLimit;
 
-        size_t m_dropCount;
-};
+        std::atomic<size_t> m_dropCount;
+
+        /*
+         * Coalescing stage, used only when queue is over the limit, so it's
+         * protected by mutex.
+         */
+
+        std::mutex m_mutex;
+
+        std::deque<Notification*> m_coalesced;
+
+        std::map<FdbKey, size_t> m_coalescedIndex;
+
+        std::atomic<size_t> m_coalescedSize;
 
+        std::atomic<size_t> m_coalescedCount;
+
+        // Coalesced events moved out by consumer, accessed only by consumer
+
+        std::deque<Notification*> m_pending;
+};
@@ -0,0 +1,219 @@
+#include "PortRatesPlugin.h"
+
+#include "meta/sai_serialize.h"
+
+#include "swss/logger.h"
+#include "swss/redisclient.h"
+
+#include <algorithm>
+
+PortRatesPlugin::PortRatesPlugin():
+    m_run(0)
+{
+    SWSS_LOG_ENTER();
+
+    m_counterIndex[sai_serialize_port_stat(SAI_PORT_STAT_IF_IN_OCTETS)] = IN_OCTETS;
+    m_counterIndex[sai_serialize_port_stat(SAI_PORT_STAT_IF_IN_UCAST_PKTS)] = IN_UCAST_PKTS;
+    m_counterIndex[sai_serialize_port_stat(SAI_PORT_STAT_IF_IN_NON_UCAST_PKTS)] = IN_NON_UCAST_PKTS;
+    m_counterIndex[sai_serialize_port_stat(SAI_PORT_STAT_IF_OUT_OCTETS)] = OUT_OCTETS;
+    m_counterIndex[sai_serialize_port_stat(SAI_PORT_STAT_IF_OUT_UCAST_PKTS)] = OUT_UCAST_PKTS;
+    m_counterIndex[sai_serialize_port_stat(SAI_PORT_STAT_IF_OUT_NON_UCAST_PKTS)] = OUT_NON_UCAST_PKTS;
+}
+
+sai_object_type_t PortRatesPlugin::getObjectType() const
+{
+    SWSS_LOG_ENTER();
+
+    return SAI_OBJECT_TYPE_PORT;
+}
+
+double PortRatesPlugin::getAlpha(
+        _In_ swss::DBConnector& db)
+{
+    SWSS_LOG_ENTER();
+
+    swss::RedisClient client(&db);
+
+    auto alpha = client.hget(std::string(PORT_RATES_TABLE) + ":" + PORT_RATES_CONFIG_KEY, PORT_RATES_ALPHA_FIELD);
+
+    if (alpha == nullptr)
+    {
+        return PORT_RATES_DEFAULT_ALPHA;
+    }
+
+    try
+    {
+        double value = std::stod(*alpha);
+
+        if (value > 0 && value <= 1)
+        {
+            return value;
+        }
+    }
+    catch (const std::exception&)
+    {
+        // fall through to default
+    }
+
+    SWSS_LOG_WARN("invalid %s value '%s', using %.2f", PORT_RATES_ALPHA_FIELD, alpha->c_str(), PORT_RATES_DEFAULT_ALPHA);
+
+    return PORT_RATES_DEFAULT_ALPHA;
+}
+
+bool PortRatesPlugin::getCounters(
+        _In_ const flex_counter_values_t& object,
+        _Out_ uint64_t counters[COUNTER_MAX]) const
+{
+    SWSS_LOG_ENTER();
+
+    const auto& values = *object.values;
+
+    bool found[COUNTER_MAX] = {};
+
+    size_t foundCount = 0;
+
+    for (size_t idx = 0; idx < values.size(); idx++)
+    {
+        auto it = m_counterIndex.find(values[idx].first);
+
+        if (it == m_counterIndex.end() || found[it->second])
+        {
+            continue;
+        }
+
+        counters[it->second] = object.stats->at(idx);
+
+        found[it->second] = true;
+
+        foundCount++;
+    }
+
+    return foundCount == COUNTER_MAX;
+}
+
+void PortRatesPlugin::run(
+        _In_ const std::vector<flex_counter_values_t>& objects,
+        _In_ swss::DBConnector& db,
+        _In_ swss::RedisPipeline& pipeline)
+{
+    SWSS_LOG_ENTER();
+
+    if (objects.empty())
+    {
+        return;
+    }
+
+    double alpha = getAlpha(db);
+
+    swss::Table ratesTable(&pipeline, PORT_RATES_TABLE, true);
+
+    updateRates(objects, alpha, std::chrono::steady_clock::now(), ratesTable);
+}
+
+void PortRatesPlugin::updateRates(
+        _In_ const std::vector<flex_counter_values_t>& objects,
+        _In_ double alpha,
+        _In_ std::chrono::steady_clock::time_point now,
+        _In_ swss::Table& ratesTable)
+{
+    SWSS_LOG_ENTER();
+
+    m_run++;
+
+    for (const auto& object: objects)
+    {
+        uint64_t counters[COUNTER_MAX];
+
+        if (!getCounters(object, counters))
+        {
+            SWSS_LOG_DEBUG("port %s doesn't poll counters needed for rates", object.vid->c_str());
+            continue;
+        }
+
+        auto it = m_ports.find(*object.vid);
+
+        if (it == m_ports.end())
+        {
+            PortState state = {};
+
+            std::copy(counters, counters + COUNTER_MAX, state.last);
+
+            state.timestamp = now;
+            state.run = m_run;
+
+            m_ports.emplace(*object.vid, state);
+            continue;
+        }
+
+        PortState& state = it->second;
+
+        double delta = std::chrono::duration<double>(now - state.timestamp).count();
+
+        bool cleared = false;
+
+        for (size_t counter = 0; counter < COUNTER_MAX; counter++)
+        {
+            cleared |= counters[counter] < state.last[counter];
+        }
+
+        if (!cleared && delta > 0)
+        {
+            double rxBps = (double)(counters[IN_OCTETS] - state.last[IN_OCTETS]) / delta;
+            double txBps = (double)(counters[OUT_OCTETS] - state.last[OUT_OCTETS]) / delta;
+
+            double rxPps = (double)((counters[IN_UCAST_PKTS] + counters[IN_NON_UCAST_PKTS]) -
+                    (state.last[IN_UCAST_PKTS] + state.last[IN_NON_UCAST_PKTS])) / delta;
+
+            double txPps = (double)((counters[OUT_UCAST_PKTS] + counters[OUT_NON_UCAST_PKTS]) -
+                    (state.last[OUT_UCAST_PKTS] + state.last[OUT_NON_UCAST_PKTS])) / delta;
+
+            if (state.ratesValid)
+            {
+                // exponential moving average, same as port_rates.lua
+                state.rxBps = alpha * rxBps + (1 - alpha) * state.rxBps;
+                state.txBps = alpha * txBps + (1 - alpha) * state.txBps;
+                state.rxPps = alpha * rxPps + (1 - alpha) * state.rxPps;
+                state.txPps = alpha * txPps + (1 - alpha) * state.txPps;
+            }
+            else
+            {
+                // first rates are stored without smoothing
+                state.rxBps = rxBps;
+                state.txBps = txBps;
+                state.rxPps = rxPps;
+                state.txPps = txPps;
+
+                state.ratesValid = true;
+            }
+
+            std::vector<swss::FieldValueTuple> values;
+
+            values.emplace_back("RX_BPS", std::to_string(state.rxBps));
+            values.emplace_back("RX_PPS", std::to_string(state.rxPps));
+            values.emplace_back("TX_BPS", std::to_string(state.txBps));
+            values.emplace_back("TX_PPS", std::to_string(state.txPps));
+
+            ratesTable.set(*object.vid, values, "");
+        }
+
+        std::copy(counters, counters + COUNTER_MAX, state.last);
+
+        state.timestamp = now;
+        state.run = m_run;
+    }
+
+    // Forget ports which were not polled in this cycle (removed or failed),
+    // rates of such port start again from scratch
+
+    for (auto it = m_ports.begin(); it != m_ports.end(); )
+    {
+        if (it->second.run != m_run)
+        {
+            it = m_ports.erase(it);
+        }
+        else
+        {
+            it++;
+        }
+    }
+}
@@ -0,0 +1,103 @@
+#pragma once
+
+#include "FlexCounterPlugin.h"
+
+#include <chrono>
+#include <unordered_map>
+
+#define PORT_RATES_PLUGIN_NAME "port_rates"
+
+#define PORT_RATES_TABLE "RATES"
+
+/**
+ * @brief Key in rates table holding port rates configuration.
+ */
+#define PORT_RATES_CONFIG_KEY "PORT"
+
+#define PORT_RATES_ALPHA_FIELD "PORT_ALPHA"
+
+#define PORT_RATES_DEFAULT_ALPHA (0.18)
+
+/**
+ * @brief Native port rates plugin.
+ *
+ * Computes RX/TX bytes and packets per second of each port, smoothed by
+ * exponential moving average with configured alpha, and writes them to
+ * RATES:<port VID> same as port_rates.lua. Previous counter values are kept
+ * in memory instead of rates table.
+ */
+class PortRatesPlugin:
+    public FlexCounterPlugin
+{
+    public:
+
+        PortRatesPlugin();
+
+        virtual ~PortRatesPlugin() = default;
+
+    public:
+
+        virtual sai_object_type_t getObjectType() const override;
+
+        virtual void run(
+                _In_ const std::vector<flex_counter_values_t>& objects,
+                _In_ swss::DBConnector& db,
+                _In_ swss::RedisPipeline& pipeline) override;
+
+        /**
+         * @brief Compute rates of objects polled at given time.
+         *
+         * Rates are written to given table, objects not present since last
+         * call are forgotten.
+         */
+        void updateRates(
+                _In_ const std::vector<flex_counter_values_t>& objects,
+                _In_ double alpha,
+                _In_ std::chrono::steady_clock::time_point now,
+                _In_ swss::Table& ratesTable);
+
+    private:
+
+        enum Counter
+        {
+            IN_OCTETS,
+            IN_UCAST_PKTS,
+            IN_NON_UCAST_PKTS,
+            OUT_OCTETS,
+            OUT_UCAST_PKTS,
+            OUT_NON_UCAST_PKTS,
+            COUNTER_MAX
+        };
+
+        struct PortState
+        {
+            uint64_t last[COUNTER_MAX];
+
+            std::chrono::steady_clock::time_point timestamp;
+
+            bool ratesValid;
+
+            uint64_t run;
+
+            double rxBps;
+            double txBps;
+            double rxPps;
+            double txPps;
+        };
+
+        double getAlpha(
+                _In_ swss::DBConnector& db);
+
+        bool getCounters(
+                _In_ const flex_counter_values_t& object,
+                _Out_ uint64_t counters[COUNTER_MAX]) const;
+
+    private:
+
+        // Counter name to index of counter needed for rates
+        std::unordered_map<std::string, size_t> m_counterIndex;
+
+        std::unordered_map<std::string, PortState> m_ports;
+
+        uint64_t m_run;
+};
@@ -0,0 +1,168 @@
+#include "RedisBatchWriter.h"
+
+#include "swss/logger.h"
+#include "swss/redisreply.h"
+
+#include <algorithm>
+
+RedisBatchWriter::RedisBatchWriter(
+        _In_ std::shared_ptr<swss::DBConnector> db,
+        _In_ size_t batchSize):
+    m_db(db),
+    m_batchSize(batchSize),
+    m_pending(0),
+    m_commandCount(0),
+    m_flushCount(0)
+{
+    SWSS_LOG_ENTER();
+
+    if (batchSize == 0)
+    {
+        SWSS_LOG_THROW("batch size must be non zero");
+    }
+}
+
+RedisBatchWriter::~RedisBatchWriter()
+{
+    SWSS_LOG_ENTER();
+
+    if (m_pending)
+    {
+        SWSS_LOG_ERROR("destroying writer with %zu pending commands, flush was not called", m_pending);
+    }
+}
+
+void RedisBatchWriter::del(
+        _In_ const std::vector<std::string>& keys)
+{
+    SWSS_LOG_ENTER();
+
+    for (size_t start = 0; start < keys.size(); start += m_batchSize)
+    {
+        size_t end = std::min(keys.size(), start + m_batchSize);
+
+        std::vector<std::string> args = { "DEL" };
+
+        args.insert(args.end(), keys.begin() + (long)start, keys.begin() + (long)end);
+
+        append(args);
+    }
+}
+
+void RedisBatchWriter::hmset(
+        _In_ const std::string& key,
+        _In_ const std::vector<swss::FieldValueTuple>& values)
+{
+    SWSS_LOG_ENTER();
+
+    if (values.empty())
+    {
+        SWSS_LOG_THROW("can't execute HMSET without values on key %s", key.c_str());
+    }
+
+    std::vector<std::string> args = { "HMSET", key };
+
+    args.reserve(2 + 2 * values.size());
+
+    for (const auto& fv: values)
+    {
+        args.push_back(fvField(fv));
+        args.push_back(fvValue(fv));
+    }
+
+    append(args);
+}
+
+void RedisBatchWriter::append(
+        _In_ const std::vector<std::string>& args)
+{
+    SWSS_LOG_ENTER();
+
+    std::vector<const char*> argv;
+    std::vector<size_t> argvlen;
+
+    argv.reserve(args.size());
+    argvlen.reserve(args.size());
+
+    for (const auto& arg: args)
+    {
+        argv.push_back(arg.c_str());
+        argvlen.push_back(arg.size());
+    }
+
+    redisContext *ctx = m_db->getContext();
+
+    if (redisAppendCommandArgv(ctx, (int)argv.size(), argv.data(), argvlen.data()) != REDIS_OK)
+    {
+        SWSS_LOG_THROW("failed to append %s command: %s", args.at(0).c_str(), ctx->errstr);
+    }
+
+    m_pending++;
+
+    if (m_pending >= m_batchSize)
+    {
+        flush();
+    }
+}
+
+void RedisBatchWriter::flush()
+{
+    SWSS_LOG_ENTER();
+
+    if (m_pending == 0)
+    {
+        return;
+    }
+
+    redisContext *ctx = m_db->getContext();
+
+    /*
+     * Read all replies even if some command failed, so connection is left
+     * in consistent state, and report first error afterwards.
+     */
+
+    std::string error;
+
+    size_t pending = m_pending;
+
+    m_pending = 0;
+
+    for (size_t idx = 0; idx < pending; idx++)
+    {
+        void *reply = NULL;
+
+        if (redisGetReply(ctx, &reply) != REDIS_OK || reply == NULL)
+        {
+            SWSS_LOG_THROW("failed to get reply: %s", ctx->errstr);
+        }
+
+        swss::RedisReply r((redisReply*)reply);
+
+        if (r.getContext()->type == REDIS_REPLY_ERROR && error.empty())
+        {
+            error = std::string(r.getContext()->str, r.getContext()->len);
+        }
+    }
+
+    m_commandCount += pending;
+    m_flushCount++;
+
+    if (!error.empty())
+    {
+        SWSS_LOG_THROW("batch command failed: %s", error.c_str());
+    }
+}
+
+size_t RedisBatchWriter::getCommandCount() const
+{
+    SWSS_LOG_ENTER();
+
+    return m_commandCount;
+}
+
+size_t RedisBatchWriter::getFlushCount() const
+{
+    SWSS_LOG_ENTER();
+
+    return m_flushCount;
+}
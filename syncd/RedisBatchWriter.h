@@ -0,0 +1,85 @@
+#pragma once
+
+extern "C" {
+#include <sai.h>
+}
+
+#include "swss/dbconnector.h"
+#include "swss/table.h"
+
+#include <string>
+#include <vector>
+#include <memory>
+
+/**
+ * @brief Default number of commands sent to redis before replies are read.
+ */
+#define REDIS_BATCH_WRITER_DEFAULT_BATCH_SIZE (1000)
+
+/**
+ * @brief Pipelined redis writer.
+ *
+ * Write commands are appended to connection output buffer and replies are
+ * read only when batch is full or on explicit flush, so each batch costs
+ * single round trip to redis instead of one per command.
+ *
+ * Writer uses connection of given database directly, so all commands must be
+ * flushed before this connection is used by any other redis client.
+ */
+class RedisBatchWriter
+{
+    public:
+
+        RedisBatchWriter(
+                _In_ std::shared_ptr<swss::DBConnector> db,
+                _In_ size_t batchSize = REDIS_BATCH_WRITER_DEFAULT_BATCH_SIZE);
+
+        virtual ~RedisBatchWriter();
+
+    public:
+
+        /**
+         * @brief Delete keys, each batch of keys is removed by single DEL.
+         */
+        void del(
+                _In_ const std::vector<std::string>& keys);
+
+        /**
+         * @brief Set all given fields of hash using single HMSET.
+         */
+        void hmset(
+                _In_ const std::string& key,
+                _In_ const std::vector<swss::FieldValueTuple>& values);
+
+        /**
+         * @brief Send pending commands and check their replies.
+         */
+        void flush();
+
+        /**
+         * @brief Get number of commands executed so far.
+         */
+        size_t getCommandCount() const;
+
+        /**
+         * @brief Get number of round trips to redis so far.
+         */
+        size_t getFlushCount() const;
+
+    private:
+
+        void append(
+                _In_ const std::vector<std::string>& args);
+
+    private:
+
+        std::shared_ptr<swss::DBConnector> m_db;
+
+        size_t m_batchSize;
+
+        size_t m_pending;
+
+        size_t m_commandCount;
+
+        size_t m_flushCount;
+};
@@ -0,0 +1,126 @@
+#include "WorkerPool.h"
+
+#include "swss/logger.h"
+
+WorkerPool::WorkerPool(
+        _In_ size_t workers):
+    m_generation(0),
+    m_pending(0),
+    m_stop(false)
+{
+    SWSS_LOG_ENTER();
+
+    if (workers == 0)
+    {
+        SWSS_LOG_THROW("worker count must be non zero");
+    }
+
+    for (size_t idx = 0; idx < workers; idx++)
+    {
+        m_threads.push_back(std::make_shared<std::thread>(&WorkerPool::workerThread, this, idx));
+    }
+}
+
+WorkerPool::~WorkerPool()
+{
+    SWSS_LOG_ENTER();
+
+    {
+        std::lock_guard<std::mutex> lock(m_mutex);
+
+        m_stop = true;
+    }
+
+    m_runCond.notify_all();
+
+    for (auto& thread: m_threads)
+    {
+        thread->join();
+    }
+}
+
+void WorkerPool::run(
+        _In_ const Task& task)
+{
+    SWSS_LOG_ENTER();
+
+    std::unique_lock<std::mutex> lock(m_mutex);
+
+    m_task = task;
+    m_pending = m_threads.size();
+    m_exception = nullptr;
+    m_generation++;
+
+    m_runCond.notify_all();
+
+    m_doneCond.wait(lock, [&]{ return m_pending == 0; });
+
+    m_task = nullptr;
+
+    if (m_exception)
+    {
+        std::exception_ptr e = m_exception;
+
+        m_exception = nullptr;
+
+        std::rethrow_exception(e);
+    }
+}
+
+size_t WorkerPool::getWorkerCount() const
+{
+    SWSS_LOG_ENTER();
+
+    return m_threads.size();
+}
+
+void WorkerPool::workerThread(
+        _In_ size_t index)
+{
+    SWSS_LOG_ENTER();
+
+    uint64_t generation = 0;
+
+    while (true)
+    {
+        Task task;
+
+        {
+            std::unique_lock<std::mutex> lock(m_mutex);
+
+            m_runCond.wait(lock, [&]{ return m_stop || m_generation != generation; });
+
+            if (m_stop)
+            {
+                return;
+            }
+
+            generation = m_generation;
+
+            task = m_task;
+        }
+
+        std::exception_ptr exception;
+
+        try
+        {
+            task(index);
+        }
+        catch (...)
+        {
+            exception = std::current_exception();
+        }
+
+        std::lock_guard<std::mutex> lock(m_mutex);
+
+        if (exception && !m_exception)
+        {
+            m_exception = exception;
+        }
+
+        if (--m_pending == 0)
+        {
+            m_doneCond.notify_one();
+        }
+    }
+}
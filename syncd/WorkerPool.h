@@ -0,0 +1,72 @@
+#pragma once
+
+extern "C" {
+#include <sai.h>
+}
+
+#include <vector>
+#include <memory>
+#include <thread>
+#include <mutex>
+#include <condition_variable>
+#include <functional>
+#include <exception>
+
+/**
+ * @brief Fixed size pool of worker threads.
+ *
+ * Each call to run executes given task once on every worker, passing worker
+ * index, and returns when all workers finished. This allows caller to keep
+ * per worker resources (like database connections) indexed by worker.
+ *
+ * Only one run can be in progress at a time.
+ */
+class WorkerPool
+{
+    public:
+
+        typedef std::function<void(size_t)> Task;
+
+        WorkerPool(
+                _In_ size_t workers);
+
+        virtual ~WorkerPool();
+
+    public:
+
+        /**
+         * @brief Execute task on all workers and wait for completion.
+         *
+         * If task throws on any worker, first exception is rethrown after
+         * all workers finished.
+         */
+        void run(
+                _In_ const Task& task);
+
+        size_t getWorkerCount() const;
+
+    private:
+
+        void workerThread(
+                _In_ size_t index);
+
+    private:
+
+        std::vector<std::shared_ptr<std::thread>> m_threads;
+
+        std::mutex m_mutex;
+
+        std::condition_variable m_runCond;
+
+        std::condition_variable m_doneCond;
+
+        Task m_task;
+
+        uint64_t m_generation;
+
+        size_t m_pending;
+
+        bool m_stop;
+
+        std::exception_ptr m_exception;
+};
@@ -9,6 +9,7 @@
 #include "swss/warm_restart.h"
 #include "swss/table.h"
 #include "swss/redisapi.h"
+#include "swss/redisreply.h"
 
 #include "TimerWatchdog.h"
 #include "CommandLineOptionsParser.h"
@@ -17,6 +18,7 @@
 #include <iostream>
 #include <map>
 #include <unordered_map>
+#include <algorithm>
 
 #define DEF_SAI_WARM_BOOT_DATA_FILE "/var/warmboot/sai-warmboot.bin"
 #define MAX_OBJLIST_LEN 128
@@ -84,8 +86,6 @@ volatile bool g_asicInitViewMode = false;
  */
 sai_object_id_t gSwitchId;
 
-std::string fdbFlushSha;
-std::string fdbFlushLuaScriptName = "fdb_flush.lua";
 
 std::shared_ptr<CommandLineOptions> g_commandLineOptions; // TODO move to syncd object
 
@@ -110,7 +110,7 @@ void notify_OA_about_syncd_exception()
 
             SWSS_LOG_NOTICE("sending switch_shutdown_request notification to OA");
 
-            notifications->send("switch_shutdown_request", "", entry);
+            send_notification("switch_shutdown_request", "", entry);
 
             SWSS_LOG_NOTICE("notification send successfull");
         }
@@ -319,6 +319,281 @@ void remove_rid_and_vid_from_local(
     local_vid_to_rid.erase(vid);
 }
 
+/**
+ * @brief Load whole VIDTORID map from redis to local db.
+ *
+ * RIDTOVID is inverse of VIDTORID, so single HGETALL is enough to populate
+ * both local maps. After this, translations don't need to reach redis unless
+ * object was added to redis maps by other means.
+ */
+void loadRidAndVidMapsToLocal()
+{
+    SWSS_LOG_ENTER();
+
+    SWSS_LOG_TIMER("load rid and vid maps");
+
+    local_rid_to_vid.clear();
+    local_vid_to_rid.clear();
+
+    auto hash = g_redisClient->hgetall(VIDTORID);
+
+    local_rid_to_vid.reserve(hash.size());
+    local_vid_to_rid.reserve(hash.size());
+
+    for (auto &kv: hash)
+    {
+        sai_object_id_t vid;
+        sai_object_id_t rid;
+
+        sai_deserialize_object_id(kv.first, vid);
+        sai_deserialize_object_id(kv.second, rid);
+
+        save_rid_and_vid_to_local(rid, vid);
+    }
+
+    SWSS_LOG_NOTICE("loaded %zu rid and vid pairs to local db", local_vid_to_rid.size());
+}
+
+/**
+ * @brief Maximum number of RID/VID pairs updated by single transaction.
+ */
+#define RID_VID_TRANSACTION_BATCH_SIZE (1024)
+
+void redis_append_command(
+        _In_ redisContext *ctx,
+        _In_ const std::vector<std::string> &args)
+{
+    SWSS_LOG_ENTER();
+
+    std::vector<const char*> argv;
+    std::vector<size_t> argvlen;
+
+    for (const auto &arg: args)
+    {
+        argv.push_back(arg.c_str());
+        argvlen.push_back(arg.size());
+    }
+
+    if (redisAppendCommandArgv(ctx, (int)argv.size(), argv.data(), argvlen.data()) != REDIS_OK)
+    {
+        SWSS_LOG_THROW("failed to append %s command: %s", args.at(0).c_str(), ctx->errstr);
+    }
+}
+
+redisReply* redis_get_reply(
+        _In_ redisContext *ctx)
+{
+    SWSS_LOG_ENTER();
+
+    void *reply = NULL;
+
+    if (redisGetReply(ctx, &reply) != REDIS_OK || reply == NULL)
+    {
+        SWSS_LOG_THROW("failed to get reply: %s", ctx->errstr);
+    }
+
+    return (redisReply*)reply;
+}
+
+/**
+ * @brief Number of keys requested by single SCAN command.
+ */
+#define REDIS_SCAN_COUNT (10000)
+
+std::vector<std::string> redis_scan_keys(
+        _In_ const std::string &pattern)
+{
+    SWSS_LOG_ENTER();
+
+    std::vector<std::string> keys;
+
+    std::string cursor = "0";
+
+    do
+    {
+        swss::RedisCommand scan;
+
+        scan.format("SCAN %s MATCH %s COUNT %d", cursor.c_str(), pattern.c_str(), REDIS_SCAN_COUNT);
+
+        swss::RedisReply r(dbAsic.get(), scan, REDIS_REPLY_ARRAY);
+
+        redisReply *reply = r.getContext();
+
+        if (reply->elements != 2)
+        {
+            SWSS_LOG_THROW("invalid SCAN reply, expected 2 elements, got %zu", reply->elements);
+        }
+
+        cursor = std::string(reply->element[0]->str, reply->element[0]->len);
+
+        redisReply *batch = reply->element[1];
+
+        for (size_t idx = 0; idx < batch->elements; idx++)
+        {
+            keys.emplace_back(batch->element[idx]->str, batch->element[idx]->len);
+        }
+    }
+    while (cursor != "0");
+
+    /*
+     * SCAN can return same key more than once.
+     */
+
+    std::sort(keys.begin(), keys.end());
+
+    keys.erase(std::unique(keys.begin(), keys.end()), keys.end());
+
+    return keys;
+}
+
+/**
+ * @brief Update RIDTOVID and VIDTORID maps in redis.
+ *
+ * Pairs are split in batches, each batch is executed as MULTI/EXEC
+ * transaction updating both maps, so RID and VID are never visible in only
+ * one of them. All transactions are pipelined and replies are read at the
+ * end, so whole update costs single round trip to redis.
+ */
+static void redisUpdateRidAndVidPairs(
+        _In_ const std::vector<std::pair<sai_object_id_t, sai_object_id_t>> &ridVidPairs,
+        _In_ bool isRemove)
+{
+    SWSS_LOG_ENTER();
+
+    if (ridVidPairs.empty())
+    {
+        return;
+    }
+
+    redisContext *ctx = dbAsic->getContext();
+
+    size_t transactions = 0;
+
+    for (size_t start = 0; start < ridVidPairs.size(); start += RID_VID_TRANSACTION_BATCH_SIZE)
+    {
+        size_t end = std::min(ridVidPairs.size(), start + RID_VID_TRANSACTION_BATCH_SIZE);
+
+        std::vector<std::string> ridToVid = { isRemove ? "HDEL" : "HMSET", RIDTOVID };
+        std::vector<std::string> vidToRid = { isRemove ? "HDEL" : "HMSET", VIDTORID };
+
+        for (size_t idx = start; idx < end; idx++)
+        {
+            std::string strRid = sai_serialize_object_id(ridVidPairs[idx].first);
+            std::string strVid = sai_serialize_object_id(ridVidPairs[idx].second);
+
+            ridToVid.push_back(strRid);
+            vidToRid.push_back(strVid);
+
+            if (!isRemove)
+            {
+                ridToVid.push_back(strVid);
+                vidToRid.push_back(strRid);
+            }
+        }
+
+        redis_append_command(ctx, { "MULTI" });
+        redis_append_command(ctx, ridToVid);
+        redis_append_command(ctx, vidToRid);
+        redis_append_command(ctx, { "EXEC" });
+
+        transactions++;
+    }
+
+    for (size_t idx = 0; idx < transactions; idx++)
+    {
+        // MULTI and both queued commands reply with status
+
+        for (int cmd = 0; cmd < 3; cmd++)
+        {
+            swss::RedisReply r(redis_get_reply(ctx));
+
+            r.checkReplyType(REDIS_REPLY_STATUS);
+        }
+
+        swss::RedisReply exec(redis_get_reply(ctx));
+
+        exec.checkReplyType(REDIS_REPLY_ARRAY);
+
+        redisReply *reply = exec.getContext();
+
+        for (size_t e = 0; e < reply->elements; e++)
+        {
+            if (reply->element[e]->type == REDIS_REPLY_ERROR)
+            {
+                SWSS_LOG_THROW("rid and vid map update failed: %s", reply->element[e]->str);
+            }
+        }
+    }
+}
+
+/**
+ * @brief Replace binary attributes field written to ASIC_STATE by consumer
+ * table with attributes text form.
+ *
+ * Both commands are executed as single transaction in one round trip, so
+ * object is never visible without attributes.
+ */
+static void redisReplaceBinaryAttributes(
+        _In_ const std::string &key,
+        _In_ const std::vector<swss::FieldValueTuple> &values)
+{
+    SWSS_LOG_ENTER();
+
+    redisContext *ctx = dbAsic->getContext();
+
+    std::vector<std::string> hmset = { "HMSET", key };
+
+    for (const auto &v: values)
+    {
+        hmset.push_back(fvField(v));
+        hmset.push_back(fvValue(v));
+    }
+
+    redis_append_command(ctx, { "MULTI" });
+    redis_append_command(ctx, { "HDEL", key, BINARY_ATTRIBUTES_FIELD });
+    redis_append_command(ctx, hmset);
+    redis_append_command(ctx, { "EXEC" });
+
+    // MULTI and both queued commands reply with status
+
+    for (int cmd = 0; cmd < 3; cmd++)
+    {
+        swss::RedisReply r(redis_get_reply(ctx));
+
+        r.checkReplyType(REDIS_REPLY_STATUS);
+    }
+
+    swss::RedisReply exec(redis_get_reply(ctx));
+
+    exec.checkReplyType(REDIS_REPLY_ARRAY);
+
+    redisReply *reply = exec.getContext();
+
+    for (size_t e = 0; e < reply->elements; e++)
+    {
+        if (reply->element[e]->type == REDIS_REPLY_ERROR)
+        {
+            SWSS_LOG_THROW("binary attributes replace failed on %s: %s", key.c_str(), reply->element[e]->str);
+        }
+    }
+}
+
+void redisSetRidAndVidPairs(
+        _In_ const std::vector<std::pair<sai_object_id_t, sai_object_id_t>> &ridVidPairs)
+{
+    SWSS_LOG_ENTER();
+
+    redisUpdateRidAndVidPairs(ridVidPairs, false);
+}
+
+void redisRemoveRidAndVidPairs(
+        _In_ const std::vector<std::pair<sai_object_id_t, sai_object_id_t>> &ridVidPairs)
+{
+    SWSS_LOG_ENTER();
+
+    redisUpdateRidAndVidPairs(ridVidPairs, true);
+}
+
 /*
  * This method will create VID for actual RID retrieved from device when doing
  * GET api and snooping while in init view mode.
@@ -368,6 +643,8 @@ sai_object_id_t translate_rid_to_vid(
 
         SWSS_LOG_DEBUG("translated RID 0x%" PRIx64 " to VID 0x%" PRIx64, rid, vid);
 
+        save_rid_and_vid_to_local(rid, vid);
+
         return vid;
     }
 
@@ -394,16 +671,11 @@ sai_object_id_t translate_rid_to_vid(
 
     SWSS_LOG_DEBUG("translated RID 0x%" PRIx64 " to VID 0x%" PRIx64, rid, vid);
 
-    std::string str_vid = sai_serialize_object_id(vid);
-
     /*
-     * TODO: This must be ATOMIC.
-     *
      * TODO: To support multiple switches we need this map per switch;
      */
 
-    g_redisClient->hset(RIDTOVID, str_rid, str_vid);
-    g_redisClient->hset(VIDTORID, str_vid, str_rid);
+    redisSetRidAndVidPairs({ std::make_pair(rid, vid) });
 
     save_rid_and_vid_to_local(rid, vid);
 
@@ -596,11 +868,11 @@ sai_object_id_t translate_vid_to_rid(
     sai_deserialize_object_id(str_rid, rid);
 
     /*
-     * We got this RID from redis db, so put it also to local db so it will be
-     * faster to retrieve it late on.
+     * We got this RID from redis db, so put it also to local db in both
+     * directions so it will be faster to retrieve it late on.
      */
 
-    local_vid_to_rid[vid] = rid;
+    save_rid_and_vid_to_local(rid, vid);
 
     SWSS_LOG_DEBUG("translated VID 0x%" PRIx64 " to RID 0x%" PRIx64, vid, rid);
 
@@ -981,7 +1253,9 @@ void internal_syncd_get_send(
 
 void internal_syncd_api_send_response(
         _In_ sai_common_api_t api,
-        _In_ sai_status_t status)
+        _In_ sai_status_t status,
+        _In_ uint32_t object_count = 0,
+        _In_ const sai_status_t *object_statuses = NULL)
 {
     SWSS_LOG_ENTER();
 
@@ -997,6 +1271,16 @@ void internal_syncd_api_send_response(
 
     std::vector<swss::FieldValueTuple> entry;
 
+    /*
+     * For bulk api we also send status of each object in the same order as
+     * objects were received.
+     */
+
+    for (uint32_t idx = 0; idx < object_count; ++idx)
+    {
+        entry.emplace_back(sai_serialize_status(object_statuses[idx]), "");
+    }
+
     std::string str_status = sai_serialize_status(status);
 
     SWSS_LOG_INFO("sending response for %d api with status: %s", api, str_status.c_str());
@@ -1271,8 +1555,7 @@ void post_port_remove(
         sai_object_id_t vid;
         sai_deserialize_object_id(str_vid, vid);
 
-        g_redisClient->hdel(VIDTORID, str_vid);
-        g_redisClient->hdel(RIDTOVID, str_rid);
+        redisRemoveRidAndVidPairs({ std::make_pair(rid, vid) });
 
         // remove from local vid2rid and rid2vid map
 
@@ -1413,23 +1696,15 @@ sai_status_t handle_generic(
                      * need to save virtual id's to redis db.
                      */
 
-                    std::string str_vid = sai_serialize_object_id(object_id);
-                    std::string str_rid = sai_serialize_object_id(real_object_id);
-
                     /*
-                     * TODO: This must be ATOMIC.
-                     *
                      * To support multiple switches vid/rid map must be per switch.
                      */
 
-                    {
-                        g_redisClient->hset(VIDTORID, str_vid, str_rid);
-                        g_redisClient->hset(RIDTOVID, str_rid, str_vid);
+                    redisSetRidAndVidPairs({ std::make_pair(real_object_id, object_id) });
 
-                        save_rid_and_vid_to_local(real_object_id, object_id);
-                    }
+                    save_rid_and_vid_to_local(real_object_id, object_id);
 
-                    SWSS_LOG_INFO("saved VID %s to RID %s", str_vid.c_str(), str_rid.c_str());
+                    SWSS_LOG_INFO("saved VID 0x%" PRIx64 " to RID 0x%" PRIx64, object_id, real_object_id);
 
                     if (object_type == SAI_OBJECT_TYPE_SWITCH)
                     {
@@ -1479,20 +1754,9 @@ sai_status_t handle_generic(
 
                 if (status == SAI_STATUS_SUCCESS)
                 {
-                    std::string str_vid = sai_serialize_object_id(object_id);
-                    std::string str_rid = sai_serialize_object_id(rid);
-
-                    /*
-                     * TODO: This must be ATOMIC.
-                     */
-
-                    {
+                    redisRemoveRidAndVidPairs({ std::make_pair(rid, object_id) });
 
-                        g_redisClient->hdel(VIDTORID, str_vid);
-                        g_redisClient->hdel(RIDTOVID, str_rid);
-
-                        remove_rid_and_vid_from_local(rid, object_id);
-                    }
+                    remove_rid_and_vid_from_local(rid, object_id);
 
                     // TODO remove all related objects from REDIS DB and also
                     // from existing object references since at this point
@@ -1878,6 +2142,20 @@ sai_status_t notifySyncd(
 {
     SWSS_LOG_ENTER();
 
+    if (op == SYNCD_ENABLE_BINARY_ATTRIBUTES)
+    {
+        /*
+         * Binary attributes are recognized on each message, so there is no
+         * state to change, we only confirm that they are supported.
+         */
+
+        SWSS_LOG_NOTICE("sairedis will send attributes in binary form");
+
+        sendNotifyResponse(SAI_STATUS_SUCCESS);
+
+        return SAI_STATUS_SUCCESS;
+    }
+
     if (!g_commandLineOptions->m_enableTempView)
     {
         SWSS_LOG_NOTICE("received %s, ignored since TEMP VIEW is not used, returning success", op.c_str());
@@ -1990,12 +2268,16 @@ sai_status_t notifySyncd(
         {
             /*
              * We successfully applied new view, VID mapping could change, so we
-             * need to clear local db, and all new VIDs will be queried using
-             * redis.
+             * need to reload local db from redis.
              */
 
-            local_rid_to_vid.clear();
-            local_vid_to_rid.clear();
+            loadRidAndVidMapsToLocal();
+
+            /*
+             * ASIC view was rewritten, so FDB index needs to be rebuilt.
+             */
+
+            fdbIndexRebuild();
         }
         else
         {
@@ -2307,13 +2589,10 @@ void on_switch_create_in_init_view(
         SWSS_LOG_NOTICE("created real switch VID %s to RID %s in init view mode", str_vid.c_str(), str_rid.c_str());
 
         /*
-         * TODO: This must be ATOMIC.
-         *
          * To support multiple switches vid/rid map must be per switch.
          */
 
-        g_redisClient->hset(VIDTORID, str_vid, str_rid);
-        g_redisClient->hset(RIDTOVID, str_rid, str_vid);
+        redisSetRidAndVidPairs({ std::make_pair(switch_rid, switch_vid) });
 
         save_rid_and_vid_to_local(switch_rid, switch_vid);
 
@@ -2644,18 +2923,309 @@ sai_object_id_t extractSwitchVid(
     }
 }
 
-sai_status_t handle_bulk_generic(
+/**
+ * @brief Object type and bulk api pairs for which vendor SAI bulk api
+ * returned not implemented.
+ *
+ * Vendor SAI can expose bulk api function pointer, but still return
+ * SAI_STATUS_NOT_IMPLEMENTED (like virtual switch does). When that happens we
+ * remember that, and all next bulk operations of that type will go directly
+ * to per object path.
+ */
+std::set<std::pair<sai_object_type_t, sai_common_api_t>> bulkApiNotImplemented;
+
+bool is_bulk_api_not_implemented(
+        _In_ sai_status_t status)
+{
+    SWSS_LOG_ENTER();
+
+    return status == SAI_STATUS_NOT_IMPLEMENTED || status == SAI_STATUS_NOT_SUPPORTED;
+}
+
+void get_bulk_attr_lists(
+        _In_ const std::vector<std::shared_ptr<SaiAttributeList>> &attributes,
+        _Out_ std::vector<uint32_t> &attr_counts,
+        _Out_ std::vector<const sai_attribute_t*> &attr_lists)
+{
+    SWSS_LOG_ENTER();
+
+    attr_counts.resize(attributes.size());
+    attr_lists.resize(attributes.size());
+
+    for (size_t idx = 0; idx < attributes.size(); ++idx)
+    {
+        attr_counts[idx] = attributes[idx]->get_attr_count();
+        attr_lists[idx] = attributes[idx]->get_attr_list();
+    }
+}
+
+sai_status_t handle_bulk_route_entry(
+        _In_ const std::vector<std::string> &object_ids,
+        _In_ sai_common_api_t api,
+        _In_ const std::vector<std::shared_ptr<SaiAttributeList>> &attributes,
+        _Out_ std::vector<sai_status_t> &object_statuses)
+{
+    SWSS_LOG_ENTER();
+
+    uint32_t object_count = (uint32_t)object_ids.size();
+
+    std::vector<sai_route_entry_t> entries(object_count);
+
+    for (uint32_t idx = 0; idx < object_count; ++idx)
+    {
+        sai_object_meta_key_t meta_key;
+
+        meta_key.objecttype = SAI_OBJECT_TYPE_ROUTE_ENTRY;
+
+        sai_deserialize_route_entry(object_ids[idx], meta_key.objectkey.key.route_entry);
+
+        translate_vid_to_rid_non_object_id(meta_key);
+
+        entries[idx] = meta_key.objectkey.key.route_entry;
+    }
+
+    switch (api)
+    {
+        case SAI_COMMON_API_BULK_CREATE:
+
+            {
+                if (sai_metadata_sai_route_api->create_route_entries == NULL)
+                {
+                    return SAI_STATUS_NOT_IMPLEMENTED;
+                }
+
+                std::vector<uint32_t> attr_counts;
+                std::vector<const sai_attribute_t*> attr_lists;
+
+                get_bulk_attr_lists(attributes, attr_counts, attr_lists);
+
+                return sai_metadata_sai_route_api->create_route_entries(
+                        object_count,
+                        entries.data(),
+                        attr_counts.data(),
+                        attr_lists.data(),
+                        SAI_BULK_OP_ERROR_MODE_STOP_ON_ERROR,
+                        object_statuses.data());
+            }
+
+        case SAI_COMMON_API_BULK_REMOVE:
+
+            if (sai_metadata_sai_route_api->remove_route_entries == NULL)
+            {
+                return SAI_STATUS_NOT_IMPLEMENTED;
+            }
+
+            return sai_metadata_sai_route_api->remove_route_entries(
+                    object_count,
+                    entries.data(),
+                    SAI_BULK_OP_ERROR_MODE_STOP_ON_ERROR,
+                    object_statuses.data());
+
+        case SAI_COMMON_API_BULK_SET:
+
+            {
+                if (sai_metadata_sai_route_api->set_route_entries_attribute == NULL)
+                {
+                    return SAI_STATUS_NOT_IMPLEMENTED;
+                }
+
+                /*
+                 * Bulk set api accepts exactly one attribute per object.
+                 */
+
+                std::vector<sai_attribute_t> attrs(object_count);
+
+                for (uint32_t idx = 0; idx < object_count; ++idx)
+                {
+                    if (attributes[idx]->get_attr_count() != 1)
+                    {
+                        SWSS_LOG_WARN("bulk set on %s expects 1 attribute, got %u, executing one by one",
+                                object_ids[idx].c_str(),
+                                attributes[idx]->get_attr_count());
+
+                        return SAI_STATUS_NOT_SUPPORTED;
+                    }
+
+                    attrs[idx] = attributes[idx]->get_attr_list()[0];
+                }
+
+                return sai_metadata_sai_route_api->set_route_entries_attribute(
+                        object_count,
+                        entries.data(),
+                        attrs.data(),
+                        SAI_BULK_OP_ERROR_MODE_STOP_ON_ERROR,
+                        object_statuses.data());
+            }
+
+        default:
+            SWSS_LOG_THROW("api %d is not supported in bulk route", api);
+    }
+}
+
+sai_status_t handle_bulk_next_hop_group_member(
+        _In_ const std::vector<std::string> &object_ids,
+        _In_ sai_common_api_t api,
+        _In_ const std::vector<std::shared_ptr<SaiAttributeList>> &attributes,
+        _Out_ std::vector<sai_status_t> &object_statuses)
+{
+    SWSS_LOG_ENTER();
+
+    uint32_t object_count = (uint32_t)object_ids.size();
+
+    std::vector<sai_object_id_t> vids(object_count);
+    std::vector<sai_object_id_t> rids(object_count, SAI_NULL_OBJECT_ID);
+
+    for (uint32_t idx = 0; idx < object_count; ++idx)
+    {
+        sai_deserialize_object_id(object_ids[idx], vids[idx]);
+    }
+
+    sai_status_t status;
+
+    switch (api)
+    {
+        case SAI_COMMON_API_BULK_CREATE:
+
+            {
+                if (sai_metadata_sai_next_hop_group_api->create_next_hop_group_members == NULL)
+                {
+                    return SAI_STATUS_NOT_IMPLEMENTED;
+                }
+
+                /*
+                 * All VIDs in single bulk request are created on the same
+                 * switch, so we can extract switch from first one.
+                 */
+
+                sai_object_id_t switch_rid = translate_vid_to_rid(redis_sai_switch_id_query(vids.at(0)));
+
+                std::vector<uint32_t> attr_counts;
+                std::vector<const sai_attribute_t*> attr_lists;
+
+                get_bulk_attr_lists(attributes, attr_counts, attr_lists);
+
+                status = sai_metadata_sai_next_hop_group_api->create_next_hop_group_members(
+                        switch_rid,
+                        object_count,
+                        attr_counts.data(),
+                        attr_lists.data(),
+                        SAI_BULK_OP_ERROR_MODE_STOP_ON_ERROR,
+                        rids.data(),
+                        object_statuses.data());
+
+                if (is_bulk_api_not_implemented(status))
+                {
+                    return status;
+                }
+
+                std::vector<std::pair<sai_object_id_t, sai_object_id_t>> ridVidPairs;
+
+                for (uint32_t idx = 0; idx < object_count; ++idx)
+                {
+                    if (object_statuses[idx] != SAI_STATUS_SUCCESS)
+                    {
+                        continue;
+                    }
+
+                    /*
+                     * Object was created so new object id was generated we
+                     * need to save virtual id's to redis db.
+                     */
+
+                    ridVidPairs.push_back(std::make_pair(rids[idx], vids[idx]));
+
+                    save_rid_and_vid_to_local(rids[idx], vids[idx]);
+                }
+
+                redisSetRidAndVidPairs(ridVidPairs);
+
+                return status;
+            }
+
+        case SAI_COMMON_API_BULK_REMOVE:
+
+            {
+                if (sai_metadata_sai_next_hop_group_api->remove_next_hop_group_members == NULL)
+                {
+                    return SAI_STATUS_NOT_IMPLEMENTED;
+                }
+
+                for (uint32_t idx = 0; idx < object_count; ++idx)
+                {
+                    rids[idx] = translate_vid_to_rid(vids[idx]);
+                }
+
+                status = sai_metadata_sai_next_hop_group_api->remove_next_hop_group_members(
+                        object_count,
+                        rids.data(),
+                        SAI_BULK_OP_ERROR_MODE_STOP_ON_ERROR,
+                        object_statuses.data());
+
+                if (is_bulk_api_not_implemented(status))
+                {
+                    return status;
+                }
+
+                std::vector<std::pair<sai_object_id_t, sai_object_id_t>> ridVidPairs;
+
+                for (uint32_t idx = 0; idx < object_count; ++idx)
+                {
+                    if (object_statuses[idx] != SAI_STATUS_SUCCESS)
+                    {
+                        continue;
+                    }
+
+                    ridVidPairs.push_back(std::make_pair(rids[idx], vids[idx]));
+
+                    remove_rid_and_vid_from_local(rids[idx], vids[idx]);
+                }
+
+                redisRemoveRidAndVidPairs(ridVidPairs);
+
+                return status;
+            }
+
+        case SAI_COMMON_API_BULK_SET:
+
+            /*
+             * There is no bulk set api for next hop group members.
+             */
+
+            return SAI_STATUS_NOT_IMPLEMENTED;
+
+        default:
+            SWSS_LOG_THROW("api %d is not supported in bulk next hop group member", api);
+    }
+}
+
+sai_status_t handle_bulk_per_object(
         _In_ sai_object_type_t object_type,
         _In_ const std::vector<std::string> &object_ids,
         _In_ sai_common_api_t api,
-        _In_ const std::vector<std::shared_ptr<SaiAttributeList>> &attributes)
+        _In_ const std::vector<std::shared_ptr<SaiAttributeList>> &attributes,
+        _Out_ std::vector<sai_status_t> &object_statuses)
 {
     SWSS_LOG_ENTER();
 
-    /*
-     * Since we don't have asic support yet for bulk api, just execute one by
-     * one.
-     */
+    sai_common_api_t single_api;
+
+    switch (api)
+    {
+        case SAI_COMMON_API_BULK_CREATE:
+            single_api = SAI_COMMON_API_CREATE;
+            break;
+
+        case SAI_COMMON_API_BULK_REMOVE:
+            single_api = SAI_COMMON_API_REMOVE;
+            break;
+
+        case SAI_COMMON_API_BULK_SET:
+            single_api = SAI_COMMON_API_SET;
+            break;
+
+        default:
+            SWSS_LOG_THROW("api %d is not supported in bulk", api);
+    }
 
     for (size_t idx = 0; idx < object_ids.size(); ++idx)
     {
@@ -2668,49 +3238,102 @@ sai_status_t handle_bulk_generic(
 
         sai_object_meta_key_t meta_key;
         meta_key.objecttype = object_type;
+
         switch (object_type)
         {
             case SAI_OBJECT_TYPE_ROUTE_ENTRY:
                 sai_deserialize_route_entry(object_ids[idx], meta_key.objectkey.key.route_entry);
+                status = handle_non_object_id(meta_key, single_api, attr_count, attr_list);
                 break;
+
             case SAI_OBJECT_TYPE_FDB_ENTRY:
                 sai_deserialize_fdb_entry(object_ids[idx], meta_key.objectkey.key.fdb_entry);
+                status = handle_non_object_id(meta_key, single_api, attr_count, attr_list);
                 break;
+
             case SAI_OBJECT_TYPE_NEXT_HOP_GROUP_MEMBER:
-                sai_deserialize_object_id(object_ids[idx], meta_key.objectkey.key.object_id);
+
+                /*
+                 * Object id type needs VID/RID map update on create and
+                 * remove, so it must go through generic handler.
+                 */
+
+                status = handle_generic(object_type, object_ids[idx], single_api, attr_count, attr_list);
                 break;
+
             default:
                 SWSS_LOG_THROW("invalid object_type: %s", sai_serialize_object_type(object_type).c_str());
         }
 
-        if (api == SAI_COMMON_API_BULK_SET)
-        {
-            status = handle_non_object_id(meta_key, SAI_COMMON_API_SET, attr_count, attr_list);
-        }
-        else if (api == SAI_COMMON_API_BULK_CREATE)
+        object_statuses[idx] = status;
+
+        if (status != SAI_STATUS_SUCCESS)
         {
-            status = handle_non_object_id(meta_key, SAI_COMMON_API_CREATE, attr_count, attr_list);
+            return status;
         }
-        else if (api == SAI_COMMON_API_BULK_REMOVE)
+    }
+
+    return SAI_STATUS_SUCCESS;
+}
+
+sai_status_t handle_bulk_generic(
+        _In_ sai_object_type_t object_type,
+        _In_ const std::vector<std::string> &object_ids,
+        _In_ sai_common_api_t api,
+        _In_ const std::vector<std::shared_ptr<SaiAttributeList>> &attributes,
+        _Out_ std::vector<sai_status_t> &object_statuses)
+{
+    SWSS_LOG_ENTER();
+
+    object_statuses.assign(object_ids.size(), SAI_STATUS_NOT_EXECUTED);
+
+    auto key = std::make_pair(object_type, api);
+
+    if (bulkApiNotImplemented.find(key) == bulkApiNotImplemented.end())
+    {
+        sai_status_t status;
+
+        switch (object_type)
         {
-            status = handle_non_object_id(meta_key, SAI_COMMON_API_REMOVE, attr_count, attr_list);
+            case SAI_OBJECT_TYPE_ROUTE_ENTRY:
+                status = handle_bulk_route_entry(object_ids, api, attributes, object_statuses);
+                break;
+
+            case SAI_OBJECT_TYPE_NEXT_HOP_GROUP_MEMBER:
+                status = handle_bulk_next_hop_group_member(object_ids, api, attributes, object_statuses);
+                break;
+
+            default:
+
+                /*
+                 * SAI headers we compile against don't define bulk api for
+                 * FDB entries, so those are always executed one by one.
+                 */
+
+                status = SAI_STATUS_NOT_IMPLEMENTED;
+                break;
         }
-        else
+
+        if (!is_bulk_api_not_implemented(status))
         {
-            SWSS_LOG_THROW("api %d is not supported in bulk route", api);
+            return status;
         }
 
-        if (status != SAI_STATUS_SUCCESS)
+        SWSS_LOG_NOTICE("vendor bulk api %d for %s is not implemented, executing one by one",
+                api,
+                sai_serialize_object_type(object_type).c_str());
+
+        if (status == SAI_STATUS_NOT_IMPLEMENTED)
         {
-            internal_syncd_api_send_response(api, status);
-            return status;
+            bulkApiNotImplemented.insert(key);
         }
+
+        object_statuses.assign(object_ids.size(), SAI_STATUS_NOT_EXECUTED);
     }
 
-    return SAI_STATUS_SUCCESS;
+    return handle_bulk_per_object(object_type, object_ids, api, attributes, object_statuses);
 }
 
-
 sai_status_t processBulkEvent(
         _In_ sai_common_api_t api,
         _In_ const swss::KeyOpFieldsValuesTuple &kco)
@@ -2733,6 +3356,10 @@ sai_status_t processBulkEvent(
 
     std::vector<std::shared_ptr<SaiAttributeList>> attributes;
 
+    // serialized attributes are needed to update fdb index after execution
+
+    std::vector<std::vector<swss::FieldValueTuple>> fdbEntries;
+
     for (const auto &fvt: values)
     {
         std::string str_object_id = fvField(fvt);
@@ -2766,6 +3393,11 @@ sai_status_t processBulkEvent(
             std::make_shared<SaiAttributeList>(object_type, entries, false);
 
         attributes.push_back(list);
+
+        if (object_type == SAI_OBJECT_TYPE_FDB_ENTRY)
+        {
+            fdbEntries.push_back(entries);
+        }
     }
 
     SWSS_LOG_NOTICE("bulk %s execute with %zu items",
@@ -2792,12 +3424,14 @@ sai_status_t processBulkEvent(
 
     sai_status_t status;
 
+    std::vector<sai_status_t> object_statuses;
+
     switch (object_type)
     {
         case SAI_OBJECT_TYPE_ROUTE_ENTRY:
         case SAI_OBJECT_TYPE_NEXT_HOP_GROUP_MEMBER:
         case SAI_OBJECT_TYPE_FDB_ENTRY:
-            status = handle_bulk_generic(object_type, object_ids, api, attributes);
+            status = handle_bulk_generic(object_type, object_ids, api, attributes, object_statuses);
             break;
 
         default:
@@ -2805,14 +3439,35 @@ sai_status_t processBulkEvent(
                     sai_serialize_object_type(object_type).c_str());
     }
 
+    if (object_type == SAI_OBJECT_TYPE_FDB_ENTRY)
+    {
+        for (size_t idx = 0; idx < object_statuses.size(); ++idx)
+        {
+            if (object_statuses[idx] == SAI_STATUS_SUCCESS)
+            {
+                fdbIndexUpdate(api, object_ids[idx], fdbEntries[idx]);
+            }
+        }
+    }
+
+    internal_syncd_api_send_response(api, status, (uint32_t)object_statuses.size(), object_statuses.data());
+
     if (status != SAI_STATUS_SUCCESS)
     {
+        for (size_t idx = 0; idx < object_statuses.size(); ++idx)
+        {
+            if (object_statuses[idx] != SAI_STATUS_SUCCESS)
+            {
+                SWSS_LOG_ERROR("bulk %s failed: %s",
+                        object_ids[idx].c_str(),
+                        sai_serialize_status(object_statuses[idx]).c_str());
+            }
+        }
+
         SWSS_LOG_THROW("failed to execute bulk api: %s",
                 sai_serialize_status(status).c_str());
     }
 
-    internal_syncd_api_send_response(api, status);
-
     return status;
 }
 
@@ -3092,22 +3747,50 @@ sai_status_t processEvent(
             SWSS_LOG_THROW("undefined object type %s", sai_serialize_object_type(object_type).c_str());
         }
 
-        const std::vector<swss::FieldValueTuple> &values = kfvFieldsValues(kco);
+        const std::vector<swss::FieldValueTuple> &fieldValues = kfvFieldsValues(kco);
+
+        bool binary = fieldValues.size() == 1 && fvField(fieldValues[0]) == BINARY_ATTRIBUTES_FIELD;
+
+        std::shared_ptr<SaiAttributeList> list = binary
+            ? std::make_shared<SaiAttributeList>(object_type, fvValue(fieldValues[0]))
+            : std::make_shared<SaiAttributeList>(object_type, fieldValues, false);
+
+        /*
+         * Attributes sent in binary form are decoded without text parsing, but
+         * ASIC_STATE must still contain text, since it's used by apply view,
+         * hard reinit and saidump. Text must be produced before VID to RID
+         * translation.
+         */
+
+        std::vector<swss::FieldValueTuple> binaryValues;
+
+        if (binary)
+        {
+            binaryValues = SaiAttributeList::serialize_attr_list(
+                    object_type,
+                    list->get_attr_count(),
+                    list->get_attr_list(),
+                    false);
+
+            std::string prefix = isInitViewMode() ? TEMP_PREFIX : "";
+
+            redisReplaceBinaryAttributes(prefix + ASIC_STATE_TABLE + ":" + key, binaryValues);
+        }
+
+        const std::vector<swss::FieldValueTuple> &values = binary ? binaryValues : fieldValues;
 
         for (const auto &v: values)
         {
             SWSS_LOG_DEBUG("attr: %s: %s", fvField(v).c_str(), fvValue(v).c_str());
         }
 
-        SaiAttributeList list(object_type, values, false);
-
         /*
          * Attribute list can't be const since we will use it to translate VID to
          * RID in place.
          */
 
-        sai_attribute_t *attr_list = list.get_attr_list();
-        uint32_t attr_count = list.get_attr_count();
+        sai_attribute_t *attr_list = list->get_attr_list();
+        uint32_t attr_count = list->get_attr_count();
 
         /*
          * NOTE: This check pointers must be executed before init view mode, since
@@ -3182,6 +3865,11 @@ sai_status_t processEvent(
             }
 
             status = handle_non_object_id(meta_key, api, attr_count, attr_list);
+
+            if (object_type == SAI_OBJECT_TYPE_FDB_ENTRY && status == SAI_STATUS_SUCCESS)
+            {
+                fdbIndexUpdate(api, str_object_id, values);
+            }
         }
         else
         {
@@ -3275,6 +3963,22 @@ void processFlexCounterGroupEvent(
             {
                 FlexCounter::setPollInterval(stoi(value), groupName);
             }
+            else if (field == POLL_WORKERS_FIELD)
+            {
+                FlexCounter::setPollWorkers(stoi(value), groupName);
+            }
+            else if (field == DELTA_PUBLISH_FIELD)
+            {
+                FlexCounter::updateDeltaPublish(value, groupName);
+            }
+            else if (field == FULL_REFRESH_CYCLES_FIELD)
+            {
+                FlexCounter::setFullRefreshCycles(stoi(value), groupName);
+            }
+            else if (field == POLL_OFFSET_FIELD)
+            {
+                FlexCounter::setPollOffset(stoi(value), groupName);
+            }
             else if (field == QUEUE_PLUGIN_FIELD)
             {
                 auto shaStrings = swss::tokenize(value, ',');
@@ -3780,6 +4484,10 @@ void onSyncdStart(bool warmStart)
 
         performWarmRestart();
 
+        loadRidAndVidMapsToLocal();
+
+        fdbIndexRebuild();
+
         SWSS_LOG_NOTICE("skipping hard reinit since WARM start was performed");
         return;
     }
@@ -3792,6 +4500,10 @@ void onSyncdStart(bool warmStart)
      */
 
     hardReinit();
+
+    loadRidAndVidMapsToLocal();
+
+    fdbIndexRebuild();
 }
 
 void sai_meta_log_syncd(
@@ -3918,9 +4630,6 @@ int syncd_main(int argc, char **argv)
     getResponse  = std::make_shared<swss::ProducerTable>(dbAsic.get(), "GETRESPONSE");
     notifications = std::make_shared<swss::NotificationProducer>(dbNtf.get(), "NOTIFICATIONS");
 
-    std::string fdbFlushLuaScript = swss::loadLuaScript(fdbFlushLuaScriptName);
-    fdbFlushSha = swss::loadRedisScript(dbAsic.get(), fdbFlushLuaScript);
-    
     g_veryFirstRun = isVeryFirstRun();
 
     /* ignore warm logic here if syncd starts in Mellanox fastfast boot mode */
@@ -80,13 +80,43 @@ void translate_vid_to_rid_non_object_id(
 void redisClearVidToRidMap();
 void redisClearRidToVidMap();
 
+void redisSetRidAndVidPairs(
+        _In_ const std::vector<std::pair<sai_object_id_t, sai_object_id_t>> &ridVidPairs);
+
+void redisRemoveRidAndVidPairs(
+        _In_ const std::vector<std::pair<sai_object_id_t, sai_object_id_t>> &ridVidPairs);
+
+void loadRidAndVidMapsToLocal();
+
+/**
+ * @brief Append command to redis context output buffer without waiting for
+ * reply, reply needs to be read later using redis_get_reply.
+ */
+void redis_append_command(
+        _In_ redisContext *ctx,
+        _In_ const std::vector<std::string> &args);
+
+redisReply* redis_get_reply(
+        _In_ redisContext *ctx);
+
+/**
+ * @brief Get keys matching pattern using SCAN instead of blocking KEYS.
+ */
+std::vector<std::string> redis_scan_keys(
+        _In_ const std::string &pattern);
+
+/**
+ * @brief Get fields of given keys using pipelined HGETALL.
+ */
+std::vector<std::vector<swss::FieldValueTuple>> redisGetAsicStateValues(
+        _In_ const std::vector<std::string> &keys);
+
 sai_object_type_t getObjectTypeFromVid(
         _In_ sai_object_id_t sai_object_id);
 
 extern std::shared_ptr<swss::NotificationProducer>  notifications;
 extern std::shared_ptr<swss::RedisClient>   g_redisClient;
 extern std::shared_ptr<swss::DBConnector>   dbAsic;
-extern std::string fdbFlushSha;
 
 sai_object_id_t redis_create_virtual_object_id(
         _In_ sai_object_id_t switch_id,
@@ -121,9 +151,31 @@ bool is_set_attribute_workaround(
         _In_ sai_attr_id_t attrid,
         _In_ sai_status_t status);
 
+extern std::set<std::pair<sai_object_type_t, sai_common_api_t>> bulkApiNotImplemented;
+
+bool is_bulk_api_not_implemented(
+        _In_ sai_status_t status);
+
+void get_bulk_attr_lists(
+        _In_ const std::vector<std::shared_ptr<SaiAttributeList>> &attributes,
+        _Out_ std::vector<uint32_t> &attr_counts,
+        _Out_ std::vector<const sai_attribute_t*> &attr_lists);
+
+void send_notification(
+        _In_ std::string op,
+        _In_ std::string data,
+        _In_ std::vector<swss::FieldValueTuple> &entry);
+
 void startNotificationsProcessingThread();
 void stopNotificationsProcessingThread();
 
+void fdbIndexUpdate(
+        _In_ sai_common_api_t api,
+        _In_ const std::string &strFdbEntry,
+        _In_ const std::vector<swss::FieldValueTuple> &values);
+
+void fdbIndexRebuild();
+
 sai_status_t processBulkEvent(
         _In_ sai_common_api_t api,
         _In_ const swss::KeyOpFieldsValuesTuple &kco);
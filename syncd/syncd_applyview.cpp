@@ -5,10 +5,13 @@
 #include "swss/dbconnector.h"
 
 #include "CommandLineOptions.h"
+#include "RedisBatchWriter.h"
+#include "WorkerPool.h"
 
 #include <inttypes.h>
 #include <algorithm>
 #include <list>
+#include <set>
 
 extern std::shared_ptr<CommandLineOptions> g_commandLineOptions; // TODO move to syncd object
 
@@ -332,7 +335,77 @@ class SaiAttr
 /**
  * @brief Class represents SAI object
  */
-class SaiObj
+class SaiObj;
+
+/**
+ * @brief Orders objects by string object id.
+ */
+struct SaiObjStrIdCompare
+{
+    bool operator()(
+            _In_ const std::shared_ptr<SaiObj> &a,
+            _In_ const std::shared_ptr<SaiObj> &b) const;
+};
+
+/**
+ * @brief Not processed objects of single object type in a view, ordered by
+ * string object id, the same way as all objects of that type in view.
+ */
+typedef std::set<std::shared_ptr<SaiObj>, SaiObjStrIdCompare> NotProcessedBucket;
+
+/**
+ * @brief Objects of single type indexed by value of single attribute.
+ */
+typedef struct _CreateOnlyAttrIndex
+{
+    /**
+     * @brief Objects by serialized attribute value.
+     */
+    std::unordered_map<std::string, std::vector<std::shared_ptr<SaiObj>>> withValue;
+
+    /**
+     * @brief Objects which don't have this attribute.
+     */
+    std::vector<std::shared_ptr<SaiObj>> withoutAttr;
+
+} CreateOnlyAttrIndex;
+
+/**
+ * @brief Objects of single type indexed by fingerprint of CREATE_ONLY and KEY
+ * attributes.
+ */
+typedef struct _FingerprintIndex
+{
+    /**
+     * @brief False if some object can't be fingerprinted, then match found in
+     * index may not be the only candidate.
+     */
+    bool usable;
+
+    /**
+     * @brief CREATE_ONLY and KEY attributes present on any indexed object.
+     */
+    std::set<sai_attr_id_t> attrIds;
+
+    /**
+     * @brief Attributes without default value missing on some indexed object.
+     */
+    std::set<sai_attr_id_t> missingAttrIds;
+
+    /**
+     * @brief Default values of attributes in current view.
+     */
+    std::map<sai_attr_id_t, std::shared_ptr<SaiAttr>> defaults;
+
+    /**
+     * @brief Objects by fingerprint.
+     */
+    std::unordered_multimap<std::string, std::shared_ptr<SaiObj>> objects;
+
+} FingerprintIndex;
+
+class SaiObj:
+    public std::enable_shared_from_this<SaiObj>
 {
     public:
 
@@ -341,7 +414,8 @@ class SaiObj
          */
         SaiObj():
             createdObject(false),
-            m_object_status(SAI_OBJECT_STATUS_NOT_PROCESSED)
+            m_object_status(SAI_OBJECT_STATUS_NOT_PROCESSED),
+            m_inNotProcessedBucket(false)
         {
             SWSS_LOG_ENTER();
 
@@ -422,6 +496,40 @@ class SaiObj
             SWSS_LOG_ENTER();
 
             m_object_status = object_status;
+
+            if (object_status == SAI_OBJECT_STATUS_NOT_PROCESSED)
+            {
+                linkNotProcessedBucket();
+            }
+            else
+            {
+                unlinkNotProcessedBucket();
+            }
+        }
+
+        /**
+         * @brief Sets bucket of not processed objects owned by view.
+         *
+         * Object is kept on bucket list as long as its status is not
+         * processed, so view can get not processed objects without
+         * scanning all objects.
+         *
+         * @param[in] bucket Bucket of object type in view, or nullptr when
+         * object is removed from view.
+         */
+        void setNotProcessedBucket(
+                _In_ const std::shared_ptr<NotProcessedBucket> &bucket)
+        {
+            SWSS_LOG_ENTER();
+
+            unlinkNotProcessedBucket();
+
+            m_notProcessedBucket = bucket;
+
+            if (m_object_status == SAI_OBJECT_STATUS_NOT_PROCESSED)
+            {
+                linkNotProcessedBucket();
+            }
         }
 
         /**
@@ -483,20 +591,127 @@ class SaiObj
          * objects as many times as their reference will get down to zero.
          */
 
+    private:
+
+        void linkNotProcessedBucket()
+        {
+            SWSS_LOG_ENTER();
+
+            auto bucket = m_notProcessedBucket.lock();
+
+            if (bucket == nullptr || m_inNotProcessedBucket)
+            {
+                return;
+            }
+
+            auto inserted = bucket->insert(shared_from_this());
+
+            if (!inserted.second)
+            {
+                SWSS_LOG_THROW("object %s is already on not processed bucket", str_object_id.c_str());
+            }
+
+            m_notProcessedIterator = inserted.first;
+
+            m_inNotProcessedBucket = true;
+        }
+
+        void unlinkNotProcessedBucket()
+        {
+            SWSS_LOG_ENTER();
+
+            if (!m_inNotProcessedBucket)
+            {
+                return;
+            }
+
+            m_inNotProcessedBucket = false;
+
+            auto bucket = m_notProcessedBucket.lock();
+
+            if (bucket == nullptr)
+            {
+                // view owning bucket was already destroyed
+
+                return;
+            }
+
+            // erase can release last reference to this object
+
+            auto self = shared_from_this();
+
+            bucket->erase(m_notProcessedIterator);
+        }
+
     private:
 
         sai_object_status_t m_object_status;
 
         std::unordered_map<sai_attr_id_t, std::shared_ptr<SaiAttr>> m_attrs;
 
+        /**
+         * @brief Bucket is owned by view, object only holds weak reference
+         * to it, so there is no reference cycle between bucket and object.
+         */
+        std::weak_ptr<NotProcessedBucket> m_notProcessedBucket;
+
+        NotProcessedBucket::iterator m_notProcessedIterator;
+
+        bool m_inNotProcessedBucket;
+
         SaiObj(const SaiObj&);
         SaiObj& operator=(const SaiObj&);
 };
 
+bool SaiObjStrIdCompare::operator()(
+        _In_ const std::shared_ptr<SaiObj> &a,
+        _In_ const std::shared_ptr<SaiObj> &b) const
+{
+    SWSS_LOG_ENTER();
+
+    return a->str_object_id < b->str_object_id;
+}
+
 typedef std::unordered_map<sai_object_id_t, sai_object_id_t> ObjectIdMap;
 typedef std::map<std::string, std::shared_ptr<SaiObj>> StrObjectIdToSaiObjectHash;
 typedef std::map<sai_object_id_t, std::shared_ptr<SaiObj>> ObjectIdToSaiObjectHash;
 
+/**
+ * @brief Object and attribute id which is referring some VID.
+ */
+typedef std::pair<std::shared_ptr<SaiObj>, sai_attr_id_t> VidReferrer;
+
+/**
+ * @brief Orders VID referrers by referring object string id and attribute id.
+ *
+ * Heap address of object is used only to distinguish objects with the same
+ * string id, so order of referrers doesn't depend on memory allocation and
+ * matching heuristics will pick the same candidate on each run.
+ */
+struct VidReferrerCompare
+{
+    bool operator()(
+            _In_ const VidReferrer &a,
+            _In_ const VidReferrer &b) const
+    {
+        SWSS_LOG_ENTER();
+
+        int cmp = a.first->str_object_id.compare(b.first->str_object_id);
+
+        if (cmp != 0)
+        {
+            return cmp < 0;
+        }
+
+        if (a.second != b.second)
+        {
+            return a.second < b.second;
+        }
+
+        return a.first.get() < b.first.get();
+    }
+};
+
 /**
  * @brief Class represents ASIC view
  */
@@ -518,12 +733,19 @@ class AsicView
         /**
          * @brief Populates ASIC view from REDIS table dump
          *
+         * Objects and attributes are deserialized in parallel when worker
+         * pool is given, then they are inserted to view in dump order by
+         * calling thread, so view content doesn't depend on number of
+         * workers.
+         *
          * @param[in] dump Redis table dump
+         * @param[in] pool Worker pool used to deserialize objects, can be null
          *
          * NOTE: Could be static method that returns AsicView object.
          */
         void fromDump(
-                _In_ const swss::TableDump &dump)
+                _In_ const swss::TableDump &dump,
+                _In_ WorkerPool *pool = nullptr)
         {
             SWSS_LOG_ENTER();
 
@@ -532,94 +754,42 @@ class AsicView
              * here right away but we would need VIDs as well.
              */
 
-            for (const auto &key: dump)
-            {
-                auto start = key.first.find_first_of(":");
-
-                if (start == std::string::npos)
-                {
-                    SWSS_LOG_THROW("failed to find colon in %s", key.first.c_str());
-                }
-
-                std::shared_ptr<SaiObj> o = std::make_shared<SaiObj>();
+            std::vector<const swss::TableDump::value_type*> entries;
 
-                // TODO we could use sai deserialize object meta key
+            entries.reserve(dump.size());
 
-                o->str_object_type  = key.first.substr(0, start);
-                o->str_object_id    = key.first.substr(start + 1);
-
-                sai_deserialize_object_type(o->str_object_type, o->meta_key.objecttype);
-
-                o->info = sai_metadata_get_object_type_info(o->meta_key.objecttype);
+            for (const auto &key: dump)
+            {
+                entries.push_back(&key);
+            }
 
-                /*
-                 * Since neighbor/route/fdb structs objects contains OIDs, we
-                 * need to increase vid reference. With new metadata for SAI
-                 * 1.0 this can be done in generic way for all non object ids.
-                 */
+            std::vector<std::shared_ptr<SaiObj>> objects(entries.size());
 
-                switch (o->meta_key.objecttype)
+            auto deserialize = [&](size_t first, size_t step)
+            {
+                for (size_t idx = first; idx < entries.size(); idx += step)
                 {
-                    case SAI_OBJECT_TYPE_FDB_ENTRY:
-                        sai_deserialize_fdb_entry(o->str_object_id, o->meta_key.objectkey.key.fdb_entry);
-                        soFdbs[o->str_object_id] = o;
-                        break;
-
-                    case SAI_OBJECT_TYPE_NEIGHBOR_ENTRY:
-                        sai_deserialize_neighbor_entry(o->str_object_id, o->meta_key.objectkey.key.neighbor_entry);
-                        soNeighbors[o->str_object_id] = o;
-                        break;
-
-                    case SAI_OBJECT_TYPE_ROUTE_ENTRY:
-                        sai_deserialize_route_entry(o->str_object_id, o->meta_key.objectkey.key.route_entry);
-                        soRoutes[o->str_object_id] = o;
-
-                        routesByPrefix[sai_serialize_ip_prefix(o->meta_key.objectkey.key.route_entry.destination)].push_back(o->str_object_id);
-
-                        break;
-
-                    case SAI_OBJECT_TYPE_NAT_ENTRY:
-                        sai_deserialize_nat_entry(o->str_object_id, o->meta_key.objectkey.key.nat_entry);    
-                        soNatEntries[o->str_object_id] = o;
-                        break;
-
-                    default:
-
-                        if (o->info->isnonobjectid)
-                        {
-                            SWSS_LOG_THROW("object %s is non object id, not handled, FIXME", key.first.c_str());
-                        }
-
-                        sai_deserialize_object_id(o->str_object_id, o->meta_key.objectkey.key.object_id);
-
-                        soOids[o->str_object_id] = o;
-                        oOids[o->meta_key.objectkey.key.object_id] = o;
-
-                        break;
+                    objects[idx] = deserializeObject(entries[idx]->first, entries[idx]->second);
                 }
+            };
 
-                soAll[o->str_object_id] = o;
-                sotAll[o->meta_key.objecttype][o->str_object_id] = o;
+            if (pool == nullptr)
+            {
+                deserialize(0, 1);
+            }
+            else
+            {
+                pool->run([&](size_t worker) { deserialize(worker, pool->getWorkerCount()); });
+            }
 
-                if (o->info->isnonobjectid)
-                {
-                    updateNonObjectIdVidReferenceCountByValue(o, 1);
-                }
-                else
-                {
-                    /*
-                     * Here is only object VID declaration, since we don't
-                     * know what objects were processed previously but on
-                     * some of previous object attributes this VID could be
-                     * used, so value can be already greater than zero, but
-                     * here we need to just mark that vid exists in
-                     * vidReference.
-                     */
+            size_t routes = (size_t)std::count_if(objects.begin(), objects.end(),
+                    [](const std::shared_ptr<SaiObj> &o) { return o->getObjectType() == SAI_OBJECT_TYPE_ROUTE_ENTRY; });
 
-                    m_vidReference[o->meta_key.objectkey.key.object_id] += 0;
-                }
+            routesByPrefix.reserve(routesByPrefix.size() + routes);
 
-                populateAttributes(o, key.second);
+            for (const auto &o: objects)
+            {
+                insertDumpObject(o);
             }
         }
 
@@ -628,9 +798,11 @@ class AsicView
         /**
          * @brief Release existing VID links (references) based on given attribute.
          *
+         * @param[in] obj Object which attribute belongs to.
          * @param[in] attr Attribute which will be used to obtain oids.
          */
         void releaseExisgingLinks(
+                _In_ const std::shared_ptr<SaiObj> &obj,
                 _In_ const std::shared_ptr<const SaiAttr> &attr)
         {
             SWSS_LOG_ENTER();
@@ -641,14 +813,15 @@ class AsicView
              *
              * Second operation after could increase links of setting new attribute, or
              * nothing if object was removed.
-             *
-             * Also if we want to keep track of object reverse dependency
-             * this action can be more complicated.
              */
 
+            sai_attr_id_t attrId = attr->getAttrMetadata()->attrid;
+
             for (auto const &vid: attr->getOidListFromAttribute())
             {
                 releaseVidReference(vid);
+
+                removeVidReferrer(vid, obj, attrId);
             }
         }
 
@@ -660,13 +833,13 @@ class AsicView
          * @param[in] obj Object which will be used to obtain attributes and oids
          */
         void releaseExisgingLinks(
-                _In_ const std::shared_ptr<const SaiObj> &obj)
+                _In_ const std::shared_ptr<SaiObj> &obj)
         {
             SWSS_LOG_ENTER();
 
             for (const auto &ita: obj->getAllAttributes())
             {
-                releaseExisgingLinks(ita.second);
+                releaseExisgingLinks(obj, ita.second);
             }
         }
 
@@ -719,9 +892,11 @@ class AsicView
         /**
          * @brief Bind new links (references) based on attribute
          *
+         * @param[in] obj Object which attribute belongs to
          * @param[in] attr Attribute to obtain oids to bind references
          */
         void bindNewLinks(
+                _In_ const std::shared_ptr<SaiObj> &obj,
                 _In_ const std::shared_ptr<const SaiAttr> &attr)
         {
             SWSS_LOG_ENTER();
@@ -735,14 +910,15 @@ class AsicView
              * not the case since we either created new object on current view or
              * either we matched current object to temporary object so RID can be the
              * same.
-             *
-             * Also if we want to keep track of object reverse dependency
-             * this action can be more complicated.
              */
 
+            sai_attr_id_t attrId = attr->getAttrMetadata()->attrid;
+
             for (auto const &vid: attr->getOidListFromAttribute())
             {
                 bindNewVidReference(vid);
+
+                insertVidReferrer(vid, obj, attrId);
             }
         }
 
@@ -754,13 +930,13 @@ class AsicView
          * @param[in] obj Object which will be used to obtain attributes and oids
          */
         void bindNewLinks(
-                _In_ const std::shared_ptr<const SaiObj> &obj)
+                _In_ const std::shared_ptr<SaiObj> &obj)
         {
             SWSS_LOG_ENTER();
 
             for (const auto &ita: obj->getAllAttributes())
             {
-                bindNewLinks(ita.second);
+                bindNewLinks(obj, ita.second);
             }
         }
 
@@ -808,6 +984,76 @@ class AsicView
                     referenceCount);
         }
 
+        /**
+         * @brief Insert object attribute to VID reverse reference index.
+         *
+         * @param[in] vid Virtual ID used in attribute.
+         * @param[in] obj Object which is referring VID.
+         * @param[in] attrId Attribute id which contains VID.
+         */
+        void insertVidReferrer(
+                _In_ sai_object_id_t vid,
+                _In_ const std::shared_ptr<SaiObj> &obj,
+                _In_ sai_attr_id_t attrId)
+        {
+            SWSS_LOG_ENTER();
+
+            if (vid == SAI_NULL_OBJECT_ID)
+            {
+                return;
+            }
+
+            m_vidReferrers[vid].insert(VidReferrer(obj, attrId));
+        }
+
+        /**
+         * @brief Remove object attribute from VID reverse reference index.
+         *
+         * When VID is used multiple times in the same attribute (object list),
+         * only one entry is removed.
+         *
+         * @param[in] vid Virtual ID used in attribute.
+         * @param[in] obj Object which is referring VID.
+         * @param[in] attrId Attribute id which contains VID.
+         */
+        void removeVidReferrer(
+                _In_ sai_object_id_t vid,
+                _In_ const std::shared_ptr<SaiObj> &obj,
+                _In_ sai_attr_id_t attrId)
+        {
+            SWSS_LOG_ENTER();
+
+            if (vid == SAI_NULL_OBJECT_ID)
+            {
+                return;
+            }
+
+            auto it = m_vidReferrers.find(vid);
+
+            if (it == m_vidReferrers.end())
+            {
+                SWSS_LOG_THROW("vid %s doesn't exist in reverse reference index, BUG",
+                        sai_serialize_object_id(vid).c_str());
+            }
+
+            auto rit = it->second.find(VidReferrer(obj, attrId));
+
+            if (rit == it->second.end())
+            {
+                SWSS_LOG_THROW("%s attr 0x%x is not referring vid %s, BUG",
+                        obj->str_object_id.c_str(),
+                        attrId,
+                        sai_serialize_object_id(vid).c_str());
+            }
+
+            it->second.erase(rit);
+
+            if (it->second.empty())
+            {
+                m_vidReferrers.erase(it);
+            }
+        }
+
     public:
 
         /**
@@ -875,12 +1121,59 @@ class AsicView
 
         std::map<sai_object_type_t, StrObjectIdToSaiObjectHash> sotAll;
 
+        /**
+         * @brief Not processed objects by object type.
+         *
+         * Objects link and unlink themselves when their status changes.
+         */
+        std::map<sai_object_type_t, std::shared_ptr<NotProcessedBucket>> m_notProcessed;
+
+        /**
+         * @brief Gets not processed bucket of object type, creates it if
+         * it doesn't exist yet.
+         */
+        std::shared_ptr<NotProcessedBucket> getNotProcessedBucket(
+                _In_ sai_object_type_t object_type)
+        {
+            SWSS_LOG_ENTER();
+
+            auto &bucket = m_notProcessed[object_type];
+
+            if (bucket == nullptr)
+            {
+                bucket = std::make_shared<NotProcessedBucket>();
+            }
+
+            return bucket;
+        }
+
     public:
 
         ObjectIdToSaiObjectHash oOids;
 
         std::unordered_map<sai_object_id_t, sai_object_id_t> preMatchMap;
 
+        /**
+         * @brief Not processed objects indexed by primitive CREATE_ONLY
+         * attributes values.
+         *
+         * Used only on current view and built on first generic best match
+         * lookup of given object type. Objects are not processed only after
+         * view is populated, and their attributes don't change until they are
+         * matched, so index doesn't need to be updated, object status is
+         * checked on lookup.
+         */
+        mutable std::map<sai_object_type_t, std::map<sai_attr_id_t, CreateOnlyAttrIndex>> createOnlyAttrIndex;
+
+        /**
+         * @brief Not processed objects indexed by fingerprint of CREATE_ONLY
+         * and KEY attributes.
+         *
+         * Used only on current view and built on first generic best match
+         * lookup of given object type, the same way as createOnlyAttrIndex.
+         */
+        mutable std::map<sai_object_type_t, FingerprintIndex> fingerprintIndex;
+
         /*
          * On temp view this needs to be used for actual NEW rids created and
          * then reused with rid mapping to create new rid/vid map.
@@ -931,48 +1224,44 @@ class AsicView
         /**
          * @brief Gets not processed objects by object type.
          *
-         * Call to this method can be expensive, since every time we iterate
-         * entire list. This list can contain even 10k elements if view will be
-         * very large.
+         * Objects are kept in per object type bucket, which is updated when
+         * object status changes, so this call doesn't iterate or copy
+         * processed objects.
+         *
+         * NOTE: Returned list changes when status of any object of this type
+         * is changed, so object status must not be changed while iterating.
          *
          * @param object_type Object type to be used as filter.
          *
          * @return List of objects with requested object type and marked
-         * as not processed. Order on list is random.
+         * as not processed. List is ordered by object string id.
          */
-        std::vector<std::shared_ptr<SaiObj>> getNotProcessedObjectsByObjectType(
+        const NotProcessedBucket& getNotProcessedObjectsByObjectType(
                 _In_ sai_object_type_t object_type) const
         {
             SWSS_LOG_ENTER();
 
-            std::vector<std::shared_ptr<SaiObj>> list;
+            static const NotProcessedBucket empty;
 
             /*
              * We need to use find, since object type may not exist.
              */
 
-            auto it = sotAll.find(object_type);
-
-            if (it == sotAll.end())
-            {
-                return list;
-            }
+            auto it = m_notProcessed.find(object_type);
 
-            for (const auto &p: it->second)
+            if (it == m_notProcessed.end())
             {
-                if (p.second->getObjectStatus() == SAI_OBJECT_STATUS_NOT_PROCESSED)
-                {
-                    list.push_back(p.second);
-                }
+                return empty;
             }
 
-            return list;
+            return *it->second;
         }
 
         /**
          * @brief Gets all not processed objects
          *
-         * @return List of all not processed objects. Order on list is random.
+         * @return List of all not processed objects. List is ordered by
+         * object type and object string id.
          */
         std::vector<std::shared_ptr<SaiObj>> getAllNotProcessedObjects() const
         {
@@ -980,11 +1269,88 @@ class AsicView
 
             std::vector<std::shared_ptr<SaiObj>> list;
 
-            for (const auto &p: soAll)
+            for (const auto &p: m_notProcessed)
             {
-                if (p.second->getObjectStatus() == SAI_OBJECT_STATUS_NOT_PROCESSED)
+                list.insert(list.end(), p.second->begin(), p.second->end());
+            }
+
+            return list;
+        }
+
+        /**
+         * @brief Gets objects referring VID in given attribute.
+         *
+         * Uses reverse reference index, so cost depends only on number of
+         * objects using this VID, not on number of objects in view.
+         *
+         * @param vid Virtual ID which is referred.
+         * @param object_type Object type of referring objects.
+         * @param attr_id Attribute id of referring objects which contains VID.
+         *
+         * @return List of objects with requested object type which are using
+         * VID in requested attribute. List is ordered by object string id.
+         */
+        std::vector<std::shared_ptr<SaiObj>> getObjectsReferringVid(
+                _In_ sai_object_id_t vid,
+                _In_ sai_object_type_t object_type,
+                _In_ sai_attr_id_t attr_id) const
+        {
+            SWSS_LOG_ENTER();
+
+            std::vector<std::shared_ptr<SaiObj>> list;
+
+            auto it = m_vidReferrers.find(vid);
+
+            if (it == m_vidReferrers.end())
+            {
+                return list;
+            }
+
+            for (const auto &r: it->second)
+            {
+                if (r.second != attr_id || r.first->getObjectType() != object_type)
+                {
+                    continue;
+                }
+
+                // object list attribute can refer the same VID many times
+
+                if (list.size() && list.back() == r.first)
+                {
+                    continue;
+                }
+
+                list.push_back(r.first);
+            }
+
+            return list;
+        }
+
+        /**
+         * @brief Gets not processed objects referring VID in given attribute.
+         *
+         * @param vid Virtual ID which is referred.
+         * @param object_type Object type of referring objects.
+         * @param attr_id Attribute id of referring objects which contains VID.
+         *
+         * @return List of objects with requested object type and marked as
+         * not processed, which are using VID in requested attribute. List
+         * is ordered by object string id.
+         */
+        std::vector<std::shared_ptr<SaiObj>> getNotProcessedObjectsReferringVid(
+                _In_ sai_object_id_t vid,
+                _In_ sai_object_type_t object_type,
+                _In_ sai_attr_id_t attr_id) const
+        {
+            SWSS_LOG_ENTER();
+
+            std::vector<std::shared_ptr<SaiObj>> list;
+
+            for (const auto &obj: getObjectsReferringVid(vid, object_type, attr_id))
+            {
+                if (obj->getObjectStatus() == SAI_OBJECT_STATUS_NOT_PROCESSED)
                 {
-                    list.push_back(p.second);
+                    list.push_back(obj);
                 }
             }
 
@@ -1033,6 +1399,8 @@ class AsicView
             soAll[o->str_object_id] = o;
             sotAll[o->meta_key.objecttype][o->str_object_id] = o;
 
+            o->setNotProcessedBucket(getNotProcessedBucket(o->meta_key.objecttype));
+
             ridToVid[rid] = vid;
             vidToRid[vid] = rid;
         }
@@ -1085,12 +1453,12 @@ class AsicView
                      * they are not NULL.
                      */
 
-                    releaseExisgingLinks(currentObj->getSaiAttr(meta->attrid));
+                    releaseExisgingLinks(currentObj, currentObj->getSaiAttr(meta->attrid));
                 }
 
                 currentObj->setAttr(attr);
 
-                bindNewLinks(currentObj->getSaiAttr(meta->attrid));
+                bindNewLinks(currentObj, currentObj->getSaiAttr(meta->attrid));
             }
             else
             {
@@ -1158,6 +1526,8 @@ class AsicView
                 soAll[currentObj->str_object_id] = currentObj;
                 sotAll[currentObj->meta_key.objecttype][currentObj->str_object_id] = currentObj;
 
+                currentObj->setNotProcessedBucket(getNotProcessedBucket(currentObj->meta_key.objecttype));
+
                 /*
                  * Since we are creating object, we just need to mark that
                  * reference is there.  But at this point object is not used
@@ -1206,6 +1576,8 @@ class AsicView
                 soAll[currentObj->str_object_id] = currentObj;
                 sotAll[currentObj->meta_key.objecttype][currentObj->str_object_id] = currentObj;
 
+                currentObj->setNotProcessedBucket(getNotProcessedBucket(currentObj->meta_key.objecttype));
+
                 updateNonObjectIdVidReferenceCountByValue(currentObj, 1);
             }
 
@@ -1277,6 +1649,8 @@ class AsicView
                 soAll.erase(currentObj->str_object_id);
                 sotAll.at(currentObj->meta_key.objecttype).erase(currentObj->str_object_id);
 
+                currentObj->setNotProcessedBucket(nullptr);
+
                 m_vidReference[currentObj->meta_key.objectkey.key.object_id] -= 1;
 
                 /*
@@ -1336,6 +1710,8 @@ class AsicView
                 soAll.erase(currentObj->str_object_id);
                 sotAll.at(currentObj->meta_key.objecttype).erase(currentObj->str_object_id);
 
+                currentObj->setNotProcessedBucket(nullptr);
+
                 updateNonObjectIdVidReferenceCountByValue(currentObj, -1);
             }
 
@@ -1641,6 +2017,15 @@ class AsicView
          */
         std::map<sai_object_id_t, int> m_vidReference;
 
+        /**
+         * @brief Reverse reference index.
+         *
+         * VID is key, value is set of objects and attributes which are
+         * referring that VID. Updated together with m_vidReference for OID
+         * attributes, members of non object id structs are not indexed.
+         */
+        std::map<sai_object_id_t, std::multiset<VidReferrer, VidReferrerCompare>> m_vidReferrers;
+
         /**
          * @brief Asic operation ID.
          *
@@ -1671,8 +2056,166 @@ class AsicView
          */
         std::map<sai_object_id_t, int> m_vidToAsicOperationId;
 
-        void populateAttributes(
-                _In_ std::shared_ptr<SaiObj> &obj,
+        /**
+         * @brief Deserialize object and its attributes from dump entry.
+         *
+         * Doesn't access view, so it can be called from many threads.
+         *
+         * @param[in] strKey Object key in dump.
+         * @param[in] map Object attributes in dump.
+         *
+         * @return New object.
+         */
+        static std::shared_ptr<SaiObj> deserializeObject(
+                _In_ const std::string &strKey,
+                _In_ const swss::TableMap &map)
+        {
+            SWSS_LOG_ENTER();
+
+            auto start = strKey.find_first_of(":");
+
+            if (start == std::string::npos)
+            {
+                SWSS_LOG_THROW("failed to find colon in %s", strKey.c_str());
+            }
+
+            std::shared_ptr<SaiObj> o = std::make_shared<SaiObj>();
+
+            // TODO we could use sai deserialize object meta key
+
+            o->str_object_type  = strKey.substr(0, start);
+            o->str_object_id    = strKey.substr(start + 1);
+
+            sai_deserialize_object_type(o->str_object_type, o->meta_key.objecttype);
+
+            o->info = sai_metadata_get_object_type_info(o->meta_key.objecttype);
+
+            switch (o->meta_key.objecttype)
+            {
+                case SAI_OBJECT_TYPE_FDB_ENTRY:
+                    sai_deserialize_fdb_entry(o->str_object_id, o->meta_key.objectkey.key.fdb_entry);
+                    break;
+
+                case SAI_OBJECT_TYPE_NEIGHBOR_ENTRY:
+                    sai_deserialize_neighbor_entry(o->str_object_id, o->meta_key.objectkey.key.neighbor_entry);
+                    break;
+
+                case SAI_OBJECT_TYPE_ROUTE_ENTRY:
+                    sai_deserialize_route_entry(o->str_object_id, o->meta_key.objectkey.key.route_entry);
+                    break;
+
+                case SAI_OBJECT_TYPE_NAT_ENTRY:
+                    sai_deserialize_nat_entry(o->str_object_id, o->meta_key.objectkey.key.nat_entry);
+                    break;
+
+                default:
+
+                    if (o->info->isnonobjectid)
+                    {
+                        SWSS_LOG_THROW("object %s is non object id, not handled, FIXME", strKey.c_str());
+                    }
+
+                    sai_deserialize_object_id(o->str_object_id, o->meta_key.objectkey.key.object_id);
+
+                    break;
+            }
+
+            deserializeAttributes(o, map);
+
+            return o;
+        }
+
+        /**
+         * @brief Insert deserialized dump object to view.
+         *
+         * @param[in] o Object returned by deserializeObject.
+         */
+        void insertDumpObject(
+                _In_ const std::shared_ptr<SaiObj> &o)
+        {
+            SWSS_LOG_ENTER();
+
+            /*
+             * Since neighbor/route/fdb structs objects contains OIDs, we
+             * need to increase vid reference. With new metadata for SAI
+             * 1.0 this can be done in generic way for all non object ids.
+             */
+
+            switch (o->meta_key.objecttype)
+            {
+                case SAI_OBJECT_TYPE_FDB_ENTRY:
+                    soFdbs[o->str_object_id] = o;
+                    break;
+
+                case SAI_OBJECT_TYPE_NEIGHBOR_ENTRY:
+                    soNeighbors[o->str_object_id] = o;
+                    break;
+
+                case SAI_OBJECT_TYPE_ROUTE_ENTRY:
+                    soRoutes[o->str_object_id] = o;
+
+                    routesByPrefix[sai_serialize_ip_prefix(o->meta_key.objectkey.key.route_entry.destination)].push_back(o->str_object_id);
+
+                    break;
+
+                case SAI_OBJECT_TYPE_NAT_ENTRY:
+                    soNatEntries[o->str_object_id] = o;
+                    break;
+
+                default:
+
+                    soOids[o->str_object_id] = o;
+                    oOids[o->meta_key.objectkey.key.object_id] = o;
+
+                    break;
+            }
+
+            soAll[o->str_object_id] = o;
+            sotAll[o->meta_key.objecttype][o->str_object_id] = o;
+
+            o->setNotProcessedBucket(getNotProcessedBucket(o->meta_key.objecttype));
+
+            if (o->info->isnonobjectid)
+            {
+                updateNonObjectIdVidReferenceCountByValue(o, 1);
+            }
+            else
+            {
+                /*
+                 * Here is only object VID declaration, since we don't
+                 * know what objects were processed previously but on
+                 * some of previous object attributes this VID could be
+                 * used, so value can be already greater than zero, but
+                 * here we need to just mark that vid exists in
+                 * vidReference.
+                 */
+
+                m_vidReference[o->meta_key.objectkey.key.object_id] += 0;
+            }
+
+            /*
+             * Since attributes can contain OIDs we need to update
+             * reference count on them.
+             */
+
+            for (const auto &pair: o->getAllAttributes())
+            {
+                const auto &attr = pair.second;
+
+                for (auto const &vid: attr->getOidListFromAttribute())
+                {
+                    if (vid != SAI_NULL_OBJECT_ID)
+                    {
+                        m_vidReference[vid] += 1;
+
+                        insertVidReferrer(vid, o, attr->getAttrMetadata()->attrid);
+                    }
+                }
+            }
+        }
+
+        static void deserializeAttributes(
+                _In_ const std::shared_ptr<SaiObj> &obj,
                 _In_ const swss::TableMap &map)
         {
             SWSS_LOG_ENTER();
@@ -1725,19 +2268,6 @@ class AsicView
                 }
 
                 obj->setAttr(attr);
-
-                /*
-                 * Since attributes can contain OIDs we need to update
-                 * reference count on them.
-                 */
-
-                for (auto const &vid: attr->getOidListFromAttribute())
-                {
-                    if (vid != SAI_NULL_OBJECT_ID)
-                    {
-                        m_vidReference[vid] += 1;
-                    }
-                }
             }
         }
 
@@ -1801,14 +2331,22 @@ class AsicView
         AsicView& operator=(const SaiAttr&);
 };
 
+/**
+ * @brief Maximum number of threads deserializing single view.
+ */
+#define ASIC_VIEW_LOAD_MAX_WORKERS (8)
+
 void redisGetAsicView(
         _In_ const std::string &tableName,
-        _In_ AsicView &view)
+        _In_ AsicView &view,
+        _In_ WorkerPool *pool)
 {
     SWSS_LOG_ENTER();
 
     SWSS_LOG_TIMER("get asic view from %s", tableName.c_str());
 
+    // each view is loaded by different thread, so it needs own connection
+
     swss::DBConnector db("ASIC_DB", 0);
 
     swss::Table table(&db, tableName);
@@ -1817,11 +2355,47 @@ void redisGetAsicView(
 
     table.dump(dump);
 
-    view.fromDump(dump);
+    view.fromDump(dump, pool);
 
     SWSS_LOG_NOTICE("objects count for %s: %zu", tableName.c_str(), view.soAll.size());
 }
 
+/**
+ * @brief Load current and temporary view at the same time.
+ *
+ * Each view is read and deserialized by its own set of workers, available
+ * cores are split between both views.
+ */
+void redisGetAsicViews(
+        _In_ AsicView &current,
+        _In_ AsicView &temp)
+{
+    SWSS_LOG_ENTER();
+
+    SWSS_LOG_TIMER("get current and temporary asic view");
+
+    size_t workers = std::thread::hardware_concurrency() / 2;
+
+    workers = std::max((size_t)1, std::min(workers, (size_t)ASIC_VIEW_LOAD_MAX_WORKERS));
+
+    WorkerPool currentPool(workers);
+    WorkerPool tempPool(workers);
+
+    WorkerPool loader(2);
+
+    loader.run([&](size_t idx)
+    {
+        if (idx == 0)
+        {
+            redisGetAsicView(ASIC_STATE_TABLE, current, &currentPool);
+        }
+        else
+        {
+            redisGetAsicView(TEMP_PREFIX ASIC_STATE_TABLE, temp, &tempPool);
+        }
+    });
+}
+
 void checkObjectsStatus(
         _In_ const AsicView &view)
 {
@@ -2585,8 +3159,6 @@ std::shared_ptr<SaiObj> findCurrentBestMatchForLag(
      * same VID, since it will be the same in both views.
      */
 
-    const auto tmpLagMembersNP = temporaryView.getNotProcessedObjectsByObjectType(SAI_OBJECT_TYPE_LAG_MEMBER);
-
     /*
      * First we need to find at least 1 LAG member that belongs to temporary
      * object so we could extract port object.
@@ -2596,21 +3168,20 @@ std::shared_ptr<SaiObj> findCurrentBestMatchForLag(
 
     sai_object_id_t temporaryLagMemberPortVid = SAI_NULL_OBJECT_ID;
 
-    for (const auto &lagMember: tmpLagMembersNP)
-    {
-        // lag member attr lag should always exists on
-        const auto lagMemberLagAttr = lagMember->getSaiAttr(SAI_LAG_MEMBER_ATTR_LAG_ID);
+    const auto tmpLagMembersNP = temporaryView.getNotProcessedObjectsReferringVid(
+            tmpLagVid,
+            SAI_OBJECT_TYPE_LAG_MEMBER,
+            SAI_LAG_MEMBER_ATTR_LAG_ID);
 
-        if (lagMemberLagAttr->getSaiAttr()->value.oid == tmpLagVid)
-        {
-            SWSS_LOG_NOTICE("found temp LAG member %s which uses temp LAG %s",
-                    temporaryObj->str_object_id.c_str(),
-                    lagMember->str_object_id.c_str());
+    if (tmpLagMembersNP.size())
+    {
+        const auto &lagMember = tmpLagMembersNP.front();
 
-            temporaryLagMemberPortVid = lagMember->getSaiAttr(SAI_LAG_MEMBER_ATTR_PORT_ID)->getSaiAttr()->value.oid;
+        SWSS_LOG_NOTICE("found temp LAG member %s which uses temp LAG %s",
+                temporaryObj->str_object_id.c_str(),
+                lagMember->str_object_id.c_str());
 
-            break;
-        }
+        temporaryLagMemberPortVid = lagMember->getSaiAttr(SAI_LAG_MEMBER_ATTR_PORT_ID)->getSaiAttr()->value.oid;
     }
 
     if (temporaryLagMemberPortVid == SAI_NULL_OBJECT_ID)
@@ -2626,37 +3197,34 @@ std::shared_ptr<SaiObj> findCurrentBestMatchForLag(
      * current view.
      */
 
-    const auto curLagMembersNP = currentView.getNotProcessedObjectsByObjectType(SAI_OBJECT_TYPE_LAG_MEMBER);
+    const auto curLagMembersNP = currentView.getNotProcessedObjectsReferringVid(
+            temporaryLagMemberPortVid,
+            SAI_OBJECT_TYPE_LAG_MEMBER,
+            SAI_LAG_MEMBER_ATTR_PORT_ID);
 
     for (const auto &lagMember: curLagMembersNP)
     {
-        // lag member attr lag should always exists on
-        const auto lagMemberPortAttr = lagMember->getSaiAttr(SAI_LAG_MEMBER_ATTR_PORT_ID);
-
-        if (lagMemberPortAttr->getSaiAttr()->value.oid == temporaryLagMemberPortVid)
-        {
-            SWSS_LOG_NOTICE("found current LAG member %s which uses PORT %s",
-                    lagMember->str_object_id.c_str(),
-                    sai_serialize_object_id(temporaryLagMemberPortVid).c_str());
+        SWSS_LOG_NOTICE("found current LAG member %s which uses PORT %s",
+                lagMember->str_object_id.c_str(),
+                sai_serialize_object_id(temporaryLagMemberPortVid).c_str());
 
-            /*
-             * We found LAG member which uses the same PORT VID, let's extract
-             * LAG and check if this LAG is on the candidate list.
-             */
+        /*
+         * We found LAG member which uses the same PORT VID, let's extract
+         * LAG and check if this LAG is on the candidate list.
+         */
 
-            sai_object_id_t currentLagVid = lagMember->getSaiAttr(SAI_LAG_MEMBER_ATTR_LAG_ID)->getSaiAttr()->value.oid;
+        sai_object_id_t currentLagVid = lagMember->getSaiAttr(SAI_LAG_MEMBER_ATTR_LAG_ID)->getSaiAttr()->value.oid;
 
-            for (auto &c: candidateObjects)
+        for (auto &c: candidateObjects)
+        {
+            if (c.obj->getVid() == currentLagVid)
             {
-                if (c.obj->getVid() == currentLagVid)
-                {
-                    SWSS_LOG_NOTICE("found best candidate for temp LAG %s which is current LAG %s using PORT %s",
-                            temporaryObj->str_object_id.c_str(),
-                            sai_serialize_object_id(currentLagVid).c_str(),
-                            sai_serialize_object_id(temporaryLagMemberPortVid).c_str());
+                SWSS_LOG_NOTICE("found best candidate for temp LAG %s which is current LAG %s using PORT %s",
+                        temporaryObj->str_object_id.c_str(),
+                        sai_serialize_object_id(currentLagVid).c_str(),
+                        sai_serialize_object_id(temporaryLagMemberPortVid).c_str());
 
-                    return c.obj;
-                }
+                return c.obj;
             }
         }
     }
@@ -2685,50 +3253,56 @@ std::shared_ptr<SaiObj> findCurrentBestMatchForNextHopGroup(
      * First find route entries on which temporary NHG is assigned.
      */
 
-    const auto tmpRouteEntries = temporaryView.getNotProcessedObjectsByObjectType(SAI_OBJECT_TYPE_ROUTE_ENTRY);
-
-    std::shared_ptr<SaiObj> tmpRouteCandidate = nullptr;
+    const auto tmpRouteEntries = temporaryView.getNotProcessedObjectsReferringVid(
+            temporaryObj->getVid(),
+            SAI_OBJECT_TYPE_ROUTE_ENTRY,
+            SAI_ROUTE_ENTRY_ATTR_NEXT_HOP_ID);
 
-    for (auto tmpRoute: tmpRouteEntries)
+    if (tmpRouteEntries.empty())
     {
-        if (!tmpRoute->hasAttr(SAI_ROUTE_ENTRY_ATTR_NEXT_HOP_ID))
-            continue;
+        SWSS_LOG_NOTICE("failed to find route candidate for NHG: %s",
+                temporaryObj->str_object_id.c_str());
 
-        const auto routeNH = tmpRoute->getSaiAttr(SAI_ROUTE_ENTRY_ATTR_NEXT_HOP_ID);
+        return nullptr;
+    }
 
-        if (routeNH->getSaiAttr()->value.oid != temporaryObj->getVid())
-            continue;
+    const auto &tmpRouteCandidate = tmpRouteEntries.front();
 
-        tmpRouteCandidate = tmpRoute;
+    SWSS_LOG_NOTICE("Found route candidate for NHG: %s: %s",
+            temporaryObj->str_object_id.c_str(),
+            tmpRouteCandidate->str_object_id.c_str());
 
-        SWSS_LOG_NOTICE("Found route candidate for NHG: %s: %s",
-                temporaryObj->str_object_id.c_str(),
-                tmpRoute->str_object_id.c_str());
+    /*
+     * We found route candidate, then let's find the same route on the candidate side.
+     * But we will only compare prefix value.
+     *
+     * Routes by prefix are indexed when view is populated, routes removed
+     * since then are not present in route map any more.
+     */
 
-        break;
-    }
+    std::string tmpPrefix = sai_serialize_ip_prefix(tmpRouteCandidate->meta_key.objectkey.key.route_entry.destination);
 
-    if (tmpRouteCandidate == nullptr)
+    auto it = currentView.routesByPrefix.find(tmpPrefix);
+
+    if (it == currentView.routesByPrefix.end())
     {
-        SWSS_LOG_NOTICE("failed to find route candidate for NHG: %s",
+        SWSS_LOG_NOTICE("failed to find current route with prefix %s for NHG: %s",
+                tmpPrefix.c_str(),
                 temporaryObj->str_object_id.c_str());
 
         return nullptr;
     }
 
-    /*
-     * We found route candidate, then let's find the same route on the candidate side.
-     * But we will only compare prefix value.
-     */
+    for (const auto &strRouteEntry: it->second)
+    {
+        auto rit = currentView.soRoutes.find(strRouteEntry);
 
-    const auto curRouteEntries = currentView.getNotProcessedObjectsByObjectType(SAI_OBJECT_TYPE_ROUTE_ENTRY);
+        if (rit == currentView.soRoutes.end())
+            continue;
 
-    for (auto curRoute: curRouteEntries)
-    {
-        std::string tmpPrefix = sai_serialize_ip_prefix(tmpRouteCandidate->meta_key.objectkey.key.route_entry.destination);
-        std::string curPrefix = sai_serialize_ip_prefix(curRoute->meta_key.objectkey.key.route_entry.destination);
+        const auto &curRoute = rit->second;
 
-        if (tmpPrefix != curPrefix)
+        if (curRoute->getObjectStatus() != SAI_OBJECT_STATUS_NOT_PROCESSED)
             continue;
 
         /*
@@ -2908,31 +3482,23 @@ std::shared_ptr<SaiObj> findCurrentBestMatchForAclTableGroup(
      * temporary and current view.
      */
 
-    const auto ports = temporaryView.getObjectsByObjectType(SAI_OBJECT_TYPE_PORT);
-
-    std::vector<int> aclPortAttrs = {
+    std::vector<sai_attr_id_t> aclPortAttrs = {
         SAI_PORT_ATTR_INGRESS_ACL,
         SAI_PORT_ATTR_EGRESS_ACL,
     };
 
     for (auto attrId: aclPortAttrs)
     {
+        const auto ports = temporaryView.getObjectsReferringVid(temporaryObj->getVid(), SAI_OBJECT_TYPE_PORT, attrId);
+
         for (auto port: ports)
         {
-            auto portAcl = port->tryGetSaiAttr(attrId);
-
-            if (portAcl == nullptr)
-                continue;
-
-            if (portAcl ->getSaiAttr()->value.oid != temporaryObj->getVid())
-                continue;
-
             SWSS_LOG_DEBUG("found port candidate %s for ACL table group",
                     port->str_object_id.c_str());
 
             auto curPort = currentView.oOids.at(port->getVid());
 
-            portAcl = curPort->tryGetSaiAttr(attrId);
+            auto portAcl = curPort->tryGetSaiAttr(attrId);
 
             if (portAcl == nullptr)
                 continue;
@@ -2962,18 +3528,10 @@ std::shared_ptr<SaiObj> findCurrentBestMatchForAclTableGroup(
 
     // TODO this could be helper method, since we will need this for router interface
 
-    const auto tmpLags = temporaryView.getObjectsByObjectType(SAI_OBJECT_TYPE_LAG);
+    const auto tmpLags = temporaryView.getObjectsReferringVid(temporaryObj->getVid(), SAI_OBJECT_TYPE_LAG, SAI_LAG_ATTR_INGRESS_ACL);
 
     for (auto tmpLag: tmpLags)
     {
-        if (!tmpLag->hasAttr(SAI_LAG_ATTR_INGRESS_ACL))
-            continue;
-
-        auto inACL = tmpLag->getSaiAttr(SAI_LAG_ATTR_INGRESS_ACL);
-
-        if (inACL->getSaiAttr()->value.oid != temporaryObj->getVid())
-            continue;
-
         /*
          * We found LAG on which this ACL is present, but this object status is
          * not processed so we need to trace back to port using LAG member.
@@ -2981,15 +3539,13 @@ std::shared_ptr<SaiObj> findCurrentBestMatchForAclTableGroup(
 
         SWSS_LOG_INFO("found LAG candidate: lag status %d", tmpLag->getObjectStatus());
 
-        const auto tmpLagMembers = temporaryView.getNotProcessedObjectsByObjectType(SAI_OBJECT_TYPE_LAG_MEMBER);
+        const auto tmpLagMembers = temporaryView.getNotProcessedObjectsReferringVid(
+                tmpLag->getVid(),
+                SAI_OBJECT_TYPE_LAG_MEMBER,
+                SAI_LAG_MEMBER_ATTR_LAG_ID);
 
         for (auto tmpLagMember: tmpLagMembers)
         {
-            const auto tmpLagMemberLagAttr = tmpLagMember->getSaiAttr(SAI_LAG_MEMBER_ATTR_LAG_ID);
-
-            if (tmpLagMemberLagAttr->getSaiAttr()->value.oid != tmpLag->getVid())
-                continue;
-
             const auto tmpLagMemberPortAttr = tmpLagMember->getSaiAttr(SAI_LAG_MEMBER_ATTR_PORT_ID);
 
             sai_object_id_t tmpPortVid = tmpLagMemberPortAttr->getSaiAttr()->value.oid;
@@ -3000,15 +3556,13 @@ std::shared_ptr<SaiObj> findCurrentBestMatchForAclTableGroup(
 
             sai_object_id_t curPortVid = currentView.ridToVid.at(portRid);
 
-            const auto curLagMembers = currentView.getNotProcessedObjectsByObjectType(SAI_OBJECT_TYPE_LAG_MEMBER);
+            const auto curLagMembers = currentView.getNotProcessedObjectsReferringVid(
+                    curPortVid,
+                    SAI_OBJECT_TYPE_LAG_MEMBER,
+                    SAI_LAG_MEMBER_ATTR_PORT_ID);
 
             for (auto curLagMember: curLagMembers)
             {
-                const auto curLagMemberPortAttr = curLagMember->getSaiAttr(SAI_LAG_MEMBER_ATTR_PORT_ID);
-
-                if (curLagMemberPortAttr->getSaiAttr()->value.oid != curPortVid)
-                    continue;
-
                 const auto curLagMemberLagAttr = curLagMember->getSaiAttr(SAI_LAG_MEMBER_ATTR_LAG_ID);
 
                 sai_object_id_t curLagId = curLagMemberLagAttr->getSaiAttr()->value.oid;
@@ -3020,7 +3574,7 @@ std::shared_ptr<SaiObj> findCurrentBestMatchForAclTableGroup(
                 if (!curLag->hasAttr(SAI_LAG_ATTR_INGRESS_ACL))
                     continue;
 
-                inACL = curLag->getSaiAttr(SAI_LAG_ATTR_INGRESS_ACL);
+                auto inACL = curLag->getSaiAttr(SAI_LAG_ATTR_INGRESS_ACL);
 
                 for (auto c: candidateObjects)
                 {
@@ -3132,7 +3686,7 @@ std::shared_ptr<SaiObj> findCurrentBestMatchForAclTable(
 
     // try using pre match in this case
 
-    const auto tmpMembers = temporaryView.getNotProcessedObjectsByObjectType(SAI_OBJECT_TYPE_ACL_TABLE_GROUP_MEMBER);
+    const auto &tmpMembers = temporaryView.getNotProcessedObjectsByObjectType(SAI_OBJECT_TYPE_ACL_TABLE_GROUP_MEMBER);
 
     for (auto tmpAclTableGroupMember: tmpMembers)
     {
@@ -3150,7 +3704,7 @@ std::shared_ptr<SaiObj> findCurrentBestMatchForAclTable(
         if (it == temporaryView.preMatchMap.end())
             continue;
 
-        auto curAclTableGroupMembers = currentView.getNotProcessedObjectsByObjectType(SAI_OBJECT_TYPE_ACL_TABLE_GROUP_MEMBER);
+        const auto &curAclTableGroupMembers = currentView.getNotProcessedObjectsByObjectType(SAI_OBJECT_TYPE_ACL_TABLE_GROUP_MEMBER);
 
         for (auto curAclTableGroupMember: curAclTableGroupMembers)
         {
@@ -3205,7 +3759,7 @@ std::shared_ptr<SaiObj> findCurrentBestMatchForRouterInterface(
         return nullptr;
     }
 
-    const auto tmpTunnels = temporaryView.getNotProcessedObjectsByObjectType(SAI_OBJECT_TYPE_TUNNEL);
+    const auto &tmpTunnels = temporaryView.getNotProcessedObjectsByObjectType(SAI_OBJECT_TYPE_TUNNEL);
 
     for (auto tmpTunnel: tmpTunnels)
     {
@@ -3221,7 +3775,7 @@ std::shared_ptr<SaiObj> findCurrentBestMatchForRouterInterface(
 
         const std::string tmpSrcIP = tmpTunnel->getSaiAttr(SAI_TUNNEL_ATTR_ENCAP_SRC_IP)->getStrAttrValue();
 
-        const auto curTunnels = currentView.getNotProcessedObjectsByObjectType(SAI_OBJECT_TYPE_TUNNEL);
+        const auto &curTunnels = currentView.getNotProcessedObjectsByObjectType(SAI_OBJECT_TYPE_TUNNEL);
 
         for (auto curTunnel: curTunnels)
         {
@@ -3288,11 +3842,11 @@ std::shared_ptr<SaiObj> findCurrentBestMatchForRouterInterface(
 
     for (auto tmpTunnel: tmpTunnels)
     {
-        const auto curTunnels = currentView.getNotProcessedObjectsByObjectType(SAI_OBJECT_TYPE_TUNNEL);
+        const auto &curTunnels = currentView.getNotProcessedObjectsByObjectType(SAI_OBJECT_TYPE_TUNNEL);
 
         for (auto curTunnel: curTunnels)
         {
-            const auto tmpTunnelTermTableEtnries = temporaryView.getNotProcessedObjectsByObjectType(SAI_OBJECT_TYPE_TUNNEL_TERM_TABLE_ENTRY);
+            const auto &tmpTunnelTermTableEtnries = temporaryView.getNotProcessedObjectsByObjectType(SAI_OBJECT_TYPE_TUNNEL_TERM_TABLE_ENTRY);
 
             for (auto tmpTunnelTermTableEntry: tmpTunnelTermTableEtnries)
             {
@@ -3309,7 +3863,7 @@ std::shared_ptr<SaiObj> findCurrentBestMatchForRouterInterface(
                 if (tmpTunnelId->getOid() != tmpTunnel->getVid())   // not this tunnel
                     continue;
 
-                const auto curTunnelTermTableEtnries = currentView.getNotProcessedObjectsByObjectType(SAI_OBJECT_TYPE_TUNNEL_TERM_TABLE_ENTRY);
+                const auto &curTunnelTermTableEtnries = currentView.getNotProcessedObjectsByObjectType(SAI_OBJECT_TYPE_TUNNEL_TERM_TABLE_ENTRY);
 
                 for (auto curTunnelTermTableEntry: curTunnelTermTableEtnries)
                 {
@@ -3577,7 +4131,7 @@ std::shared_ptr<SaiObj> findCurrentBestMatchForBufferPool(
      * priority group or queue. Those two should be already matched.
      */
 
-    const auto tmpBufferProfiles = temporaryView.getNotProcessedObjectsByObjectType(SAI_OBJECT_TYPE_BUFFER_PROFILE);
+    const auto &tmpBufferProfiles = temporaryView.getNotProcessedObjectsByObjectType(SAI_OBJECT_TYPE_BUFFER_PROFILE);
 
     for (auto tmpBufferProfile: tmpBufferProfiles)
     {
@@ -4093,257 +4647,299 @@ std::shared_ptr<SaiAttr> getSaiAttrFromDefaultValue(
         _In_ const AsicView &currentView,
         _In_ const sai_attr_metadata_t &meta);
 
-std::shared_ptr<SaiObj> findCurrentBestMatchForGenericObject(
-        _In_ const AsicView &currentView,
-        _In_ const AsicView &temporaryView,
-        _In_ const std::shared_ptr<const SaiObj> &temporaryObj)
-{
-    SWSS_LOG_ENTER();
+/**
+ * @brief Check whether attribute can be used to pre filter candidates.
+ *
+ * For primitive attributes hasEqualAttribute compares only serialized values,
+ * so current object which has CREATE_ONLY attribute with different value is
+ * never a generic best match candidate.
+ *
+ * @param attr Attribute to be checked.
+ *
+ * @return True if attribute can be used to pre filter candidates.
+ */
+bool isCreateOnlyPrimitiveAttr(
+        _In_ const std::shared_ptr<const SaiAttr> &attr)
+{
+    SWSS_LOG_ENTER();
 
-    /*
-     * This method will try to find current best match object for a given
-     * temporary object. This method should be used only on object id objects,
-     * since non object id structures also contains object id which in this
-     * case are not take into account. Besides for objects like FDB, ROUTE or
-     * NEIGHBOR we can do quick hash lookup instead of looping for all objects
-     * where there can be a lot of them.
-     *
-     * Special case here we can add later on is VLAN, since we can have a lot
-     * of VLANS so instead looking via all of them we just need to make sure
-     * that we will create reverse map via VLAN_ID KEY and then we can make
-     * hash lookup to see if such vlan is present.
-     */
+    const sai_attr_metadata_t* meta = attr->getAttrMetadata();
 
-    /*
-     * Since our system design is to restart orchagent without restarting syncd
-     * and recreating objects and reassign new VIDs created inside orchagent,
-     * in our most cases values of objects will not change.  This will cause to
-     * make our comparison logic here fairly simple:
-     *
-     * Find all objects that have the same equal attributes on current object
-     * and choose the one with the most attributes that match current and
-     * temporary object.
-     *
-     * This seems simple, but there are a lot of cases that needs to be taken
-     * into account:
-     *
-     * - what if we have several objects with the same number of equal
-     *   attributes then we can choose at random or implement some heuristic
-     *   logic to try figure out which of those objects will be the best, even
-     *   then if we choose wrong object, then there can be a lot of removes and
-     *   recreating objects on the ASIC
-     *
-     * - what if in temporary object CREATE_ONLY attributes don't match but
-     *   many of CREATE_AND_SET are the same, in that case we can choose object
-     *   with most matching attributes, but object will still needs to be
-     *   destroyed because we need to set new CREATE_ONLY attributes
-     *
-     * - there are also cases with default values of attributes where attribute
-     *   is present only in one object but on other one it have default value
-     *   and this default value is the same as the one in attribute
-     *
-     * - another case is for objects that needs to be removed since there are
-     *   no corresponding objects in temporary view, but they can't be removed,
-     *   objects like PORT or default QUEUEs or INGRESS_PRIORITY_GROUPs, then
-     *   we need to bring their current set values to default ones, which also
-     *   can be challenging since we need to know previous default value and it
-     *   could be assigned by switch internally, like default MAC address or
-     *   default TRAP group etc
-     *
-     * - there is also interesting case with KEYs attributes which when
-     *   doing remove/create they needs to be removed first since
-     *   we can't have 2 identical cases
-     *
-     * There are a lot of aspects to consider here, in here we will cake only
-     * couple of them in consideration, and other will be taken care inside
-     * processObjectForViewTransition method which will handle all other cases
-     * not mentioned here.
-     */
+    return SAI_HAS_FLAG_CREATE_ONLY(meta->flags) &&
+        meta->attrvaluetype != SAI_ATTR_VALUE_TYPE_POINTER &&
+        meta->attrvaluetype != SAI_ATTR_VALUE_TYPE_QOS_MAP_LIST &&
+        !attr->isObjectIdAttr();
+}
 
-    /*
-     * First check if object is oid object, if yes, check if it status is
-     * matched.
-     */
+/**
+ * @brief Get index of not processed objects by primitive CREATE_ONLY attributes.
+ *
+ * Index is built on first call for given object type.
+ *
+ * @param currentView Current view.
+ * @param object_type Object type of indexed objects.
+ *
+ * @return Index of objects by attribute id.
+ */
+const std::map<sai_attr_id_t, CreateOnlyAttrIndex>& getCreateOnlyAttrIndex(
+        _In_ const AsicView &currentView,
+        _In_ sai_object_type_t object_type)
+{
+    SWSS_LOG_ENTER();
 
-    if (!temporaryObj->isOidObject())
+    auto it = currentView.createOnlyAttrIndex.find(object_type);
+
+    if (it != currentView.createOnlyAttrIndex.end())
     {
-        SWSS_LOG_THROW("non object id %s is used in generic method, please implement special case, FIXME",
-                temporaryObj->str_object_type.c_str());
+        return it->second;
     }
 
-    /*
-     * Get not processed objects of temporary object type, and all attributes
-     * that are set on that object. This function should be used only on oid
-     * object ids, since for non object id finding best match is based on
-     * struct entry of object id.
-     */
+    auto &index = currentView.createOnlyAttrIndex[object_type];
 
-    sai_object_type_t object_type = temporaryObj->getObjectType();
+    const auto &notProcessedObjects = currentView.getNotProcessedObjectsByObjectType(object_type);
 
-    const auto notProcessedObjects = currentView.getNotProcessedObjectsByObjectType(object_type);
+    for (const auto &obj: notProcessedObjects)
+    {
+        for (const auto &attr: obj->getAllAttributes())
+        {
+            if (isCreateOnlyPrimitiveAttr(attr.second))
+            {
+                index[attr.first];
+            }
+        }
+    }
 
-    const auto attrs = temporaryObj->getAllAttributes();
+    for (const auto &obj: notProcessedObjects)
+    {
+        for (auto &p: index)
+        {
+            auto attr = obj->tryGetSaiAttr(p.first);
 
-    /*
-     * Complexity here is O((n^2)*m) since we iterate via all not processed
-     * objects, then we iterate through all present attributes.  N is squared
-     * since for given object type we iterate via entire list for each object,
-     * this can be optimized a little bit inside AsicView class.
-     */
+            if (attr == nullptr)
+            {
+                p.second.withoutAttr.push_back(obj);
+            }
+            else
+            {
+                p.second.withValue[attr->getStrAttrValue()].push_back(obj);
+            }
+        }
+    }
 
-    SWSS_LOG_INFO("not processed objects for %s: %zu, attrs: %zu",
-            temporaryObj->str_object_type.c_str(),
+    SWSS_LOG_INFO("built create only attributes index for %s: %zu objects, %zu attributes",
+            sai_serialize_object_type(object_type).c_str(),
             notProcessedObjects.size(),
-            attrs.size());
+            index.size());
 
-    std::vector<sai_object_compare_info_t> candidateObjects;
+    return index;
+}
 
-    for (const auto &currentObj: notProcessedObjects)
-    {
-        sai_object_compare_info_t soci = { 0, currentObj };
+/**
+ * @brief Get current objects which can be generic best match candidates.
+ *
+ * Most selective primitive CREATE_ONLY attribute of temporary object is used.
+ * Current object which has this attribute with different value would be
+ * disqualified by generic best match anyway, so only not processed objects
+ * with the same value and objects without this attribute are returned. Those
+ * are still compared attribute by attribute, including default values, so
+ * selected candidates are the same as when all objects are compared.
+ *
+ * @param currentView Current view.
+ * @param temporaryObj Temporary object.
+ * @param objects Output objects, ordered by object string id.
+ *
+ * @return False if temporary object has no attribute which could be used,
+ * and all not processed objects need to be compared.
+ */
+bool getCreateOnlyAttrPreFilteredObjects(
+        _In_ const AsicView &currentView,
+        _In_ const std::shared_ptr<const SaiObj> &temporaryObj,
+        _Out_ std::vector<std::shared_ptr<SaiObj>> &objects)
+{
+    SWSS_LOG_ENTER();
 
-        bool has_different_create_only_attr = false;
+    objects.clear();
 
-        /*
-         * NOTE: we only iterate by attributes that are present in temporary
-         * view. It may happen that current view has some additional attributes
-         * set that are create only and value can't be updated then, so in that
-         * case such object must be disqualified from being candidate.
-         */
+    static const std::vector<std::shared_ptr<SaiObj>> empty;
+
+    const auto &index = getCreateOnlyAttrIndex(currentView, temporaryObj->getObjectType());
+
+    const std::vector<std::shared_ptr<SaiObj>> *bestWithValue = nullptr;
+    const std::vector<std::shared_ptr<SaiObj>> *bestWithoutAttr = nullptr;
 
-        for (const auto &attr: attrs)
+    for (const auto &attr: temporaryObj->getAllAttributes())
+    {
+        if (!isCreateOnlyPrimitiveAttr(attr.second))
         {
-            sai_attr_id_t attrId = attr.first;
+            continue;
+        }
 
-            /*
-             * Function hasEqualAttribute check if attribute exists on both objects.
-             */
+        auto it = index.find(attr.first);
 
-            if (hasEqualAttribute(currentView, temporaryView, currentObj, temporaryObj, attrId))
-            {
-                soci.equal_attributes++;
+        if (it == index.end())
+        {
+            // no current object has this attribute, so nothing is filtered
 
-                SWSS_LOG_INFO("ob equal %s %s, %s: %s",
-                        temporaryObj->str_object_id.c_str(),
-                        currentObj->str_object_id.c_str(),
-                        attr.second->getStrAttrId().c_str(),
-                        attr.second->getStrAttrValue().c_str());
-            }
-            else
-            {
-                SWSS_LOG_INFO("ob not equal %s %s, %s: %s",
-                        temporaryObj->str_object_id.c_str(),
-                        currentObj->str_object_id.c_str(),
-                        attr.second->getStrAttrId().c_str(),
-                        attr.second->getStrAttrValue().c_str());
+            continue;
+        }
 
-                /*
-                 * Function hasEqualAttribute returns true only when both
-                 * attributes are existing and both are equal, so here it
-                 * returned false, so it may mean 2 things:
-                 *
-                 * - attribute doesn't exist in current view, or
-                 * - attributes are different
-                 *
-                 * If we check if attribute also exists in current view and has
-                 * CREATE_ONLY flag then attributes are different and we
-                 * disqualify this object since new temporary object needs to
-                 * pass new different attribute with CREATE_ONLY flag.
-                 *
-                 * Case when attribute doesn't exist is much more complicated
-                 * since it maybe conditional and have default value, we will
-                 * do that check when we select best match.
-                 */
+        auto vit = it->second.withValue.find(attr.second->getStrAttrValue());
 
-                /*
-                 * Get attribute metadata to see if contains CREATE_ONLY flag.
-                 */
+        const auto &withValue = (vit == it->second.withValue.end()) ? empty : vit->second;
 
-                const sai_attr_metadata_t* meta = attr.second->getAttrMetadata();
+        if (bestWithValue == nullptr ||
+                withValue.size() + it->second.withoutAttr.size() < bestWithValue->size() + bestWithoutAttr->size())
+        {
+            bestWithValue = &withValue;
+            bestWithoutAttr = &it->second.withoutAttr;
+        }
+    }
 
-                if (SAI_HAS_FLAG_CREATE_ONLY(meta->flags) && currentObj->hasAttr(attrId))
-                {
-                    has_different_create_only_attr = true;
+    if (bestWithValue == nullptr)
+    {
+        return false;
+    }
 
-                    SWSS_LOG_INFO("obj has not equal create only attributes %s",
-                            temporaryObj->str_object_id.c_str());
+    for (const auto *list: { bestWithValue, bestWithoutAttr })
+    {
+        for (const auto &obj: *list)
+        {
+            if (obj->getObjectStatus() == SAI_OBJECT_STATUS_NOT_PROCESSED)
+            {
+                objects.push_back(obj);
+            }
+        }
+    }
 
-                    /*
-                     * In this case there is no need to compare other
-                     * attributes since we won't be able to update them anyway.
-                     */
+    /*
+     * Keep the same order as not processed objects, since candidates order
+     * matters when there are ties.
+     */
 
-                    break;
-                }
+    std::sort(objects.begin(), objects.end(), SaiObjStrIdCompare());
 
-                if (SAI_HAS_FLAG_CREATE_ONLY(meta->flags) && !currentObj->hasAttr(attrId))
-                {
-                    /*
-                     * This attribute exists only on temporary view and it's
-                     * create only.  If it has default value, check if it's the
-                     * same as current.
-                     */
+    SWSS_LOG_INFO("pre filtered not processed objects for %s: %zu",
+            temporaryObj->str_object_id.c_str(),
+            objects.size());
 
-                    auto curDefault = getSaiAttrFromDefaultValue(currentView, *meta);
+    return true;
+}
 
-                    if (curDefault != nullptr)
-                    {
-                        if (curDefault->getStrAttrValue() != attr.second->getStrAttrValue())
-                        {
-                            has_different_create_only_attr = true;
+/**
+ * @brief Compare current object with temporary object for generic best match.
+ *
+ * @param currentView Current view.
+ * @param temporaryView Temporary view.
+ * @param currentObj Current object.
+ * @param temporaryObj Temporary object.
+ * @param soci Compare info, number of equal attributes is updated.
+ *
+ * @return True if current object is candidate, false if it's disqualified by
+ * different CREATE_ONLY attribute.
+ */
+bool compareGenericObjectCandidate(
+        _In_ const AsicView &currentView,
+        _In_ const AsicView &temporaryView,
+        _In_ const std::shared_ptr<SaiObj> &currentObj,
+        _In_ const std::shared_ptr<const SaiObj> &temporaryObj,
+        _Inout_ sai_object_compare_info_t &soci)
+{
+    SWSS_LOG_ENTER();
 
-                            SWSS_LOG_INFO("obj has not equal create only attributes %s (default): %s",
-                                    temporaryObj->str_object_id.c_str(),
-                                    meta->attridname);
-                            break;
-                        }
-                        else
-                        {
-                            SWSS_LOG_INFO("obj has equal create only value %s (default): %s",
-                                    temporaryObj->str_object_id.c_str(),
-                                    meta->attridname);
-                        }
-                    }
-                }
-            }
-        }
+    const auto &attrs = temporaryObj->getAllAttributes();
+
+    bool has_different_create_only_attr = false;
+
+    /*
+     * NOTE: we only iterate by attributes that are present in temporary
+     * view. It may happen that current view has some additional attributes
+     * set that are create only and value can't be updated then, so in that
+     * case such object must be disqualified from being candidate.
+     */
+
+    for (const auto &attr: attrs)
+    {
+        sai_attr_id_t attrId = attr.first;
 
         /*
-         * Before we add this object as candidate, see if there are some create
-         * only attributes which are not present in temporary object but
-         * present in current, and if there is default value that is the same.
+         * Function hasEqualAttribute check if attribute exists on both objects.
          */
 
-        const auto curAttrs = currentObj->getAllAttributes();
+        if (hasEqualAttribute(currentView, temporaryView, currentObj, temporaryObj, attrId))
+        {
+            soci.equal_attributes++;
 
-        for (auto curAttr: curAttrs)
+            SWSS_LOG_INFO("ob equal %s %s, %s: %s",
+                    temporaryObj->str_object_id.c_str(),
+                    currentObj->str_object_id.c_str(),
+                    attr.second->getStrAttrId().c_str(),
+                    attr.second->getStrAttrValue().c_str());
+        }
+        else
         {
-            if (attrs.find(curAttr.first) != attrs.end())
+            SWSS_LOG_INFO("ob not equal %s %s, %s: %s",
+                    temporaryObj->str_object_id.c_str(),
+                    currentObj->str_object_id.c_str(),
+                    attr.second->getStrAttrId().c_str(),
+                    attr.second->getStrAttrValue().c_str());
+
+            /*
+             * Function hasEqualAttribute returns true only when both
+             * attributes are existing and both are equal, so here it
+             * returned false, so it may mean 2 things:
+             *
+             * - attribute doesn't exist in current view, or
+             * - attributes are different
+             *
+             * If we check if attribute also exists in current view and has
+             * CREATE_ONLY flag then attributes are different and we
+             * disqualify this object since new temporary object needs to
+             * pass new different attribute with CREATE_ONLY flag.
+             *
+             * Case when attribute doesn't exist is much more complicated
+             * since it maybe conditional and have default value, we will
+             * do that check when we select best match.
+             */
+
+            /*
+             * Get attribute metadata to see if contains CREATE_ONLY flag.
+             */
+
+            const sai_attr_metadata_t* meta = attr.second->getAttrMetadata();
+
+            if (SAI_HAS_FLAG_CREATE_ONLY(meta->flags) && currentObj->hasAttr(attrId))
             {
-                // attr exists in both objects.
-                continue;
-            }
+                has_different_create_only_attr = true;
+
+                SWSS_LOG_INFO("obj has not equal create only attributes %s",
+                        temporaryObj->str_object_id.c_str());
+
+                /*
+                 * In this case there is no need to compare other
+                 * attributes since we won't be able to update them anyway.
+                 */
 
-            const sai_attr_metadata_t* meta = curAttr.second->getAttrMetadata();
+                break;
+            }
 
-            if (SAI_HAS_FLAG_CREATE_ONLY(meta->flags) && !temporaryObj->hasAttr(curAttr.first))
+            if (SAI_HAS_FLAG_CREATE_ONLY(meta->flags) && !currentObj->hasAttr(attrId))
             {
                 /*
-                 * This attribute exists only on current view and it's
+                 * This attribute exists only on temporary view and it's
                  * create only.  If it has default value, check if it's the
                  * same as current.
                  */
 
-                auto tmpDefault = getSaiAttrFromDefaultValue(temporaryView, *meta);
+                auto curDefault = getSaiAttrFromDefaultValue(currentView, *meta);
 
-                if (tmpDefault != nullptr)
+                if (curDefault != nullptr)
                 {
-                    if (tmpDefault->getStrAttrValue() != curAttr.second->getStrAttrValue())
+                    if (curDefault->getStrAttrValue() != attr.second->getStrAttrValue())
                     {
                         has_different_create_only_attr = true;
 
                         SWSS_LOG_INFO("obj has not equal create only attributes %s (default): %s",
-                                currentObj->str_object_id.c_str(),
+                                temporaryObj->str_object_id.c_str(),
                                 meta->attridname);
                         break;
                     }
@@ -4356,451 +4952,421 @@ std::shared_ptr<SaiObj> findCurrentBestMatchForGenericObject(
                 }
             }
         }
+    }
 
-        if (has_different_create_only_attr)
-        {
-            /*
-             * Those objects differs with attribute which is marked as
-             * CREATE_ONLY so we will not be able to update current if
-             * necessary using SET operations.
-             */
+    /*
+     * Before we add this object as candidate, see if there are some create
+     * only attributes which are not present in temporary object but
+     * present in current, and if there is default value that is the same.
+     */
+
+    const auto curAttrs = currentObj->getAllAttributes();
 
+    for (auto curAttr: curAttrs)
+    {
+        if (attrs.find(curAttr.first) != attrs.end())
+        {
+            // attr exists in both objects.
             continue;
         }
 
-        candidateObjects.push_back(soci);
-    }
+        const sai_attr_metadata_t* meta = curAttr.second->getAttrMetadata();
 
-    SWSS_LOG_INFO("number candidate objects for %s is %zu",
-            temporaryObj->str_object_id.c_str(),
-            candidateObjects.size());
+        if (SAI_HAS_FLAG_CREATE_ONLY(meta->flags) && !temporaryObj->hasAttr(curAttr.first))
+        {
+            /*
+             * This attribute exists only on current view and it's
+             * create only.  If it has default value, check if it's the
+             * same as current.
+             */
 
-    if (candidateObjects.size() == 0)
-    {
-        /*
-         * We didn't found any object.
-         */
+            auto tmpDefault = getSaiAttrFromDefaultValue(temporaryView, *meta);
 
-        return nullptr;
+            if (tmpDefault != nullptr)
+            {
+                if (tmpDefault->getStrAttrValue() != curAttr.second->getStrAttrValue())
+                {
+                    has_different_create_only_attr = true;
+
+                    SWSS_LOG_INFO("obj has not equal create only attributes %s (default): %s",
+                            currentObj->str_object_id.c_str(),
+                            meta->attridname);
+                    break;
+                }
+                else
+                {
+                    SWSS_LOG_INFO("obj has equal create only value %s (default): %s",
+                            temporaryObj->str_object_id.c_str(),
+                            meta->attridname);
+                }
+            }
+        }
     }
 
-    if (candidateObjects.size() == 1)
+    if (has_different_create_only_attr)
     {
         /*
-         * We found only one object so it must be it.
+         * Those objects differs with attribute which is marked as
+         * CREATE_ONLY so we will not be able to update current if
+         * necessary using SET operations.
          */
 
-        return candidateObjects.begin()->obj;
+        return false;
     }
 
-    /*
-     * If we have more than 1 object matched actually more preferred
-     * object would be the object with most CREATE_ONLY attributes matching
-     * since that will reduce risk of removing and recreating that object in
-     * current view.
-     */
-
-    /*
-     * But at this point also let's try find best candidate using graph paths,
-     * since if some attributes are mismatched (like for example more ACLs are
-     * created) this can lead to choose wrong LAG and have implications on
-     * router interface and so on.  So matching by graph path here could be
-     * more precise.
-     */
-
-    auto graphCandidate = findCurrentBestMatchForGenericObjectUsingGraph(
-            currentView,
-            temporaryView,
-            temporaryObj,
-            candidateObjects);
-
-    if (graphCandidate != nullptr)
-        return graphCandidate;
-
-    /*
-     * Sort candidate objects by equal attributes in descending order, we know
-     * here that we have at least 2 candidates.
-     *
-     * NOTE: maybe at this point we should be using heuristics?
-     */
+    return true;
+}
 
-    std::sort(candidateObjects.begin(), candidateObjects.end(), compareByEqualAttributes);
+/**
+ * @brief Get canonical form of VID which is the same in both views.
+ *
+ * If VID has RID, then RID is used, temporary VIDs which are not matched yet
+ * are translated using pre match map. Created objects have the same VID in
+ * both views.
+ *
+ * @param currentView Current view.
+ * @param temporaryView Temporary view.
+ * @param vid Virtual ID to be translated.
+ * @param isTemporary True if VID belongs to temporary view.
+ *
+ * @return Canonical string of VID.
+ */
+std::string getCanonicalVid(
+        _In_ const AsicView &currentView,
+        _In_ const AsicView &temporaryView,
+        _In_ sai_object_id_t vid,
+        _In_ bool isTemporary)
+{
+    SWSS_LOG_ENTER();
 
-    if (candidateObjects.at(0).equal_attributes > candidateObjects.at(1).equal_attributes)
+    if (vid == SAI_NULL_OBJECT_ID)
     {
-        /*
-         * We have only 1 object with the greatest number of equal attributes
-         * lets choose that object as our best match.
-         */
-
-        SWSS_LOG_INFO("eq attributes: %ld vs %ld",
-            candidateObjects.at(0).equal_attributes,
-            candidateObjects.at(1).equal_attributes);
-
-        return candidateObjects.begin()->obj;
+        return "null";
     }
 
-    /*
-     * In here there are at least 2 current objects that have the same
-     * number of equal attributes. In here we can do two things
-     *
-     * - select object at random, or
-     * - use heuristic/smart lookup for inside graph
-     *
-     * Smart lookup would be for example searching whether current object is
-     * pointing to the same PORT as temporary object (since ports are matched
-     * at the beginning). For different types of objects we need different type
-     * of logic and we can start adding that when needed and when missing we
-     * will just choose at random possible causing some remove/recreate but
-     * this logic is not perfect at this point.
-     */
-
-    /*
-     * Lets also remove candidates with less equal attributes
-     */
+    const AsicView &view = isTemporary ? temporaryView : currentView;
 
-    size_t previousCandidates = candidateObjects.size();
+    auto it = view.vidToRid.find(vid);
 
-    size_t equalAttributes = candidateObjects.at(0).equal_attributes;
+    if (it != view.vidToRid.end())
+    {
+        return "r" + sai_serialize_object_id(it->second);
+    }
 
-    auto endIt = std::remove_if(candidateObjects.begin(), candidateObjects.end(),
-            [equalAttributes](const sai_object_compare_info_t &candidate)
-            { return candidate.equal_attributes != equalAttributes; });
+    if (isTemporary)
+    {
+        auto pit = temporaryView.preMatchMap.find(vid);
 
-    candidateObjects.erase(endIt, candidateObjects.end());
+        if (pit != temporaryView.preMatchMap.end())
+        {
+            it = currentView.vidToRid.find(pit->second);
 
-    SWSS_LOG_INFO("multiple candidates found (%zu of %zu) for %s, will use heuristic",
-            candidateObjects.size(),
-            previousCandidates,
-            temporaryObj->str_object_id.c_str());
+            if (it != currentView.vidToRid.end())
+            {
+                return "r" + sai_serialize_object_id(it->second);
+            }
+        }
+    }
 
-    return findCurrentBestMatchForGenericObjectUsingHeuristic(
-            currentView,
-            temporaryView,
-            temporaryObj,
-            candidateObjects);
+    return "v" + sai_serialize_object_id(vid);
 }
 
-bool exchangeTemporaryVidToCurrentVid(
+/**
+ * @brief Get fingerprint of object CREATE_ONLY and KEY attributes.
+ *
+ * Fingerprint contains values of given attributes, missing attributes are
+ * filled with default values the same way as generic best match compares
+ * them, and object ids are in canonical form, so objects with the same
+ * fingerprint in current and temporary view have equal CREATE_ONLY and KEY
+ * attributes.
+ *
+ * @param currentView Current view.
+ * @param temporaryView Temporary view.
+ * @param obj Object to be processed.
+ * @param isTemporary True if object belongs to temporary view.
+ * @param attrIds Attributes to be used.
+ * @param defaults Default values cache of object view.
+ * @param fingerprint Output fingerprint.
+ * @param missingAttrIds Output attributes missing on object which don't have
+ * default value.
+ *
+ * @return False if fingerprint can't be used for this object, since it has
+ * attributes which can't be compared by value.
+ */
+bool getCreateOnlyAttributesFingerprint(
         _In_ const AsicView &currentView,
         _In_ const AsicView &temporaryView,
-        _Inout_ sai_object_meta_key_t &meta_key)
+        _In_ const std::shared_ptr<const SaiObj> &obj,
+        _In_ bool isTemporary,
+        _In_ const std::set<sai_attr_id_t> &attrIds,
+        _Inout_ std::map<sai_attr_id_t, std::shared_ptr<SaiAttr>> &defaults,
+        _Out_ std::string &fingerprint,
+        _Out_ std::set<sai_attr_id_t> &missingAttrIds)
 {
     SWSS_LOG_ENTER();
 
-    auto info = sai_metadata_get_object_type_info(meta_key.objecttype);
+    fingerprint.clear();
 
-    // XXX if (info->isobjectid)
+    missingAttrIds.clear();
 
-    if (!info->isnonobjectid)
+    for (auto attrId: attrIds)
     {
-        SWSS_LOG_THROW("expected non object id, but got: %s",
-                sai_serialize_object_meta_key(meta_key).c_str());
-    }
+        auto attr = obj->tryGetSaiAttr(attrId);
 
-    for (size_t j = 0; j < info->structmemberscount; ++j)
-    {
-        const sai_struct_member_info_t *m = info->structmembers[j];
+        if (attr == nullptr)
+        {
+            auto it = defaults.find(attrId);
 
-        if (m->membervaluetype != SAI_ATTR_VALUE_TYPE_OBJECT_ID)
+            if (it == defaults.end())
+            {
+                const sai_attr_metadata_t* meta = sai_metadata_get_attr_metadata(obj->getObjectType(), attrId);
+
+                auto defaultAttr = getSaiAttrFromDefaultValue(isTemporary ? temporaryView : currentView, *meta);
+
+                it = defaults.insert(std::make_pair(attrId, defaultAttr)).first;
+            }
+
+            attr = it->second;
+        }
+
+        if (attr == nullptr)
         {
+            missingAttrIds.insert(attrId);
+
+            fingerprint += "-;";
             continue;
         }
 
-        sai_object_id_t tempVid = m->getoid(&meta_key);
-
-        auto temporaryIt = temporaryView.vidToRid.find(tempVid);
+        const sai_attr_metadata_t* meta = attr->getAttrMetadata();
 
-        if (temporaryIt == temporaryView.vidToRid.end())
+        switch (meta->attrvaluetype)
         {
-            /*
-             * RID for temporary VID was not assigned, so we didn't matched it
-             * in previous processing, or VID will be created later on. This
-             * mean we can't match because even if all attributes are matching,
-             * RID in struct after create will not match so at the end of
-             * processing current object will need to be destroyed and new one
-             * needs to be created.
-             */
+            case SAI_ATTR_VALUE_TYPE_POINTER:
 
-            return false;
-        }
+                // same as in hasEqualAttribute, only null matters
 
-        sai_object_id_t temporaryRid = temporaryIt->second;
+                fingerprint += (attr->getSaiAttr()->value.ptr == nullptr) ? "null" : "ptr";
+                break;
 
-        auto currentIt = currentView.ridToVid.find(temporaryRid);
+            case SAI_ATTR_VALUE_TYPE_QOS_MAP_LIST:
 
-        if (currentIt == currentView.ridToVid.end())
-        {
-            /*
-             * This is just sanity check, should never happen.
-             */
+                // order of entries doesn't matter, compared by heuristic
 
-            SWSS_LOG_THROW("found tempoary RID %s but current VID doesn't exist, FATAL",
-                    sai_serialize_object_id(temporaryRid).c_str());
-        }
+                return false;
 
-        /*
-         * This vid is vid of current view, it may or may not be
-         * equal to temporaryVid, but we need to this step to not guess vids.
-         */
+            case SAI_ATTR_VALUE_TYPE_OBJECT_ID:
+            case SAI_ATTR_VALUE_TYPE_OBJECT_LIST:
 
-        sai_object_id_t currentVid = currentIt->second;
+                for (auto vid: attr->getOidListFromAttribute())
+                {
+                    fingerprint += getCanonicalVid(currentView, temporaryView, vid, isTemporary) + ",";
+                }
 
-        m->setoid(&meta_key, currentVid);
+                break;
+
+            default:
+
+                if (attr->isObjectIdAttr())
+                {
+                    // object ids inside acl fields and actions
+
+                    return false;
+                }
+
+                fingerprint += attr->getStrAttrValue();
+                break;
+        }
+
+        fingerprint += ";";
     }
 
     return true;
 }
 
-// TODO we can do this in generic way, we need serialize
-
 /**
- * @brief Find current best match for neighbor.
- *
- * For Neighbor we don't need to iterate via all current neighbors, we can do
- * dictionary lookup, but we need to do smart trick, since temporary object was
- * processed we just need to check whether VID in neighbor_entry struct is
- * matched/final and it has RID assigned from current view. If, RID exists, we
- * can use that RID to get VID of current view, exchange in neighbor_entry
- * struct and do dictionary lookup on serialized neighbor_entry.
+ * @brief Get index of not processed objects by fingerprint.
  *
- * With this approach for many entries this is the quickest possible way. In
- * case when RID doesn't exist, that means we have invalid neighbor entry, so we
- * must return null.
+ * Index is built on first call for given object type.
  *
  * @param currentView Current view.
  * @param temporaryView Temporary view.
- * @param temporaryObj Temporary object.
+ * @param object_type Object type of indexed objects.
  *
- * @return Best match object if found or nullptr.
+ * @return Fingerprint index.
  */
-std::shared_ptr<SaiObj> findCurrentBestMatchForNeighborEntry(
+FingerprintIndex& getFingerprintIndex(
         _In_ const AsicView &currentView,
         _In_ const AsicView &temporaryView,
-        _In_ const std::shared_ptr<const SaiObj> &temporaryObj)
+        _In_ sai_object_type_t object_type)
 {
     SWSS_LOG_ENTER();
 
-    /*
-     * Make a copy here to not destroy object data, later
-     * on this data should be read only.
-     */
+    auto it = currentView.fingerprintIndex.find(object_type);
 
-    sai_object_meta_key_t mk = temporaryObj->meta_key;
-
-    if (!exchangeTemporaryVidToCurrentVid(currentView, temporaryView, mk))
+    if (it != currentView.fingerprintIndex.end())
     {
-        /*
-         * Not all oids inside struct object were translated, so there is no
-         * matching object in current view, we need to return null.
-         */
-
-        return nullptr;
+        return it->second;
     }
 
-    std::string str_neighbor_entry = sai_serialize_neighbor_entry(mk.objectkey.key.neighbor_entry);
+    auto &index = currentView.fingerprintIndex[object_type];
 
-    /*
-     * Now when we have serialized neighbor entry with temporary rif_if VID
-     * replaced to current rif_id VID we can do dictionary lookup for neighbor.
-     */
+    index.usable = true;
 
-    auto currentNeighborIt = currentView.soNeighbors.find(str_neighbor_entry);
+    const auto &notProcessedObjects = currentView.getNotProcessedObjectsByObjectType(object_type);
 
-    if (currentNeighborIt == currentView.soNeighbors.end())
+    for (const auto &obj: notProcessedObjects)
     {
-        SWSS_LOG_DEBUG("unable to find neighbor entry %s in current asic view",
-                str_neighbor_entry.c_str());
+        for (const auto &attr: obj->getAllAttributes())
+        {
+            const sai_attr_metadata_t* meta = attr.second->getAttrMetadata();
 
-        return nullptr;
+            if (SAI_HAS_FLAG_CREATE_ONLY(meta->flags) || SAI_HAS_FLAG_KEY(meta->flags))
+            {
+                index.attrIds.insert(attr.first);
+            }
+        }
     }
 
-    /*
-     * We found the same neighbor entry in current view! Just one extra check
-     * of object status if it's not processed yet.
-     */
+    std::string fingerprint;
 
-    auto currentNeighborObj = currentNeighborIt->second;
+    std::set<sai_attr_id_t> missingAttrIds;
 
-    if (currentNeighborObj->getObjectStatus() == SAI_OBJECT_STATUS_NOT_PROCESSED)
+    for (const auto &obj: notProcessedObjects)
     {
-        return currentNeighborObj;
+        if (!getCreateOnlyAttributesFingerprint(currentView, temporaryView, obj, false,
+                    index.attrIds, index.defaults, fingerprint, missingAttrIds))
+        {
+            index.usable = false;
+            index.objects.clear();
+            break;
+        }
+
+        index.missingAttrIds.insert(missingAttrIds.begin(), missingAttrIds.end());
+
+        index.objects.insert(std::make_pair(fingerprint, obj));
     }
 
-    /*
-     * If we are here, that means this neighbor was already processed, which
-     * can indicate a bug or somehow duplicated entries.
-     */
+    SWSS_LOG_INFO("built fingerprint index for %s: %zu objects, usable: %d",
+            sai_serialize_object_type(object_type).c_str(),
+            index.objects.size(),
+            index.usable);
 
-    SWSS_LOG_THROW("found neighbor entry %s in current view, but it status is %d, FATAL",
-            str_neighbor_entry.c_str(),
-            currentNeighborObj->getObjectStatus());
+    return index;
 }
 
 /**
- * @brief Find current best match for route.
+ * @brief Find current object with the same CREATE_ONLY and KEY attributes.
  *
- * For Route we don't need to iterate via all current routes, we can do
- * dictionary lookup, but we need to do smart trick, since temporary object was
- * processed we just need to check whether VID in route_entry struct is
- * matched/final and it has RID assigned from current view. If, RID exists, we
- * can use that RID to get VID of current view, exchange in route_entry struct
- * and do dictionary lookup on serialized route_entry.
+ * After orchagent restart most of objects don't change, so they can be
+ * matched by hash lookup instead of comparing attributes of all not
+ * processed objects.
  *
- * With this approach for many entries this is the quickest possible way. In
- * case when RID doesn't exist, that means we have invalid route entry, so we
- * must return null.
+ * Current object which has different CREATE_ONLY attribute value, including
+ * default value, is never generic best match candidate, so if exactly one
+ * not processed object has the same fingerprint and it's a candidate, then
+ * it's the only candidate and comparing all objects would select it too.
+ * This is not true when attribute without default value is missing on one
+ * of the objects, since such attribute is not compared, so then nullptr is
+ * returned.
  *
  * @param currentView Current view.
  * @param temporaryView Temporary view.
  * @param temporaryObj Temporary object.
  *
- * @return Best match object if found or nullptr.
+ * @return Current object if it's the only candidate found by fingerprint,
+ * nullptr otherwise.
  */
-std::shared_ptr<SaiObj> findCurrentBestMatchForRouteEntry(
+std::shared_ptr<SaiObj> findCurrentBestMatchForGenericObjectUsingFingerprint(
         _In_ const AsicView &currentView,
         _In_ const AsicView &temporaryView,
         _In_ const std::shared_ptr<const SaiObj> &temporaryObj)
 {
     SWSS_LOG_ENTER();
 
-    /*
-     * Make a copy here to not destroy object data, later
-     * on this data should be read only.
-     */
-
-    sai_object_meta_key_t mk = temporaryObj->meta_key;
+    const auto &index = getFingerprintIndex(currentView, temporaryView, temporaryObj->getObjectType());
 
-    if (!exchangeTemporaryVidToCurrentVid(currentView, temporaryView, mk))
+    if (!index.usable)
     {
-        /*
-         * Not all oids inside struct object were translated, so there is no
-         * matching object in current view, we need to return null.
-         */
-
         return nullptr;
     }
 
-    std::string str_route_entry = sai_serialize_route_entry(mk.objectkey.key.route_entry);
+    for (const auto &attr: temporaryObj->getAllAttributes())
+    {
+        const sai_attr_metadata_t* meta = attr.second->getAttrMetadata();
 
-    /*
-     * Now when we have serialized route entry with temporary vr_id VID
-     * replaced to current vr_id VID we can do dictionary lookup for route.
-     */
-    auto currentRouteIt = currentView.soRoutes.find(str_route_entry);
+        if (!SAI_HAS_FLAG_CREATE_ONLY(meta->flags) && !SAI_HAS_FLAG_KEY(meta->flags))
+        {
+            continue;
+        }
 
-    if (currentRouteIt == currentView.soRoutes.end())
-    {
-        SWSS_LOG_DEBUG("unable to find route entry %s in current asic view", str_route_entry.c_str());
+        if (index.attrIds.find(attr.first) == index.attrIds.end() ||
+                index.missingAttrIds.find(attr.first) != index.missingAttrIds.end())
+        {
+            // attribute is missing on some current object
 
-        return nullptr;
+            return nullptr;
+        }
     }
 
-    /*
-     * We found the same route entry in current view! Just one extra check
-     * of object status if it's not processed yet.
-     */
+    std::map<sai_attr_id_t, std::shared_ptr<SaiAttr>> defaults;
 
-    auto currentRouteObj = currentRouteIt->second;
+    std::string fingerprint;
 
-    if (currentRouteObj->getObjectStatus() == SAI_OBJECT_STATUS_NOT_PROCESSED)
+    std::set<sai_attr_id_t> missingAttrIds;
+
+    if (!getCreateOnlyAttributesFingerprint(currentView, temporaryView, temporaryObj, true,
+                index.attrIds, defaults, fingerprint, missingAttrIds) || missingAttrIds.size())
     {
-        return currentRouteObj;
+        return nullptr;
     }
 
-    /*
-     * If we are here, that means this route was already processed, which
-     * can indicate a bug or somehow duplicated entries.
-     */
-
-    SWSS_LOG_THROW("found route entry %s in current view, but it status is %d, FATAL",
-            str_route_entry.c_str(),
-            currentRouteObj->getObjectStatus());
-}
-
-/**
- * @brief Find current best match for FDB.
- *
- * For FDB we don't need to iterate via all current FDBs, we can do dictionary
- * lookup, but we need to do smart trick, since temporary object was processed
- * we just need to check whether VID in fdb_entry struct is matched/final and
- * it has RID assigned from current view. If, RID exists, we can use that RID
- * to get VID of current view, exchange in fdb_entry struct and do dictionary
- * lookup on serialized fdb_entry.
- *
- * With this approach for many entries this is the quickest possible way. In
- * case when RID doesn't exist, that means we have invalid fdb entry, so we must
- * return null.
- *
- * @param currentView Current view.
- * @param temporaryView Temporary view.
- * @param temporaryObj Temporary object.
- *
- * @return Best match object if found or nullptr.
- */
-std::shared_ptr<SaiObj> findCurrentBestMatchForFdbEntry(
-        _In_ const AsicView &currentView,
-        _In_ const AsicView &temporaryView,
-        _In_ const std::shared_ptr<const SaiObj> &temporaryObj)
-{
-    SWSS_LOG_ENTER();
-
-    /*
-     * Make a copy here to not destroy object data, later
-     * on this data should be read only.
-     */
+    auto range = index.objects.equal_range(fingerprint);
 
-    sai_object_meta_key_t mk = temporaryObj->meta_key;
+    std::shared_ptr<SaiObj> match = nullptr;
 
-    if (!exchangeTemporaryVidToCurrentVid(currentView, temporaryView, mk))
+    for (auto it = range.first; it != range.second; ++it)
     {
-        /*
-         * Not all oids inside struct object were translated, so there is no
-         * matching object in current view, we need to return null.
-         */
+        const auto &currentObj = it->second;
 
-        return nullptr;
-    }
+        if (currentObj->getObjectStatus() != SAI_OBJECT_STATUS_NOT_PROCESSED)
+            continue;
 
-    std::string str_fdb_entry = sai_serialize_fdb_entry(mk.objectkey.key.fdb_entry);
+        if (match != nullptr)
+        {
+            SWSS_LOG_INFO("more than one current object match %s by fingerprint",
+                    temporaryObj->str_object_id.c_str());
 
-    /*
-     * Now when we have serialized fdb entry with temporary VIDs
-     * replaced to current VIDs we can do dictionary lookup for fdb.
-     */
+            return nullptr;
+        }
 
-    auto currentFdbIt = currentView.soFdbs.find(str_fdb_entry);
+        match = currentObj;
+    }
 
-    if (currentFdbIt == currentView.soFdbs.end())
+    if (match == nullptr)
     {
-        SWSS_LOG_DEBUG("unable to find fdb entry %s in current asic view", str_fdb_entry.c_str());
-
         return nullptr;
     }
 
-    /*
-     * We found the same fdb entry in current view! Just one extra check
-     * of object status if it's not processed yet.
-     */
+    sai_object_compare_info_t soci = { 0, match };
 
-    auto currentFdbObj = currentFdbIt->second;
-
-    if (currentFdbObj->getObjectStatus() == SAI_OBJECT_STATUS_NOT_PROCESSED)
+    if (!compareGenericObjectCandidate(currentView, temporaryView, match, temporaryObj, soci))
     {
-        return currentFdbObj;
+        /*
+         * Temporary object ids which are only pre matched are not equal to
+         * any current object ids yet.
+         */
+
+        return nullptr;
     }
 
-    /*
-     * If we are here, that means this fdb was already processed, which
-     * can indicate a bug or somehow duplicated entries.
-     */
+    SWSS_LOG_INFO("found best match for %s by fingerprint: %s",
+            temporaryObj->str_object_id.c_str(),
+            match->str_object_id.c_str());
 
-    SWSS_LOG_THROW("found fdb entry %s in current view, but it status is %d, FATAL",
-            str_fdb_entry.c_str(),
-            currentFdbObj->getObjectStatus());
+    return match;
 }
 
-std::shared_ptr<SaiObj> findCurrentBestMatchForSwitch(
+std::shared_ptr<SaiObj> findCurrentBestMatchForGenericObject(
         _In_ const AsicView &currentView,
         _In_ const AsicView &temporaryView,
         _In_ const std::shared_ptr<const SaiObj> &temporaryObj)
@@ -4808,1712 +5374,1968 @@ std::shared_ptr<SaiObj> findCurrentBestMatchForSwitch(
     SWSS_LOG_ENTER();
 
     /*
-     * On compare logic we checked that we have one switch
-     * so we can just get first.
+     * This method will try to find current best match object for a given
+     * temporary object. This method should be used only on object id objects,
+     * since non object id structures also contains object id which in this
+     * case are not take into account. Besides for objects like FDB, ROUTE or
+     * NEIGHBOR we can do quick hash lookup instead of looping for all objects
+     * where there can be a lot of them.
+     *
+     * Special case here we can add later on is VLAN, since we can have a lot
+     * of VLANS so instead looking via all of them we just need to make sure
+     * that we will create reverse map via VLAN_ID KEY and then we can make
+     * hash lookup to see if such vlan is present.
      */
 
-    auto currentSwitches = currentView.getObjectsByObjectType(SAI_OBJECT_TYPE_SWITCH);
-
-    if (currentSwitches.size() == 0)
-    {
-        SWSS_LOG_NOTICE("unable to find switch object in current view");
+    /*
+     * Since our system design is to restart orchagent without restarting syncd
+     * and recreating objects and reassign new VIDs created inside orchagent,
+     * in our most cases values of objects will not change.  This will cause to
+     * make our comparison logic here fairly simple:
+     *
+     * Find all objects that have the same equal attributes on current object
+     * and choose the one with the most attributes that match current and
+     * temporary object.
+     *
+     * This seems simple, but there are a lot of cases that needs to be taken
+     * into account:
+     *
+     * - what if we have several objects with the same number of equal
+     *   attributes then we can choose at random or implement some heuristic
+     *   logic to try figure out which of those objects will be the best, even
+     *   then if we choose wrong object, then there can be a lot of removes and
+     *   recreating objects on the ASIC
+     *
+     * - what if in temporary object CREATE_ONLY attributes don't match but
+     *   many of CREATE_AND_SET are the same, in that case we can choose object
+     *   with most matching attributes, but object will still needs to be
+     *   destroyed because we need to set new CREATE_ONLY attributes
+     *
+     * - there are also cases with default values of attributes where attribute
+     *   is present only in one object but on other one it have default value
+     *   and this default value is the same as the one in attribute
+     *
+     * - another case is for objects that needs to be removed since there are
+     *   no corresponding objects in temporary view, but they can't be removed,
+     *   objects like PORT or default QUEUEs or INGRESS_PRIORITY_GROUPs, then
+     *   we need to bring their current set values to default ones, which also
+     *   can be challenging since we need to know previous default value and it
+     *   could be assigned by switch internally, like default MAC address or
+     *   default TRAP group etc
+     *
+     * - there is also interesting case with KEYs attributes which when
+     *   doing remove/create they needs to be removed first since
+     *   we can't have 2 identical cases
+     *
+     * There are a lot of aspects to consider here, in here we will cake only
+     * couple of them in consideration, and other will be taken care inside
+     * processObjectForViewTransition method which will handle all other cases
+     * not mentioned here.
+     */
 
-        return nullptr;
-    }
+    /*
+     * First check if object is oid object, if yes, check if it status is
+     * matched.
+     */
 
-    if (currentSwitches.size() > 1)
+    if (!temporaryObj->isOidObject())
     {
-        SWSS_LOG_THROW("found %zu switches declared in current view, not supported",
-                currentSwitches.size());
+        SWSS_LOG_THROW("non object id %s is used in generic method, please implement special case, FIXME",
+                temporaryObj->str_object_type.c_str());
     }
 
     /*
-     * We found switch object in current view! Just one extra check
-     * of object status if it's not processed yet.
+     * Get not processed objects of temporary object type, and all attributes
+     * that are set on that object. This function should be used only on oid
+     * object ids, since for non object id finding best match is based on
+     * struct entry of object id.
      */
 
-    auto currentSwitchObj = currentSwitches.at(0);
+    /*
+     * Most objects are the same after orchagent restart, so first try to find
+     * the only current object with the same CREATE_ONLY and KEY attributes,
+     * and compare attributes of not processed objects only if it's not found.
+     */
 
-    if (currentSwitchObj->getObjectStatus() == SAI_OBJECT_STATUS_NOT_PROCESSED)
+    auto fingerprintMatch = findCurrentBestMatchForGenericObjectUsingFingerprint(currentView, temporaryView, temporaryObj);
+
+    if (fingerprintMatch != nullptr)
     {
-        return currentSwitchObj;
+        return fingerprintMatch;
     }
 
+    sai_object_type_t object_type = temporaryObj->getObjectType();
+
+    const auto &notProcessedObjects = currentView.getNotProcessedObjectsByObjectType(object_type);
+
+    const auto &attrs = temporaryObj->getAllAttributes();
+
     /*
-     * If we are here, that means this switch was already processed, which
-     * can indicate a bug or somehow duplicated entries.
+     * Complexity here is O(n*m) for each object, since we iterate via not
+     * processed objects of this type, then we iterate through all present
+     * attributes. Not processed objects are kept in per type bucket, so
+     * already matched objects are not visited and list is not copied.
      */
 
-    SWSS_LOG_THROW("found switch object %s in current view, but it status is %d, FATAL",
-            currentSwitchObj->str_object_id.c_str(),
-            currentSwitchObj->getObjectStatus());
-}
+    SWSS_LOG_INFO("not processed objects for %s: %zu, attrs: %zu",
+            temporaryObj->str_object_type.c_str(),
+            notProcessedObjects.size(),
+            attrs.size());
 
-/**
- * @brief Find current best match for NAT entry.
- *
- *
- * @param currentView Current view.
- * @param temporaryView Temporary view.
- * @param temporaryObj Temporary object.
- *
- * @return Best match object if found or nullptr.
- */
-std::shared_ptr<SaiObj> findCurrentBestMatchForNatEntry(
-        _In_ const AsicView &currentView,
-        _In_ const AsicView &temporaryView,
-        _In_ const std::shared_ptr<const SaiObj> &temporaryObj)
-{
-    SWSS_LOG_ENTER();
+    std::vector<sai_object_compare_info_t> candidateObjects;
 
     /*
-     * Make a copy here to not destroy object data, later
-     * on this data should be read only.
+     * Most objects have CREATE_ONLY attributes with unique values, so first
+     * try to reduce number of compared objects using index of those values.
      */
 
-    sai_object_meta_key_t mk = temporaryObj->meta_key;
+    std::vector<std::shared_ptr<SaiObj>> preFilteredObjects;
 
-    if (!exchangeTemporaryVidToCurrentVid(currentView, temporaryView, mk))
+    if (getCreateOnlyAttrPreFilteredObjects(currentView, temporaryObj, preFilteredObjects))
+    {
+        for (const auto &currentObj: preFilteredObjects)
+        {
+            sai_object_compare_info_t soci = { 0, currentObj };
+
+            if (compareGenericObjectCandidate(currentView, temporaryView, currentObj, temporaryObj, soci))
+            {
+                candidateObjects.push_back(soci);
+            }
+        }
+    }
+    else
+    {
+        for (const auto &currentObj: notProcessedObjects)
+        {
+            sai_object_compare_info_t soci = { 0, currentObj };
+
+            if (compareGenericObjectCandidate(currentView, temporaryView, currentObj, temporaryObj, soci))
+            {
+                candidateObjects.push_back(soci);
+            }
+        }
+    }
+
+    SWSS_LOG_INFO("number candidate objects for %s is %zu",
+            temporaryObj->str_object_id.c_str(),
+            candidateObjects.size());
+
+    if (candidateObjects.size() == 0)
     {
         /*
-         * Not all oids inside struct object were translated, so there is no
-         * matching object in current view, we need to return null.
+         * We didn't found any object.
          */
 
         return nullptr;
     }
 
-    std::string str_nat_entry = sai_serialize_nat_entry(mk.objectkey.key.nat_entry);
+    if (candidateObjects.size() == 1)
+    {
+        /*
+         * We found only one object so it must be it.
+         */
+
+        return candidateObjects.begin()->obj;
+    }
 
     /*
-     * Now when we have serialized NAT entry with temporary vr_id VID
-     * replaced to current vr_id VID we can do dictionary lookup for NAT entry.
+     * If we have more than 1 object matched actually more preferred
+     * object would be the object with most CREATE_ONLY attributes matching
+     * since that will reduce risk of removing and recreating that object in
+     * current view.
      */
-    auto currentNatEntry = currentView.soNatEntries.find(str_nat_entry);
 
-    if (currentNatEntry == currentView.soNatEntries.end())
-    {
-        SWSS_LOG_DEBUG("unable to find NAT entry %s in current asic view", str_nat_entry.c_str());
+    /*
+     * But at this point also let's try find best candidate using graph paths,
+     * since if some attributes are mismatched (like for example more ACLs are
+     * created) this can lead to choose wrong LAG and have implications on
+     * router interface and so on.  So matching by graph path here could be
+     * more precise.
+     */
 
-        return nullptr;
-    }
+    auto graphCandidate = findCurrentBestMatchForGenericObjectUsingGraph(
+            currentView,
+            temporaryView,
+            temporaryObj,
+            candidateObjects);
+
+    if (graphCandidate != nullptr)
+        return graphCandidate;
 
     /*
-     * We found the same NAT entry in current view! Just one extra check
-     * of object status if it's not processed yet.
+     * Sort candidate objects by equal attributes in descending order, we know
+     * here that we have at least 2 candidates.
+     *
+     * NOTE: maybe at this point we should be using heuristics?
      */
 
-    auto currentNatObj = currentNatEntry->second;
+    std::sort(candidateObjects.begin(), candidateObjects.end(), compareByEqualAttributes);
 
-    if (currentNatObj->getObjectStatus() == SAI_OBJECT_STATUS_NOT_PROCESSED)
+    if (candidateObjects.at(0).equal_attributes > candidateObjects.at(1).equal_attributes)
     {
-        return currentNatObj;
+        /*
+         * We have only 1 object with the greatest number of equal attributes
+         * lets choose that object as our best match.
+         */
+
+        SWSS_LOG_INFO("eq attributes: %ld vs %ld",
+            candidateObjects.at(0).equal_attributes,
+            candidateObjects.at(1).equal_attributes);
+
+        return candidateObjects.begin()->obj;
     }
 
+    /*
+     * In here there are at least 2 current objects that have the same
+     * number of equal attributes. In here we can do two things
+     *
+     * - select object at random, or
+     * - use heuristic/smart lookup for inside graph
+     *
+     * Smart lookup would be for example searching whether current object is
+     * pointing to the same PORT as temporary object (since ports are matched
+     * at the beginning). For different types of objects we need different type
+     * of logic and we can start adding that when needed and when missing we
+     * will just choose at random possible causing some remove/recreate but
+     * this logic is not perfect at this point.
+     */
 
     /*
-     * If we are here, that means this NAT entry was already processed, which
-     * can indicate a bug or somehow duplicated entries.
+     * Lets also remove candidates with less equal attributes
      */
 
-    SWSS_LOG_THROW("found NAT entry %s in current view, but it status is %d, FATAL",
-            str_nat_entry.c_str(),
-            currentNatObj->getObjectStatus());
+    size_t previousCandidates = candidateObjects.size();
+
+    size_t equalAttributes = candidateObjects.at(0).equal_attributes;
+
+    auto endIt = std::remove_if(candidateObjects.begin(), candidateObjects.end(),
+            [equalAttributes](const sai_object_compare_info_t &candidate)
+            { return candidate.equal_attributes != equalAttributes; });
+
+    candidateObjects.erase(endIt, candidateObjects.end());
+
+    SWSS_LOG_INFO("multiple candidates found (%zu of %zu) for %s, will use heuristic",
+            candidateObjects.size(),
+            previousCandidates,
+            temporaryObj->str_object_id.c_str());
+
+    return findCurrentBestMatchForGenericObjectUsingHeuristic(
+            currentView,
+            temporaryView,
+            temporaryObj,
+            candidateObjects);
 }
 
-std::shared_ptr<SaiObj> findCurrentBestMatch(
+bool exchangeTemporaryVidToCurrentVid(
         _In_ const AsicView &currentView,
         _In_ const AsicView &temporaryView,
-        _In_ const std::shared_ptr<const SaiObj> &temporaryObj)
+        _Inout_ sai_object_meta_key_t &meta_key)
 {
     SWSS_LOG_ENTER();
 
-    if (temporaryObj->isOidObject() &&
-            temporaryObj->getObjectStatus() == SAI_OBJECT_STATUS_MATCHED)
-    {
-        /*
-         * Object status is matched so current and temp VID are the same so we
-         * can just take object directly.
-         */
+    auto info = sai_metadata_get_object_type_info(meta_key.objecttype);
 
-        SWSS_LOG_INFO("found best match for %s %s since object status is MATCHED",
-                temporaryObj->str_object_type.c_str(),
-                temporaryObj->str_object_id.c_str());
+    // XXX if (info->isobjectid)
 
-        return currentView.oOids.at(temporaryObj->getVid());
+    if (!info->isnonobjectid)
+    {
+        SWSS_LOG_THROW("expected non object id, but got: %s",
+                sai_serialize_object_meta_key(meta_key).c_str());
     }
 
-    /*
-     * NOTE: Later on best match find can be done based on present CREATE_ONLY
-     * attributes or on most matched CREATE_AND_SET attributes.
-     */
-
-    switch (temporaryObj->getObjectType())
+    for (size_t j = 0; j < info->structmemberscount; ++j)
     {
-        /*
-         * Non object id cases
-         */
+        const sai_struct_member_info_t *m = info->structmembers[j];
 
-        case SAI_OBJECT_TYPE_NEIGHBOR_ENTRY:
-            return findCurrentBestMatchForNeighborEntry(currentView, temporaryView, temporaryObj);
+        if (m->membervaluetype != SAI_ATTR_VALUE_TYPE_OBJECT_ID)
+        {
+            continue;
+        }
 
-        case SAI_OBJECT_TYPE_ROUTE_ENTRY:
-            return findCurrentBestMatchForRouteEntry(currentView, temporaryView, temporaryObj);
+        sai_object_id_t tempVid = m->getoid(&meta_key);
 
-        case SAI_OBJECT_TYPE_FDB_ENTRY:
-            return findCurrentBestMatchForFdbEntry(currentView, temporaryView, temporaryObj);
+        auto temporaryIt = temporaryView.vidToRid.find(tempVid);
 
-        case SAI_OBJECT_TYPE_NAT_ENTRY:
-            return findCurrentBestMatchForNatEntry(currentView, temporaryView, temporaryObj);
- 
+        if (temporaryIt == temporaryView.vidToRid.end())
+        {
             /*
-             * We can have special case for switch since we know there should
-             * be only one switch.
+             * RID for temporary VID was not assigned, so we didn't matched it
+             * in previous processing, or VID will be created later on. This
+             * mean we can't match because even if all attributes are matching,
+             * RID in struct after create will not match so at the end of
+             * processing current object will need to be destroyed and new one
+             * needs to be created.
              */
 
-        case SAI_OBJECT_TYPE_SWITCH:
-            return findCurrentBestMatchForSwitch(currentView, temporaryView, temporaryObj);
+            return false;
+        }
 
-        default:
+        sai_object_id_t temporaryRid = temporaryIt->second;
 
-            if (!temporaryObj->isOidObject())
-            {
-                SWSS_LOG_THROW("object %s:%s is non object id, not handled yet, FIXME",
-                        temporaryObj->str_object_type.c_str(),
-                        temporaryObj->str_object_id.c_str());
-            }
+        auto currentIt = currentView.ridToVid.find(temporaryRid);
 
+        if (currentIt == currentView.ridToVid.end())
+        {
             /*
-             * Here we support only object id object types.
+             * This is just sanity check, should never happen.
              */
 
-            return findCurrentBestMatchForGenericObject(currentView, temporaryView, temporaryObj);
+            SWSS_LOG_THROW("found tempoary RID %s but current VID doesn't exist, FATAL",
+                    sai_serialize_object_id(temporaryRid).c_str());
+        }
+
+        /*
+         * This vid is vid of current view, it may or may not be
+         * equal to temporaryVid, but we need to this step to not guess vids.
+         */
+
+        sai_object_id_t currentVid = currentIt->second;
+
+        m->setoid(&meta_key, currentVid);
     }
+
+    return true;
 }
 
-void processObjectForViewTransition(
-        _In_ AsicView &currentView,
-        _In_ AsicView &temporaryView,
-        _In_ const std::shared_ptr<SaiObj> &temporayObj);
+// TODO we can do this in generic way, we need serialize
 
 /**
- * @brief Process object attributes for view transition.
+ * @brief Find current best match for neighbor.
  *
- * Since each object can contain attributes (or non id struct object can
- * contain oids inside struct) they need to be processed first recursively and
- * they need to be in FINAL state before processing temporary view further.
+ * For Neighbor we don't need to iterate via all current neighbors, we can do
+ * dictionary lookup, but we need to do smart trick, since temporary object was
+ * processed we just need to check whether VID in neighbor_entry struct is
+ * matched/final and it has RID assigned from current view. If, RID exists, we
+ * can use that RID to get VID of current view, exchange in neighbor_entry
+ * struct and do dictionary lookup on serialized neighbor_entry.
  *
- * This processing may result in changes in current view like removing and
- * recreating or adding new objects depends on transitions.
+ * With this approach for many entries this is the quickest possible way. In
+ * case when RID doesn't exist, that means we have invalid neighbor entry, so we
+ * must return null.
  *
  * @param currentView Current view.
  * @param temporaryView Temporary view.
  * @param temporaryObj Temporary object.
+ *
+ * @return Best match object if found or nullptr.
  */
-void procesObjectAttributesForViewTransition(
-        _In_ AsicView &currentView,
-        _In_ AsicView &temporaryView,
-        _In_ const std::shared_ptr<SaiObj> &temporaryObj)
+std::shared_ptr<SaiObj> findCurrentBestMatchForNeighborEntry(
+        _In_ const AsicView &currentView,
+        _In_ const AsicView &temporaryView,
+        _In_ const std::shared_ptr<const SaiObj> &temporaryObj)
 {
     SWSS_LOG_ENTER();
 
-    SWSS_LOG_INFO("%s %s", temporaryObj->str_object_type.c_str(), temporaryObj->str_object_id.c_str());
-
     /*
-     * First we need to make sure if all attributes of this temporary object
-     * are in FINAL or MATCHED state, then we can process this object and find
-     * best match in current asic view.
+     * Make a copy here to not destroy object data, later
+     * on this data should be read only.
      */
 
-    for (auto &at: temporaryObj->getAllAttributes())
-    {
-        auto &attribute = at.second;
-
-        SWSS_LOG_INFO("attr %s", attribute->getStrAttrId().c_str());
+    sai_object_meta_key_t mk = temporaryObj->meta_key;
 
+    if (!exchangeTemporaryVidToCurrentVid(currentView, temporaryView, mk))
+    {
         /*
-         * For each object id in attributes go recursively to match those
-         * objects.
+         * Not all oids inside struct object were translated, so there is no
+         * matching object in current view, we need to return null.
          */
 
-        for (auto vid: attribute->getOidListFromAttribute())
-        {
-            if (vid == SAI_NULL_OBJECT_ID)
-            {
-                continue;
-            }
-
-            SWSS_LOG_INFO("- processing attr VID %s", sai_serialize_object_id(vid).c_str());
+        return nullptr;
+    }
 
-            auto tempParent = temporaryView.oOids.at(vid);
+    std::string str_neighbor_entry = sai_serialize_neighbor_entry(mk.objectkey.key.neighbor_entry);
 
-            processObjectForViewTransition(currentView, temporaryView, tempParent); // recursion
+    /*
+     * Now when we have serialized neighbor entry with temporary rif_if VID
+     * replaced to current rif_id VID we can do dictionary lookup for neighbor.
+     */
 
-            /*
-             * Temporary object here is never changed, even if we do recursion
-             * here all that could been removed are objects in current view
-             * tree so we don't need to worry about any temporary object
-             * removal.
-             */
-        }
-    }
+    auto currentNeighborIt = currentView.soNeighbors.find(str_neighbor_entry);
 
-    if (temporaryObj->isOidObject())
+    if (currentNeighborIt == currentView.soNeighbors.end())
     {
-        return;
+        SWSS_LOG_DEBUG("unable to find neighbor entry %s in current asic view",
+                str_neighbor_entry.c_str());
+
+        return nullptr;
     }
 
     /*
-     * For non object id types like NEIGHBOR or ROUTE they have object id
-     * inside object struct entry, they also need to be processed, in SAI 1.0
-     * this can be automated since we have metadata for those structs.
+     * We found the same neighbor entry in current view! Just one extra check
+     * of object status if it's not processed yet.
      */
 
-    for (size_t j = 0; j < temporaryObj->info->structmemberscount; ++j)
-    {
-        const sai_struct_member_info_t *m = temporaryObj->info->structmembers[j];
-
-        if (m->membervaluetype != SAI_ATTR_VALUE_TYPE_OBJECT_ID)
-        {
-            continue;
-        }
-
-        sai_object_id_t vid = m->getoid(&temporaryObj->meta_key);
+    auto currentNeighborObj = currentNeighborIt->second;
 
-        SWSS_LOG_INFO("- processing %s (%s) VID %s",
-                temporaryObj->str_object_type.c_str(),
-                m->membername,
-                sai_serialize_object_id(vid).c_str());
+    if (currentNeighborObj->getObjectStatus() == SAI_OBJECT_STATUS_NOT_PROCESSED)
+    {
+        return currentNeighborObj;
+    }
 
-        auto structObject = temporaryView.oOids.at(vid);
+    /*
+     * If we are here, that means this neighbor was already processed, which
+     * can indicate a bug or somehow duplicated entries.
+     */
 
-        processObjectForViewTransition(currentView, temporaryView, structObject); // recursion
-    }
+    SWSS_LOG_THROW("found neighbor entry %s in current view, but it status is %d, FATAL",
+            str_neighbor_entry.c_str(),
+            currentNeighborObj->getObjectStatus());
 }
 
-void bringNonRemovableObjectToDefaultState(
-        _In_ AsicView &currentView,
-        _In_ const std::shared_ptr<SaiObj> &currentObj)
+/**
+ * @brief Find current best match for route.
+ *
+ * For Route we don't need to iterate via all current routes, we can do
+ * dictionary lookup, but we need to do smart trick, since temporary object was
+ * processed we just need to check whether VID in route_entry struct is
+ * matched/final and it has RID assigned from current view. If, RID exists, we
+ * can use that RID to get VID of current view, exchange in route_entry struct
+ * and do dictionary lookup on serialized route_entry.
+ *
+ * With this approach for many entries this is the quickest possible way. In
+ * case when RID doesn't exist, that means we have invalid route entry, so we
+ * must return null.
+ *
+ * @param currentView Current view.
+ * @param temporaryView Temporary view.
+ * @param temporaryObj Temporary object.
+ *
+ * @return Best match object if found or nullptr.
+ */
+std::shared_ptr<SaiObj> findCurrentBestMatchForRouteEntry(
+        _In_ const AsicView &currentView,
+        _In_ const AsicView &temporaryView,
+        _In_ const std::shared_ptr<const SaiObj> &temporaryObj)
 {
     SWSS_LOG_ENTER();
 
-    for (const auto &it: currentObj->getAllAttributes())
+    /*
+     * Make a copy here to not destroy object data, later
+     * on this data should be read only.
+     */
+
+    sai_object_meta_key_t mk = temporaryObj->meta_key;
+
+    if (!exchangeTemporaryVidToCurrentVid(currentView, temporaryView, mk))
     {
-        const auto &attr = it.second;
+        /*
+         * Not all oids inside struct object were translated, so there is no
+         * matching object in current view, we need to return null.
+         */
 
-        const auto &meta = attr->getAttrMetadata();
+        return nullptr;
+    }
 
-        if (!SAI_HAS_FLAG_CREATE_AND_SET(meta->flags))
-        {
-            SWSS_LOG_THROW("attribute %s is not CREATE_AND_SET, bug?", meta->attridname);
-        }
+    std::string str_route_entry = sai_serialize_route_entry(mk.objectkey.key.route_entry);
 
-        if (meta->defaultvaluetype == SAI_DEFAULT_VALUE_TYPE_NONE)
-        {
-            SWSS_LOG_THROW("attribute %s default value type is NONE, bug?", meta->attridname);
-        }
+    /*
+     * Now when we have serialized route entry with temporary vr_id VID
+     * replaced to current vr_id VID we can do dictionary lookup for route.
+     */
+    auto currentRouteIt = currentView.soRoutes.find(str_route_entry);
 
-        auto defaultValueAttr = getSaiAttrFromDefaultValue(currentView, *meta);
+    if (currentRouteIt == currentView.soRoutes.end())
+    {
+        SWSS_LOG_DEBUG("unable to find route entry %s in current asic view", str_route_entry.c_str());
 
-        if (defaultValueAttr == nullptr)
-        {
-            SWSS_LOG_THROW("Can't get default value for present current attr %s:%s, FIXME",
-                    meta->attridname,
-                    attr->getStrAttrValue().c_str());
-        }
+        return nullptr;
+    }
 
-        if (attr->getStrAttrValue() == defaultValueAttr->getStrAttrValue())
-        {
-            /*
-             * If current value is the same as default value no need to
-             * generate ASIC update command.
-             */
+    /*
+     * We found the same route entry in current view! Just one extra check
+     * of object status if it's not processed yet.
+     */
 
-            continue;
-        }
+    auto currentRouteObj = currentRouteIt->second;
 
-        currentView.asicSetAttribute(currentObj, defaultValueAttr);
+    if (currentRouteObj->getObjectStatus() == SAI_OBJECT_STATUS_NOT_PROCESSED)
+    {
+        return currentRouteObj;
     }
 
-    currentObj->setObjectStatus(SAI_OBJECT_STATUS_FINAL);
-
     /*
-     * TODO Revisit.
-     *
-     * Problem here is that default trap group is used and we build references
-     * for it, so it will not be "removed" when processing, since it's default
-     * object so it will not be processed, and also it can't be removed since
-     * it's default object.
+     * If we are here, that means this route was already processed, which
+     * can indicate a bug or somehow duplicated entries.
      */
+
+    SWSS_LOG_THROW("found route entry %s in current view, but it status is %d, FATAL",
+            str_route_entry.c_str(),
+            currentRouteObj->getObjectStatus());
 }
 
 /**
- * @brief Indicates whether object can be removed.
+ * @brief Find current best match for FDB.
  *
- * This method should be used on oid objects, all non oid objects (like route,
- * neighbor, etc.) can be safely removed.
+ * For FDB we don't need to iterate via all current FDBs, we can do dictionary
+ * lookup, but we need to do smart trick, since temporary object was processed
+ * we just need to check whether VID in fdb_entry struct is matched/final and
+ * it has RID assigned from current view. If, RID exists, we can use that RID
+ * to get VID of current view, exchange in fdb_entry struct and do dictionary
+ * lookup on serialized fdb_entry.
  *
- * @param currentObj Current object to be examined.
+ * With this approach for many entries this is the quickest possible way. In
+ * case when RID doesn't exist, that means we have invalid fdb entry, so we must
+ * return null.
  *
- * @return True if object can be removed, false otherwise.
+ * @param currentView Current view.
+ * @param temporaryView Temporary view.
+ * @param temporaryObj Temporary object.
+ *
+ * @return Best match object if found or nullptr.
  */
-bool isNonRemovableObject(
+std::shared_ptr<SaiObj> findCurrentBestMatchForFdbEntry(
         _In_ const AsicView &currentView,
         _In_ const AsicView &temporaryView,
-        _In_ const std::shared_ptr<const SaiObj> &currentObj)
+        _In_ const std::shared_ptr<const SaiObj> &temporaryObj)
 {
     SWSS_LOG_ENTER();
 
-    if (currentObj->isOidObject())
+    /*
+     * Make a copy here to not destroy object data, later
+     * on this data should be read only.
+     */
+
+    sai_object_meta_key_t mk = temporaryObj->meta_key;
+
+    if (!exchangeTemporaryVidToCurrentVid(currentView, temporaryView, mk))
     {
-        sai_object_id_t rid = currentView.vidToRid.at(currentObj->getVid());
+        /*
+         * Not all oids inside struct object were translated, so there is no
+         * matching object in current view, we need to return null.
+         */
 
-        // XXX we have only 1 switch, so we can get away with this
+        return nullptr;
+    }
 
-        auto sw = switches.begin()->second;
+    std::string str_fdb_entry = sai_serialize_fdb_entry(mk.objectkey.key.fdb_entry);
 
-        return sw->isNonRemovableRid(rid);
+    /*
+     * Now when we have serialized fdb entry with temporary VIDs
+     * replaced to current VIDs we can do dictionary lookup for fdb.
+     */
+
+    auto currentFdbIt = currentView.soFdbs.find(str_fdb_entry);
+
+    if (currentFdbIt == currentView.soFdbs.end())
+    {
+        SWSS_LOG_DEBUG("unable to find fdb entry %s in current asic view", str_fdb_entry.c_str());
+
+        return nullptr;
     }
 
     /*
-     * Object is non object id, like ROUTE_ENTRY etc, can be removed.
+     * We found the same fdb entry in current view! Just one extra check
+     * of object status if it's not processed yet.
      */
 
-    return false;
+    auto currentFdbObj = currentFdbIt->second;
+
+    if (currentFdbObj->getObjectStatus() == SAI_OBJECT_STATUS_NOT_PROCESSED)
+    {
+        return currentFdbObj;
+    }
+
+    /*
+     * If we are here, that means this fdb was already processed, which
+     * can indicate a bug or somehow duplicated entries.
+     */
+
+    SWSS_LOG_THROW("found fdb entry %s in current view, but it status is %d, FATAL",
+            str_fdb_entry.c_str(),
+            currentFdbObj->getObjectStatus());
 }
 
-void removeExistingObjectFromCurrentView(
-        _In_ AsicView &currentView,
+std::shared_ptr<SaiObj> findCurrentBestMatchForSwitch(
+        _In_ const AsicView &currentView,
         _In_ const AsicView &temporaryView,
-        _In_ const std::shared_ptr<SaiObj> &currentObj)
+        _In_ const std::shared_ptr<const SaiObj> &temporaryObj)
 {
     SWSS_LOG_ENTER();
 
     /*
-     * This decreasing VID reference will be hard when actual reference will
-     * be one of default objects like CPU or default trap group when we "bring
-     * default value" or maybe in oid case we will not bring default values and
-     * just remove and recreate.
+     * On compare logic we checked that we have one switch
+     * so we can just get first.
      */
 
-    if (currentObj->isOidObject())
+    auto currentSwitches = currentView.getObjectsByObjectType(SAI_OBJECT_TYPE_SWITCH);
+
+    if (currentSwitches.size() == 0)
     {
-        int count = currentView.getVidReferenceCount(currentObj->getVid());
+        SWSS_LOG_NOTICE("unable to find switch object in current view");
 
-        if (count != 0)
-        {
-            /*
-             * If references count is not zero, we need to remove child
-             * first for that we need dependency tree, not supported yet.
-             *
-             * NOTE: Object can be non removable and can have reference on it.
-             */
+        return nullptr;
+    }
 
-            SWSS_LOG_THROW("can't remove existing object %s:%s since reference count is %d, FIXME",
-                    currentObj->str_object_type.c_str(),
-                    currentObj->str_object_id.c_str(),
-                    count);
-        }
+    if (currentSwitches.size() > 1)
+    {
+        SWSS_LOG_THROW("found %zu switches declared in current view, not supported",
+                currentSwitches.size());
     }
 
     /*
-     * If some object can't be removed from current view and it's missing from
-     * temp, then it needs to be transferred to temp as well and bring to
-     * default values.
-     *
-     * First we need to check if object can be removed, like port's cant be
-     * removed, vlan 1, queues, ingress pg etc.
-     *
-     * Remove for those objects is not supported now lets bring back
-     * object to default state.
-     *
-     * For oid values we can figure out if we would have list of
-     * defaults which can be removed and which can't and use list same
-     * for queues, schedulers etc.
-     *
-     * We could use switch here and non created objects to make this simpler.
+     * We found switch object in current view! Just one extra check
+     * of object status if it's not processed yet.
      */
 
+    auto currentSwitchObj = currentSwitches.at(0);
 
-    if (currentObj->getObjectType() == SAI_OBJECT_TYPE_SWITCH)
-    {
-        /*
-         * Remove switch is much simpler, we just need check if switch doesn't
-         * exist in temporary view, and we can just remove it. In here when
-         * attributes don't match it's much complicated.
-         */
-
-        SWSS_LOG_THROW("switch can't be removed from current view, not supported yet");
-    }
-
-    if (isNonRemovableObject(currentView, temporaryView, currentObj))
+    if (currentSwitchObj->getObjectStatus() == SAI_OBJECT_STATUS_NOT_PROCESSED)
     {
-        bringNonRemovableObjectToDefaultState(currentView, currentObj);
+        return currentSwitchObj;
     }
-    else
-    {
-        /*
-         * Asic remove object is decreasing reference count on non object ID if
-         * current object is non object id, release existing links only looks
-         * into attributes.
-         */
 
-        currentView.asicRemoveObject(currentObj);
+    /*
+     * If we are here, that means this switch was already processed, which
+     * can indicate a bug or somehow duplicated entries.
+     */
 
-        currentObj->setObjectStatus(SAI_OBJECT_STATUS_REMOVED);
-    }
+    SWSS_LOG_THROW("found switch object %s in current view, but it status is %d, FATAL",
+            currentSwitchObj->str_object_id.c_str(),
+            currentSwitchObj->getObjectStatus());
 }
 
-sai_object_id_t translateTemporaryVidToCurrentVid(
+/**
+ * @brief Find current best match for NAT entry.
+ *
+ *
+ * @param currentView Current view.
+ * @param temporaryView Temporary view.
+ * @param temporaryObj Temporary object.
+ *
+ * @return Best match object if found or nullptr.
+ */
+std::shared_ptr<SaiObj> findCurrentBestMatchForNatEntry(
         _In_ const AsicView &currentView,
         _In_ const AsicView &temporaryView,
-        _In_ sai_object_id_t tvid)
+        _In_ const std::shared_ptr<const SaiObj> &temporaryObj)
 {
     SWSS_LOG_ENTER();
 
     /*
-     * This method is used to translate temporary VID to current VID using RID
-     * which should be present in both views. If RID doesn't exist, then we
-     * check whether object was created if so, then we return temporary VID
-     * instead of creating new current VID and we don't need to track mapping
-     * of those vids not having actual RID. This function should be used only
-     * when we creating new objects in current view.
+     * Make a copy here to not destroy object data, later
+     * on this data should be read only.
      */
 
-    auto temporaryIt = temporaryView.vidToRid.find(tvid);
+    sai_object_meta_key_t mk = temporaryObj->meta_key;
 
-    if (temporaryIt == temporaryView.vidToRid.end())
+    if (!exchangeTemporaryVidToCurrentVid(currentView, temporaryView, mk))
     {
         /*
-         * This can also happen when this VID object was created dynamically,
-         * and don't have RID assigned yet, in that case we should use exact
-         * same VID. We need to get temporary object for that VID and see if
-         * flag created is set, and same VID must then exists in current view.
-         */
-
-        /*
-         * We need to find object that has this vid
+         * Not all oids inside struct object were translated, so there is no
+         * matching object in current view, we need to return null.
          */
 
-        auto tempIt = temporaryView.oOids.find(tvid);
-
-        if (tempIt == temporaryView.oOids.end())
-        {
-            SWSS_LOG_THROW("temporary VID %s not found in temporary view",
-                    sai_serialize_object_id(tvid).c_str());
-        }
+        return nullptr;
+    }
 
-        const auto &tempObj = tempIt->second;
+    std::string str_nat_entry = sai_serialize_nat_entry(mk.objectkey.key.nat_entry);
 
-        if (tempObj->createdObject)
-        {
-            SWSS_LOG_DEBUG("translated temp VID %s to current, since object was created",
-                    sai_serialize_object_id(tvid).c_str());
+    /*
+     * Now when we have serialized NAT entry with temporary vr_id VID
+     * replaced to current vr_id VID we can do dictionary lookup for NAT entry.
+     */
+    auto currentNatEntry = currentView.soNatEntries.find(str_nat_entry);
 
-            return tvid;
-        }
+    if (currentNatEntry == currentView.soNatEntries.end())
+    {
+        SWSS_LOG_DEBUG("unable to find NAT entry %s in current asic view", str_nat_entry.c_str());
 
-        SWSS_LOG_THROW("VID %s was not found in temporary view, was object created? FIXME",
-                sai_serialize_object_id(tvid).c_str());
+        return nullptr;
     }
 
-    sai_object_id_t rid = temporaryIt->second;
+    /*
+     * We found the same NAT entry in current view! Just one extra check
+     * of object status if it's not processed yet.
+     */
 
-    auto currentIt = currentView.ridToVid.find(rid);
+    auto currentNatObj = currentNatEntry->second;
 
-    if (currentIt == currentView.ridToVid.end())
+    if (currentNatObj->getObjectStatus() == SAI_OBJECT_STATUS_NOT_PROCESSED)
     {
-        SWSS_LOG_THROW("RID %s was not found in current view",
-                sai_serialize_object_id(rid).c_str());
+        return currentNatObj;
     }
 
-    sai_object_id_t cvid = currentIt->second;
 
-    SWSS_LOG_DEBUG("translated temp VID %s using RID %s to current VID %s",
-            sai_serialize_object_id(tvid).c_str(),
-            sai_serialize_object_id(rid).c_str(),
-            sai_serialize_object_id(cvid).c_str());
+    /*
+     * If we are here, that means this NAT entry was already processed, which
+     * can indicate a bug or somehow duplicated entries.
+     */
 
-    return cvid;
+    SWSS_LOG_THROW("found NAT entry %s in current view, but it status is %d, FATAL",
+            str_nat_entry.c_str(),
+            currentNatObj->getObjectStatus());
 }
 
-std::shared_ptr<SaiAttr> translateTemporaryVidsToCurrentVids(
+std::shared_ptr<SaiObj> findCurrentBestMatch(
         _In_ const AsicView &currentView,
         _In_ const AsicView &temporaryView,
-        _In_ const std::shared_ptr<SaiObj> &currentObj,
-        _In_ const std::shared_ptr<SaiAttr> &inattr)
+        _In_ const std::shared_ptr<const SaiObj> &temporaryObj)
 {
     SWSS_LOG_ENTER();
 
-    /*
-     * We are creating copy here since we will modify contents of that
-     * attribute.
-     */
+    if (temporaryObj->isOidObject() &&
+            temporaryObj->getObjectStatus() == SAI_OBJECT_STATUS_MATCHED)
+    {
+        /*
+         * Object status is matched so current and temp VID are the same so we
+         * can just take object directly.
+         */
 
-    auto attr = std::make_shared<SaiAttr>(inattr->getStrAttrId(), inattr->getStrAttrValue());
+        SWSS_LOG_INFO("found best match for %s %s since object status is MATCHED",
+                temporaryObj->str_object_type.c_str(),
+                temporaryObj->str_object_id.c_str());
 
-    if (!attr->isObjectIdAttr())
-    {
-        return attr;
+        return currentView.oOids.at(temporaryObj->getVid());
     }
 
     /*
-     * We need temporary VID translation to current view RID.
-     *
-     * We also need simpler version that will translate simple VID for
-     * oids present inside non object id structs.
+     * NOTE: Later on best match find can be done based on present CREATE_ONLY
+     * attributes or on most matched CREATE_AND_SET attributes.
      */
 
-    uint32_t count = 0;
-
-    sai_object_id_t *objectIdList = NULL;
-
-    auto &at = *attr->getRWSaiAttr();
-
-    switch (attr->getAttrMetadata()->attrvaluetype)
+    switch (temporaryObj->getObjectType())
     {
-        case SAI_ATTR_VALUE_TYPE_OBJECT_ID:
-            count = 1;
-            objectIdList = &at.value.oid;
-            break;
+        /*
+         * Non object id cases
+         */
 
-        case SAI_ATTR_VALUE_TYPE_OBJECT_LIST:
-            count = at.value.objlist.count;
-            objectIdList = at.value.objlist.list;
-            break;
+        case SAI_OBJECT_TYPE_NEIGHBOR_ENTRY:
+            return findCurrentBestMatchForNeighborEntry(currentView, temporaryView, temporaryObj);
 
-        case SAI_ATTR_VALUE_TYPE_ACL_FIELD_DATA_OBJECT_ID:
+        case SAI_OBJECT_TYPE_ROUTE_ENTRY:
+            return findCurrentBestMatchForRouteEntry(currentView, temporaryView, temporaryObj);
 
-            if (at.value.aclfield.enable)
-            {
-                count = 1;
-                objectIdList = &at.value.aclfield.data.oid;
-            }
+        case SAI_OBJECT_TYPE_FDB_ENTRY:
+            return findCurrentBestMatchForFdbEntry(currentView, temporaryView, temporaryObj);
 
-            break;
+        case SAI_OBJECT_TYPE_NAT_ENTRY:
+            return findCurrentBestMatchForNatEntry(currentView, temporaryView, temporaryObj);
+ 
+            /*
+             * We can have special case for switch since we know there should
+             * be only one switch.
+             */
 
-        case SAI_ATTR_VALUE_TYPE_ACL_FIELD_DATA_OBJECT_LIST:
+        case SAI_OBJECT_TYPE_SWITCH:
+            return findCurrentBestMatchForSwitch(currentView, temporaryView, temporaryObj);
 
-            if (at.value.aclfield.enable)
+        default:
+
+            if (!temporaryObj->isOidObject())
             {
-                count = at.value.aclfield.data.objlist.count;
-                objectIdList = at.value.aclfield.data.objlist.list;
+                SWSS_LOG_THROW("object %s:%s is non object id, not handled yet, FIXME",
+                        temporaryObj->str_object_type.c_str(),
+                        temporaryObj->str_object_id.c_str());
             }
 
-            break;
+            /*
+             * Here we support only object id object types.
+             */
 
-        case SAI_ATTR_VALUE_TYPE_ACL_ACTION_DATA_OBJECT_ID:
+            return findCurrentBestMatchForGenericObject(currentView, temporaryView, temporaryObj);
+    }
+}
 
-            if (at.value.aclaction.enable)
-            {
-                count = 1;
-                objectIdList = &at.value.aclaction.parameter.oid;
-            }
+void processObjectForViewTransition(
+        _In_ AsicView &currentView,
+        _In_ AsicView &temporaryView,
+        _In_ const std::shared_ptr<SaiObj> &temporayObj);
 
-            break;
+/**
+ * @brief Process object attributes for view transition.
+ *
+ * Since each object can contain attributes (or non id struct object can
+ * contain oids inside struct) they need to be processed first recursively and
+ * they need to be in FINAL state before processing temporary view further.
+ *
+ * This processing may result in changes in current view like removing and
+ * recreating or adding new objects depends on transitions.
+ *
+ * @param currentView Current view.
+ * @param temporaryView Temporary view.
+ * @param temporaryObj Temporary object.
+ */
+void procesObjectAttributesForViewTransition(
+        _In_ AsicView &currentView,
+        _In_ AsicView &temporaryView,
+        _In_ const std::shared_ptr<SaiObj> &temporaryObj)
+{
+    SWSS_LOG_ENTER();
 
-        case SAI_ATTR_VALUE_TYPE_ACL_ACTION_DATA_OBJECT_LIST:
+    SWSS_LOG_INFO("%s %s", temporaryObj->str_object_type.c_str(), temporaryObj->str_object_id.c_str());
 
-            if (at.value.aclaction.enable)
+    /*
+     * First we need to make sure if all attributes of this temporary object
+     * are in FINAL or MATCHED state, then we can process this object and find
+     * best match in current asic view.
+     */
+
+    for (auto &at: temporaryObj->getAllAttributes())
+    {
+        auto &attribute = at.second;
+
+        SWSS_LOG_INFO("attr %s", attribute->getStrAttrId().c_str());
+
+        /*
+         * For each object id in attributes go recursively to match those
+         * objects.
+         */
+
+        for (auto vid: attribute->getOidListFromAttribute())
+        {
+            if (vid == SAI_NULL_OBJECT_ID)
             {
-                count = at.value.aclaction.parameter.objlist.count;
-                objectIdList = at.value.aclaction.parameter.objlist.list;
+                continue;
             }
 
-            break;
+            SWSS_LOG_INFO("- processing attr VID %s", sai_serialize_object_id(vid).c_str());
 
-        default:
-            break;
+            auto tempParent = temporaryView.oOids.at(vid);
+
+            processObjectForViewTransition(currentView, temporaryView, tempParent); // recursion
+
+            /*
+             * Temporary object here is never changed, even if we do recursion
+             * here all that could been removed are objects in current view
+             * tree so we don't need to worry about any temporary object
+             * removal.
+             */
+        }
     }
 
-    for (uint32_t i = 0; i < count; ++i)
+    if (temporaryObj->isOidObject())
     {
-        sai_object_id_t tvid = objectIdList[i];
+        return;
+    }
 
-        if (tvid == SAI_NULL_OBJECT_ID)
+    /*
+     * For non object id types like NEIGHBOR or ROUTE they have object id
+     * inside object struct entry, they also need to be processed, in SAI 1.0
+     * this can be automated since we have metadata for those structs.
+     */
+
+    for (size_t j = 0; j < temporaryObj->info->structmemberscount; ++j)
+    {
+        const sai_struct_member_info_t *m = temporaryObj->info->structmembers[j];
+
+        if (m->membervaluetype != SAI_ATTR_VALUE_TYPE_OBJECT_ID)
         {
             continue;
         }
 
-        /*
-         * Do actual translation.
-         */
+        sai_object_id_t vid = m->getoid(&temporaryObj->meta_key);
 
-        objectIdList[i] =  translateTemporaryVidToCurrentVid(currentView, temporaryView, tvid);
+        SWSS_LOG_INFO("- processing %s (%s) VID %s",
+                temporaryObj->str_object_type.c_str(),
+                m->membername,
+                sai_serialize_object_id(vid).c_str());
+
+        auto structObject = temporaryView.oOids.at(vid);
+
+        processObjectForViewTransition(currentView, temporaryView, structObject); // recursion
     }
+}
 
-    /*
-     * Since we probably performed updates on this attribute, since VID was
-     * exchanged, we need to update value string of that attribute.
-     */
+void bringNonRemovableObjectToDefaultState(
+        _In_ AsicView &currentView,
+        _In_ const std::shared_ptr<SaiObj> &currentObj)
+{
+    SWSS_LOG_ENTER();
 
-    attr->UpdateValue();
+    for (const auto &it: currentObj->getAllAttributes())
+    {
+        const auto &attr = it.second;
 
-    return attr;
+        const auto &meta = attr->getAttrMetadata();
+
+        if (!SAI_HAS_FLAG_CREATE_AND_SET(meta->flags))
+        {
+            SWSS_LOG_THROW("attribute %s is not CREATE_AND_SET, bug?", meta->attridname);
+        }
+
+        if (meta->defaultvaluetype == SAI_DEFAULT_VALUE_TYPE_NONE)
+        {
+            SWSS_LOG_THROW("attribute %s default value type is NONE, bug?", meta->attridname);
+        }
+
+        auto defaultValueAttr = getSaiAttrFromDefaultValue(currentView, *meta);
+
+        if (defaultValueAttr == nullptr)
+        {
+            SWSS_LOG_THROW("Can't get default value for present current attr %s:%s, FIXME",
+                    meta->attridname,
+                    attr->getStrAttrValue().c_str());
+        }
+
+        if (attr->getStrAttrValue() == defaultValueAttr->getStrAttrValue())
+        {
+            /*
+             * If current value is the same as default value no need to
+             * generate ASIC update command.
+             */
+
+            continue;
+        }
+
+        currentView.asicSetAttribute(currentObj, defaultValueAttr);
+    }
+
+    currentObj->setObjectStatus(SAI_OBJECT_STATUS_FINAL);
+
+    /*
+     * TODO Revisit.
+     *
+     * Problem here is that default trap group is used and we build references
+     * for it, so it will not be "removed" when processing, since it's default
+     * object so it will not be processed, and also it can't be removed since
+     * it's default object.
+     */
 }
 
 /**
- * @brief Set attribute on current object
+ * @brief Indicates whether object can be removed.
  *
- * This function will set given attribute to current object adding new
- * attribute or replacing existing one. Given attribute can be either one
- * temporary attribute missing or different from current object object or
- * default attribute value if we need to bring some attribute to default value.
+ * This method should be used on oid objects, all non oid objects (like route,
+ * neighbor, etc.) can be safely removed.
  *
- * @param currentView Current view.
- * @param temporaryView Temporary view.
- * @param currentObj Current object on which we set attribute.
- * @param inattr Attribute to be set on current object.
+ * @param currentObj Current object to be examined.
+ *
+ * @return True if object can be removed, false otherwise.
  */
-void setAttributeOnCurrentObject(
-        _In_ AsicView &currentView,
+bool isNonRemovableObject(
+        _In_ const AsicView &currentView,
         _In_ const AsicView &temporaryView,
-        _In_ const std::shared_ptr<SaiObj> &currentObj,
-        _In_ const std::shared_ptr<SaiAttr> &inattr)
+        _In_ const std::shared_ptr<const SaiObj> &currentObj)
 {
     SWSS_LOG_ENTER();
 
-    /*
-     * At the beginning just small assert to check if object is create and set.
-     */
+    if (currentObj->isOidObject())
+    {
+        sai_object_id_t rid = currentView.vidToRid.at(currentObj->getVid());
 
-    const auto meta = inattr->getAttrMetadata();
+        // XXX we have only 1 switch, so we can get away with this
 
-    if (!SAI_HAS_FLAG_CREATE_AND_SET(meta->flags))
-    {
-        SWSS_LOG_THROW("can't set attribute %s on current object %s:%s since it's not CREATE_AND_SET",
-                meta->attridname,
-                currentObj->str_object_type.c_str(),
-                currentObj->str_object_id.c_str());
+        auto sw = switches.begin()->second;
+
+        return sw->isNonRemovableRid(rid);
     }
 
     /*
-     * NOTE: Since attribute we SET can be OID attribute, and that can be a VID
-     * or list of VIDs from temporary view. So after this "set" operation we
-     * will end up with MIXED VIDs on current view, some object will contain
-     * VIDs from temporary view, and this can lead to fail in
-     * translate_vid_to_rid since we will need to look inside two views to find
-     * right RID.
-     *
-     * We need a flag to say that VID is for object that was created
-     * and we can mix only those VID's for objects that was created.
-     *
-     * In here we need to translate attribute VIDs to current VIDs to keep
-     * track in dependency tree, since if we use temporary VID that will point
-     * to the same RID then we will lost track in dependency tree of that VID
-     * reference count.
-     *
-     * This should also done for object id's inside non object ids.
+     * Object is non object id, like ROUTE_ENTRY etc, can be removed.
      */
 
-    std::shared_ptr<SaiAttr> attr = translateTemporaryVidsToCurrentVids(currentView, temporaryView, currentObj, inattr);
-
-    currentView.asicSetAttribute(currentObj, attr);
+    return false;
 }
 
-/**
- * @brief Create new object from temporary object.
- *
- * Since best match was not found we need to create a brand new object and put
- * it into current view as well.
- *
- * @param currentView Current view.
- * @param temporaryView Temporary view.
- * @param temporaryObj Temporary object to be cloned to current view.
- */
-void createNewObjectFromTemporaryObject(
+void removeExistingObjectFromCurrentView(
         _In_ AsicView &currentView,
         _In_ const AsicView &temporaryView,
-        _In_ const std::shared_ptr<SaiObj> &temporaryObj)
+        _In_ const std::shared_ptr<SaiObj> &currentObj)
 {
     SWSS_LOG_ENTER();
 
-    SWSS_LOG_INFO("creating object %s:%s",
-                    temporaryObj->str_object_type.c_str(),
-                    temporaryObj->str_object_id.c_str());
-
     /*
-     * This trap can be default trap group, so let's check if it's, then we
-     * can't create it, we need to set new attributes if that possible. But
-     * this case should not happen since on syncd start we are putting default
-     * trap group to asic view, so if user will query default one, they will be
-     * matched by RID.
-     *
-     * Default trap group is transferred to view on init if it doesn't exist.
-     *
-     * There should be no such action here, since this scenario would mean that
-     * there is default switch object in temporary view, but not in current
-     * view. All default objects are put to ASIC state table when switch is
-     * created. So what can happen is opposite scenario.
+     * This decreasing VID reference will be hard when actual reference will
+     * be one of default objects like CPU or default trap group when we "bring
+     * default value" or maybe in oid case we will not bring default values and
+     * just remove and recreate.
      */
 
-    /*
-     * NOTE: Since attributes we pass to create can be OID attributes, and that
-     * can be a VID or list of VIDs from temporary view. So after this create
-     * operation we will end up with MIXED VIDs on current view, some object
-     * will contain VIDs from temporary view, and this can lead to fail in
-     * translate_vid_to_rid since we will need to look inside two views to find
-     * right RID.
-     *
-     * We need a flag to say that VID is for object that was created and we can
-     * mix only those VID's for objects that was created.
-     *
-     * In here we need to translate attribute VIDs to current VIDs to keep
-     * track in dependency tree, since if we use temporary VID that will point
-     * to the same RID then we will lost track in dependency tree of that VID
-     * reference count.
-     *
-     * This should also be done for object id's inside non object ids.
-     */
+    if (currentObj->isOidObject())
+    {
+        int count = currentView.getVidReferenceCount(currentObj->getVid());
 
-    /*
-     * We need to loop through all attributes and create copy of this object
-     * and translate all attributes for getting correct VIDs like in set
-     * operation, we can't use VID's from temporary view to not mix them with
-     * current view, except created object ID's, since we won't be creating any
-     * new VID on the way (but we could) maybe we can do that later - but for
-     * that we will need some kind of RID which would later need to be removed.
-     */
+        if (count != 0)
+        {
+            /*
+             * If references count is not zero, we need to remove child
+             * first for that we need dependency tree, not supported yet.
+             *
+             * NOTE: Object can be non removable and can have reference on it.
+             */
 
-    std::shared_ptr<SaiObj> currentObj = std::make_shared<SaiObj>();
+            SWSS_LOG_THROW("can't remove existing object %s:%s since reference count is %d, FIXME",
+                    currentObj->str_object_type.c_str(),
+                    currentObj->str_object_id.c_str(),
+                    count);
+        }
+    }
 
     /*
-     * TODO Find out better way to do this, copy operator ?
+     * If some object can't be removed from current view and it's missing from
+     * temp, then it needs to be transferred to temp as well and bring to
+     * default values.
+     *
+     * First we need to check if object can be removed, like port's cant be
+     * removed, vlan 1, queues, ingress pg etc.
+     *
+     * Remove for those objects is not supported now lets bring back
+     * object to default state.
+     *
+     * For oid values we can figure out if we would have list of
+     * defaults which can be removed and which can't and use list same
+     * for queues, schedulers etc.
+     *
+     * We could use switch here and non created objects to make this simpler.
      */
 
-    currentObj->str_object_type  = temporaryObj->str_object_type;
-    currentObj->str_object_id    = temporaryObj->str_object_id;      // temporary VID / non object id
-    currentObj->meta_key         = temporaryObj->meta_key;           // temporary VID / non object id
-    currentObj->info             = temporaryObj->info;
 
-    if (!temporaryObj->isOidObject())
+    if (currentObj->getObjectType() == SAI_OBJECT_TYPE_SWITCH)
     {
         /*
-         * Since object contains OID inside struct, this OID may already exist
-         * in current view, so we need to do translation here.
+         * Remove switch is much simpler, we just need check if switch doesn't
+         * exist in temporary view, and we can just remove it. In here when
+         * attributes don't match it's much complicated.
          */
 
-        for (size_t j = 0; j < currentObj->info->structmemberscount; ++j)
-        {
-            const sai_struct_member_info_t *m = currentObj->info->structmembers[j];
+        SWSS_LOG_THROW("switch can't be removed from current view, not supported yet");
+    }
 
-            if (m->membervaluetype != SAI_ATTR_VALUE_TYPE_OBJECT_ID)
-            {
-                continue;
-            }
+    if (isNonRemovableObject(currentView, temporaryView, currentObj))
+    {
+        bringNonRemovableObjectToDefaultState(currentView, currentObj);
+    }
+    else
+    {
+        /*
+         * Asic remove object is decreasing reference count on non object ID if
+         * current object is non object id, release existing links only looks
+         * into attributes.
+         */
 
-            sai_object_id_t vid = m->getoid(&currentObj->meta_key);
+        currentView.asicRemoveObject(currentObj);
 
-            vid = translateTemporaryVidToCurrentVid(currentView, temporaryView, vid);
+        currentObj->setObjectStatus(SAI_OBJECT_STATUS_REMOVED);
+    }
+}
 
-            m->setoid(&currentObj->meta_key, vid);
+sai_object_id_t translateTemporaryVidToCurrentVid(
+        _In_ const AsicView &currentView,
+        _In_ const AsicView &temporaryView,
+        _In_ sai_object_id_t tvid)
+{
+    SWSS_LOG_ENTER();
 
-            /*
-             * Bind new vid reference is already done inside asicCreateObject.
-             */
-        }
+    /*
+     * This method is used to translate temporary VID to current VID using RID
+     * which should be present in both views. If RID doesn't exist, then we
+     * check whether object was created if so, then we return temporary VID
+     * instead of creating new current VID and we don't need to track mapping
+     * of those vids not having actual RID. This function should be used only
+     * when we creating new objects in current view.
+     */
+
+    auto temporaryIt = temporaryView.vidToRid.find(tvid);
 
+    if (temporaryIt == temporaryView.vidToRid.end())
+    {
         /*
-         * Since it's possible that object id may had been changed, we need to
-         * update string as well.
+         * This can also happen when this VID object was created dynamically,
+         * and don't have RID assigned yet, in that case we should use exact
+         * same VID. We need to get temporary object for that VID and see if
+         * flag created is set, and same VID must then exists in current view.
          */
 
-        switch (temporaryObj->getObjectType())
-        {
-            case SAI_OBJECT_TYPE_ROUTE_ENTRY:
-
-                currentObj->str_object_id = sai_serialize_route_entry(currentObj->meta_key.objectkey.key.route_entry);
-                break;
-
-            case SAI_OBJECT_TYPE_NEIGHBOR_ENTRY:
+        /*
+         * We need to find object that has this vid
+         */
 
-                currentObj->str_object_id = sai_serialize_neighbor_entry(currentObj->meta_key.objectkey.key.neighbor_entry);
-                break;
+        auto tempIt = temporaryView.oOids.find(tvid);
 
-            case SAI_OBJECT_TYPE_FDB_ENTRY:
-                currentObj->str_object_id = sai_serialize_fdb_entry(currentObj->meta_key.objectkey.key.fdb_entry);
-                break;
+        if (tempIt == temporaryView.oOids.end())
+        {
+            SWSS_LOG_THROW("temporary VID %s not found in temporary view",
+                    sai_serialize_object_id(tvid).c_str());
+        }
 
-            case SAI_OBJECT_TYPE_NAT_ENTRY:
-                currentObj->str_object_id = sai_serialize_nat_entry(currentObj->meta_key.objectkey.key.nat_entry);
-                break;
+        const auto &tempObj = tempIt->second;
 
-            default:
+        if (tempObj->createdObject)
+        {
+            SWSS_LOG_DEBUG("translated temp VID %s to current, since object was created",
+                    sai_serialize_object_id(tvid).c_str());
 
-                SWSS_LOG_THROW("unexpected non object id type: %s",
-                        sai_serialize_object_type(temporaryObj->getObjectType()).c_str());
+            return tvid;
         }
+
+        SWSS_LOG_THROW("VID %s was not found in temporary view, was object created? FIXME",
+                sai_serialize_object_id(tvid).c_str());
     }
 
-    /*
-     * CreateObject flag is set to true, so when we we will be looking to
-     * translate VID between temporary view and current view (since status will
-     * be FINAL) then we will know that there is no actual RID yet, and both
-     * VIDs are the same. So this is how we cam match both objects between
-     * views.
-     */
+    sai_object_id_t rid = temporaryIt->second;
 
-    currentObj->createdObject = true;
-    temporaryObj->createdObject = true;
+    auto currentIt = currentView.ridToVid.find(rid);
 
-    for (const auto &pair: temporaryObj->getAllAttributes())
+    if (currentIt == currentView.ridToVid.end())
     {
-        const auto &tmpattr = pair.second;
+        SWSS_LOG_THROW("RID %s was not found in current view",
+                sai_serialize_object_id(rid).c_str());
+    }
 
-        std::shared_ptr<SaiAttr> attr = translateTemporaryVidsToCurrentVids(currentView, temporaryView, currentObj, tmpattr);
+    sai_object_id_t cvid = currentIt->second;
 
-        if (attr->isObjectIdAttr())
-        {
-            /*
-             * This is new attribute so we don't need to release any new links.
-             * But we need to bind new links on current object.
-             */
+    SWSS_LOG_DEBUG("translated temp VID %s using RID %s to current VID %s",
+            sai_serialize_object_id(tvid).c_str(),
+            sai_serialize_object_id(rid).c_str(),
+            sai_serialize_object_id(cvid).c_str());
 
-            currentObj->setAttr(attr);
-        }
-        else
-        {
-            /*
-             * This create attribute don't contain any OIDs so no extra
-             * operations are required, we don't need to break any references
-             * and decrease any reference count.
-             */
+    return cvid;
+}
 
-            currentObj->setAttr(attr);
-        }
-    }
+std::shared_ptr<SaiAttr> translateTemporaryVidsToCurrentVids(
+        _In_ const AsicView &currentView,
+        _In_ const AsicView &temporaryView,
+        _In_ const std::shared_ptr<SaiObj> &currentObj,
+        _In_ const std::shared_ptr<SaiAttr> &inattr)
+{
+    SWSS_LOG_ENTER();
 
     /*
-     * Asic create object inserts new reference to track inside asic view.
+     * We are creating copy here since we will modify contents of that
+     * attribute.
      */
 
-    currentView.asicCreateObject(currentObj);
+    auto attr = std::make_shared<SaiAttr>(inattr->getStrAttrId(), inattr->getStrAttrValue());
+
+    if (!attr->isObjectIdAttr())
+    {
+        return attr;
+    }
 
     /*
-     * Move both object status to FINAL since both objects were processed
-     * successfully and object was created.
+     * We need temporary VID translation to current view RID.
+     *
+     * We also need simpler version that will translate simple VID for
+     * oids present inside non object id structs.
      */
 
-    currentObj->setObjectStatus(SAI_OBJECT_STATUS_FINAL);
-    temporaryObj->setObjectStatus(SAI_OBJECT_STATUS_FINAL);
-}
-
-void UpdateObjectStatus(
-        _In_ AsicView &currentView,
-        _In_ AsicView &temporaryView,
-        _In_ const std::shared_ptr<SaiObj> &currentBestMatch,
-        _In_ const std::shared_ptr<SaiObj> &temporaryObj)
-{
-    SWSS_LOG_ENTER();
+    uint32_t count = 0;
 
-    bool notprocessed = ((temporaryObj->getObjectStatus() == SAI_OBJECT_STATUS_NOT_PROCESSED) &&
-            (currentBestMatch->getObjectStatus() == SAI_OBJECT_STATUS_NOT_PROCESSED));
+    sai_object_id_t *objectIdList = NULL;
 
-    bool matched = ((temporaryObj->getObjectStatus() == SAI_OBJECT_STATUS_MATCHED) &&
-            (currentBestMatch->getObjectStatus() == SAI_OBJECT_STATUS_MATCHED));
+    auto &at = *attr->getRWSaiAttr();
 
-    if (notprocessed || matched)
+    switch (attr->getAttrMetadata()->attrvaluetype)
     {
-        /*
-         * Since everything was processed, then move those object status to
-         * FINAL.
-         */
+        case SAI_ATTR_VALUE_TYPE_OBJECT_ID:
+            count = 1;
+            objectIdList = &at.value.oid;
+            break;
 
-        temporaryObj->setObjectStatus(SAI_OBJECT_STATUS_FINAL);
-        currentBestMatch->setObjectStatus(SAI_OBJECT_STATUS_FINAL);
+        case SAI_ATTR_VALUE_TYPE_OBJECT_LIST:
+            count = at.value.objlist.count;
+            objectIdList = at.value.objlist.list;
+            break;
 
-        if (temporaryObj->isOidObject())
-        {
-            /*
-             * When objects are object id type, we need to update map in
-             * temporary view for correct VID/RID.
-             *
-             * In here RID should always exists, since when objects are MATCHED
-             * then RID exists and both VID's are the same, and when both
-             * objects are not processed, then RID also exists since current
-             * object was selected as current best match. Other options are
-             * object was removed, but the it could not be selected, or object
-             * was created, but then is in FINAL state so also could not be
-             * selected here.
-             */
+        case SAI_ATTR_VALUE_TYPE_ACL_FIELD_DATA_OBJECT_ID:
 
-            sai_object_id_t tvid = temporaryObj->getVid();
-            sai_object_id_t cvid = currentBestMatch->getVid();
-            sai_object_id_t rid = currentView.vidToRid.at(cvid);
+            if (at.value.aclfield.enable)
+            {
+                count = 1;
+                objectIdList = &at.value.aclfield.data.oid;
+            }
 
-            SWSS_LOG_INFO("remapped current VID %s to temp VID %s using RID %s",
-                    sai_serialize_object_id(cvid).c_str(),
-                    sai_serialize_object_id(tvid).c_str(),
-                    sai_serialize_object_id(rid).c_str());
+            break;
 
-            temporaryView.ridToVid[rid] = tvid;
-            temporaryView.vidToRid[tvid] = rid;
+        case SAI_ATTR_VALUE_TYPE_ACL_FIELD_DATA_OBJECT_LIST:
 
-            /*
-             * TODO: Set new VID if it doesn't exist in current view with NULL RID
-             * that will mean we created new object, this VID will be later
-             * used to count references and as a sanity check if we are
-             * increasing valid reference.
-             *
-             * Revisit. We have create flag now.
-             */
-        }
-        else
-        {
-            /*
-             * For non object id we will create map by object type and map
-             * current to temporary and vice versa. For some objects like TRAP
-             * or VLAN values will be the same but for ROUTES or NEIGHBORS can
-             * be different since they contain VID which in temporary view can
-             * be different and because of that we will need a map.
-             */
+            if (at.value.aclfield.enable)
+            {
+                count = at.value.aclfield.data.objlist.count;
+                objectIdList = at.value.aclfield.data.objlist.list;
+            }
 
-            sai_object_type_t objectType = temporaryObj->getObjectType();
+            break;
 
-            SWSS_LOG_INFO("remapped %s current %s to temp %s",
-                    sai_serialize_object_type(temporaryObj->getObjectType()).c_str(),
-                    currentBestMatch->str_object_id.c_str(),
-                    temporaryObj->str_object_id.c_str());
+        case SAI_ATTR_VALUE_TYPE_ACL_ACTION_DATA_OBJECT_ID:
 
-            temporaryView.nonObjectIdMap[objectType][temporaryObj->str_object_id] = currentBestMatch->str_object_id;
-            currentView.nonObjectIdMap[objectType][currentBestMatch->str_object_id] = temporaryObj->str_object_id;
-        }
+            if (at.value.aclaction.enable)
+            {
+                count = 1;
+                objectIdList = &at.value.aclaction.parameter.oid;
+            }
+
+            break;
+
+        case SAI_ATTR_VALUE_TYPE_ACL_ACTION_DATA_OBJECT_LIST:
+
+            if (at.value.aclaction.enable)
+            {
+                count = at.value.aclaction.parameter.objlist.count;
+                objectIdList = at.value.aclaction.parameter.objlist.list;
+            }
+
+            break;
+
+        default:
+            break;
     }
-    else
+
+    for (uint32_t i = 0; i < count; ++i)
     {
+        sai_object_id_t tvid = objectIdList[i];
+
+        if (tvid == SAI_NULL_OBJECT_ID)
+        {
+            continue;
+        }
+
         /*
-         * This method should be used only for objects that have status MATCHED
-         * or NON_PROCESSED, other combinations are not supported since other
-         * actions will be either create new object from temporary object or
-         * remove existing current object.
+         * Do actual translation.
          */
 
-        SWSS_LOG_THROW("unexpected status combination: current %d, temporary %d",
-                currentBestMatch->getObjectStatus(),
-                temporaryObj->getObjectStatus());
+        objectIdList[i] =  translateTemporaryVidToCurrentVid(currentView, temporaryView, tvid);
     }
+
+    /*
+     * Since we probably performed updates on this attribute, since VID was
+     * exchanged, we need to update value string of that attribute.
+     */
+
+    attr->UpdateValue();
+
+    return attr;
 }
 
-std::shared_ptr<SaiAttr> getSaiAttrFromDefaultValue(
-        _In_ const AsicView &currentView,
-        _In_ const sai_attr_metadata_t &meta)
+/**
+ * @brief Set attribute on current object
+ *
+ * This function will set given attribute to current object adding new
+ * attribute or replacing existing one. Given attribute can be either one
+ * temporary attribute missing or different from current object object or
+ * default attribute value if we need to bring some attribute to default value.
+ *
+ * @param currentView Current view.
+ * @param temporaryView Temporary view.
+ * @param currentObj Current object on which we set attribute.
+ * @param inattr Attribute to be set on current object.
+ */
+void setAttributeOnCurrentObject(
+        _In_ AsicView &currentView,
+        _In_ const AsicView &temporaryView,
+        _In_ const std::shared_ptr<SaiObj> &currentObj,
+        _In_ const std::shared_ptr<SaiAttr> &inattr)
 {
     SWSS_LOG_ENTER();
 
     /*
-     * Worth notice, that this is only helper, since metadata on attributes
-     * tell default value for example for oid object as SAI_NULL_OBJECT_ID but
-     * maybe on the switch vendor actually assigned some value, so default
-     * value will not be NULL after creation.
-     *
-     * We can check that by using SAI discovery.
-     *
-     * TODO Default value also must depend on dependency tree !
-     * This will be tricky, we need to revisit that !
+     * At the beginning just small assert to check if object is create and set.
      */
 
-    if (meta.objecttype == SAI_OBJECT_TYPE_SWITCH &&
-            meta.attrid == SAI_SWITCH_ATTR_SRC_MAC_ADDRESS)
-    {
-        /*
-         * Same will apply for default values which are pointing to
-         * different attributes.
-         *
-         * Default value is stored in SaiSwitch class.
-         */
-
-        // XXX we have only 1 switch, so we can get away with this
+    const auto meta = inattr->getAttrMetadata();
 
-        auto sw = switches.begin()->second;
+    if (!SAI_HAS_FLAG_CREATE_AND_SET(meta->flags))
+    {
+        SWSS_LOG_THROW("can't set attribute %s on current object %s:%s since it's not CREATE_AND_SET",
+                meta->attridname,
+                currentObj->str_object_type.c_str(),
+                currentObj->str_object_id.c_str());
+    }
 
-        sai_attribute_t attr;
+    /*
+     * NOTE: Since attribute we SET can be OID attribute, and that can be a VID
+     * or list of VIDs from temporary view. So after this "set" operation we
+     * will end up with MIXED VIDs on current view, some object will contain
+     * VIDs from temporary view, and this can lead to fail in
+     * translate_vid_to_rid since we will need to look inside two views to find
+     * right RID.
+     *
+     * We need a flag to say that VID is for object that was created
+     * and we can mix only those VID's for objects that was created.
+     *
+     * In here we need to translate attribute VIDs to current VIDs to keep
+     * track in dependency tree, since if we use temporary VID that will point
+     * to the same RID then we will lost track in dependency tree of that VID
+     * reference count.
+     *
+     * This should also done for object id's inside non object ids.
+     */
 
-        memset(&attr, 0, sizeof(sai_attribute_t));
+    std::shared_ptr<SaiAttr> attr = translateTemporaryVidsToCurrentVids(currentView, temporaryView, currentObj, inattr);
 
-        attr.id = meta.attrid;
+    currentView.asicSetAttribute(currentObj, attr);
+}
 
-        sw->getDefaultMacAddress(attr.value.mac);
+/**
+ * @brief Create new object from temporary object.
+ *
+ * Since best match was not found we need to create a brand new object and put
+ * it into current view as well.
+ *
+ * @param currentView Current view.
+ * @param temporaryView Temporary view.
+ * @param temporaryObj Temporary object to be cloned to current view.
+ */
+void createNewObjectFromTemporaryObject(
+        _In_ AsicView &currentView,
+        _In_ const AsicView &temporaryView,
+        _In_ const std::shared_ptr<SaiObj> &temporaryObj)
+{
+    SWSS_LOG_ENTER();
 
-        std::string str_attr_value = sai_serialize_attr_value(meta, attr, false);
+    SWSS_LOG_INFO("creating object %s:%s",
+                    temporaryObj->str_object_type.c_str(),
+                    temporaryObj->str_object_id.c_str());
 
-        SWSS_LOG_NOTICE("bringing default %s", meta.attridname);
+    /*
+     * This trap can be default trap group, so let's check if it's, then we
+     * can't create it, we need to set new attributes if that possible. But
+     * this case should not happen since on syncd start we are putting default
+     * trap group to asic view, so if user will query default one, they will be
+     * matched by RID.
+     *
+     * Default trap group is transferred to view on init if it doesn't exist.
+     *
+     * There should be no such action here, since this scenario would mean that
+     * there is default switch object in temporary view, but not in current
+     * view. All default objects are put to ASIC state table when switch is
+     * created. So what can happen is opposite scenario.
+     */
 
-        return std::make_shared<SaiAttr>(meta.attridname, str_attr_value);
-    }
+    /*
+     * NOTE: Since attributes we pass to create can be OID attributes, and that
+     * can be a VID or list of VIDs from temporary view. So after this create
+     * operation we will end up with MIXED VIDs on current view, some object
+     * will contain VIDs from temporary view, and this can lead to fail in
+     * translate_vid_to_rid since we will need to look inside two views to find
+     * right RID.
+     *
+     * We need a flag to say that VID is for object that was created and we can
+     * mix only those VID's for objects that was created.
+     *
+     * In here we need to translate attribute VIDs to current VIDs to keep
+     * track in dependency tree, since if we use temporary VID that will point
+     * to the same RID then we will lost track in dependency tree of that VID
+     * reference count.
+     *
+     * This should also be done for object id's inside non object ids.
+     */
 
     /*
-     * Move this method to asicview class.
+     * We need to loop through all attributes and create copy of this object
+     * and translate all attributes for getting correct VIDs like in set
+     * operation, we can't use VID's from temporary view to not mix them with
+     * current view, except created object ID's, since we won't be creating any
+     * new VID on the way (but we could) maybe we can do that later - but for
+     * that we will need some kind of RID which would later need to be removed.
      */
 
-    switch (meta.defaultvaluetype)
-    {
-        case SAI_DEFAULT_VALUE_TYPE_EMPTY_LIST:
-
-            {
-                /*
-                 * For empty list we can use trick here, just set attr to all
-                 * zeros, then all count's will be zeros and all lists pointers
-                 * will be NULL.
-                 *
-                 * TODO: If this is executed on existing attribute then we need
-                 * Dependency tree since initially that list may not be empty!
-                 */
-
-                sai_attribute_t attr;
-
-                memset(&attr, 0, sizeof(sai_attribute_t));
-
-                attr.id = meta.attrid;
-
-                std::string str_attr_value = sai_serialize_attr_value(meta, attr, false);
+    std::shared_ptr<SaiObj> currentObj = std::make_shared<SaiObj>();
 
-                return std::make_shared<SaiAttr>(meta.attridname, str_attr_value);
-            }
+    /*
+     * TODO Find out better way to do this, copy operator ?
+     */
 
+    currentObj->str_object_type  = temporaryObj->str_object_type;
+    currentObj->str_object_id    = temporaryObj->str_object_id;      // temporary VID / non object id
+    currentObj->meta_key         = temporaryObj->meta_key;           // temporary VID / non object id
+    currentObj->info             = temporaryObj->info;
 
-        case SAI_DEFAULT_VALUE_TYPE_CONST:
+    if (!temporaryObj->isOidObject())
+    {
+        /*
+         * Since object contains OID inside struct, this OID may already exist
+         * in current view, so we need to do translation here.
+         */
 
-            /*
-             * Only primitives can be supported on CONST.
-             */
+        for (size_t j = 0; j < currentObj->info->structmemberscount; ++j)
+        {
+            const sai_struct_member_info_t *m = currentObj->info->structmembers[j];
 
-            switch (meta.attrvaluetype)
+            if (m->membervaluetype != SAI_ATTR_VALUE_TYPE_OBJECT_ID)
             {
-                case SAI_ATTR_VALUE_TYPE_BOOL:
-                case SAI_ATTR_VALUE_TYPE_UINT8:
-                case SAI_ATTR_VALUE_TYPE_INT8:
-                case SAI_ATTR_VALUE_TYPE_UINT16:
-                case SAI_ATTR_VALUE_TYPE_INT16:
-                case SAI_ATTR_VALUE_TYPE_UINT32:
-                case SAI_ATTR_VALUE_TYPE_INT32:
-                case SAI_ATTR_VALUE_TYPE_UINT64:
-                case SAI_ATTR_VALUE_TYPE_INT64:
-                case SAI_ATTR_VALUE_TYPE_POINTER:
-                case SAI_ATTR_VALUE_TYPE_OBJECT_ID:
-
-                    {
-                        sai_attribute_t attr;
-
-                        attr.id = meta.attrid;
-                        attr.value = *meta.defaultvalue;
-
-                        std::string str_attr_value = sai_serialize_attr_value(meta, attr, false);
+                continue;
+            }
 
-                        return std::make_shared<SaiAttr>(meta.attridname, str_attr_value);
-                    }
+            sai_object_id_t vid = m->getoid(&currentObj->meta_key);
 
-                default:
+            vid = translateTemporaryVidToCurrentVid(currentView, temporaryView, vid);
 
-                    SWSS_LOG_ERROR("serialization type %s is not supported yet, FIXME",
-                            sai_serialize_attr_value_type(meta.attrvaluetype).c_str());
-                    break;
-            }
+            m->setoid(&currentObj->meta_key, vid);
 
             /*
-             * NOTE: default for acl flags or action is disabled.
+             * Bind new vid reference is already done inside asicCreateObject.
              */
+        }
 
-            break;
+        /*
+         * Since it's possible that object id may had been changed, we need to
+         * update string as well.
+         */
 
-        case SAI_DEFAULT_VALUE_TYPE_ATTR_VALUE:
+        switch (temporaryObj->getObjectType())
+        {
+            case SAI_OBJECT_TYPE_ROUTE_ENTRY:
 
-            /*
-             * TODO normally we need check default object type and value but
-             * this is only available in metadata sai 1.0.
-             *
-             * We need to look at attrvalue in metadata and object type if it's switch.
-             * then get it from switch
-             *
-             * And all those values we should keep in double map object type
-             * and attribute id, and auto select from attr value.
-             */
+                currentObj->str_object_id = sai_serialize_route_entry(currentObj->meta_key.objectkey.key.route_entry);
+                break;
 
-            // TODO double check that, to make it generic (check attr value type is oid)
-            if (meta.objecttype == SAI_OBJECT_TYPE_HOSTIF_TRAP && meta.attrid == SAI_HOSTIF_TRAP_ATTR_TRAP_GROUP)
-            {
-                /*
-                 * Default trap group is set on traps by default, so to bring them to
-                 * default state we need to explicitly set this.
-                 */
+            case SAI_OBJECT_TYPE_NEIGHBOR_ENTRY:
 
-                SWSS_LOG_NOTICE("bring default trap group on %s", meta.attridname);
+                currentObj->str_object_id = sai_serialize_neighbor_entry(currentObj->meta_key.objectkey.key.neighbor_entry);
+                break;
 
-                const auto &tg = currentView.ridToVid.find(currentView.defaultTrapGroupRid);
+            case SAI_OBJECT_TYPE_FDB_ENTRY:
+                currentObj->str_object_id = sai_serialize_fdb_entry(currentObj->meta_key.objectkey.key.fdb_entry);
+                break;
 
-                if (tg == currentView.ridToVid.end())
-                {
-                    SWSS_LOG_THROW("default trap group RID 0x%" PRIx64 " doesn't exist in current view", currentView.defaultTrapGroupRid);
-                }
+            case SAI_OBJECT_TYPE_NAT_ENTRY:
+                currentObj->str_object_id = sai_serialize_nat_entry(currentObj->meta_key.objectkey.key.nat_entry);
+                break;
 
-                sai_attribute_t at;
+            default:
 
-                at.id = meta.attrid;
-                at.value.oid = tg->second; // default trap group VID
+                SWSS_LOG_THROW("unexpected non object id type: %s",
+                        sai_serialize_object_type(temporaryObj->getObjectType()).c_str());
+        }
+    }
 
-                std::string str_attr_value = sai_serialize_attr_value(meta, at, false);
+    /*
+     * CreateObject flag is set to true, so when we we will be looking to
+     * translate VID between temporary view and current view (since status will
+     * be FINAL) then we will know that there is no actual RID yet, and both
+     * VIDs are the same. So this is how we cam match both objects between
+     * views.
+     */
 
-                return std::make_shared<SaiAttr>(meta.attridname, str_attr_value);
-            }
+    currentObj->createdObject = true;
+    temporaryObj->createdObject = true;
 
-            SWSS_LOG_ERROR("default value type %d is not supported yet for %s, FIXME",
-                    meta.defaultvaluetype,
-                    meta.attridname);
+    for (const auto &pair: temporaryObj->getAllAttributes())
+    {
+        const auto &tmpattr = pair.second;
 
-            return nullptr;
+        std::shared_ptr<SaiAttr> attr = translateTemporaryVidsToCurrentVids(currentView, temporaryView, currentObj, tmpattr);
 
-        case SAI_DEFAULT_VALUE_TYPE_NONE:
+        if (attr->isObjectIdAttr())
+        {
+            /*
+             * This is new attribute so we don't need to release any new links.
+             * But we need to bind new links on current object.
+             */
 
+            currentObj->setAttr(attr);
+        }
+        else
+        {
             /*
-             * No default value present.
+             * This create attribute don't contain any OIDs so no extra
+             * operations are required, we don't need to break any references
+             * and decrease any reference count.
              */
 
-            return nullptr;
+            currentObj->setAttr(attr);
+        }
+    }
 
-        default:
+    /*
+     * Asic create object inserts new reference to track inside asic view.
+     */
 
-            SWSS_LOG_ERROR("default value type %d is not supported yet for %s, FIXME",
-                    meta.defaultvaluetype,
-                    meta.attridname);
+    currentView.asicCreateObject(currentObj);
 
-            return nullptr;
-    }
+    /*
+     * Move both object status to FINAL since both objects were processed
+     * successfully and object was created.
+     */
 
-    return nullptr;
+    currentObj->setObjectStatus(SAI_OBJECT_STATUS_FINAL);
+    temporaryObj->setObjectStatus(SAI_OBJECT_STATUS_FINAL);
 }
 
-bool performObjectSetTransition(
+void UpdateObjectStatus(
         _In_ AsicView &currentView,
         _In_ AsicView &temporaryView,
         _In_ const std::shared_ptr<SaiObj> &currentBestMatch,
-        _In_ const std::shared_ptr<const SaiObj> &temporaryObj,
-        _In_ bool performTransition)
+        _In_ const std::shared_ptr<SaiObj> &temporaryObj)
 {
     SWSS_LOG_ENTER();
 
-    /*
-     * All parents (if any) are in final state here, we could now search for
-     * best match in current view that some of the objects in temp final state
-     * could been created so they should exist in current view but without
-     * actual RID since all creation and RID mapping is done after all
-     * matching, so it may cause problems for finding RID for compare.
-     */
-
-    /*
-     * When we have best match we need to determine whether current object can
-     * be updated to "this temporary" object or whether current needs to be
-     * destroyed and recreated according to temporary.
-     */
-
-    std::set<sai_attr_id_t> processedAttributes;
-
-    /*
-     * Matched objects can have different attributes so we need to mark in
-     * processed attributes which one were processed so if current object has
-     * more attributes then we need to bring them back to default values if
-     * possible.
-     */
-
-    /*
-     * Depending on performTransition flag this method used in first pass will
-     * determine whether current object can be updated to temporary one.  If
-     * first pass was successful second pass when flag is set to true, actual
-     * SET operations will be generated and current view will be modified.  No
-     * actual ASIC operations will be performed, all ASIC changes will be done
-     * after all object will be moved to final state.
-     */
+    bool notprocessed = ((temporaryObj->getObjectStatus() == SAI_OBJECT_STATUS_NOT_PROCESSED) &&
+            (currentBestMatch->getObjectStatus() == SAI_OBJECT_STATUS_NOT_PROCESSED));
 
-    /*
-     * XXX If objects are matched (same vid/rid on object id) then this
-     * function must return true, just skip all create only attributes.
-     */
+    bool matched = ((temporaryObj->getObjectStatus() == SAI_OBJECT_STATUS_MATCHED) &&
+            (currentBestMatch->getObjectStatus() == SAI_OBJECT_STATUS_MATCHED));
 
-    for (auto &at: temporaryObj->getAllAttributes())
+    if (notprocessed || matched)
     {
-        auto &temporaryAttr = at.second;
-
-        SWSS_LOG_INFO("first pass (temp): attr %s", temporaryAttr->getStrAttrId().c_str());
-
-        const auto meta = temporaryAttr->getAttrMetadata();
-
-        const sai_attribute_t &attr = *temporaryAttr->getSaiAttr();
+        /*
+         * Since everything was processed, then move those object status to
+         * FINAL.
+         */
 
-        processedAttributes.insert(attr.id); // mark attr id as processed
+        temporaryObj->setObjectStatus(SAI_OBJECT_STATUS_FINAL);
+        currentBestMatch->setObjectStatus(SAI_OBJECT_STATUS_FINAL);
 
-        if (currentBestMatch->hasAttr(attr.id))
+        if (temporaryObj->isOidObject())
         {
             /*
-             * Same attribute exists on current and temp view, check if it's
-             * the same.  Previously we used hasEqualAttribute method to find
-             * best match but now we are looking for different attribute
-             * values.
-             */
-
-            auto currentAttr = currentBestMatch->getSaiAttr(attr.id);
-
-            SWSS_LOG_INFO("compare attr value curr %s vs temp %s",
-                     currentBestMatch->getSaiAttr(attr.id)->getStrAttrValue().c_str(),
-                     temporaryObj->getSaiAttr(attr.id)->getStrAttrValue().c_str());
-
+             * When objects are object id type, we need to update map in
+             * temporary view for correct VID/RID.
+             *
+             * In here RID should always exists, since when objects are MATCHED
+             * then RID exists and both VID's are the same, and when both
+             * objects are not processed, then RID also exists since current
+             * object was selected as current best match. Other options are
+             * object was removed, but the it could not be selected, or object
+             * was created, but then is in FINAL state so also could not be
+             * selected here.
+             */
 
+            sai_object_id_t tvid = temporaryObj->getVid();
+            sai_object_id_t cvid = currentBestMatch->getVid();
+            sai_object_id_t rid = currentView.vidToRid.at(cvid);
 
-            if (hasEqualAttribute(currentView, temporaryView, currentBestMatch, temporaryObj, attr.id))
-            {
-                /*
-                 * Attributes are equal so go for next attribute
-                 */
+            SWSS_LOG_INFO("remapped current VID %s to temp VID %s using RID %s",
+                    sai_serialize_object_id(cvid).c_str(),
+                    sai_serialize_object_id(tvid).c_str(),
+                    sai_serialize_object_id(rid).c_str());
 
-                continue;
-            }
+            temporaryView.ridToVid[rid] = tvid;
+            temporaryView.vidToRid[tvid] = rid;
 
             /*
-             * Now we know that attribute values are different.
+             * TODO: Set new VID if it doesn't exist in current view with NULL RID
+             * that will mean we created new object, this VID will be later
+             * used to count references and as a sanity check if we are
+             * increasing valid reference.
+             *
+             * Revisit. We have create flag now.
              */
-
+        }
+        else
+        {
             /*
-             * Here we don't need to check if attribute is mandatory on create
-             * or conditional since attribute is present on both objects. If
-             * attribute is CREATE_AND_SET that means we can update attribute
-             * value on current best match object.
+             * For non object id we will create map by object type and map
+             * current to temporary and vice versa. For some objects like TRAP
+             * or VLAN values will be the same but for ROUTES or NEIGHBORS can
+             * be different since they contain VID which in temporary view can
+             * be different and because of that we will need a map.
              */
 
-            if (SAI_HAS_FLAG_CREATE_AND_SET(meta->flags))
-            {
-                SWSS_LOG_DEBUG("Attr %s can be updated from %s to %s",
-                        meta->attridname,
-                        currentAttr->getStrAttrValue().c_str(),
-                        temporaryAttr->getStrAttrValue().c_str());
-
-                /*
-                 * Generate action and update current view in second pass
-                 * and continue for next attribute.
-                 */
-
-                if (performTransition)
-                {
-                    setAttributeOnCurrentObject(currentView, temporaryView, currentBestMatch, temporaryAttr);
-                }
-
-                continue;
-            }
-
-            /*
-             * In this place we know attribute is CREATE_ONLY and it's value is
-             * different on both objects. Object must be destroyed and new
-             * object must be created. In this case does not matter whether
-             * attribute is mandatory on create or conditional since attribute
-             * is present on both objects.
-             */
+            sai_object_type_t objectType = temporaryObj->getObjectType();
 
-            if (currentBestMatch->getObjectStatus() == SAI_OBJECT_STATUS_MATCHED)
-            {
-                /*
-                 * This should not happen, since this mean, that attribute is
-                 * create only, object is matched, and attribute value is
-                 * different! DB is broken?
-                 */
+            SWSS_LOG_INFO("remapped %s current %s to temp %s",
+                    sai_serialize_object_type(temporaryObj->getObjectType()).c_str(),
+                    currentBestMatch->str_object_id.c_str(),
+                    temporaryObj->str_object_id.c_str());
 
-                SWSS_LOG_THROW("Attr %s CAN'T be updated from %s to %s on VID %s when MATCHED and CREATE_ONLY, FATAL",
-                        meta->attridname,
-                        currentAttr->getStrAttrValue().c_str(),
-                        temporaryAttr->getStrAttrValue().c_str(),
-                        temporaryObj->str_object_id.c_str());
-            }
+            temporaryView.nonObjectIdMap[objectType][temporaryObj->str_object_id] = currentBestMatch->str_object_id;
+            currentView.nonObjectIdMap[objectType][currentBestMatch->str_object_id] = temporaryObj->str_object_id;
+        }
+    }
+    else
+    {
+        /*
+         * This method should be used only for objects that have status MATCHED
+         * or NON_PROCESSED, other combinations are not supported since other
+         * actions will be either create new object from temporary object or
+         * remove existing current object.
+         */
 
-            SWSS_LOG_WARN("Attr %s CAN'T be updated from %s to %s since it's CREATE_ONLY",
-                    meta->attridname,
-                    currentAttr->getStrAttrValue().c_str(),
-                    temporaryAttr->getStrAttrValue().c_str());
+        SWSS_LOG_THROW("unexpected status combination: current %d, temporary %d",
+                currentBestMatch->getObjectStatus(),
+                temporaryObj->getObjectStatus());
+    }
+}
 
-            /*
-             * We return false since object can't be updated.  Object creation
-             * is in different place when current best match is not found.
-             */
+std::shared_ptr<SaiAttr> getSaiAttrFromDefaultValue(
+        _In_ const AsicView &currentView,
+        _In_ const sai_attr_metadata_t &meta)
+{
+    SWSS_LOG_ENTER();
 
-            return false;
-        }
+    /*
+     * Worth notice, that this is only helper, since metadata on attributes
+     * tell default value for example for oid object as SAI_NULL_OBJECT_ID but
+     * maybe on the switch vendor actually assigned some value, so default
+     * value will not be NULL after creation.
+     *
+     * We can check that by using SAI discovery.
+     *
+     * TODO Default value also must depend on dependency tree !
+     * This will be tricky, we need to revisit that !
+     */
 
+    if (meta.objecttype == SAI_OBJECT_TYPE_SWITCH &&
+            meta.attrid == SAI_SWITCH_ATTR_SRC_MAC_ADDRESS)
+    {
         /*
-         * In this case attribute exists only on temporary object.  Because of
-         * different flags, and conditions this maybe not easy task to
-         * determine what should happen.
-         *
-         * Depends on attribute order processing, we may process mandatory on
-         * create conditional attribute first, before finding out that
-         * condition attribute is different, but if condition would be the same
-         * then this conditional attribute would be also present on current
-         * best match.
+         * Same will apply for default values which are pointing to
+         * different attributes.
          *
-         * There are also default values here that come into play.  We can
-         * expand this logic in the future.
+         * Default value is stored in SaiSwitch class.
          */
 
-        bool conditional = meta->isconditional;
+        // XXX we have only 1 switch, so we can get away with this
 
-        /*
-         * If attribute is CREATE_AND_SET and not conditional then it's
-         * safe to make SET operation.
-         *
-         * XXX previously we had (meta->flags == SAI_ATTR_FLAGS_CREATE_AND_SET)
-         * If it's not conditional current SAI_HAS_FLAG should not matter. But it
-         * can also be mandatory on create but this does not matter since if
-         * it's mandatory on create then current object already exists co we can
-         * still perform update on this attribute because it was passed during
-         * creation.
-         */
+        auto sw = switches.begin()->second;
 
-        if (SAI_HAS_FLAG_CREATE_AND_SET(meta->flags) && !conditional)
-        {
-            SWSS_LOG_INFO("Missing current attr %s can be set to %s",
-                    meta->attridname,
-                    temporaryAttr->getStrAttrValue().c_str());
+        sai_attribute_t attr;
 
-            /*
-             * There is another case here, if this attribute exists only in
-             * temporary view and it has default value, and SET value is the
-             * same as default, then there is no need for ASIC operation.
-             *
-             * NOTE: This can lead to not put attributes with default VALUE to
-             * redis database and could be confusing when debugging.
-             */
+        memset(&attr, 0, sizeof(sai_attribute_t));
 
-            const auto defaultValueAttr = getSaiAttrFromDefaultValue(currentView, *meta);
+        attr.id = meta.attrid;
 
-            if (defaultValueAttr != nullptr)
-            {
-                std::string defStr = sai_serialize_attr_value(*meta, *defaultValueAttr->getSaiAttr());
+        sw->getDefaultMacAddress(attr.value.mac);
 
-                if (defStr == temporaryAttr->getStrAttrValue())
-                {
-                    SWSS_LOG_NOTICE("explicit %s:%s is the same as default, no need for ASIC SET action",
-                            meta->attridname, defStr.c_str());
+        std::string str_attr_value = sai_serialize_attr_value(meta, attr, false);
 
-                    continue;
-                }
-            }
+        SWSS_LOG_NOTICE("bringing default %s", meta.attridname);
 
-            /*
-             * Generate action and update current view in second pass
-             * and continue for next attribute.
-             */
+        return std::make_shared<SaiAttr>(meta.attridname, str_attr_value);
+    }
 
-            if (performTransition)
-            {
-                setAttributeOnCurrentObject(currentView, temporaryView, currentBestMatch, temporaryAttr);
-            }
+    /*
+     * Move this method to asicview class.
+     */
 
-            continue;
-        }
+    switch (meta.defaultvaluetype)
+    {
+        case SAI_DEFAULT_VALUE_TYPE_EMPTY_LIST:
 
-        if (currentBestMatch->getObjectStatus() == SAI_OBJECT_STATUS_MATCHED)
-        {
-            if (SAI_HAS_FLAG_CREATE_ONLY(meta->flags))
             {
                 /*
-                 * Attribute is create only attribute on matched object. This
-                 * can happen when we are have create only attributes in asic
-                 * view, those attributes were put by snoop logic. Since we
-                 * skipping only read-only attributes then we snoop create-only
-                 * also, but on "existing" objects this will cause problem and
-                 * during apply logic we need to skip this attribute since we
-                 * won't be able to SET it anyway on matched object, and value
-                 * is the same as current object.
+                 * For empty list we can use trick here, just set attr to all
+                 * zeros, then all count's will be zeros and all lists pointers
+                 * will be NULL.
+                 *
+                 * TODO: If this is executed on existing attribute then we need
+                 * Dependency tree since initially that list may not be empty!
                  */
 
-                SWSS_LOG_INFO("Skipping create only attr on matched object: %s:%s",
-                        meta->attridname,
-                        temporaryAttr->getStrAttrValue().c_str());
+                sai_attribute_t attr;
 
-                continue;
-            }
-        }
+                memset(&attr, 0, sizeof(sai_attribute_t));
 
-        /*
-         * This is the most interesting case, we currently leave it here and we
-         * will support it later. Some other cases here also can be considered
-         * as success, for example if default value is the same as current
-         * value.
-         */
+                attr.id = meta.attrid;
 
-        SWSS_LOG_WARN("Missing current attr %s (conditional: %d) CAN'T be set to %s, flags: 0x%x, FIXME",
-                meta->attridname,
-                conditional,
-                temporaryAttr->getStrAttrValue().c_str(),
-                meta->flags);
+                std::string str_attr_value = sai_serialize_attr_value(meta, attr, false);
 
-        /*
-         * We can't continue with update in that case, so return false.
-         */
+                return std::make_shared<SaiAttr>(meta.attridname, str_attr_value);
+            }
 
-        return false;
-    }
 
-    /*
-     * Current best match can have more attributes than temporary object.
-     * let see if we can bring them to default value if possible.
-     */
+        case SAI_DEFAULT_VALUE_TYPE_CONST:
 
-    for (auto &ac: currentBestMatch->getAllAttributes())
-    {
-        auto &currentAttr = ac.second;
+            /*
+             * Only primitives can be supported on CONST.
+             */
 
-        const auto &meta = currentAttr->getAttrMetadata();
+            switch (meta.attrvaluetype)
+            {
+                case SAI_ATTR_VALUE_TYPE_BOOL:
+                case SAI_ATTR_VALUE_TYPE_UINT8:
+                case SAI_ATTR_VALUE_TYPE_INT8:
+                case SAI_ATTR_VALUE_TYPE_UINT16:
+                case SAI_ATTR_VALUE_TYPE_INT16:
+                case SAI_ATTR_VALUE_TYPE_UINT32:
+                case SAI_ATTR_VALUE_TYPE_INT32:
+                case SAI_ATTR_VALUE_TYPE_UINT64:
+                case SAI_ATTR_VALUE_TYPE_INT64:
+                case SAI_ATTR_VALUE_TYPE_POINTER:
+                case SAI_ATTR_VALUE_TYPE_OBJECT_ID:
 
-        const sai_attribute_t &attr = *currentAttr->getSaiAttr();
+                    {
+                        sai_attribute_t attr;
 
-        if (processedAttributes.find(attr.id) != processedAttributes.end())
-        {
-            /*
-             * This attribute was processed in previous temporary attributes processing so skip it here.
-             */
+                        attr.id = meta.attrid;
+                        attr.value = *meta.defaultvalue;
 
-            continue;
-        }
+                        std::string str_attr_value = sai_serialize_attr_value(meta, attr, false);
 
-        SWSS_LOG_INFO("first pass (curr): attr %s", currentAttr->getStrAttrId().c_str());
+                        return std::make_shared<SaiAttr>(meta.attridname, str_attr_value);
+                    }
 
-        /*
-         * Check if we are bringing one of the default created objects to
-         * default value, since for that we will need dependency TREE.  Most of
-         * the time user should just query configuration and just set new
-         * values based on get results, so this will not be needed.
-         *
-         * And even if we will have dependency tree, those values may not be
-         * synced because of remove etc, so we will need to check if default
-         * values actually exists.
-         */
+                default:
 
-        if (currentBestMatch->isOidObject())
-        {
-            sai_object_id_t vid = currentBestMatch->getVid();
+                    SWSS_LOG_ERROR("serialization type %s is not supported yet, FIXME",
+                            sai_serialize_attr_value_type(meta.attrvaluetype).c_str());
+                    break;
+            }
 
             /*
-             * Current best match may be created, check if vid/rid exist.
+             * NOTE: default for acl flags or action is disabled.
              */
 
-            if (currentView.hasVid(vid))
+            break;
+
+        case SAI_DEFAULT_VALUE_TYPE_ATTR_VALUE:
+
+            /*
+             * TODO normally we need check default object type and value but
+             * this is only available in metadata sai 1.0.
+             *
+             * We need to look at attrvalue in metadata and object type if it's switch.
+             * then get it from switch
+             *
+             * And all those values we should keep in double map object type
+             * and attribute id, and auto select from attr value.
+             */
+
+            // TODO double check that, to make it generic (check attr value type is oid)
+            if (meta.objecttype == SAI_OBJECT_TYPE_HOSTIF_TRAP && meta.attrid == SAI_HOSTIF_TRAP_ATTR_TRAP_GROUP)
             {
-                sai_object_id_t rid = currentView.vidToRid.at(vid);
+                /*
+                 * Default trap group is set on traps by default, so to bring them to
+                 * default state we need to explicitly set this.
+                 */
 
-                // XXX we have only 1 switch, so we can get away with this
+                SWSS_LOG_NOTICE("bring default trap group on %s", meta.attridname);
 
-                auto sw = switches.begin()->second;
+                const auto &tg = currentView.ridToVid.find(currentView.defaultTrapGroupRid);
 
-                if (sw->isDiscoveredRid(rid))
+                if (tg == currentView.ridToVid.end())
                 {
-                    SWSS_LOG_INFO("performing default on existing object VID %s: %s: %s, we need default dependency TREE, FIXME",
-                            sai_serialize_object_id(vid).c_str(),
-                            meta->attridname,
-                            currentAttr->getStrAttrValue().c_str());
+                    SWSS_LOG_THROW("default trap group RID 0x%" PRIx64 " doesn't exist in current view", currentView.defaultTrapGroupRid);
                 }
-            }
-        }
 
-        /*
-         * We should not have MANDATORY_ON_CREATE attributes here since all
-         * mandatory on create (even conditional) should be present in in
-         * previous loop and they are matching, so we should get here
-         * CREATE_ONLY or CREATE_AND_SET attributes only. So we should not get
-         * conditional attributes here also, but lets take extra care about that
-         * just as sanity check.
-         */
+                sai_attribute_t at;
 
-        bool conditional = meta->isconditional;
+                at.id = meta.attrid;
+                at.value.oid = tg->second; // default trap group VID
 
-        if (conditional || SAI_HAS_FLAG_MANDATORY_ON_CREATE(meta->flags))
-        {
-            if (currentBestMatch->getObjectStatus() == SAI_OBJECT_STATUS_MATCHED &&
-                    SAI_HAS_FLAG_CREATE_AND_SET(meta->flags))
-            {
-                if (meta->objecttype == SAI_OBJECT_TYPE_PORT &&
-                        meta->attrid == SAI_PORT_ATTR_SPEED)
-                {
-                    /*
-                     * NOTE: for SPEED we could query each port at start and
-                     * save it's speed to recover here, or even we could query
-                     * each attribute on existing object during discovery
-                     * process.
-                     */
+                std::string str_attr_value = sai_serialize_attr_value(meta, at, false);
 
-                    SWSS_LOG_WARN("No previous value specified on %s (VID), can't bring to default, leaving attr unchanged: %s:%s",
-                            sai_serialize_object_id(currentBestMatch->getVid()).c_str(),
-                            meta->attridname,
-                            currentAttr->getStrAttrValue().c_str());
+                return std::make_shared<SaiAttr>(meta.attridname, str_attr_value);
+            }
 
-                    continue;
-                }
+            SWSS_LOG_ERROR("default value type %d is not supported yet for %s, FIXME",
+                    meta.defaultvaluetype,
+                    meta.attridname);
 
-                if (meta->objecttype == SAI_OBJECT_TYPE_SCHEDULER_GROUP &&
-                        meta->attrid == SAI_SCHEDULER_GROUP_ATTR_SCHEDULER_PROFILE_ID)
-                {
-                    /*
-                     * This attribute can hold reference to user created
-                     * objects which maybe required to be destroyed, that's why
-                     * we need to bring real value. What if real value were
-                     * removed?
-                     */
+            return nullptr;
 
-                    sai_object_id_t def = SAI_NULL_OBJECT_ID;
+        case SAI_DEFAULT_VALUE_TYPE_NONE:
 
-                    auto sw = switches.begin()->second;
+            /*
+             * No default value present.
+             */
 
-                    sai_object_id_t vid = currentBestMatch->getVid();
+            return nullptr;
 
-                    if (currentView.hasVid(vid))
-                    {
-                        // scheduler_group RID
-                        sai_object_id_t rid = currentView.vidToRid.at(vid);
+        default:
 
-                        rid = sw->getDefaultValueForOidAttr(rid, SAI_SCHEDULER_GROUP_ATTR_SCHEDULER_PROFILE_ID);
+            SWSS_LOG_ERROR("default value type %d is not supported yet for %s, FIXME",
+                    meta.defaultvaluetype,
+                    meta.attridname);
 
-                        if (rid != SAI_NULL_OBJECT_ID && currentView.hasRid(rid))
-                        {
-                            /*
-                             * We found default value
-                             */
+            return nullptr;
+    }
 
-                            SWSS_LOG_DEBUG("found default rid %s, vid %s for %s",
-                                    sai_serialize_object_id(rid).c_str(),
-                                    sai_serialize_object_id(vid).c_str(),
-                                    meta->attridname);
+    return nullptr;
+}
 
-                            def = currentView.ridToVid.at(rid);
-                        }
-                    }
+bool performObjectSetTransition(
+        _In_ AsicView &currentView,
+        _In_ AsicView &temporaryView,
+        _In_ const std::shared_ptr<SaiObj> &currentBestMatch,
+        _In_ const std::shared_ptr<const SaiObj> &temporaryObj,
+        _In_ bool performTransition)
+{
+    SWSS_LOG_ENTER();
 
-                    sai_attribute_t defattr;
+    /*
+     * All parents (if any) are in final state here, we could now search for
+     * best match in current view that some of the objects in temp final state
+     * could been created so they should exist in current view but without
+     * actual RID since all creation and RID mapping is done after all
+     * matching, so it may cause problems for finding RID for compare.
+     */
 
-                    defattr.id = meta->attrid;
-                    defattr.value.oid = def;
+    /*
+     * When we have best match we need to determine whether current object can
+     * be updated to "this temporary" object or whether current needs to be
+     * destroyed and recreated according to temporary.
+     */
 
-                    std::string str_attr_value = sai_serialize_attr_value(*meta, defattr, false);
+    std::set<sai_attr_id_t> processedAttributes;
 
-                    auto defaultValueAttr = std::make_shared<SaiAttr>(meta->attridname, str_attr_value);
+    /*
+     * Matched objects can have different attributes so we need to mark in
+     * processed attributes which one were processed so if current object has
+     * more attributes then we need to bring them back to default values if
+     * possible.
+     */
 
-                    if (performTransition)
-                    {
-                        setAttributeOnCurrentObject(currentView, temporaryView, currentBestMatch, defaultValueAttr);
-                    }
+    /*
+     * Depending on performTransition flag this method used in first pass will
+     * determine whether current object can be updated to temporary one.  If
+     * first pass was successful second pass when flag is set to true, actual
+     * SET operations will be generated and current view will be modified.  No
+     * actual ASIC operations will be performed, all ASIC changes will be done
+     * after all object will be moved to final state.
+     */
 
-                    continue;
-                }
+    /*
+     * XXX If objects are matched (same vid/rid on object id) then this
+     * function must return true, just skip all create only attributes.
+     */
 
-               // SAI_QUEUE_ATTR_PARENT_SCHEDULER_NODE
-               // SAI_SCHEDULER_GROUP_ATTR_SCHEDULER_PROFILE_ID*
-               // SAI_SCHEDULER_GROUP_ATTR_PARENT_NODE
-               // SAI_BRIDGE_PORT_ATTR_BRIDGE_ID
-               //
-               // TODO matched by ID (MATCHED state) should always be updatable
-               // except those 4 above (at least for those above since they can have
-               // default value present after switch creation
+    for (auto &at: temporaryObj->getAllAttributes())
+    {
+        auto &temporaryAttr = at.second;
 
-                // TODO SAI_SCHEDULER_GROUP_ATTR_SCHEDULER_PROFILE_ID is mandatory on create but also SET
-                // if attribute is set we and object is in MATCHED state then that means we are able to
-                // bring this attribute to default state not for all attributes!
-                // *SAI_SCHEDULER_GROUP_ATTR_SCHEDULER_PROFILE_ID - is not any more mandatory on create, so default should be NULL
+        SWSS_LOG_INFO("first pass (temp): attr %s", temporaryAttr->getStrAttrId().c_str());
 
-                SWSS_LOG_ERROR("current attribute is mandatory on create, crate and set, and object MATCHED, FIXME %s %s:%s",
-                        currentBestMatch->str_object_id.c_str(),
-                        meta->attridname,
-                        currentAttr->getStrAttrValue().c_str());
+        const auto meta = temporaryAttr->getAttrMetadata();
 
-                return false;
+        const sai_attribute_t &attr = *temporaryAttr->getSaiAttr();
+
+        processedAttributes.insert(attr.id); // mark attr id as processed
+
+        if (currentBestMatch->hasAttr(attr.id))
+        {
+            /*
+             * Same attribute exists on current and temp view, check if it's
+             * the same.  Previously we used hasEqualAttribute method to find
+             * best match but now we are looking for different attribute
+             * values.
+             */
+
+            auto currentAttr = currentBestMatch->getSaiAttr(attr.id);
+
+            SWSS_LOG_INFO("compare attr value curr %s vs temp %s",
+                     currentBestMatch->getSaiAttr(attr.id)->getStrAttrValue().c_str(),
+                     temporaryObj->getSaiAttr(attr.id)->getStrAttrValue().c_str());
+
+
+
+            if (hasEqualAttribute(currentView, temporaryView, currentBestMatch, temporaryObj, attr.id))
+            {
+                /*
+                 * Attributes are equal so go for next attribute
+                 */
+
+                continue;
             }
 
-            if (currentBestMatch->getObjectStatus() == SAI_OBJECT_STATUS_MATCHED)
+            /*
+             * Now we know that attribute values are different.
+             */
+
+            /*
+             * Here we don't need to check if attribute is mandatory on create
+             * or conditional since attribute is present on both objects. If
+             * attribute is CREATE_AND_SET that means we can update attribute
+             * value on current best match object.
+             */
+
+            if (SAI_HAS_FLAG_CREATE_AND_SET(meta->flags))
             {
-                if (SAI_HAS_FLAG_CREATE_ONLY(meta->flags))
-                {
-                    /*
-                     * Attribute is create only attribute on matched object. This
-                     * can happen when we are have create only attributes in asic
-                     * view, those attributes were put by snoop logic. Since we
-                     * skipping only read-only attributes then we snoop create-only
-                     * also, but on "existing" objects this will cause problem and
-                     * during apply logic we need to skip this attribute since we
-                     * won't be able to SET it anyway on matched object, and value
-                     * is the same as current object.
-                     */
+                SWSS_LOG_DEBUG("Attr %s can be updated from %s to %s",
+                        meta->attridname,
+                        currentAttr->getStrAttrValue().c_str(),
+                        temporaryAttr->getStrAttrValue().c_str());
 
-                    SWSS_LOG_INFO("Skipping create only attr on matched object: %s:%s",
-                            meta->attridname,
-                            currentAttr->getStrAttrValue().c_str());
+                /*
+                 * Generate action and update current view in second pass
+                 * and continue for next attribute.
+                 */
 
-                    continue;
+                if (performTransition)
+                {
+                    setAttributeOnCurrentObject(currentView, temporaryView, currentBestMatch, temporaryAttr);
                 }
+
+                continue;
             }
 
-            SWSS_LOG_ERROR("Present current attr %s:%s is conditional or MANDATORY_ON_CREATE, we don't expect this here, FIXME",
+            /*
+             * In this place we know attribute is CREATE_ONLY and it's value is
+             * different on both objects. Object must be destroyed and new
+             * object must be created. In this case does not matter whether
+             * attribute is mandatory on create or conditional since attribute
+             * is present on both objects.
+             */
+
+            if (currentBestMatch->getObjectStatus() == SAI_OBJECT_STATUS_MATCHED)
+            {
+                /*
+                 * This should not happen, since this mean, that attribute is
+                 * create only, object is matched, and attribute value is
+                 * different! DB is broken?
+                 */
+
+                SWSS_LOG_THROW("Attr %s CAN'T be updated from %s to %s on VID %s when MATCHED and CREATE_ONLY, FATAL",
+                        meta->attridname,
+                        currentAttr->getStrAttrValue().c_str(),
+                        temporaryAttr->getStrAttrValue().c_str(),
+                        temporaryObj->str_object_id.c_str());
+            }
+
+            SWSS_LOG_WARN("Attr %s CAN'T be updated from %s to %s since it's CREATE_ONLY",
                     meta->attridname,
-                    currentAttr->getStrAttrValue().c_str());
+                    currentAttr->getStrAttrValue().c_str(),
+                    temporaryAttr->getStrAttrValue().c_str());
 
             /*
-             * We don't expect conditional or mandatory on create attributes,
-             * since in previous loop all attributes were matching they also
-             * had to match.  If we hit this case we need to take a closer look
-             * since it will mean we have a bug somewhere.
+             * We return false since object can't be updated.  Object creation
+             * is in different place when current best match is not found.
              */
 
             return false;
         }
 
         /*
-         * If attribute is CREATE_AND_SET or CREATE_ONLY, they may have a
-         * default value, for create and set we maybe able to set it and for
-         * create only we just need to make sure its expected value, if not
-         * then it can't be updated and we need to return false.
+         * In this case attribute exists only on temporary object.  Because of
+         * different flags, and conditions this maybe not easy task to
+         * determine what should happen.
          *
-         * TODO Currently we will support limited default value types.
+         * Depends on attribute order processing, we may process mandatory on
+         * create conditional attribute first, before finding out that
+         * condition attribute is different, but if condition would be the same
+         * then this conditional attribute would be also present on current
+         * best match.
          *
-         * Later this comparison of default value we need to extract to
-         * separate functions. Maybe create SaiAttr from default value or
-         * nullptr if it's not supported yet.
+         * There are also default values here that come into play.  We can
+         * expand this logic in the future.
          */
 
-        if (meta->flags == SAI_ATTR_FLAGS_CREATE_AND_SET || meta->flags == SAI_ATTR_FLAGS_CREATE_ONLY)
-        {
-            // TODO default value for existing objects needs dependency tree
+        bool conditional = meta->isconditional;
 
-            const auto defaultValueAttr = getSaiAttrFromDefaultValue(currentView, *meta);
+        /*
+         * If attribute is CREATE_AND_SET and not conditional then it's
+         * safe to make SET operation.
+         *
+         * XXX previously we had (meta->flags == SAI_ATTR_FLAGS_CREATE_AND_SET)
+         * If it's not conditional current SAI_HAS_FLAG should not matter. But it
+         * can also be mandatory on create but this does not matter since if
+         * it's mandatory on create then current object already exists co we can
+         * still perform update on this attribute because it was passed during
+         * creation.
+         */
 
-            if (defaultValueAttr == nullptr)
-            {
-                SWSS_LOG_WARN("Can't get default value for present current attr %s:%s, FIXME",
-                        meta->attridname,
-                        currentAttr->getStrAttrValue().c_str());
+        if (SAI_HAS_FLAG_CREATE_AND_SET(meta->flags) && !conditional)
+        {
+            SWSS_LOG_INFO("Missing current attr %s can be set to %s",
+                    meta->attridname,
+                    temporaryAttr->getStrAttrValue().c_str());
 
-                /*
-                 * If we can't get default value then we can't do set, because
-                 * we don't know with what, so we need to destroy current
-                 * object and recreate new one from temporary.
-                 */
+            /*
+             * There is another case here, if this attribute exists only in
+             * temporary view and it has default value, and SET value is the
+             * same as default, then there is no need for ASIC operation.
+             *
+             * NOTE: This can lead to not put attributes with default VALUE to
+             * redis database and could be confusing when debugging.
+             */
 
-                return false;
-            }
+            const auto defaultValueAttr = getSaiAttrFromDefaultValue(currentView, *meta);
 
-            if (currentAttr->getStrAttrValue() == defaultValueAttr->getStrAttrValue())
+            if (defaultValueAttr != nullptr)
             {
-                SWSS_LOG_INFO("Present current attr %s value %s is the same as default value, no action needed",
-                    meta->attridname,
-                    currentAttr->getStrAttrValue().c_str());
-
-                continue;
-            }
+                std::string defStr = sai_serialize_attr_value(*meta, *defaultValueAttr->getSaiAttr());
 
-            if (meta->flags == SAI_ATTR_FLAGS_CREATE_ONLY)
-            {
-                SWSS_LOG_WARN("Present current attr %s:%s has default that CAN'T be set to %s since it's CREATE_ONLY",
-                        meta->attridname,
-                        currentAttr->getStrAttrValue().c_str(),
-                        defaultValueAttr->getStrAttrValue().c_str());
+                if (defStr == temporaryAttr->getStrAttrValue())
+                {
+                    SWSS_LOG_NOTICE("explicit %s:%s is the same as default, no need for ASIC SET action",
+                            meta->attridname, defStr.c_str());
 
-                return false;
+                    continue;
+                }
             }
 
-            SWSS_LOG_INFO("Present current attr %s:%s has default that can be set to %s",
-                    meta->attridname,
-                    currentAttr->getStrAttrValue().c_str(),
-                    defaultValueAttr->getStrAttrValue().c_str());
-
             /*
              * Generate action and update current view in second pass
              * and continue for next attribute.
@@ -6521,34 +7343,357 @@ bool performObjectSetTransition(
 
             if (performTransition)
             {
-                setAttributeOnCurrentObject(currentView, temporaryView, currentBestMatch, defaultValueAttr);
+                setAttributeOnCurrentObject(currentView, temporaryView, currentBestMatch, temporaryAttr);
             }
 
             continue;
         }
 
-        SWSS_LOG_THROW("we should not get here, we have a bug, current present attribute %s:%s has some wrong flags 0x%x",
-                    meta->attridname,
-                    currentAttr->getStrAttrValue().c_str(),
-                    meta->flags);
+        if (currentBestMatch->getObjectStatus() == SAI_OBJECT_STATUS_MATCHED)
+        {
+            if (SAI_HAS_FLAG_CREATE_ONLY(meta->flags))
+            {
+                /*
+                 * Attribute is create only attribute on matched object. This
+                 * can happen when we are have create only attributes in asic
+                 * view, those attributes were put by snoop logic. Since we
+                 * skipping only read-only attributes then we snoop create-only
+                 * also, but on "existing" objects this will cause problem and
+                 * during apply logic we need to skip this attribute since we
+                 * won't be able to SET it anyway on matched object, and value
+                 * is the same as current object.
+                 */
+
+                SWSS_LOG_INFO("Skipping create only attr on matched object: %s:%s",
+                        meta->attridname,
+                        temporaryAttr->getStrAttrValue().c_str());
+
+                continue;
+            }
+        }
+
+        /*
+         * This is the most interesting case, we currently leave it here and we
+         * will support it later. Some other cases here also can be considered
+         * as success, for example if default value is the same as current
+         * value.
+         */
+
+        SWSS_LOG_WARN("Missing current attr %s (conditional: %d) CAN'T be set to %s, flags: 0x%x, FIXME",
+                meta->attridname,
+                conditional,
+                temporaryAttr->getStrAttrValue().c_str(),
+                meta->flags);
+
+        /*
+         * We can't continue with update in that case, so return false.
+         */
+
+        return false;
     }
 
     /*
-     * All attributes were processed, and ether no changes are required or all
-     * changes can be performed or some missing attributes has exact value as
-     * default value.
+     * Current best match can have more attributes than temporary object.
+     * let see if we can bring them to default value if possible.
      */
 
-    return true;
-}
+    for (auto &ac: currentBestMatch->getAllAttributes())
+    {
+        auto &currentAttr = ac.second;
 
-/**
- * @brief Process SAI object for ASIC view transition
- *
- * Purpose of this function is to find matching SAI object in current view
- * corresponding to new temporary view for which we want to make switch current
- * ASIC configuration.
- *
+        const auto &meta = currentAttr->getAttrMetadata();
+
+        const sai_attribute_t &attr = *currentAttr->getSaiAttr();
+
+        if (processedAttributes.find(attr.id) != processedAttributes.end())
+        {
+            /*
+             * This attribute was processed in previous temporary attributes processing so skip it here.
+             */
+
+            continue;
+        }
+
+        SWSS_LOG_INFO("first pass (curr): attr %s", currentAttr->getStrAttrId().c_str());
+
+        /*
+         * Check if we are bringing one of the default created objects to
+         * default value, since for that we will need dependency TREE.  Most of
+         * the time user should just query configuration and just set new
+         * values based on get results, so this will not be needed.
+         *
+         * And even if we will have dependency tree, those values may not be
+         * synced because of remove etc, so we will need to check if default
+         * values actually exists.
+         */
+
+        if (currentBestMatch->isOidObject())
+        {
+            sai_object_id_t vid = currentBestMatch->getVid();
+
+            /*
+             * Current best match may be created, check if vid/rid exist.
+             */
+
+            if (currentView.hasVid(vid))
+            {
+                sai_object_id_t rid = currentView.vidToRid.at(vid);
+
+                // XXX we have only 1 switch, so we can get away with this
+
+                auto sw = switches.begin()->second;
+
+                if (sw->isDiscoveredRid(rid))
+                {
+                    SWSS_LOG_INFO("performing default on existing object VID %s: %s: %s, we need default dependency TREE, FIXME",
+                            sai_serialize_object_id(vid).c_str(),
+                            meta->attridname,
+                            currentAttr->getStrAttrValue().c_str());
+                }
+            }
+        }
+
+        /*
+         * We should not have MANDATORY_ON_CREATE attributes here since all
+         * mandatory on create (even conditional) should be present in in
+         * previous loop and they are matching, so we should get here
+         * CREATE_ONLY or CREATE_AND_SET attributes only. So we should not get
+         * conditional attributes here also, but lets take extra care about that
+         * just as sanity check.
+         */
+
+        bool conditional = meta->isconditional;
+
+        if (conditional || SAI_HAS_FLAG_MANDATORY_ON_CREATE(meta->flags))
+        {
+            if (currentBestMatch->getObjectStatus() == SAI_OBJECT_STATUS_MATCHED &&
+                    SAI_HAS_FLAG_CREATE_AND_SET(meta->flags))
+            {
+                if (meta->objecttype == SAI_OBJECT_TYPE_PORT &&
+                        meta->attrid == SAI_PORT_ATTR_SPEED)
+                {
+                    /*
+                     * NOTE: for SPEED we could query each port at start and
+                     * save it's speed to recover here, or even we could query
+                     * each attribute on existing object during discovery
+                     * process.
+                     */
+
+                    SWSS_LOG_WARN("No previous value specified on %s (VID), can't bring to default, leaving attr unchanged: %s:%s",
+                            sai_serialize_object_id(currentBestMatch->getVid()).c_str(),
+                            meta->attridname,
+                            currentAttr->getStrAttrValue().c_str());
+
+                    continue;
+                }
+
+                if (meta->objecttype == SAI_OBJECT_TYPE_SCHEDULER_GROUP &&
+                        meta->attrid == SAI_SCHEDULER_GROUP_ATTR_SCHEDULER_PROFILE_ID)
+                {
+                    /*
+                     * This attribute can hold reference to user created
+                     * objects which maybe required to be destroyed, that's why
+                     * we need to bring real value. What if real value were
+                     * removed?
+                     */
+
+                    sai_object_id_t def = SAI_NULL_OBJECT_ID;
+
+                    auto sw = switches.begin()->second;
+
+                    sai_object_id_t vid = currentBestMatch->getVid();
+
+                    if (currentView.hasVid(vid))
+                    {
+                        // scheduler_group RID
+                        sai_object_id_t rid = currentView.vidToRid.at(vid);
+
+                        rid = sw->getDefaultValueForOidAttr(rid, SAI_SCHEDULER_GROUP_ATTR_SCHEDULER_PROFILE_ID);
+
+                        if (rid != SAI_NULL_OBJECT_ID && currentView.hasRid(rid))
+                        {
+                            /*
+                             * We found default value
+                             */
+
+                            SWSS_LOG_DEBUG("found default rid %s, vid %s for %s",
+                                    sai_serialize_object_id(rid).c_str(),
+                                    sai_serialize_object_id(vid).c_str(),
+                                    meta->attridname);
+
+                            def = currentView.ridToVid.at(rid);
+                        }
+                    }
+
+                    sai_attribute_t defattr;
+
+                    defattr.id = meta->attrid;
+                    defattr.value.oid = def;
+
+                    std::string str_attr_value = sai_serialize_attr_value(*meta, defattr, false);
+
+                    auto defaultValueAttr = std::make_shared<SaiAttr>(meta->attridname, str_attr_value);
+
+                    if (performTransition)
+                    {
+                        setAttributeOnCurrentObject(currentView, temporaryView, currentBestMatch, defaultValueAttr);
+                    }
+
+                    continue;
+                }
+
+               // SAI_QUEUE_ATTR_PARENT_SCHEDULER_NODE
+               // SAI_SCHEDULER_GROUP_ATTR_SCHEDULER_PROFILE_ID*
+               // SAI_SCHEDULER_GROUP_ATTR_PARENT_NODE
+               // SAI_BRIDGE_PORT_ATTR_BRIDGE_ID
+               //
+               // TODO matched by ID (MATCHED state) should always be updatable
+               // except those 4 above (at least for those above since they can have
+               // default value present after switch creation
+
+                // TODO SAI_SCHEDULER_GROUP_ATTR_SCHEDULER_PROFILE_ID is mandatory on create but also SET
+                // if attribute is set we and object is in MATCHED state then that means we are able to
+                // bring this attribute to default state not for all attributes!
+                // *SAI_SCHEDULER_GROUP_ATTR_SCHEDULER_PROFILE_ID - is not any more mandatory on create, so default should be NULL
+
+                SWSS_LOG_ERROR("current attribute is mandatory on create, crate and set, and object MATCHED, FIXME %s %s:%s",
+                        currentBestMatch->str_object_id.c_str(),
+                        meta->attridname,
+                        currentAttr->getStrAttrValue().c_str());
+
+                return false;
+            }
+
+            if (currentBestMatch->getObjectStatus() == SAI_OBJECT_STATUS_MATCHED)
+            {
+                if (SAI_HAS_FLAG_CREATE_ONLY(meta->flags))
+                {
+                    /*
+                     * Attribute is create only attribute on matched object. This
+                     * can happen when we are have create only attributes in asic
+                     * view, those attributes were put by snoop logic. Since we
+                     * skipping only read-only attributes then we snoop create-only
+                     * also, but on "existing" objects this will cause problem and
+                     * during apply logic we need to skip this attribute since we
+                     * won't be able to SET it anyway on matched object, and value
+                     * is the same as current object.
+                     */
+
+                    SWSS_LOG_INFO("Skipping create only attr on matched object: %s:%s",
+                            meta->attridname,
+                            currentAttr->getStrAttrValue().c_str());
+
+                    continue;
+                }
+            }
+
+            SWSS_LOG_ERROR("Present current attr %s:%s is conditional or MANDATORY_ON_CREATE, we don't expect this here, FIXME",
+                    meta->attridname,
+                    currentAttr->getStrAttrValue().c_str());
+
+            /*
+             * We don't expect conditional or mandatory on create attributes,
+             * since in previous loop all attributes were matching they also
+             * had to match.  If we hit this case we need to take a closer look
+             * since it will mean we have a bug somewhere.
+             */
+
+            return false;
+        }
+
+        /*
+         * If attribute is CREATE_AND_SET or CREATE_ONLY, they may have a
+         * default value, for create and set we maybe able to set it and for
+         * create only we just need to make sure its expected value, if not
+         * then it can't be updated and we need to return false.
+         *
+         * TODO Currently we will support limited default value types.
+         *
+         * Later this comparison of default value we need to extract to
+         * separate functions. Maybe create SaiAttr from default value or
+         * nullptr if it's not supported yet.
+         */
+
+        if (meta->flags == SAI_ATTR_FLAGS_CREATE_AND_SET || meta->flags == SAI_ATTR_FLAGS_CREATE_ONLY)
+        {
+            // TODO default value for existing objects needs dependency tree
+
+            const auto defaultValueAttr = getSaiAttrFromDefaultValue(currentView, *meta);
+
+            if (defaultValueAttr == nullptr)
+            {
+                SWSS_LOG_WARN("Can't get default value for present current attr %s:%s, FIXME",
+                        meta->attridname,
+                        currentAttr->getStrAttrValue().c_str());
+
+                /*
+                 * If we can't get default value then we can't do set, because
+                 * we don't know with what, so we need to destroy current
+                 * object and recreate new one from temporary.
+                 */
+
+                return false;
+            }
+
+            if (currentAttr->getStrAttrValue() == defaultValueAttr->getStrAttrValue())
+            {
+                SWSS_LOG_INFO("Present current attr %s value %s is the same as default value, no action needed",
+                    meta->attridname,
+                    currentAttr->getStrAttrValue().c_str());
+
+                continue;
+            }
+
+            if (meta->flags == SAI_ATTR_FLAGS_CREATE_ONLY)
+            {
+                SWSS_LOG_WARN("Present current attr %s:%s has default that CAN'T be set to %s since it's CREATE_ONLY",
+                        meta->attridname,
+                        currentAttr->getStrAttrValue().c_str(),
+                        defaultValueAttr->getStrAttrValue().c_str());
+
+                return false;
+            }
+
+            SWSS_LOG_INFO("Present current attr %s:%s has default that can be set to %s",
+                    meta->attridname,
+                    currentAttr->getStrAttrValue().c_str(),
+                    defaultValueAttr->getStrAttrValue().c_str());
+
+            /*
+             * Generate action and update current view in second pass
+             * and continue for next attribute.
+             */
+
+            if (performTransition)
+            {
+                setAttributeOnCurrentObject(currentView, temporaryView, currentBestMatch, defaultValueAttr);
+            }
+
+            continue;
+        }
+
+        SWSS_LOG_THROW("we should not get here, we have a bug, current present attribute %s:%s has some wrong flags 0x%x",
+                    meta->attridname,
+                    currentAttr->getStrAttrValue().c_str(),
+                    meta->flags);
+    }
+
+    /*
+     * All attributes were processed, and ether no changes are required or all
+     * changes can be performed or some missing attributes has exact value as
+     * default value.
+     */
+
+    return true;
+}
+
+/**
+ * @brief Process SAI object for ASIC view transition
+ *
+ * Purpose of this function is to find matching SAI object in current view
+ * corresponding to new temporary view for which we want to make switch current
+ * ASIC configuration.
+ *
  * This function is recursive since it checks all object attributes including
  * attributes that contain other objects which at this stage may not be
  * processed yet.
@@ -6576,1830 +7721,2428 @@ bool performObjectSetTransition(
 void processObjectForViewTransition(
         _In_ AsicView &currentView,
         _In_ AsicView &temporaryView,
-        _In_ const std::shared_ptr<SaiObj> &temporaryObj)
+        _In_ const std::shared_ptr<SaiObj> &temporaryObj)
+{
+    SWSS_LOG_ENTER();
+
+    if (temporaryObj->getObjectStatus() == SAI_OBJECT_STATUS_FINAL)
+    {
+        /*
+         * If object is in final state, no need to process it again, nothing
+         * about this object will change.
+         */
+
+        return;
+    }
+
+    SWSS_LOG_INFO("processing: %s:%s", temporaryObj->str_object_type.c_str(), temporaryObj->str_object_id.c_str());
+
+    procesObjectAttributesForViewTransition(currentView, temporaryView, temporaryObj);
+
+    /*
+     * Now since all object ids (VIDs) were processed for temporary object we
+     * can try to find current best match.
+     */
+
+    std::shared_ptr<SaiObj> currentBestMatch = findCurrentBestMatch(currentView, temporaryView, temporaryObj);
+
+    /*
+     * So there will be interesting problem, when we don't find best matching
+     * object, but actual object will exist, and it will have the same KEY
+     * attribute like, and some other attribute will be create_only and it will
+     * be different then we can't just create temporary object because of key
+     * will match and we have conflict, so we need first in this case remove
+     * previous object with key
+     *
+     * so there are 2 options here:
+     *
+     * - either our finding best match function will always include matching
+     *   keys (if more keys, they all should (or any?) match should be right
+     *   away taken) and this should be only object returned on list possible
+     *   candidates as best match then below logic should figure out that we
+     *   cant do "set" and we need to destroy object and destroy it now, and
+     *   create temporary later this means that finding best logic can return
+     *   objects that are not upgradable "cant do set"
+     *
+     * - or second solution, in this case, finding best match will not include
+     *   this object on list, since other create only attribute will be
+     *   different which also means we need to destroy and recreate, but in
+     *   this case finding best match will figure this out and will destroy
+     *   object on the way since it will know that set transition is not
+     *   possible so here when we find best match (other object) in that case
+     *   we always will be able to do "SET", or when no object will be returned
+     *   then we can just right away create this object since all keys objects
+     *   were removed by finding best match
+     *
+     * In both cases logic is the same, someone needs to figure out whether
+     * updating object and set is possible or whether we leave object alone, or
+     * we delete it before creating new one object.
+     *
+     * Preferably this logic could be in both but that duplicates compare
+     * actions i would rather want this in finding best match, but that would
+     * modify current view which i don't like much and here it seems like to
+     * much hassle since after finding best match here we would have simple
+     * operations.
+     *
+     * Currently KEY are in: vlan, queue, port, hostif_trap
+     * - port - hw lane, we don't need to worry since we match them all
+     * - queue - all other attributes can be set
+     * - vlan - all other attributes can be set
+     * - hostif_trap - all other attributes can be set
+     *
+     * We could add a check for that in sanity.
+     */
+
+    if (currentBestMatch == nullptr)
+    {
+        /*
+         * Since we didn't found current best match, just create this object as
+         * a new object, and put it also in current view in final state.
+         */
+
+        SWSS_LOG_INFO("failed to find best match %s %s in current view, will create new object",
+                temporaryObj->str_object_type.c_str(),
+                temporaryObj->str_object_id.c_str());
+
+        createNewObjectFromTemporaryObject(currentView, temporaryView, temporaryObj);
+        return;
+    }
+
+    SWSS_LOG_INFO("found best match %s: current: %s temporary: %s",
+            currentBestMatch->str_object_type.c_str(),
+            currentBestMatch->str_object_id.c_str(),
+            temporaryObj->str_object_id.c_str());
+
+    /*
+     * We need to two passes, for not matched parameters since if first
+     * attribute will modify current object like SET operation, but second
+     * attribute will not be able to do update because of CREATE_ONLY etc, then
+     * we will end up with half modified current object and VIEW. So we have
+     * two choices here when update is not possible:
+     *
+     * - remove current object and it's childs and create temporary one, or
+     * - leave current object as unprocessed (dry run) for maybe future best
+     *   match, and just create temporary object
+     *
+     * We will choose approach witch leaving object untouched if something will
+     * go wrong, we can always switch back to destroy current best match if
+     * that would be better approach. It could be actually param of comparison
+     * logic.
+     *
+     * NOTE: this function is called twice if first time will be successful
+     * then logs will be doubled in syslog.
+     */
+
+    bool passed = performObjectSetTransition(currentView, temporaryView, currentBestMatch, temporaryObj, false);
+
+    if (!passed)
+    {
+        if (temporaryObj->getObjectStatus() == SAI_OBJECT_STATUS_MATCHED)
+        {
+            /*
+             * If object status is MATCHED, then we have the same object in
+             * current view and temporary view, so it must be possible to make
+             * transition to temporary view, hence for MATCHED objects
+             * performObjectSetTransition must pass. There can be some corner
+             * cases like existing objects after switch create and their attributes
+             * that are OID set to existing objects (like QUEUES).
+             */
+
+            SWSS_LOG_THROW("performObjectSetTransition on MATCHED object (%s) FAILED! bug?",
+                    temporaryObj->str_object_id.c_str());
+        }
+
+        /*
+         * First pass was a failure, so we can't update existing object with
+         * temporary one, probably because of CRATE_ONLY attributes.
+         *
+         * Our strategy here will be to leave untouched current object (second
+         * strategy will be to remove it and it's children if link can't be
+         * broken, Objects with non id like ROUTE FDB NEIGHBOR they need to be
+         * removed first anyway, since we got best match, and for those best
+         * match is via struct elements so we can't create next route with the
+         * same elements in the struct.
+         *
+         * Then we create new object from temporary one and set it state to
+         * final.
+         */
+
+        if (temporaryObj->getObjectType() == SAI_OBJECT_TYPE_SWITCH)
+        {
+            SWSS_LOG_THROW("we should not get switch object here, bug?");
+        }
+
+        if (!temporaryObj->isOidObject())
+        {
+            removeExistingObjectFromCurrentView(currentView, temporaryView, currentBestMatch);
+        }
+        else
+        {
+            /*
+             * Later on if we decide we want to remove objects before
+             * creating new one's we need to put here this action, or just
+             * remove this entire switch and call remove.
+             */
+        }
+
+        // No need to store VID since at this point we don't have RID yet, it will be
+        // created on execute asic and RID will be saved to maps in both views.
+
+        createNewObjectFromTemporaryObject(currentView, temporaryView, temporaryObj);
+
+        return;
+    }
+
+    /*
+     * First pass was successful, so we can do update on current object, lets do that now!
+     */
+
+    if (temporaryObj->isOidObject() && (temporaryObj->getObjectStatus() != SAI_OBJECT_STATUS_MATCHED))
+    {
+        /*
+         * We track all oid object references, and since this object was
+         * matched we need to insert it's vid to reference map since when we
+         * will update attributes in current view from temporary view
+         * attributes, then this object must be in reference map. This is
+         * sanity check. Object can't be in matched state since matched objects
+         * have the same RID and VID in both views, so VID already exists in
+         * reference map.
+         *
+         * This object VID will be remapped inside UpdateObjectStatus to
+         * rid/vid map since if we are here then we matched one of current
+         * objects to this temporary object and update can be performed.
+         */
+
+         /*
+          * TODO: This is temporary VID, it's not available in current view so
+          * we need to remove this code here, since we will translate this VID
+          * in temporary view to current view.
+          */
+
+        sai_object_id_t vid = temporaryObj->getVid();
+
+        currentView.insertNewVidReference(vid);
+
+        // save temporary vid to rid after match
+        // can't be here since vim to rid map will not match
+        // currentView.vidToRid[vid] = currentView.vidToRid.at(currentBestMatch->getVid());
+    }
+
+    performObjectSetTransition(currentView, temporaryView, currentBestMatch, temporaryObj, true);
+
+    /*
+     * Since we got here, that means matching or updating current best match
+     * object was successful, and we can now set their state to final.
+     */
+
+    UpdateObjectStatus(currentView, temporaryView, currentBestMatch, temporaryObj);
+}
+
+void checkSwitch(
+        _In_ const AsicView &currentView,
+        _In_ const AsicView &temporaryView)
+{
+    SWSS_LOG_ENTER();
+
+    auto csws = currentView.getObjectsByObjectType(SAI_OBJECT_TYPE_SWITCH);
+    auto tsws = temporaryView.getObjectsByObjectType(SAI_OBJECT_TYPE_SWITCH);
+
+    size_t csize = csws.size();
+    size_t tsize = tsws.size();
+
+    if (csize == 0 && tsize == 0)
+    {
+        return;
+    }
+
+    if (csize == 1 && tsize == 1)
+    {
+        /*
+         * VID on both switches must match.
+         */
+
+        auto csw = csws.at(0);
+        auto tsw = tsws.at(0);
+
+        if (csw->getVid() != tsw->getVid())
+        {
+            SWSS_LOG_THROW("Current switch VID %s is different than temporary VID %s",
+                    sai_serialize_object_id(csw->getVid()).c_str(),
+                    sai_serialize_object_id(tsw->getVid()).c_str());
+        }
+
+        /*
+         * TODO: We need to check create only attributes (hardware info), if
+         * they differ then throw since update will not be possible, we can
+         * separate this to different case to remove existing switch and
+         * recreate new one check switches and VID matching if it's the same.
+         */
+
+        return;
+    }
+
+    /*
+     * Current logic supports only 1 instance of switch so in both views we
+     * should have only 1 instance of switch and they must match.
+     */
+
+    SWSS_LOG_THROW("unsupported number of switches: current %zu, temp %zu", csize, tsize);
+}
+
+// TODO this needs to be done in generic way for all
+// default OID values set to attrvalue
+void bringDefaultTrapGroupToFinalState(
+        _In_ AsicView &currentView,
+        _In_ AsicView &temporaryView)
+{
+    SWSS_LOG_ENTER();
+
+    sai_object_id_t rid = currentView.defaultTrapGroupRid;
+
+    if (temporaryView.hasRid(rid))
+    {
+        /*
+         * Default trap group is defined inside temporary view
+         * so it will be matched by RID, no need to process.
+         */
+
+        return;
+    }
+
+    sai_object_id_t vid = currentView.ridToVid.at(rid);
+
+    const auto &dtgObj = currentView.oOids.at(vid);
+
+    if (dtgObj->getObjectStatus() != SAI_OBJECT_STATUS_NOT_PROCESSED)
+    {
+        /*
+         * Object was processed, no further actions are required.
+         */
+
+        return;
+    }
+
+    /*
+     * Trap group was not processed, it can't be removed so bring it to default
+     * state and release existing references.
+     */
+
+    bringNonRemovableObjectToDefaultState(currentView, dtgObj);
+}
+
+void applyViewTransition(
+        _In_ AsicView &current,
+        _In_ AsicView &temp)
+{
+    SWSS_LOG_ENTER();
+
+    SWSS_LOG_TIMER("comparison logic");
+
+    checkSwitch(current, temp);
+
+    checkMatchedPorts(temp);
+
+    /*
+     * Process all objects
+     */
+
+    /*
+     * During iteration no object from temp view are removed, so no need to
+     * worry about any iterator issues here since removed objects are only from
+     * current view.
+     *
+     * Order here can't be random, since it can mean that we will be adding
+     * routes here, and on some ASICs there is limitation that default routes
+     * must be put to ASIC first, so we need to compensate for that.
+     *
+     * TODO what about remove? can they be removed first ?
+     *
+     * There is another issue that when we are removing next hop group member
+     * and it's the last next hop group member in group where group is still in
+     * use by some group, then we can't remove it, we need to first remove
+     * route that uses this group, this puts this task in conflict when
+     * creating routes.
+     *
+     * XXX this is workaround. FIXME
+     */
+
+    for (auto &obj: temp.soAll)
+    {
+        if (obj.second->getObjectType() != SAI_OBJECT_TYPE_ROUTE_ENTRY)
+        {
+            processObjectForViewTransition(current, temp, obj.second);
+        }
+    }
+
+    for (auto &obj: temp.soAll)
+    {
+        if (obj.second->getObjectType() == SAI_OBJECT_TYPE_ROUTE_ENTRY)
+        {
+            bool isDefault = obj.second->str_object_id.find("/0") != std::string::npos;
+
+            if (isDefault)
+            {
+                processObjectForViewTransition(current, temp, obj.second);
+            }
+        }
+    }
+
+    for (auto &obj: temp.soAll)
+    {
+        if (obj.second->getObjectType() == SAI_OBJECT_TYPE_ROUTE_ENTRY)
+        {
+            bool isDefault = obj.second->str_object_id.find("/0") != std::string::npos;
+
+            if (!isDefault)
+            {
+                processObjectForViewTransition(current, temp, obj.second);
+            }
+        }
+    }
+
+    /*
+     * There is a problem here with default trap group, since when other trap
+     * groups are created and used in traps, then when removing them we reset
+     * trap group on traps to default one, and this increases reference count
+     * so in this loop, default trap group will not be considered to be removed
+     * and it will stay not processed since it will hold reference count on
+     * traps. So what we can do here, we can explicitly move default trap group
+     * to FINAL state if it's not defined in temporary view, but this problem
+     * should go away when we will put all existing objects to temporary view
+     * if they don't exist. This apply to v0.9.4 and v1.0
+     *
+     * Similar thing can happen when we start using PROFILE_ID on
+     * SCHEDULER_GROUP.
+     *
+     * TODO Revisit, since v1.0
+     */
+
+    bringDefaultTrapGroupToFinalState(current, temp);
+
+    /*
+     * Removing needs to be done from leaf with no references and it can be
+     * multiple passes since if in first pass object had non zero references,
+     * it can have zero in next pass so it is safe to remove.
+     */
+
+    /*
+     * Another issue, since user may remove bridge port and vlan members and we
+     * don't have references on them on the first place, then it may happen
+     * that bridge port remove will be before vlan member remove and it will
+     * fail. Similar problem is on hard reinit when removing existing objects.
+     *
+     * TODO we need dependency tree during sai discovery! but if we put those
+     * to redis it will cause another problem, since some of those attributes
+     * are create only, so object will be selected to "SET" after vid processing
+     * but it wont be able to set create only attributes, we would need to skip
+     * those.
+     *
+     * XXX this is workaround. FIXME
+     */
+
+    std::vector<sai_object_type_t> removeOrder = {
+        SAI_OBJECT_TYPE_VLAN_MEMBER,
+        SAI_OBJECT_TYPE_STP_PORT,
+        SAI_OBJECT_TYPE_BRIDGE_PORT };
+
+    for (const sai_object_type_t ot: removeOrder)
+    {
+        for (const auto &obj: current.getObjectsByObjectType(ot))
+        {
+            if (obj->getObjectStatus() == SAI_OBJECT_STATUS_NOT_PROCESSED)
+            {
+                if (current.getVidReferenceCount(obj->getVid()) == 0)
+                {
+                    removeExistingObjectFromCurrentView(current, temp, obj);
+                }
+            }
+        }
+    }
+
+    for (int removed = 1; removed != 0 ;)
+    {
+        removed = 0;
+
+        for (const auto &obj: current.getAllNotProcessedObjects())
+        {
+            /*
+             * What can happen during this processing some object state during
+             * processing can change from not processed to removed, if it have
+             * references, currently we are only removing objects with zero
+             * references, so this will not happen but in general case this
+             * will be the case.
+             */
+
+            if (obj->isOidObject())
+            {
+                if (current.getVidReferenceCount(obj->getVid()) == 0)
+                {
+                    /*
+                     * Reference count on this VID is zero, so it's safe to
+                     * remove this object.
+                     */
+
+                    removeExistingObjectFromCurrentView(current, temp, obj);
+                    removed++;
+                }
+            }
+            else
+            {
+                /*
+                 * Non object id objects don't have references count, they are leafs
+                 * so we can remove them right away
+                 */
+
+                removeExistingObjectFromCurrentView(current, temp, obj);
+                removed++;
+            }
+        }
+
+        if (removed)
+        {
+            SWSS_LOG_NOTICE("loop removed %d objects", removed);
+        }
+    }
+
+    /*
+     * Check statuses will make sure that there are no objects with removed
+     * status.
+     */
+}
+
+void executeOperationsOnAsic(
+        _In_ AsicView &currentView,
+        _In_ AsicView &temporaryView);
+
+// TODO find better way to access this
+extern std::set<sai_object_id_t> initViewRemovedVidSet;
+
+void populateExistingObjects(
+        _In_ AsicView &currentView,
+        _In_ AsicView &temporaryView,
+        _In_ const std::set<sai_object_id_t> rids)
 {
     SWSS_LOG_ENTER();
 
-    if (temporaryObj->getObjectStatus() == SAI_OBJECT_STATUS_FINAL)
-    {
+    /*
+     * We should transfer existing objects from current view to temporary view.
+     * But not all objects, since user could remove some default removable
+     * objects like vlan member, bridge port etc. We collected those removed
+     * objects to initViewRemovedVidSet and we will use this as a reference to
+     * transfer objects to temporary view.
+     *
+     * TODO: still sairedis metadata database have no idea about existing
+     * objects so user can create object which already exists like vlan 1 if he
+     * didn't queried it yet. We need to transfer all dependency tree to
+     * sairedis after switch create.
+     */
+
+    if (temporaryView.getObjectsByObjectType(SAI_OBJECT_TYPE_SWITCH).size() == 0)
+    {
+        SWSS_LOG_NOTICE("no switch present in temporary view, skipping");
+        return;
+    }
+
+    // XXX we have only 1 switch, so we can get away with this
+
+    auto sw = switches.begin()->second;
+
+    auto coldBootDiscoveredVids = sw->getColdBootDiscoveredVids();
+    auto warmBootDiscoveredVids = sw->getWarmBootDiscoveredVids();
+
+    /*
+     * If some objects that are existing objects on switch are not present in
+     * temporary view, just populate them with empty values.  Since vid2rid
+     * maps must match on both view after apply view.
+     */
+
+    for (const sai_object_id_t rid: rids)
+    {
+        if (rid == SAI_NULL_OBJECT_ID)
+        {
+            continue;
+        }
+
+        /*
+         * Rid's are not matched yet, but if VID is the same then we have the
+         * same object.
+         */
+
+        if (temporaryView.hasRid(rid))
+        {
+            continue;
+        }
+
+        auto it = currentView.ridToVid.find(rid);
+
+        if (it == currentView.ridToVid.end())
+        {
+            SWSS_LOG_THROW("unable to find existing object RID %s in current view",
+                    sai_serialize_object_id(rid).c_str());
+        }
+
+        sai_object_id_t vid = it->second;
+
+        if (initViewRemovedVidSet.find(vid) != initViewRemovedVidSet.end())
+        {
+            /*
+             * If this vid was removed during init view mode, it still exits in
+             * current view, but don't put it to existing objects, then
+             * comparison logic will take care of that and, it will remove it
+             * from current view as well.
+             */
+
+            continue;
+        }
+
+        /*
+         * In case of warm boot, it may happen that user set some created
+         * objects on default existing objects, like for example buffer profile
+         * on ingress priority group.  In this case buffer profile should not
+         * be considered as matched object and copied to temporary view, since
+         * this object was not default existing object (on 1st cold boot) so in
+         * this case it must be processed by comparison logic and matched with
+         * possible new buffer profile created in temporary view. This may
+         * happen if OA will not care what was set previously on ingress
+         * priority group and just create new buffer profile and assign it.  In
+         * this case we don't want any asic operations to happen.  Also if we
+         * would pass this buffer profile as existing to temporary view, it
+         * would not be matched by comparison logic, and in the result we will
+         * end up with 2 buffer profiles, which 1st of them will be not
+         * assigned anywhere and this will be memory leak.
+         *
+         * Also a bunch of new asic operations will be generated for setting
+         * new user created buffer profile.  That's why we need default existing
+         * vid list to distinguish between user created and default switch
+         * created objects.
+         *
+         * For default existing objects, we don't need to copy attributes, since
+         * if user didn't set them, we want them to be back to default values.
+         *
+         * NOTE: If we are here, then this RID exists only in current view, and
+         * if this object contains any OID attributes, discovery logic queried
+         * them so they are also existing in current view.
+         *
+         * Also in warm boot, when user removed port, and then created some new
+         * ports, new QUEUEs, IPGs and SGs will be created automatically by
+         * SAI.  Those new created objects mot likely will have different RID
+         * values then previous instances for given port. Those values should
+         * also be copied to temporary view, since they will not exist on cold
+         * boot discovered VIDs. If not, then comparison logic will try to remove
+         * them which is not what we want.
+         *
+         * This is tricky scenario, and there could be some issues also when
+         * other object types would be created by user.
+         */
+
+        bool performColdCheck = true;
+
+        if (warmBootDiscoveredVids.find(vid) != warmBootDiscoveredVids.end())
+        {
+            sai_object_type_t ot = redis_sai_object_type_query(vid);
+
+            switch (ot)
+            {
+                case SAI_OBJECT_TYPE_QUEUE:
+                case SAI_OBJECT_TYPE_INGRESS_PRIORITY_GROUP:
+                case SAI_OBJECT_TYPE_SCHEDULER_GROUP:
+
+                    // TODO this case may require adjustment, if user will do a
+                    // warm boot then remove/add some ports and make another
+                    // warm boot, it may happen that current logic will be
+                    // confused which of those objects are from previous warm
+                    // boot or second one, need better way to mark changes to
+                    // those objects in redis DB between warm boots
+
+                    performColdCheck = false;
+
+                    break;
+                default:
+                    break;
+            }
+        }
+
+        if (performColdCheck && coldBootDiscoveredVids.find(vid) == coldBootDiscoveredVids.end())
+        {
+            SWSS_LOG_INFO("object is not on default existing list: %s RID %s VID %s",
+                    sai_serialize_object_type(sai_object_type_query(rid)).c_str(),
+                    sai_serialize_object_id(rid).c_str(),
+                    sai_serialize_object_id(vid).c_str());
+
+            continue;
+        }
+
+        temporaryView.createDummyExistingObject(rid, vid);
+
+        SWSS_LOG_INFO("populate existing %s RID %s VID %s",
+                sai_serialize_object_type(sai_object_type_query(rid)).c_str(),
+                sai_serialize_object_id(rid).c_str(),
+                sai_serialize_object_id(vid).c_str());
+
         /*
-         * If object is in final state, no need to process it again, nothing
-         * about this object will change.
+         * Move both objects to matched state since match oids was already
+         * called, and here we created some new objects that should be matched.
          */
 
-        return;
+        currentView.oOids.at(vid)->setObjectStatus(SAI_OBJECT_STATUS_MATCHED);
+        temporaryView.oOids.at(vid)->setObjectStatus(SAI_OBJECT_STATUS_MATCHED);
     }
+}
 
-    SWSS_LOG_INFO("processing: %s:%s", temporaryObj->str_object_type.c_str(), temporaryObj->str_object_id.c_str());
+/**
+ * @brief Number of saved objects after which update progress is logged.
+ */
+#define UPDATE_REDIS_PROGRESS_INTERVAL (100000)
 
-    procesObjectAttributesForViewTransition(currentView, temporaryView, temporaryObj);
+void updateRedisDatabase(
+        _In_ const AsicView &currentView,
+        _In_ const AsicView &temporaryView)
+{
+    SWSS_LOG_ENTER();
 
     /*
-     * Now since all object ids (VIDs) were processed for temporary object we
-     * can try to find current best match.
+     * All commands are pipelined in batches, so update costs one round trip
+     * per batch instead of one per key or attribute.
+     *
+     * TODO: This needs to be updated if we want to support multiple switches.
      */
 
-    std::shared_ptr<SaiObj> currentBestMatch = findCurrentBestMatch(currentView, temporaryView, temporaryObj);
+    SWSS_LOG_TIMER("redis update");
 
-    /*
-     * So there will be interesting problem, when we don't find best matching
-     * object, but actual object will exist, and it will have the same KEY
-     * attribute like, and some other attribute will be create_only and it will
-     * be different then we can't just create temporary object because of key
-     * will match and we have conflict, so we need first in this case remove
-     * previous object with key
-     *
-     * so there are 2 options here:
-     *
-     * - either our finding best match function will always include matching
-     *   keys (if more keys, they all should (or any?) match should be right
-     *   away taken) and this should be only object returned on list possible
-     *   candidates as best match then below logic should figure out that we
-     *   cant do "set" and we need to destroy object and destroy it now, and
-     *   create temporary later this means that finding best logic can return
-     *   objects that are not upgradable "cant do set"
-     *
-     * - or second solution, in this case, finding best match will not include
-     *   this object on list, since other create only attribute will be
-     *   different which also means we need to destroy and recreate, but in
-     *   this case finding best match will figure this out and will destroy
-     *   object on the way since it will know that set transition is not
-     *   possible so here when we find best match (other object) in that case
-     *   we always will be able to do "SET", or when no object will be returned
-     *   then we can just right away create this object since all keys objects
-     *   were removed by finding best match
-     *
-     * In both cases logic is the same, someone needs to figure out whether
-     * updating object and set is possible or whether we leave object alone, or
-     * we delete it before creating new one object.
-     *
-     * Preferably this logic could be in both but that duplicates compare
-     * actions i would rather want this in finding best match, but that would
-     * modify current view which i don't like much and here it seems like to
-     * much hassle since after finding best match here we would have simple
-     * operations.
-     *
-     * Currently KEY are in: vlan, queue, port, hostif_trap
-     * - port - hw lane, we don't need to worry since we match them all
-     * - queue - all other attributes can be set
-     * - vlan - all other attributes can be set
-     * - hostif_trap - all other attributes can be set
-     *
-     * We could add a check for that in sanity.
-     */
+    RedisBatchWriter writer(dbAsic);
 
-    if (currentBestMatch == nullptr)
     {
+        SWSS_LOG_TIMER("redis update: remove asic state");
+
         /*
-         * Since we didn't found current best match, just create this object as
-         * a new object, and put it also in current view in final state.
+         * Remove Asic State Table and Temp Asic State Table
          */
 
-        SWSS_LOG_INFO("failed to find best match %s %s in current view, will create new object",
-                temporaryObj->str_object_type.c_str(),
-                temporaryObj->str_object_id.c_str());
+        writer.del(redis_scan_keys(ASIC_STATE_TABLE + std::string(":*")));
+        writer.del(redis_scan_keys(TEMP_PREFIX ASIC_STATE_TABLE + std::string(":*")));
 
-        createNewObjectFromTemporaryObject(currentView, temporaryView, temporaryObj);
-        return;
+        writer.flush();
     }
 
-    SWSS_LOG_INFO("found best match %s: current: %s temporary: %s",
-            currentBestMatch->str_object_type.c_str(),
-            currentBestMatch->str_object_id.c_str(),
-            temporaryObj->str_object_id.c_str());
+    {
+        SWSS_LOG_TIMER("redis update: save temporary view");
 
-    /*
-     * We need to two passes, for not matched parameters since if first
-     * attribute will modify current object like SET operation, but second
-     * attribute will not be able to do update because of CREATE_ONLY etc, then
-     * we will end up with half modified current object and VIEW. So we have
-     * two choices here when update is not possible:
-     *
-     * - remove current object and it's childs and create temporary one, or
-     * - leave current object as unprocessed (dry run) for maybe future best
-     *   match, and just create temporary object
-     *
-     * We will choose approach witch leaving object untouched if something will
-     * go wrong, we can always switch back to destroy current best match if
-     * that would be better approach. It could be actually param of comparison
-     * logic.
-     *
-     * NOTE: this function is called twice if first time will be successful
-     * then logs will be doubled in syslog.
-     */
+        /*
+         * Save temporary view as current view in redis database.
+         */
 
-    bool passed = performObjectSetTransition(currentView, temporaryView, currentBestMatch, temporaryObj, false);
+        size_t total = temporaryView.soAll.size();
+        size_t done = 0;
 
-    if (!passed)
-    {
-        if (temporaryObj->getObjectStatus() == SAI_OBJECT_STATUS_MATCHED)
+        for (const auto &pair: temporaryView.soAll)
         {
-            /*
-             * If object status is MATCHED, then we have the same object in
-             * current view and temporary view, so it must be possible to make
-             * transition to temporary view, hence for MATCHED objects
-             * performObjectSetTransition must pass. There can be some corner
-             * cases like existing objects after switch create and their attributes
-             * that are OID set to existing objects (like QUEUES).
-             */
+            const auto &obj = pair.second;
 
-            SWSS_LOG_THROW("performObjectSetTransition on MATCHED object (%s) FAILED! bug?",
-                    temporaryObj->str_object_id.c_str());
-        }
+            const auto &attr = obj->getAllAttributes();
 
-        /*
-         * First pass was a failure, so we can't update existing object with
-         * temporary one, probably because of CRATE_ONLY attributes.
-         *
-         * Our strategy here will be to leave untouched current object (second
-         * strategy will be to remove it and it's children if link can't be
-         * broken, Objects with non id like ROUTE FDB NEIGHBOR they need to be
-         * removed first anyway, since we got best match, and for those best
-         * match is via struct elements so we can't create next route with the
-         * same elements in the struct.
-         *
-         * Then we create new object from temporary one and set it state to
-         * final.
-         */
+            std::string key = std::string(ASIC_STATE_TABLE) + ":" + obj->str_object_type + ":" + obj->str_object_id;
 
-        if (temporaryObj->getObjectType() == SAI_OBJECT_TYPE_SWITCH)
-        {
-            SWSS_LOG_THROW("we should not get switch object here, bug?");
-        }
+            std::vector<swss::FieldValueTuple> values;
 
-        if (!temporaryObj->isOidObject())
-        {
-            removeExistingObjectFromCurrentView(currentView, temporaryView, currentBestMatch);
-        }
-        else
-        {
-            /*
-             * Later on if we decide we want to remove objects before
-             * creating new one's we need to put here this action, or just
-             * remove this entire switch and call remove.
-             */
-        }
+            if (attr.size() == 0)
+            {
+                /*
+                 * Object has no attributes, so populate using NULL just to
+                 * indicate that object exists.
+                 */
 
-        // No need to store VID since at this point we don't have RID yet, it will be
-        // created on execute asic and RID will be saved to maps in both views.
+                values.emplace_back("NULL", "NULL");
+            }
+            else
+            {
+                values.reserve(attr.size());
 
-        createNewObjectFromTemporaryObject(currentView, temporaryView, temporaryObj);
+                for (const auto &ap: attr)
+                {
+                    const auto saiAttr = ap.second;
 
-        return;
+                    values.emplace_back(saiAttr->getStrAttrId(), saiAttr->getStrAttrValue());
+                }
+            }
+
+            writer.hmset(key, values);
+
+            if (++done % UPDATE_REDIS_PROGRESS_INTERVAL == 0)
+            {
+                SWSS_LOG_NOTICE("redis update progress: %zu/%zu objects", done, total);
+            }
+        }
+
+        writer.flush();
+
+        SWSS_LOG_NOTICE("redis update: saved %zu objects using %zu commands in %zu batches",
+                total,
+                writer.getCommandCount(),
+                writer.getFlushCount());
     }
 
     /*
-     * First pass was successful, so we can do update on current object, lets do that now!
+     * Remove previous RID2VID maps and apply new map.
+     *
+     * TODO: This needs to be done per switch, we can't remove all maps.
      */
 
-    if (temporaryObj->isOidObject() && (temporaryObj->getObjectStatus() != SAI_OBJECT_STATUS_MATCHED))
     {
-        /*
-         * We track all oid object references, and since this object was
-         * matched we need to insert it's vid to reference map since when we
-         * will update attributes in current view from temporary view
-         * attributes, then this object must be in reference map. This is
-         * sanity check. Object can't be in matched state since matched objects
-         * have the same RID and VID in both views, so VID already exists in
-         * reference map.
-         *
-         * This object VID will be remapped inside UpdateObjectStatus to
-         * rid/vid map since if we are here then we matched one of current
-         * objects to this temporary object and update can be performed.
-         */
+        SWSS_LOG_TIMER("redis update: rid and vid maps");
 
-         /*
-          * TODO: This is temporary VID, it's not available in current view so
-          * we need to remove this code here, since we will translate this VID
-          * in temporary view to current view.
-          */
-
-        sai_object_id_t vid = temporaryObj->getVid();
+        redisClearVidToRidMap();
+        redisClearRidToVidMap();
 
-        currentView.insertNewVidReference(vid);
+        std::vector<std::pair<sai_object_id_t, sai_object_id_t>> ridVidPairs(
+                temporaryView.ridToVid.begin(),
+                temporaryView.ridToVid.end());
 
-        // save temporary vid to rid after match
-        // can't be here since vim to rid map will not match
-        // currentView.vidToRid[vid] = currentView.vidToRid.at(currentBestMatch->getVid());
+        redisSetRidAndVidPairs(ridVidPairs);
     }
 
-    performObjectSetTransition(currentView, temporaryView, currentBestMatch, temporaryObj, true);
-
-    /*
-     * Since we got here, that means matching or updating current best match
-     * object was successful, and we can now set their state to final.
-     */
-
-    UpdateObjectStatus(currentView, temporaryView, currentBestMatch, temporaryObj);
+    SWSS_LOG_NOTICE("updated redis database");
 }
 
-void checkSwitch(
+void logViewObjectCount(
         _In_ const AsicView &currentView,
         _In_ const AsicView &temporaryView)
 {
     SWSS_LOG_ENTER();
 
-    auto csws = currentView.getObjectsByObjectType(SAI_OBJECT_TYPE_SWITCH);
-    auto tsws = temporaryView.getObjectsByObjectType(SAI_OBJECT_TYPE_SWITCH);
+    bool asic_changes = false;
 
-    size_t csize = csws.size();
-    size_t tsize = tsws.size();
+    for (int i = SAI_OBJECT_TYPE_NULL + 1; i < SAI_OBJECT_TYPE_EXTENSIONS_MAX; i++)
+    {
+        sai_object_type_t ot = (sai_object_type_t)i;
+
+        size_t c = currentView.getObjectsByObjectType(ot).size();
+        size_t t = temporaryView.getObjectsByObjectType(ot).size();
+
+        if (c == t)
+            continue;
+
+        asic_changes = true;
+
+        SWSS_LOG_WARN("object count for %s on current view %zu is differnt than on temporary view: %zu",
+                sai_serialize_object_type(ot).c_str(),
+                c,
+                t);
+    }
+
+    if (asic_changes)
+    {
+        SWSS_LOG_WARN("object count is differnt on both view, there will be ASIC OPERATIONS!");
+    }
+}
+
+void checkAsicVsDatabaseConsistency(
+        _In_ const AsicView &cur,
+        _In_ const AsicView &tmp)
+{
+    SWSS_LOG_ENTER();
 
-    if (csize == 0 && tsize == 0)
-    {
-        return;
-    }
+    bool hasErrors = false;
 
-    if (csize == 1 && tsize == 1)
     {
-        /*
-         * VID on both switches must match.
-         */
+        SWSS_LOG_TIMER("consistency check");
 
-        auto csw = csws.at(0);
-        auto tsw = tsws.at(0);
+        SWSS_LOG_WARN("performing consistency check");
 
-        if (csw->getVid() != tsw->getVid())
+        for (const auto &pair: tmp.soAll)
         {
-            SWSS_LOG_THROW("Current switch VID %s is different than temporary VID %s",
-                    sai_serialize_object_id(csw->getVid()).c_str(),
-                    sai_serialize_object_id(tsw->getVid()).c_str());
-        }
+            const auto &obj = pair.second;
 
-        /*
-         * TODO: We need to check create only attributes (hardware info), if
-         * they differ then throw since update will not be possible, we can
-         * separate this to different case to remove existing switch and
-         * recreate new one check switches and VID matching if it's the same.
-         */
+            const auto &attrs = obj->getAllAttributes();
 
-        return;
-    }
+            // get object meta key for get (object id or *entry)
 
-    /*
-     * Current logic supports only 1 instance of switch so in both views we
-     * should have only 1 instance of switch and they must match.
-     */
+            sai_object_meta_key_t meta_key = obj->meta_key;
 
-    SWSS_LOG_THROW("unsupported number of switches: current %zu, temp %zu", csize, tsize);
-}
+            // translate all VID's to RIDs in non object is's
 
-// TODO this needs to be done in generic way for all
-// default OID values set to attrvalue
-void bringDefaultTrapGroupToFinalState(
-        _In_ AsicView &currentView,
-        _In_ AsicView &temporaryView)
-{
-    SWSS_LOG_ENTER();
+            translate_vid_to_rid_non_object_id(meta_key);
 
-    sai_object_id_t rid = currentView.defaultTrapGroupRid;
+            auto info = sai_metadata_get_object_type_info(obj->getObjectType());
 
-    if (temporaryView.hasRid(rid))
-    {
-        /*
-         * Default trap group is defined inside temporary view
-         * so it will be matched by RID, no need to process.
-         */
+            sai_attribute_t attr;
 
-        return;
-    }
+            memset(&attr, 0, sizeof(attr));
 
-    sai_object_id_t vid = currentView.ridToVid.at(rid);
+            if (attrs.size() == 0)
+            {
+                // get first attribute and do a get query to see if object exist's
 
-    const auto &dtgObj = currentView.oOids.at(vid);
+                auto meta = info->attrmetadata[0];
 
-    if (dtgObj->getObjectStatus() != SAI_OBJECT_STATUS_NOT_PROCESSED)
-    {
-        /*
-         * Object was processed, no further actions are required.
-         */
+                sai_status_t status = info->get(&meta_key, 1, &attr);
 
-        return;
-    }
+                switch (status)
+                {
+                    case SAI_STATUS_SUCCESS:
+                    case SAI_STATUS_BUFFER_OVERFLOW:
+                        continue;
 
-    /*
-     * Trap group was not processed, it can't be removed so bring it to default
-     * state and release existing references.
-     */
+                    case SAI_STATUS_NOT_IMPLEMENTED:
+                    case SAI_STATUS_NOT_SUPPORTED:
 
-    bringNonRemovableObjectToDefaultState(currentView, dtgObj);
-}
+                        SWSS_LOG_WARN("GET api for %s is not implemented on %s",
+                                meta->attridname,
+                                obj->str_object_id.c_str());
+                    continue;
+                }
 
-void applyViewTransition(
-        _In_ AsicView &current,
-        _In_ AsicView &temp)
-{
-    SWSS_LOG_ENTER();
+                SWSS_LOG_ERROR("failed to get %s on %s: %s",
+                        meta->attridname,
+                        obj->str_object_id.c_str(),
+                        sai_serialize_status(status).c_str());
 
-    SWSS_LOG_TIMER("comparison logic");
+                hasErrors = true;
 
-    checkSwitch(current, temp);
+                continue;
+            }
 
-    checkMatchedPorts(temp);
+            for (const auto &ap: attrs)
+            {
+                const auto &saiAttr = ap.second;
 
-    /*
-     * Process all objects
-     */
+                auto meta = saiAttr->getAttrMetadata();
 
-    /*
-     * During iteration no object from temp view are removed, so no need to
-     * worry about any iterator issues here since removed objects are only from
-     * current view.
-     *
-     * Order here can't be random, since it can mean that we will be adding
-     * routes here, and on some ASICs there is limitation that default routes
-     * must be put to ASIC first, so we need to compensate for that.
-     *
-     * TODO what about remove? can they be removed first ?
-     *
-     * There is another issue that when we are removing next hop group member
-     * and it's the last next hop group member in group where group is still in
-     * use by some group, then we can't remove it, we need to first remove
-     * route that uses this group, this puts this task in conflict when
-     * creating routes.
-     *
-     * XXX this is workaround. FIXME
-     */
+                // deserialize existing attribute so deserialize will allocate
+                // memory for all list's
 
-    for (auto &obj: temp.soAll)
-    {
-        if (obj.second->getObjectType() != SAI_OBJECT_TYPE_ROUTE_ENTRY)
-        {
-            processObjectForViewTransition(current, temp, obj.second);
-        }
-    }
+                attr.id = meta->attrid;
 
-    for (auto &obj: temp.soAll)
-    {
-        if (obj.second->getObjectType() == SAI_OBJECT_TYPE_ROUTE_ENTRY)
-        {
-            bool isDefault = obj.second->str_object_id.find("/0") != std::string::npos;
+                sai_deserialize_attr_value(saiAttr->getStrAttrValue(), *meta, attr, false);
 
-            if (isDefault)
-            {
-                processObjectForViewTransition(current, temp, obj.second);
-            }
-        }
-    }
+                // translate all VIDs from DB to RIDs for compare
 
-    for (auto &obj: temp.soAll)
-    {
-        if (obj.second->getObjectType() == SAI_OBJECT_TYPE_ROUTE_ENTRY)
-        {
-            bool isDefault = obj.second->str_object_id.find("/0") != std::string::npos;
+                translate_vid_to_rid_list(obj->getObjectType(), 1, &attr);
 
-            if (!isDefault)
-            {
-                processObjectForViewTransition(current, temp, obj.second);
-            }
-        }
-    }
+                // get attr value with RIDs
 
-    /*
-     * There is a problem here with default trap group, since when other trap
-     * groups are created and used in traps, then when removing them we reset
-     * trap group on traps to default one, and this increases reference count
-     * so in this loop, default trap group will not be considered to be removed
-     * and it will stay not processed since it will hold reference count on
-     * traps. So what we can do here, we can explicitly move default trap group
-     * to FINAL state if it's not defined in temporary view, but this problem
-     * should go away when we will put all existing objects to temporary view
-     * if they don't exist. This apply to v0.9.4 and v1.0
-     *
-     * Similar thing can happen when we start using PROFILE_ID on
-     * SCHEDULER_GROUP.
-     *
-     * TODO Revisit, since v1.0
-     */
+                const std::string& dbValue = sai_serialize_attr_value(*meta, attr);
 
-    bringDefaultTrapGroupToFinalState(current, temp);
+                sai_status_t status = info->get(&meta_key, 1, &attr);
 
-    /*
-     * Removing needs to be done from leaf with no references and it can be
-     * multiple passes since if in first pass object had non zero references,
-     * it can have zero in next pass so it is safe to remove.
-     */
+                if (meta->attrid == SAI_QOS_MAP_ATTR_MAP_TO_VALUE_LIST && meta->objecttype == SAI_OBJECT_TYPE_QOS_MAP && status == SAI_STATUS_SUCCESS)
+                {
+                    // order does not matter on this list
 
-    /*
-     * Another issue, since user may remove bridge port and vlan members and we
-     * don't have references on them on the first place, then it may happen
-     * that bridge port remove will be before vlan member remove and it will
-     * fail. Similar problem is on hard reinit when removing existing objects.
-     *
-     * TODO we need dependency tree during sai discovery! but if we put those
-     * to redis it will cause another problem, since some of those attributes
-     * are create only, so object will be selected to "SET" after vid processing
-     * but it wont be able to set create only attributes, we would need to skip
-     * those.
-     *
-     * XXX this is workaround. FIXME
-     */
+                    if (hasEqualQosMapList(attr.value.qosmap, saiAttr->getSaiAttr()->value.qosmap))
+                    {
+                        sai_deserialize_free_attribute_value(meta->attrvaluetype, attr);
+                        continue;
+                    }
+                }
 
-    std::vector<sai_object_type_t> removeOrder = {
-        SAI_OBJECT_TYPE_VLAN_MEMBER,
-        SAI_OBJECT_TYPE_STP_PORT,
-        SAI_OBJECT_TYPE_BRIDGE_PORT };
+                // free possible allocated lists
 
-    for (const sai_object_type_t ot: removeOrder)
-    {
-        for (const auto &obj: current.getObjectsByObjectType(ot))
-        {
-            if (obj->getObjectStatus() == SAI_OBJECT_STATUS_NOT_PROCESSED)
-            {
-                if (current.getVidReferenceCount(obj->getVid()) == 0)
+                if (status != SAI_STATUS_SUCCESS)
                 {
-                    removeExistingObjectFromCurrentView(current, temp, obj);
+                    SWSS_LOG_ERROR("failed to get %s on %s %s",
+                            meta->attridname,
+                            obj->str_object_id.c_str(),
+                            sai_serialize_status(status).c_str());
+
+                    hasErrors = true;
+
+                    sai_deserialize_free_attribute_value(meta->attrvaluetype, attr);
+                    continue;
                 }
-            }
-        }
-    }
 
-    for (int removed = 1; removed != 0 ;)
-    {
-        removed = 0;
+                const std::string &asicValue = sai_serialize_attr_value(*meta, attr);
 
-        for (const auto &obj: current.getAllNotProcessedObjects())
-        {
-            /*
-             * What can happen during this processing some object state during
-             * processing can change from not processed to removed, if it have
-             * references, currently we are only removing objects with zero
-             * references, so this will not happen but in general case this
-             * will be the case.
-             */
+                sai_deserialize_free_attribute_value(meta->attrvaluetype, attr);
+
+                // pointers will not be equal since those will be from
+                // different process memory maps so just check if both pointers
+                // are NULL or both are SET
 
-            if (obj->isOidObject())
-            {
-                if (current.getVidReferenceCount(obj->getVid()) == 0)
+                if (meta->attrvaluetype == SAI_ATTR_VALUE_TYPE_POINTER)
                 {
-                    /*
-                     * Reference count on this VID is zero, so it's safe to
-                     * remove this object.
-                     */
+                    if (attr.value.ptr == NULL && saiAttr->getSaiAttr()->value.ptr == NULL)
+                        continue;
 
-                    removeExistingObjectFromCurrentView(current, temp, obj);
-                    removed++;
+                    if (attr.value.ptr != NULL && saiAttr->getSaiAttr()->value.ptr != NULL)
+                        continue;
                 }
-            }
-            else
-            {
-                /*
-                 * Non object id objects don't have references count, they are leafs
-                 * so we can remove them right away
-                 */
 
-                removeExistingObjectFromCurrentView(current, temp, obj);
-                removed++;
+                if (asicValue == dbValue)
+                    continue;
+
+                SWSS_LOG_ERROR("value missmatch: %s on %s: ASIC: %s DB: %s, inconsistent state!",
+                        meta->attridname,
+                        obj->str_object_id.c_str(),
+                        asicValue.c_str(),
+                        dbValue.c_str());
+
+                hasErrors = true;
             }
         }
 
-        if (removed)
-        {
-            SWSS_LOG_NOTICE("loop removed %d objects", removed);
-        }
+        swss::Logger::getInstance().setMinPrio(swss::Logger::SWSS_INFO);
     }
 
-    /*
-     * Check statuses will make sure that there are no objects with removed
-     * status.
-     */
-}
-
-void executeOperationsOnAsic(
-        _In_ AsicView &currentView,
-        _In_ AsicView &temporaryView);
+    swss::Logger::getInstance().setMinPrio(swss::Logger::SWSS_NOTICE);
 
-// TODO find better way to access this
-extern std::set<sai_object_id_t> initViewRemovedVidSet;
+    if (hasErrors && g_commandLineOptions->m_enableUnittests)
+    {
+        SWSS_LOG_THROW("ASIC content is differnt than DB content!");
+    }
+}
 
-void populateExistingObjects(
-        _In_ AsicView &currentView,
-        _In_ AsicView &temporaryView,
-        _In_ const std::set<sai_object_id_t> rids)
+void checkMap(
+        _In_ const ObjectIdMap& firstR2V,
+        _In_ const char* firstR2Vname,
+        _In_ const ObjectIdMap& firstV2R,
+        _In_ const char * firstV2Rname,
+        _In_ const ObjectIdMap& secondR2V,
+        _In_ const char* secondR2Vname,
+        _In_ const ObjectIdMap& secondV2R,
+        _In_ const char *secondV2Rname)
 {
     SWSS_LOG_ENTER();
 
-    /*
-     * We should transfer existing objects from current view to temporary view.
-     * But not all objects, since user could remove some default removable
-     * objects like vlan member, bridge port etc. We collected those removed
-     * objects to initViewRemovedVidSet and we will use this as a reference to
-     * transfer objects to temporary view.
-     *
-     * TODO: still sairedis metadata database have no idea about existing
-     * objects so user can create object which already exists like vlan 1 if he
-     * didn't queried it yet. We need to transfer all dependency tree to
-     * sairedis after switch create.
-     */
-
-    if (temporaryView.getObjectsByObjectType(SAI_OBJECT_TYPE_SWITCH).size() == 0)
+    for (auto it: firstR2V)
     {
-        SWSS_LOG_NOTICE("no switch present in temporary view, skipping");
-        return;
-    }
+        sai_object_id_t r = it.first;
+        sai_object_id_t v = it.second;
 
-    // XXX we have only 1 switch, so we can get away with this
+        if (firstV2R.find(v) == firstV2R.end())
+            SWSS_LOG_ERROR("%s (0x%" PRIx64 ":0x%" PRIx64 ") is missing from %s", firstR2Vname, r, v, firstV2Rname);
+        else if (firstV2R.at(v) != r)
+            SWSS_LOG_ERROR("mismatch on %s (0x%" PRIx64 ":0x%" PRIx64 ") vs %s (0x%" PRIx64 ":0x%" PRIx64 ")", firstR2Vname, r, v, firstV2Rname, v, firstV2R.at(v));
 
-    auto sw = switches.begin()->second;
+        if (secondR2V.find(r) == secondR2V.end())
+            SWSS_LOG_ERROR("%s (0x%" PRIx64 ":0x%" PRIx64 ") is missing from %s", firstR2Vname, r, v, secondR2Vname);
+        else if (secondV2R.find(secondR2V.at(r)) == secondV2R.end())
+            SWSS_LOG_ERROR("%s (0x%" PRIx64 ":0x%" PRIx64 ") is missing from %s", firstR2Vname, r, secondR2V.at(r), secondV2Rname);
+    }
+}
 
-    auto coldBootDiscoveredVids = sw->getColdBootDiscoveredVids();
-    auto warmBootDiscoveredVids = sw->getWarmBootDiscoveredVids();
+void createPreMatchMapForObject(
+        _In_ const AsicView& cur,
+        _Inout_ AsicView& tmp,
+        _In_ std::shared_ptr<const SaiObj> cObj,
+        _In_ std::shared_ptr<const SaiObj> tObj,
+        _Inout_ std::set<std::string>& processed)
+{
+    SWSS_LOG_ENTER();
 
-    /*
-     * If some objects that are existing objects on switch are not present in
-     * temporary view, just populate them with empty values.  Since vid2rid
-     * maps must match on both view after apply view.
-     */
+    if (processed.find(tObj->str_object_id) != processed.end())
+        return;
 
-    for (const sai_object_id_t rid: rids)
-    {
-        if (rid == SAI_NULL_OBJECT_ID)
-        {
-            continue;
-        }
+    processed.insert(tObj->str_object_id);
 
-        /*
-         * Rid's are not matched yet, but if VID is the same then we have the
-         * same object.
-         */
+    if (cObj->getObjectType() != tObj->getObjectType())
+        return;
 
-        if (temporaryView.hasRid(rid))
-        {
-            continue;
-        }
+    // this object is matched, so it have same vid/rid in both views
+    // but it can have attributes with objects which are not matched
+    // for those we want to create pre match map
 
-        auto it = currentView.ridToVid.find(rid);
+    for (auto& ak: tObj->getAllAttributes())
+    {
+        auto id = ak.first;
+        const auto& tAttr = ak.second;
 
-        if (it == currentView.ridToVid.end())
-        {
-            SWSS_LOG_THROW("unable to find existing object RID %s in current view",
-                    sai_serialize_object_id(rid).c_str());
-        }
+        if (cObj->hasAttr(id) == false)
+            continue;
 
-        sai_object_id_t vid = it->second;
+        // both objects has the same attribute
 
-        if (initViewRemovedVidSet.find(vid) != initViewRemovedVidSet.end())
-        {
-            /*
-             * If this vid was removed during init view mode, it still exits in
-             * current view, but don't put it to existing objects, then
-             * comparison logic will take care of that and, it will remove it
-             * from current view as well.
-             */
+        const auto& cAttr = cObj->getSaiAttr(id);
 
-            continue;
-        }
+        const auto& tVids = tAttr->getOidListFromAttribute();
+        const auto& cVids = cAttr->getOidListFromAttribute();
 
-        /*
-         * In case of warm boot, it may happen that user set some created
-         * objects on default existing objects, like for example buffer profile
-         * on ingress priority group.  In this case buffer profile should not
-         * be considered as matched object and copied to temporary view, since
-         * this object was not default existing object (on 1st cold boot) so in
-         * this case it must be processed by comparison logic and matched with
-         * possible new buffer profile created in temporary view. This may
-         * happen if OA will not care what was set previously on ingress
-         * priority group and just create new buffer profile and assign it.  In
-         * this case we don't want any asic operations to happen.  Also if we
-         * would pass this buffer profile as existing to temporary view, it
-         * would not be matched by comparison logic, and in the result we will
-         * end up with 2 buffer profiles, which 1st of them will be not
-         * assigned anywhere and this will be memory leak.
-         *
-         * Also a bunch of new asic operations will be generated for setting
-         * new user created buffer profile.  That's why we need default existing
-         * vid list to distinguish between user created and default switch
-         * created objects.
-         *
-         * For default existing objects, we don't need to copy attributes, since
-         * if user didn't set them, we want them to be back to default values.
-         *
-         * NOTE: If we are here, then this RID exists only in current view, and
-         * if this object contains any OID attributes, discovery logic queried
-         * them so they are also existing in current view.
-         *
-         * Also in warm boot, when user removed port, and then created some new
-         * ports, new QUEUEs, IPGs and SGs will be created automatically by
-         * SAI.  Those new created objects mot likely will have different RID
-         * values then previous instances for given port. Those values should
-         * also be copied to temporary view, since they will not exist on cold
-         * boot discovered VIDs. If not, then comparison logic will try to remove
-         * them which is not what we want.
-         *
-         * This is tricky scenario, and there could be some issues also when
-         * other object types would be created by user.
-         */
+        if (tVids.size() != cVids.size())
+            continue; // if number of attributes is different then skip
 
-        bool performColdCheck = true;
+        if (tVids.size() != 1)
+            continue; // for now skip list attributes
 
-        if (warmBootDiscoveredVids.find(vid) != warmBootDiscoveredVids.end())
+        for (size_t i = 0; i < tVids.size(); ++i)
         {
-            sai_object_type_t ot = redis_sai_object_type_query(vid);
-
-            switch (ot)
-            {
-                case SAI_OBJECT_TYPE_QUEUE:
-                case SAI_OBJECT_TYPE_INGRESS_PRIORITY_GROUP:
-                case SAI_OBJECT_TYPE_SCHEDULER_GROUP:
-
-                    // TODO this case may require adjustment, if user will do a
-                    // warm boot then remove/add some ports and make another
-                    // warm boot, it may happen that current logic will be
-                    // confused which of those objects are from previous warm
-                    // boot or second one, need better way to mark changes to
-                    // those objects in redis DB between warm boots
+            sai_object_id_t tVid = tVids[i];
+            sai_object_id_t cVid = cVids[i];
 
-                    performColdCheck = false;
+            if (tVid == SAI_NULL_OBJECT_ID || cVid == SAI_NULL_OBJECT_ID)
+                continue;
 
-                    break;
-                default:
-                    break;
-            }
-        }
+            if (tmp.preMatchMap.find(tVid) != tmp.preMatchMap.end())
+                continue;
 
-        if (performColdCheck && coldBootDiscoveredVids.find(vid) == coldBootDiscoveredVids.end())
-        {
-            SWSS_LOG_INFO("object is not on default existing list: %s RID %s VID %s",
-                    sai_serialize_object_type(sai_object_type_query(rid)).c_str(),
-                    sai_serialize_object_id(rid).c_str(),
-                    sai_serialize_object_id(vid).c_str());
+            // since on one attribute sometimes different object types can be set
+            // check if both object types are correct
 
-            continue;
-        }
+            if (cur.oOids.at(cVid)->getObjectType() != tmp.oOids.at(tVid)->getObjectType())
+                continue;
 
-        temporaryView.createDummyExistingObject(rid, vid);
+            SWSS_LOG_INFO("inserting pre match entry for %s:%s: 0x%" PRIx64 " (tmp) -> 0x%" PRIx64 " (cur)",
+                    tObj->str_object_id.c_str(),
+                    cAttr->getAttrMetadata()->attridname,
+                    tVid,
+                    cVid);
 
-        SWSS_LOG_INFO("populate existing %s RID %s VID %s",
-                sai_serialize_object_type(sai_object_type_query(rid)).c_str(),
-                sai_serialize_object_id(rid).c_str(),
-                sai_serialize_object_id(vid).c_str());
+            tmp.preMatchMap[tVid] = cVid;
 
-        /*
-         * Move both objects to matched state since match oids was already
-         * called, and here we created some new objects that should be matched.
-         */
+            // continue recursively through object dependency tree:
 
-        currentView.oOids.at(vid)->setObjectStatus(SAI_OBJECT_STATUS_MATCHED);
-        temporaryView.oOids.at(vid)->setObjectStatus(SAI_OBJECT_STATUS_MATCHED);
+            createPreMatchMapForObject(cur, tmp, cur.oOids.at(cVid), tmp.oOids.at(tVid), processed);
+        }
     }
 }
 
-void updateRedisDatabase(
-        _In_ const AsicView &currentView,
-        _In_ const AsicView &temporaryView)
+void createPreMatchMap(
+        _In_ const AsicView& cur,
+        _Inout_ AsicView& tmp)
 {
     SWSS_LOG_ENTER();
 
     /*
-     * TODO: We can make LUA script for this which will be much faster.
+     * When comparison logic is running on object A it runs recursively on each
+     * object that was fount in object A attributes, because we need to make
+     * sure all objects are matched before actually processing object A.  For
+     * example before processing ROUTE_ENTRY, we process first NEXT_HOP and
+     * before that REOUTER_INTERFACE and before that PORT. Object processing
+     * could be described going from down to top. But figuring out for top
+     * object ex. WRED could be hard since we would need to check not matched
+     * yet buffer profile and buffer pool before we use QUEUE or IPG as an
+     * anchor object. We can actually leverage that and when processing graph
+     * from top to bottom, we can create helper map which will contain
+     * predictions which object will be suitable for current processing
+     * objects. We can have N candidates objects and instead of choosing 1 at
+     * random, to reduce number of ASIC operations we will use a pre match map
+     * which is created in this method.
      *
-     * TODO: This needs to be updated if we want to support multiple switches.
+     * This map should be almost exact match in warn boot case, but it will be
+     * treated only as hint, not as actual mapping.
+     *
+     * We will create map for all matched objects and for route_entry,
+     * fdb_entry and neighbor_entry.
      */
 
-    SWSS_LOG_TIMER("redis update");
-
-    /*
-     * Remove Asic State Table
-     */
+    std::set<std::string> processed;
 
-    const auto &asicStateKeys = g_redisClient->keys(ASIC_STATE_TABLE + std::string(":*"));
+    SWSS_LOG_TIMER("create preMatch map");
 
-    for (const auto &key: asicStateKeys)
+    for (auto& ok: tmp.soAll)
     {
-        g_redisClient->del(key);
-    }
+        auto& tObj = ok.second;
 
-    /*
-     * Remove Temp Asic State Table
-     */
+        if (tObj->getObjectStatus() != SAI_OBJECT_STATUS_MATCHED)
+            continue;
 
-    const auto &tempAsicStateKeys = g_redisClient->keys(TEMP_PREFIX ASIC_STATE_TABLE + std::string(":*"));
+        sai_object_id_t cObjVid = cur.ridToVid.at(tmp.vidToRid.at(tObj->getVid()));
 
-    for (const auto &key: tempAsicStateKeys)
-    {
-        g_redisClient->del(key);
-    }
+        auto& cObj = cur.oOids.at(cObjVid);
 
-    /*
-     * Save temporary view as current view in redis database.
-     */
+        createPreMatchMapForObject(cur, tmp, cObj, tObj, processed);
+    }
 
-    for (const auto &pair: temporaryView.soAll)
+    for (auto&pk: tmp.routesByPrefix)
     {
-        const auto &obj = pair.second;
+        auto& prefix = pk.first;
+
+        // look only for unique prefixes
 
-        const auto &attr = obj->getAllAttributes();
+        if (pk.second.size() != 1)
+            continue;
 
-        std::string key = std::string(ASIC_STATE_TABLE) + ":" + obj->str_object_type + ":" + obj->str_object_id;
+        auto it = cur.routesByPrefix.find(prefix);
 
-        SWSS_LOG_DEBUG("setting key %s", key.c_str());
+        if (it == cur.routesByPrefix.end())
+            continue;
 
-        if (attr.size() == 0)
-        {
-            /*
-             * Object has no attributes, so populate using NULL just to
-             * indicate that object exists.
-             */
+        if (it->second.size() != 1)
+            continue;
 
-            g_redisClient->hset(key, "NULL", "NULL");
-        }
-        else
-        {
-            for (const auto &ap: attr)
-            {
-                const auto saiAttr = ap.second;
+        auto& tObj = tmp.soAll.at(pk.second.at(0));
+        auto& cObj = cur.soAll.at(it->second.at(0));
 
-                g_redisClient->hset(key, saiAttr->getStrAttrId(), saiAttr->getStrAttrValue());
-            }
-        }
+        createPreMatchMapForObject(cur, tmp, cObj, tObj, processed);
     }
 
-    /*
-     * Remove previous RID2VID maps and apply new map.
-     *
-     * TODO: This needs to be done per switch, we can't remove all maps.
-     */
-
-    redisClearVidToRidMap();
-    redisClearRidToVidMap();
+    size_t count = 0;
 
-    for (auto &kv: temporaryView.ridToVid)
+    for (auto& ok: tmp.soOids)
     {
-        std::string strVid = sai_serialize_object_id(kv.second);
-        std::string strRid = sai_serialize_object_id(kv.first);
-
-        g_redisClient->hset(VIDTORID, strVid, strRid);
-        g_redisClient->hset(RIDTOVID, strRid, strVid);
+        if (ok.second->getObjectStatus() != SAI_OBJECT_STATUS_MATCHED)
+            count++;
     }
 
-    SWSS_LOG_NOTICE("updated redis database");
+    SWSS_LOG_NOTICE("preMatch map size: %zu, tmp oid obj: %zu",
+            tmp.preMatchMap.size(),
+            count);
 }
 
-void logViewObjectCount(
-        _In_ const AsicView &currentView,
-        _In_ const AsicView &temporaryView)
+sai_status_t syncdApplyView()
 {
     SWSS_LOG_ENTER();
 
-    bool asic_changes = false;
-
-    for (int i = SAI_OBJECT_TYPE_NULL + 1; i < SAI_OBJECT_TYPE_EXTENSIONS_MAX; i++)
+    if (enableRefernceCountLogs)
     {
-        sai_object_type_t ot = (sai_object_type_t)i;
+        dump_object_reference();
+    }
 
-        size_t c = currentView.getObjectsByObjectType(ot).size();
-        size_t t = temporaryView.getObjectsByObjectType(ot).size();
+    SWSS_LOG_TIMER("apply");
 
-        if (c == t)
-            continue;
+    /*
+     * We assume that there will be no case that we will move from 1 to 0, also
+     * if at the beginning there is no switch, then when user will send create,
+     * and it will be actually created (real call) so there should be no case
+     * when we are moving from 0 -> 1.
+     */
 
-        asic_changes = true;
+    /*
+     * This method contains 2 stages.
+     *
+     * First stage is non destructive, when orchagent will build new view, and
+     * there will be bug in comparison logic in first stage, then syncd will
+     * send failure when doing apply view to orchagent but it will still be
+     * running. No asic operations are performed during this stage.
+     *
+     * Second stage is destructive, so if there will be bug in comparison logic
+     * or any asic operation will fail, then syncd will crash, since asic will
+     * be in inconsistent state.
+     */
 
-        SWSS_LOG_WARN("object count for %s on current view %zu is differnt than on temporary view: %zu",
-                sai_serialize_object_type(ot).c_str(),
-                c,
-                t);
-    }
+    /*
+     * Initialize rand for future candidate object selection if necessary.
+     *
+     * NOTE: Should this be deterministic? So we could repeat random choice
+     * when something bad happen or we hit a bug, so in that case it will be
+     * easier for reproduce, we could at least log value returned from time().
+     *
+     * TODO: To make it stable, we also need to make stable redisGetAsicView
+     * since now order of items is random. Also redis result needs to be
+     * sorted.
+     */
 
-    if (asic_changes)
-    {
-        SWSS_LOG_WARN("object count is differnt on both view, there will be ASIC OPERATIONS!");
-    }
-}
+    std::srand((unsigned int)std::time(0));
 
-void checkAsicVsDatabaseConsistency(
-        _In_ const AsicView &cur,
-        _In_ const AsicView &tmp)
-{
-    SWSS_LOG_ENTER();
+    /*
+     * NOTE: Current view can contain multiple switches at once but in our
+     * implementation we only will have 1 switch.
+     */
 
-    bool hasErrors = false;
+    AsicView current;
+    AsicView temp;
 
-    {
-        SWSS_LOG_TIMER("consistency check");
+    /*
+     * We are starting first stage here, it still can throw exceptions but it's
+     * non destructive for ASIC, so just catch and return failure.
+     */
 
-        SWSS_LOG_WARN("performing consistency check");
+    try
+    {
+        /*
+         * NOTE: Need to be per switch. Asic view may contain multiple switches.
+         *
+         * In our current solution we will deal with only one switch, since
+         * supporting multiple switches will have serious impact on redesign
+         * current implementation.
+         */
 
-        for (const auto &pair: tmp.soAll)
+        if (switches.size() != 1)
         {
-            const auto &obj = pair.second;
+            /*
+             * NOTE: In our solution multiple switches are not supported.
+             */
 
-            const auto &attrs = obj->getAllAttributes();
+            SWSS_LOG_THROW("only one switch is expected, got: %zu switches", switches.size());
+        }
 
-            // get object meta key for get (object id or *entry)
+        // XXX we have only 1 switch, so we can get away with this
 
-            sai_object_meta_key_t meta_key = obj->meta_key;
+        auto sw = switches.begin()->second;
 
-            // translate all VID's to RIDs in non object is's
+        ObjectIdMap vidToRidMap = sw->redisGetVidToRidMap();
+        ObjectIdMap ridToVidMap = sw->redisGetRidToVidMap();
 
-            translate_vid_to_rid_non_object_id(meta_key);
+        current.ridToVid = ridToVidMap;
+        current.vidToRid = vidToRidMap;
 
-            auto info = sai_metadata_get_object_type_info(obj->getObjectType());
+        /*
+         * Those calls could be calls to SAI, but when this will be separate lib
+         * then we would like to limit sai to minimum or reimplement getting those.
+         *
+         * TODO: This needs to be refactored and solved in other way since asic
+         * view can contain multiple switches.
+         *
+         * TODO: This also can be optimized using metadata.
+         * We need to add access to SaiSwitch in AsicView.
+         */
 
-            sai_attribute_t attr;
+        // TODO needs to be removed and done in generic
+        current.defaultTrapGroupRid     = sw->getSwitchDefaultAttrOid(SAI_SWITCH_ATTR_DEFAULT_TRAP_GROUP);
+        temp.defaultTrapGroupRid        = current.defaultTrapGroupRid;
 
-            memset(&attr, 0, sizeof(attr));
+        /*
+         * Read current and temporary view from REDIS.
+         */
 
-            if (attrs.size() == 0)
-            {
-                // get first attribute and do a get query to see if object exist's
+        redisGetAsicViews(current, temp);
 
-                auto meta = info->attrmetadata[0];
+        /*
+         * Match oids before calling populate existing objects since after
+         * matching oids RID and VID maps will be populated.
+         */
 
-                sai_status_t status = info->get(&meta_key, 1, &attr);
+        matchOids(current, temp);
+
+        /*
+         * Populate existing objects to current and temp view if they don't
+         * exist since we are populating them when syncd starts, and when we
+         * switch view we don't want to loose any of those objects since during
+         * syncd runtime is counting on that those objects exists.
+         *
+         * TODO: If some object's will be removed like VLAN members then this
+         * existing objects needs to be updated in the switch!
+         */
+
+        const auto &existingObjects = sw->getDiscoveredRids();
+
+        populateExistingObjects(current, temp, existingObjects);
+
+        checkInternalObjects(current, temp);
+
+        /*
+         * Call main method!
+         */
+
+        if (enableRefernceCountLogs)
+        {
+            current.dumpRef("current START");
+            temp.dumpRef("temp START");
+        }
 
-                switch (status)
-                {
-                    case SAI_STATUS_SUCCESS:
-                    case SAI_STATUS_BUFFER_OVERFLOW:
-                        continue;
+        createPreMatchMap(current, temp);
 
-                    case SAI_STATUS_NOT_IMPLEMENTED:
-                    case SAI_STATUS_NOT_SUPPORTED:
+        logViewObjectCount(current, temp);
 
-                        SWSS_LOG_WARN("GET api for %s is not implemented on %s",
-                                meta->attridname,
-                                obj->str_object_id.c_str());
-                    continue;
-                }
+        applyViewTransition(current, temp);
 
-                SWSS_LOG_ERROR("failed to get %s on %s: %s",
-                        meta->attridname,
-                        obj->str_object_id.c_str(),
-                        sai_serialize_status(status).c_str());
+        SWSS_LOG_NOTICE("ASIC operations to execute: %zu", current.asicGetOperationsCount());
 
-                hasErrors = true;
+        checkObjectsStatus(temp);
 
-                continue;
-            }
+        SWSS_LOG_NOTICE("all temporary view objects were processed to FINAL state");
 
-            for (const auto &ap: attrs)
-            {
-                const auto &saiAttr = ap.second;
+        checkObjectsStatus(current);
 
-                auto meta = saiAttr->getAttrMetadata();
+        SWSS_LOG_NOTICE("all current view objects were processed to FINAL state");
 
-                // deserialize existing attribute so deserialize will allocate
-                // memory for all list's
+        /*
+         * After all operations both views should look the same so number of
+         * rid/vid should look the same.
+         */
 
-                attr.id = meta->attrid;
+        if ((current.ridToVid.size() != temp.ridToVid.size()) ||
+                (current.vidToRid.size() != temp.vidToRid.size()))
+        {
+            /*
+             * Check all possible differences.
+             */
 
-                sai_deserialize_attr_value(saiAttr->getStrAttrValue(), *meta, attr, false);
+            checkMap(current.ridToVid, "current R2V", current.vidToRid, "current V2R", temp.ridToVid, "temp R2V", temp.vidToRid, "temp V2R");
+            checkMap(temp.ridToVid, "temp R2V", temp.vidToRid, "temp V2R", current.ridToVid, "current R2V", current.vidToRid, "current V2R");
 
-                // translate all VIDs from DB to RIDs for compare
+            current.dumpVidToAsicOperatioId();
 
-                translate_vid_to_rid_list(obj->getObjectType(), 1, &attr);
+            SWSS_LOG_THROW("wrong number of vid/rid items in map, forgot to translate? R2V: %zu:%zu, V2R: %zu:%zu, FIXME",
+                    current.ridToVid.size(),
+                    temp.ridToVid.size(),
+                    current.vidToRid.size(),
+                    temp.vidToRid.size());
+        }
 
-                // get attr value with RIDs
+        /*
+         * At the end number of soAll objects must be equal on both views. If
+         * some on temporary views are missing, we need to transport empty
+         * objects to temporary view, like queues, scheduler groups, virtual
+         * router, trap groups etc.
+         */
 
-                const std::string& dbValue = sai_serialize_attr_value(*meta, attr);
+        if (current.soAll.size() != temp.soAll.size())
+        {
+            /*
+             * If this will happen that means non object id values are
+             * different since number of RID/VID maps is identical (previous
+             * check).
+             *
+             * Unlikely to be routes/neighbors/fdbs, can be traps, switch,
+             * vlan.
+             *
+             * TODO: For debug we will need to display differences
+             */
 
-                sai_status_t status = info->get(&meta_key, 1, &attr);
+            SWSS_LOG_THROW("wrong number of all objects current: %zu vs temp %zu, FIXME",
+                    current.soAll.size(),
+                    temp.soAll.size());
+        }
+    }
+    catch (const std::exception &e)
+    {
+        /*
+         * Exception was thrown in first stage, those were non destructive
+         * actions so just log exception and let syncd running.
+         */
 
-                if (meta->attrid == SAI_QOS_MAP_ATTR_MAP_TO_VALUE_LIST && meta->objecttype == SAI_OBJECT_TYPE_QOS_MAP && status == SAI_STATUS_SUCCESS)
-                {
-                    // order does not matter on this list
+        SWSS_LOG_ERROR("Exception: %s", e.what());
 
-                    if (hasEqualQosMapList(attr.value.qosmap, saiAttr->getSaiAttr()->value.qosmap))
-                    {
-                        sai_deserialize_free_attribute_value(meta->attrvaluetype, attr);
-                        continue;
-                    }
-                }
+        return SAI_STATUS_FAILURE;
+    }
 
-                // free possible allocated lists
+    /*
+     * This is second stage. Those operations are destructive, if any of them
+     * fail, then we will have inconsistent state in ASIC.
+     */
 
-                if (status != SAI_STATUS_SUCCESS)
-                {
-                    SWSS_LOG_ERROR("failed to get %s on %s %s",
-                            meta->attridname,
-                            obj->str_object_id.c_str(),
-                            sai_serialize_status(status).c_str());
+    executeOperationsOnAsic(current, temp);
 
-                    hasErrors = true;
+    updateRedisDatabase(current, temp);
 
-                    sai_deserialize_free_attribute_value(meta->attrvaluetype, attr);
-                    continue;
-                }
+    if (g_commandLineOptions->m_enableConsistencyCheck)
+    {
+        checkAsicVsDatabaseConsistency(current, temp);
+    }
 
-                const std::string &asicValue = sai_serialize_attr_value(*meta, attr);
+    return SAI_STATUS_SUCCESS;
+}
 
-                sai_deserialize_free_attribute_value(meta->attrvaluetype, attr);
+/*
+ * Below we will duplicate asic execution logic for asic operations.
+ *
+ * Since we have objects on our disposal and actual attributes, we don't need
+ * to do serialize/deserialize twice, we can take advantage of that.
+ * Only VID to RID translation is needed, and GET api is not supported
+ * anyway since comparison logic will do only SET/REMOVE/CREATE then
+ * all objects can be set to consts.
+ *
+ * We can address that when actual asic switch will be more time
+ * consuming than we expect.
+ *
+ * NOTE: Also instead of passing views everywhere we could close this in a
+ * class that will have 2 members current and temporary view. This could be
+ * helpful when we will have to manage multiple switches at the same time.
+ */
 
-                // pointers will not be equal since those will be from
-                // different process memory maps so just check if both pointers
-                // are NULL or both are SET
+sai_object_id_t asic_translate_vid_to_rid(
+        _In_ const AsicView &current,
+        _In_ const AsicView &temporary,
+        _In_ sai_object_id_t vid)
+{
+    SWSS_LOG_ENTER();
 
-                if (meta->attrvaluetype == SAI_ATTR_VALUE_TYPE_POINTER)
-                {
-                    if (attr.value.ptr == NULL && saiAttr->getSaiAttr()->value.ptr == NULL)
-                        continue;
+    if (vid == SAI_NULL_OBJECT_ID)
+    {
+        return SAI_NULL_OBJECT_ID;
+    }
 
-                    if (attr.value.ptr != NULL && saiAttr->getSaiAttr()->value.ptr != NULL)
-                        continue;
-                }
+    auto currentIt = current.vidToRid.find(vid);
 
-                if (asicValue == dbValue)
-                    continue;
+    if (currentIt == current.vidToRid.end())
+    {
+        /*
+         * If object was removed it RID was moved to removed map.  This is
+         * required since at the end we need to check whether rid/vid maps are
+         * the same for both views.
+         */
 
-                SWSS_LOG_ERROR("value missmatch: %s on %s: ASIC: %s DB: %s, inconsistent state!",
-                        meta->attridname,
-                        obj->str_object_id.c_str(),
-                        asicValue.c_str(),
-                        dbValue.c_str());
+        currentIt = current.removedVidToRid.find(vid);
 
-                hasErrors = true;
-            }
+        if (currentIt == current.removedVidToRid.end())
+        {
+            SWSS_LOG_THROW("unable to find VID %s in current view",
+                    sai_serialize_object_id(vid).c_str());
         }
-
-        swss::Logger::getInstance().setMinPrio(swss::Logger::SWSS_INFO);
     }
 
-    swss::Logger::getInstance().setMinPrio(swss::Logger::SWSS_NOTICE);
+    sai_object_id_t rid = currentIt->second;
 
-    if (hasErrors && g_commandLineOptions->m_enableUnittests)
-    {
-        SWSS_LOG_THROW("ASIC content is differnt than DB content!");
-    }
+    SWSS_LOG_INFO("translated VID 0x%" PRIx64 " to RID 0x%" PRIx64, vid, rid);
+
+    return rid;
 }
 
-void checkMap(
-        _In_ const ObjectIdMap& firstR2V,
-        _In_ const char* firstR2Vname,
-        _In_ const ObjectIdMap& firstV2R,
-        _In_ const char * firstV2Rname,
-        _In_ const ObjectIdMap& secondR2V,
-        _In_ const char* secondR2Vname,
-        _In_ const ObjectIdMap& secondV2R,
-        _In_ const char *secondV2Rname)
+void asic_translate_list_vid_to_rid(
+        _In_ const AsicView &current,
+        _In_ const AsicView &temporary,
+        _Inout_ sai_object_list_t &element)
 {
     SWSS_LOG_ENTER();
 
-    for (auto it: firstR2V)
+    for (uint32_t i = 0; i < element.count; i++)
     {
-        sai_object_id_t r = it.first;
-        sai_object_id_t v = it.second;
-
-        if (firstV2R.find(v) == firstV2R.end())
-            SWSS_LOG_ERROR("%s (0x%" PRIx64 ":0x%" PRIx64 ") is missing from %s", firstR2Vname, r, v, firstV2Rname);
-        else if (firstV2R.at(v) != r)
-            SWSS_LOG_ERROR("mismatch on %s (0x%" PRIx64 ":0x%" PRIx64 ") vs %s (0x%" PRIx64 ":0x%" PRIx64 ")", firstR2Vname, r, v, firstV2Rname, v, firstV2R.at(v));
-
-        if (secondR2V.find(r) == secondR2V.end())
-            SWSS_LOG_ERROR("%s (0x%" PRIx64 ":0x%" PRIx64 ") is missing from %s", firstR2Vname, r, v, secondR2Vname);
-        else if (secondV2R.find(secondR2V.at(r)) == secondV2R.end())
-            SWSS_LOG_ERROR("%s (0x%" PRIx64 ":0x%" PRIx64 ") is missing from %s", firstR2Vname, r, secondR2V.at(r), secondV2Rname);
+        element.list[i] = asic_translate_vid_to_rid(current, temporary, element.list[i]);
     }
 }
 
-void createPreMatchMapForObject(
-        _In_ const AsicView& cur,
-        _Inout_ AsicView& tmp,
-        _In_ std::shared_ptr<const SaiObj> cObj,
-        _In_ std::shared_ptr<const SaiObj> tObj,
-        _Inout_ std::set<std::string>& processed)
+void asic_translate_vid_to_rid_list(
+        _In_ const AsicView &current,
+        _In_ const AsicView &temporary,
+        _In_ sai_object_type_t object_type,
+        _In_ uint32_t attr_count,
+        _Inout_ sai_attribute_t *attr_list)
 {
     SWSS_LOG_ENTER();
 
-    if (processed.find(tObj->str_object_id) != processed.end())
-        return;
+    /*
+     * All id's received from view should be virtual, so lets translate them to
+     * real id's.
+     */
 
-    processed.insert(tObj->str_object_id);
+    for (uint32_t i = 0; i < attr_count; i++)
+    {
+        sai_attribute_t &attr = attr_list[i];
+
+        auto meta = sai_metadata_get_attr_metadata(object_type, attr.id);
+
+        // this should not happen we should get list right away from SaiAttr
+
+        if (meta == NULL)
+        {
+            SWSS_LOG_THROW("unable to get metadata for object type %s, attribute %d",
+                    sai_serialize_object_type(object_type).c_str(),
+                    attr.id);
 
-    if (cObj->getObjectType() != tObj->getObjectType())
-        return;
+            /*
+             * Asic will be in inconsistent state at this point
+             */
+        }
 
-    // this object is matched, so it have same vid/rid in both views
-    // but it can have attributes with objects which are not matched
-    // for those we want to create pre match map
+        switch (meta->attrvaluetype)
+        {
+            case SAI_ATTR_VALUE_TYPE_OBJECT_ID:
+                attr.value.oid = asic_translate_vid_to_rid(current, temporary, attr.value.oid);
+                break;
 
-    for (auto& ak: tObj->getAllAttributes())
-    {
-        auto id = ak.first;
-        const auto& tAttr = ak.second;
+            case SAI_ATTR_VALUE_TYPE_OBJECT_LIST:
+                asic_translate_list_vid_to_rid(current, temporary, attr.value.objlist);
+                break;
 
-        if (cObj->hasAttr(id) == false)
-            continue;
+            case SAI_ATTR_VALUE_TYPE_ACL_FIELD_DATA_OBJECT_ID:
 
-        // both objects has the same attribute
+                if (attr.value.aclfield.enable)
+                {
+                    attr.value.aclfield.data.oid = asic_translate_vid_to_rid(current, temporary, attr.value.aclfield.data.oid);
+                }
 
-        const auto& cAttr = cObj->getSaiAttr(id);
+                break;
 
-        const auto& tVids = tAttr->getOidListFromAttribute();
-        const auto& cVids = cAttr->getOidListFromAttribute();
+            case SAI_ATTR_VALUE_TYPE_ACL_FIELD_DATA_OBJECT_LIST:
 
-        if (tVids.size() != cVids.size())
-            continue; // if number of attributes is different then skip
+                if (attr.value.aclfield.enable)
+                {
+                    asic_translate_list_vid_to_rid(current, temporary, attr.value.aclfield.data.objlist);
+                }
 
-        if (tVids.size() != 1)
-            continue; // for now skip list attributes
+                break;
 
-        for (size_t i = 0; i < tVids.size(); ++i)
-        {
-            sai_object_id_t tVid = tVids[i];
-            sai_object_id_t cVid = cVids[i];
+            case SAI_ATTR_VALUE_TYPE_ACL_ACTION_DATA_OBJECT_ID:
 
-            if (tVid == SAI_NULL_OBJECT_ID || cVid == SAI_NULL_OBJECT_ID)
-                continue;
+                if (attr.value.aclaction.enable)
+                {
+                    attr.value.aclaction.parameter.oid = asic_translate_vid_to_rid(current, temporary, attr.value.aclaction.parameter.oid);
+                }
 
-            if (tmp.preMatchMap.find(tVid) != tmp.preMatchMap.end())
-                continue;
+                break;
 
-            // since on one attribute sometimes different object types can be set
-            // check if both object types are correct
+            case SAI_ATTR_VALUE_TYPE_ACL_ACTION_DATA_OBJECT_LIST:
 
-            if (cur.oOids.at(cVid)->getObjectType() != tmp.oOids.at(tVid)->getObjectType())
-                continue;
+                if (attr.value.aclaction.enable)
+                {
+                    asic_translate_list_vid_to_rid(current, temporary, attr.value.aclaction.parameter.objlist);
+                }
 
-            SWSS_LOG_INFO("inserting pre match entry for %s:%s: 0x%" PRIx64 " (tmp) -> 0x%" PRIx64 " (cur)",
-                    tObj->str_object_id.c_str(),
-                    cAttr->getAttrMetadata()->attridname,
-                    tVid,
-                    cVid);
+                break;
 
-            tmp.preMatchMap[tVid] = cVid;
+            default:
 
-            // continue recursively through object dependency tree:
+                if (meta->isoidattribute)
+                {
+                    SWSS_LOG_THROW("attribute %s is oid attribute, but not handled, FIXME", meta->attridname);
+                }
 
-            createPreMatchMapForObject(cur, tmp, cur.oOids.at(cVid), tmp.oOids.at(tVid), processed);
+                break;
         }
     }
 }
 
-void createPreMatchMap(
-        _In_ const AsicView& cur,
-        _Inout_ AsicView& tmp)
+sai_status_t asic_handle_generic(
+        _In_ AsicView &current,
+        _In_ AsicView &temporary,
+        _In_ sai_object_meta_key_t &meta_key,
+        _In_ sai_common_api_t api,
+        _In_ uint32_t attr_count,
+        _In_ const sai_attribute_t *attr_list)
 {
     SWSS_LOG_ENTER();
 
+    SWSS_LOG_DEBUG("generic %s for %s",
+            sai_serialize_common_api(api).c_str(),
+            sai_serialize_object_type(meta_key.objecttype).c_str());
+
     /*
-     * When comparison logic is running on object A it runs recursively on each
-     * object that was fount in object A attributes, because we need to make
-     * sure all objects are matched before actually processing object A.  For
-     * example before processing ROUTE_ENTRY, we process first NEXT_HOP and
-     * before that REOUTER_INTERFACE and before that PORT. Object processing
-     * could be described going from down to top. But figuring out for top
-     * object ex. WRED could be hard since we would need to check not matched
-     * yet buffer profile and buffer pool before we use QUEUE or IPG as an
-     * anchor object. We can actually leverage that and when processing graph
-     * from top to bottom, we can create helper map which will contain
-     * predictions which object will be suitable for current processing
-     * objects. We can have N candidates objects and instead of choosing 1 at
-     * random, to reduce number of ASIC operations we will use a pre match map
-     * which is created in this method.
-     *
-     * This map should be almost exact match in warn boot case, but it will be
-     * treated only as hint, not as actual mapping.
+     * If we will use split for generics we can avoid meta key if we will
+     * generate inside metadata generic pointers for all oid objects + switch
+     * special method.
      *
-     * We will create map for all matched objects and for route_entry,
-     * fdb_entry and neighbor_entry.
+     * And this needs to be executed in sai_meta_apis_query.
      */
 
-    std::set<std::string> processed;
+    auto info = sai_metadata_get_object_type_info(meta_key.objecttype);
 
-    SWSS_LOG_TIMER("create preMatch map");
+    sai_object_id_t object_id = meta_key.objectkey.key.object_id;
 
-    for (auto& ok: tmp.soAll)
+    switch (api)
     {
-        auto& tObj = ok.second;
-
-        if (tObj->getObjectStatus() != SAI_OBJECT_STATUS_MATCHED)
-            continue;
-
-        sai_object_id_t cObjVid = cur.ridToVid.at(tmp.vidToRid.at(tObj->getVid()));
+        case SAI_COMMON_API_CREATE:
+            {
+                /*
+                 * We need to get switch ID, but we know we have one switch so
+                 * we could use shortcut here, but let's do this proper way.
+                 */
 
-        auto& cObj = cur.oOids.at(cObjVid);
+                sai_object_id_t switch_vid = redis_sai_switch_id_query(object_id);
 
-        createPreMatchMapForObject(cur, tmp, cObj, tObj, processed);
-    }
+                sai_object_id_t switch_rid = asic_translate_vid_to_rid(current, temporary, switch_vid);
 
-    for (auto&pk: tmp.routesByPrefix)
-    {
-        auto& prefix = pk.first;
+                sai_status_t status = info->create(&meta_key, switch_rid, attr_count, attr_list);
 
-        // look only for unique prefixes
+                sai_object_id_t real_object_id = meta_key.objectkey.key.object_id;
 
-        if (pk.second.size() != 1)
-            continue;
+                if (status == SAI_STATUS_SUCCESS)
+                {
+                    current.ridToVid[real_object_id] = object_id;
+                    current.vidToRid[object_id] = real_object_id;
 
-        auto it = cur.routesByPrefix.find(prefix);
+                    temporary.ridToVid[real_object_id] = object_id;
+                    temporary.vidToRid[object_id] = real_object_id;
 
-        if (it == cur.routesByPrefix.end())
-            continue;
+                    std::string str_vid = sai_serialize_object_id(object_id);
+                    std::string str_rid = sai_serialize_object_id(real_object_id);
 
-        if (it->second.size() != 1)
-            continue;
+                    SWSS_LOG_INFO("saved VID %s to RID %s", str_vid.c_str(), str_rid.c_str());
+                }
+                else
+                {
+                    SWSS_LOG_ERROR("failed to create %s %s",
+                            sai_serialize_object_type(meta_key.objecttype).c_str(),
+                            sai_serialize_status(status).c_str());
+                }
 
-        auto& tObj = tmp.soAll.at(pk.second.at(0));
-        auto& cObj = cur.soAll.at(it->second.at(0));
+                return status;
+            }
 
-        createPreMatchMapForObject(cur, tmp, cObj, tObj, processed);
-    }
+        case SAI_COMMON_API_REMOVE:
+            {
+                sai_object_id_t rid = asic_translate_vid_to_rid(current, temporary, object_id);
 
-    size_t count = 0;
+                meta_key.objectkey.key.object_id = rid;
 
-    for (auto& ok: tmp.soOids)
-    {
-        if (ok.second->getObjectStatus() != SAI_OBJECT_STATUS_MATCHED)
-            count++;
-    }
+                std::string str_vid = sai_serialize_object_id(object_id);
+                std::string str_rid = sai_serialize_object_id(rid);
 
-    SWSS_LOG_NOTICE("preMatch map size: %zu, tmp oid obj: %zu",
-            tmp.preMatchMap.size(),
-            count);
-}
+                /*
+                 * Since object was removed, then we also need to remove it
+                 * from removedVidToRid map just in case if there is some bug.
+                 */
 
-sai_status_t syncdApplyView()
-{
-    SWSS_LOG_ENTER();
+                current.removedVidToRid.erase(object_id);
 
-    if (enableRefernceCountLogs)
-    {
-        dump_object_reference();
-    }
+                sai_status_t status = info->remove(&meta_key);
 
-    SWSS_LOG_TIMER("apply");
+                if (status != SAI_STATUS_SUCCESS)
+                {
+                    // TODO get object attributes
 
-    /*
-     * We assume that there will be no case that we will move from 1 to 0, also
-     * if at the beginning there is no switch, then when user will send create,
-     * and it will be actually created (real call) so there should be no case
-     * when we are moving from 0 -> 1.
-     */
+                    SWSS_LOG_ERROR("remove %s RID: %s VID %s failed: %s",
+                            sai_serialize_object_type(meta_key.objecttype).c_str(),
+                            str_rid.c_str(),
+                            str_vid.c_str(),
+                            sai_serialize_status(status).c_str());
+                }
+                else
+                {
+                    /*
+                     * When we remove object which was existing on the switch
+                     * then we need to remove it from the SaiSwitch, because
+                     * later on it will lead to creating this object again
+                     * since isNonRemovable object will return true.
+                     */
 
-    /*
-     * This method contains 2 stages.
-     *
-     * First stage is non destructive, when orchagent will build new view, and
-     * there will be bug in comparison logic in first stage, then syncd will
-     * send failure when doing apply view to orchagent but it will still be
-     * running. No asic operations are performed during this stage.
-     *
-     * Second stage is destructive, so if there will be bug in comparison logic
-     * or any asic operation will fail, then syncd will crash, since asic will
-     * be in inconsistent state.
-     */
+                    // XXX we have only 1 switch, so we can get away with this
 
-    /*
-     * Initialize rand for future candidate object selection if necessary.
-     *
-     * NOTE: Should this be deterministic? So we could repeat random choice
-     * when something bad happen or we hit a bug, so in that case it will be
-     * easier for reproduce, we could at least log value returned from time().
-     *
-     * TODO: To make it stable, we also need to make stable redisGetAsicView
-     * since now order of items is random. Also redis result needs to be
-     * sorted.
-     */
+                    auto sw = switches.begin()->second;
 
-    std::srand((unsigned int)std::time(0));
+                    if (sw->isDiscoveredRid(rid))
+                    {
+                        sw->removeExistingObjectReference(rid);
+                    }
+                }
 
-    /*
-     * NOTE: Current view can contain multiple switches at once but in our
-     * implementation we only will have 1 switch.
-     */
+                return status;
+            }
 
-    AsicView current;
-    AsicView temp;
+        case SAI_COMMON_API_SET:
+            {
+                sai_object_id_t rid = asic_translate_vid_to_rid(current, temporary, object_id);
 
-    /*
-     * We are starting first stage here, it still can throw exceptions but it's
-     * non destructive for ASIC, so just catch and return failure.
-     */
+                meta_key.objectkey.key.object_id = rid;
 
-    try
-    {
-        /*
-         * NOTE: Need to be per switch. Asic view may contain multiple switches.
-         *
-         * In our current solution we will deal with only one switch, since
-         * supporting multiple switches will have serious impact on redesign
-         * current implementation.
-         */
+                sai_status_t status = info->set(&meta_key, attr_list);
 
-        if (switches.size() != 1)
-        {
-            /*
-             * NOTE: In our solution multiple switches are not supported.
-             */
+                if (is_set_attribute_workaround(meta_key.objecttype, attr_list->id, status))
+                {
+                    return SAI_STATUS_SUCCESS;
+                }
 
-            SWSS_LOG_THROW("only one switch is expected, got: %zu switches", switches.size());
-        }
+                return status;
+            }
 
-        // XXX we have only 1 switch, so we can get away with this
+        default:
+            SWSS_LOG_ERROR("other apis not implemented");
+            return SAI_STATUS_FAILURE;
+    }
+}
 
-        auto sw = switches.begin()->second;
+void asic_translate_vid_to_rid_non_object_id(
+        _In_ const AsicView &current,
+        _In_ const AsicView &temporary,
+        _In_ sai_object_meta_key_t &meta_key)
+{
+    SWSS_LOG_ENTER();
 
-        ObjectIdMap vidToRidMap = sw->redisGetVidToRidMap();
-        ObjectIdMap ridToVidMap = sw->redisGetRidToVidMap();
+    auto info = sai_metadata_get_object_type_info(meta_key.objecttype);
 
-        current.ridToVid = ridToVidMap;
-        current.vidToRid = vidToRidMap;
+    if (info->isobjectid)
+    {
+        meta_key.objectkey.key.object_id =
+            asic_translate_vid_to_rid(current, temporary, meta_key.objectkey.key.object_id);
 
-        /*
-         * Those calls could be calls to SAI, but when this will be separate lib
-         * then we would like to limit sai to minimum or reimplement getting those.
-         *
-         * TODO: This needs to be refactored and solved in other way since asic
-         * view can contain multiple switches.
-         *
-         * TODO: This also can be optimized using metadata.
-         * We need to add access to SaiSwitch in AsicView.
-         */
+        return;
+    }
 
-        // TODO needs to be removed and done in generic
-        current.defaultTrapGroupRid     = sw->getSwitchDefaultAttrOid(SAI_SWITCH_ATTR_DEFAULT_TRAP_GROUP);
-        temp.defaultTrapGroupRid        = current.defaultTrapGroupRid;
+    for (size_t idx = 0; idx < info->structmemberscount; ++idx)
+    {
+        const sai_struct_member_info_t *m = info->structmembers[idx];
 
-        /*
-         * Read current and temporary view from REDIS.
-         */
+        if (m->membervaluetype == SAI_ATTR_VALUE_TYPE_OBJECT_ID)
+        {
+            sai_object_id_t vid = m->getoid(&meta_key);
 
-        redisGetAsicView(ASIC_STATE_TABLE, current);
-        redisGetAsicView(TEMP_PREFIX ASIC_STATE_TABLE, temp);
+            sai_object_id_t rid = asic_translate_vid_to_rid(current, temporary, vid);
 
-        /*
-         * Match oids before calling populate existing objects since after
-         * matching oids RID and VID maps will be populated.
-         */
+            m->setoid(&meta_key, rid);
+        }
+    }
+}
 
-        matchOids(current, temp);
+sai_status_t asic_handle_non_object_id(
+        _In_ const AsicView &current,
+        _In_ const AsicView &temporary,
+        _In_ sai_object_meta_key_t &meta_key,
+        _In_ sai_common_api_t api,
+        _In_ uint32_t attr_count,
+        _In_ const sai_attribute_t *attr_list)
+{
+    SWSS_LOG_ENTER();
 
-        /*
-         * Populate existing objects to current and temp view if they don't
-         * exist since we are populating them when syncd starts, and when we
-         * switch view we don't want to loose any of those objects since during
-         * syncd runtime is counting on that those objects exists.
-         *
-         * TODO: If some object's will be removed like VLAN members then this
-         * existing objects needs to be updated in the switch!
-         */
+    asic_translate_vid_to_rid_non_object_id(current, temporary, meta_key);
 
-        const auto &existingObjects = sw->getDiscoveredRids();
+    auto info = sai_metadata_get_object_type_info(meta_key.objecttype);
 
-        populateExistingObjects(current, temp, existingObjects);
+    switch (api)
+    {
+        case SAI_COMMON_API_CREATE:
+            return info->create(&meta_key, SAI_NULL_OBJECT_ID, attr_count, attr_list);
 
-        checkInternalObjects(current, temp);
+        case SAI_COMMON_API_REMOVE:
+            return info->remove(&meta_key);
 
-        /*
-         * Call main method!
-         */
+        case SAI_COMMON_API_SET:
+            return info->set(&meta_key, attr_list);
 
-        if (enableRefernceCountLogs)
-        {
-            current.dumpRef("current START");
-            temp.dumpRef("temp START");
-        }
+        default:
+            SWSS_LOG_ERROR("other apis not implemented");
+            return SAI_STATUS_FAILURE;
+    }
+}
 
-        createPreMatchMap(current, temp);
+sai_status_t asic_process_event(
+        _In_ AsicView &current,
+        _In_ AsicView &temporary,
+        _In_ const swss::KeyOpFieldsValuesTuple &kco)
+{
+    SWSS_LOG_ENTER();
 
-        logViewObjectCount(current, temp);
+    /*
+     * Since we have stored our keys in asic view, we can actually keep api
+     * type right away so we don't have to serialize and deserialize everything
+     * twice. We can take a look into that if update execution time will not be
+     * sufficient.
+     */
 
-        applyViewTransition(current, temp);
+    const std::string &key = kfvKey(kco);
+    const std::string &op = kfvOp(kco);
 
-        SWSS_LOG_NOTICE("ASIC operations to execute: %zu", current.asicGetOperationsCount());
+    sai_object_meta_key_t meta_key;
+    sai_deserialize_object_meta_key(key, meta_key);
 
-        checkObjectsStatus(temp);
+    SWSS_LOG_INFO("key: %s op: %s", key.c_str(), op.c_str());
 
-        SWSS_LOG_NOTICE("all temporary view objects were processed to FINAL state");
+    if (enableRefernceCountLogs)
+    {
+        SWSS_LOG_NOTICE("ASIC OP BEFORE : key: %s op: %s", key.c_str(), op.c_str());
 
-        checkObjectsStatus(current);
+        dump_object_reference();
+        current.dumpRef("current before");
+        temporary.dumpRef("temp before");
+    }
 
-        SWSS_LOG_NOTICE("all current view objects were processed to FINAL state");
+    sai_common_api_t api = SAI_COMMON_API_MAX;
 
+    // TODO convert those in common to use sai_common_api
+    if (op == "set")
+    {
         /*
-         * After all operations both views should look the same so number of
-         * rid/vid should look the same.
+         * Most common operation will probably be set so let put it first.
          */
 
-        if ((current.ridToVid.size() != temp.ridToVid.size()) ||
-                (current.vidToRid.size() != temp.vidToRid.size()))
-        {
-            /*
-             * Check all possible differences.
-             */
+        api = SAI_COMMON_API_SET;
+    }
+    else if (op == "create")
+    {
+        api = SAI_COMMON_API_CREATE;
+    }
+    else if (op == "remove")
+    {
+        api = SAI_COMMON_API_REMOVE;
+    }
+    else
+    {
+        SWSS_LOG_ERROR("api %s is not implemented on %s", op.c_str(), key.c_str());
 
-            checkMap(current.ridToVid, "current R2V", current.vidToRid, "current V2R", temp.ridToVid, "temp R2V", temp.vidToRid, "temp V2R");
-            checkMap(temp.ridToVid, "temp R2V", temp.vidToRid, "temp V2R", current.ridToVid, "current R2V", current.vidToRid, "current V2R");
+        return SAI_STATUS_NOT_SUPPORTED;
+    }
 
-            current.dumpVidToAsicOperatioId();
+    std::stringstream ss;
 
-            SWSS_LOG_THROW("wrong number of vid/rid items in map, forgot to translate? R2V: %zu:%zu, V2R: %zu:%zu, FIXME",
-                    current.ridToVid.size(),
-                    temp.ridToVid.size(),
-                    current.vidToRid.size(),
-                    temp.vidToRid.size());
-        }
+    sai_object_type_t object_type = meta_key.objecttype;
 
-        /*
-         * At the end number of soAll objects must be equal on both views. If
-         * some on temporary views are missing, we need to transport empty
-         * objects to temporary view, like queues, scheduler groups, virtual
-         * router, trap groups etc.
-         */
+    const std::vector<swss::FieldValueTuple> &values = kfvFieldsValues(kco);
 
-        if (current.soAll.size() != temp.soAll.size())
-        {
-            /*
-             * If this will happen that means non object id values are
-             * different since number of RID/VID maps is identical (previous
-             * check).
-             *
-             * Unlikely to be routes/neighbors/fdbs, can be traps, switch,
-             * vlan.
-             *
-             * TODO: For debug we will need to display differences
-             */
+    SaiAttributeList list(object_type, values, false);
 
-            SWSS_LOG_THROW("wrong number of all objects current: %zu vs temp %zu, FIXME",
-                    current.soAll.size(),
-                    temp.soAll.size());
-        }
+    sai_attribute_t *attr_list = list.get_attr_list();
+    uint32_t attr_count = list.get_attr_count();
+
+    asic_translate_vid_to_rid_list(current, temporary, object_type, attr_count, attr_list);
+
+    sai_status_t status;
+
+    auto info = sai_metadata_get_object_type_info(object_type);
+
+    if (object_type == SAI_OBJECT_TYPE_SWITCH)
+    {
+        check_notifications_pointers(attr_count, attr_list);
+    }
+
+    if (info->isnonobjectid)
+    {
+        status = asic_handle_non_object_id(current, temporary, meta_key, api, attr_count, attr_list);
+    }
+    else
+    {
+        status = asic_handle_generic(current, temporary, meta_key, api, attr_count, attr_list);
     }
-    catch (const std::exception &e)
+
+    if (enableRefernceCountLogs)
     {
-        /*
-         * Exception was thrown in first stage, those were non destructive
-         * actions so just log exception and let syncd running.
-         */
+        SWSS_LOG_NOTICE("ASIC OP AFTER : key: %s op: %s", key.c_str(), op.c_str());
 
-        SWSS_LOG_ERROR("Exception: %s", e.what());
+        dump_object_reference();
+        current.dumpRef("current after");
+        temporary.dumpRef("temp after");
+    }
 
-        return SAI_STATUS_FAILURE;
+    if (status == SAI_STATUS_SUCCESS)
+    {
+        return status;
+    }
+
+    for (const auto &v: values)
+    {
+        SWSS_LOG_ERROR("field: %s, value: %s", fvField(v).c_str(), fvValue(v).c_str());
     }
 
     /*
-     * This is second stage. Those operations are destructive, if any of them
-     * fail, then we will have inconsistent state in ASIC.
+     * ASIC here will be in inconsistent state, we need to terminate.
      */
 
-    executeOperationsOnAsic(current, temp);
+    SWSS_LOG_THROW("failed to execute api: %s, key: %s, status: %s",
+            op.c_str(),
+            key.c_str(),
+            sai_serialize_status(status).c_str());
+}
 
-    updateRedisDatabase(current, temp);
+/**
+ * @brief Maximum number of operations executed by single bulk api call.
+ */
+#define ASIC_BULK_MAX_OPERATIONS (1024)
 
-    if (g_commandLineOptions->m_enableConsistencyCheck)
+/*
+ * Operations generated by comparison logic are executed in order, so each
+ * operation is executed after all operations it depends on. Consecutive
+ * operations of the same type on route, neighbor, FDB and next hop group
+ * member objects don't depend on each other (none of those objects can be
+ * referenced by object of the same type), so they can be grouped and executed
+ * using vendor bulk api without changing the order of operations.
+ */
+
+bool asic_is_bulk_object_type(
+        _In_ sai_object_type_t object_type)
+{
+    SWSS_LOG_ENTER();
+
+    switch (object_type)
     {
-        checkAsicVsDatabaseConsistency(current, temp);
+        case SAI_OBJECT_TYPE_ROUTE_ENTRY:
+        case SAI_OBJECT_TYPE_NEIGHBOR_ENTRY:
+        case SAI_OBJECT_TYPE_FDB_ENTRY:
+        case SAI_OBJECT_TYPE_NEXT_HOP_GROUP_MEMBER:
+            return true;
+
+        default:
+            return false;
     }
+}
 
-    return SAI_STATUS_SUCCESS;
+sai_common_api_t asic_get_bulk_api(
+        _In_ const std::string &op)
+{
+    SWSS_LOG_ENTER();
+
+    if (op == "set")
+    {
+        return SAI_COMMON_API_BULK_SET;
+    }
+
+    if (op == "create")
+    {
+        return SAI_COMMON_API_BULK_CREATE;
+    }
+
+    if (op == "remove")
+    {
+        return SAI_COMMON_API_BULK_REMOVE;
+    }
+
+    return SAI_COMMON_API_MAX;
 }
 
-/*
- * Below we will duplicate asic execution logic for asic operations.
- *
- * Since we have objects on our disposal and actual attributes, we don't need
- * to do serialize/deserialize twice, we can take advantage of that.
- * Only VID to RID translation is needed, and GET api is not supported
- * anyway since comparison logic will do only SET/REMOVE/CREATE then
- * all objects can be set to consts.
+/**
+ * @brief Get number of operations which can be executed in single bulk.
  *
- * We can address that when actual asic switch will be more time
- * consuming than we expect.
+ * @param[in] operations Operations to execute.
+ * @param[in] first Index of first operation in bulk.
  *
- * NOTE: Also instead of passing views everywhere we could close this in a
- * class that will have 2 members current and temporary view. This could be
- * helpful when we will have to manage multiple switches at the same time.
+ * @return Number of operations in bulk, 1 if operation must be executed alone.
  */
-
-sai_object_id_t asic_translate_vid_to_rid(
-        _In_ const AsicView &current,
-        _In_ const AsicView &temporary,
-        _In_ sai_object_id_t vid)
+size_t asic_get_bulk_operations_count(
+        _In_ const std::vector<AsicOperation> &operations,
+        _In_ size_t first)
 {
     SWSS_LOG_ENTER();
 
-    if (vid == SAI_NULL_OBJECT_ID)
+    if (enableRefernceCountLogs)
     {
-        return SAI_NULL_OBJECT_ID;
+        // reference count logs are printed for each operation
+
+        return 1;
     }
 
-    auto currentIt = current.vidToRid.find(vid);
+    const std::string &key = kfvKey(*operations[first].op);
+    const std::string &op = kfvOp(*operations[first].op);
 
-    if (currentIt == current.vidToRid.end())
+    if (asic_get_bulk_api(op) == SAI_COMMON_API_MAX)
     {
-        /*
-         * If object was removed it RID was moved to removed map.  This is
-         * required since at the end we need to check whether rid/vid maps are
-         * the same for both views.
-         */
+        return 1;
+    }
 
-        currentIt = current.removedVidToRid.find(vid);
+    sai_object_meta_key_t meta_key;
+    sai_deserialize_object_meta_key(key, meta_key);
 
-        if (currentIt == current.removedVidToRid.end())
+    if (!asic_is_bulk_object_type(meta_key.objecttype))
+    {
+        return 1;
+    }
+
+    std::string prefix = key.substr(0, key.find(":") + 1);
+
+    std::set<std::string> keys;
+
+    keys.insert(key);
+
+    size_t count = 1;
+
+    while (first + count < operations.size() && count < ASIC_BULK_MAX_OPERATIONS)
+    {
+        const auto &next = *operations[first + count].op;
+
+        if (kfvOp(next) != op || kfvKey(next).compare(0, prefix.size(), prefix) != 0)
         {
-            SWSS_LOG_THROW("unable to find VID %s in current view",
-                    sai_serialize_object_id(vid).c_str());
+            break;
         }
-    }
 
-    sai_object_id_t rid = currentIt->second;
+        /*
+         * Operations on the same object (like set of 2 attributes) must be
+         * executed one after another, so they are not put in the same bulk.
+         */
 
-    SWSS_LOG_INFO("translated VID 0x%" PRIx64 " to RID 0x%" PRIx64, vid, rid);
+        if (!keys.insert(kfvKey(next)).second)
+        {
+            break;
+        }
 
-    return rid;
+        count++;
+    }
+
+    return count;
 }
 
-void asic_translate_list_vid_to_rid(
-        _In_ const AsicView &current,
-        _In_ const AsicView &temporary,
-        _Inout_ sai_object_list_t &element)
+/**
+ * @brief Check whether vendor bulk api didn't execute any object.
+ *
+ * Vendor can return not supported status after some objects were already
+ * executed, in that case operations can't be executed again one by one.
+ *
+ * @param[in] object_statuses Statuses of objects in bulk.
+ *
+ * @return True if all objects have not executed status.
+ */
+bool is_bulk_not_executed(
+        _In_ const std::vector<sai_status_t> &object_statuses)
 {
     SWSS_LOG_ENTER();
 
-    for (uint32_t i = 0; i < element.count; i++)
+    for (auto status: object_statuses)
     {
-        element.list[i] = asic_translate_vid_to_rid(current, temporary, element.list[i]);
+        if (status != SAI_STATUS_NOT_EXECUTED)
+        {
+            return false;
+        }
     }
+
+    return true;
 }
 
-void asic_translate_vid_to_rid_list(
+sai_status_t asic_bulk_route_entry(
         _In_ const AsicView &current,
         _In_ const AsicView &temporary,
-        _In_ sai_object_type_t object_type,
-        _In_ uint32_t attr_count,
-        _Inout_ sai_attribute_t *attr_list)
+        _In_ const std::vector<sai_object_meta_key_t> &meta_keys,
+        _In_ sai_common_api_t api,
+        _In_ const std::vector<std::shared_ptr<SaiAttributeList>> &attributes,
+        _Out_ std::vector<sai_status_t> &object_statuses)
 {
     SWSS_LOG_ENTER();
 
-    /*
-     * All id's received from view should be virtual, so lets translate them to
-     * real id's.
-     */
-
-    for (uint32_t i = 0; i < attr_count; i++)
-    {
-        sai_attribute_t &attr = attr_list[i];
-
-        auto meta = sai_metadata_get_attr_metadata(object_type, attr.id);
-
-        // this should not happen we should get list right away from SaiAttr
+    uint32_t object_count = (uint32_t)meta_keys.size();
 
-        if (meta == NULL)
-        {
-            SWSS_LOG_THROW("unable to get metadata for object type %s, attribute %d",
-                    sai_serialize_object_type(object_type).c_str(),
-                    attr.id);
+    std::vector<sai_route_entry_t> entries(object_count);
 
-            /*
-             * Asic will be in inconsistent state at this point
-             */
-        }
+    for (uint32_t idx = 0; idx < object_count; ++idx)
+    {
+        sai_object_meta_key_t meta_key = meta_keys[idx];
 
-        switch (meta->attrvaluetype)
-        {
-            case SAI_ATTR_VALUE_TYPE_OBJECT_ID:
-                attr.value.oid = asic_translate_vid_to_rid(current, temporary, attr.value.oid);
-                break;
+        asic_translate_vid_to_rid_non_object_id(current, temporary, meta_key);
 
-            case SAI_ATTR_VALUE_TYPE_OBJECT_LIST:
-                asic_translate_list_vid_to_rid(current, temporary, attr.value.objlist);
-                break;
+        entries[idx] = meta_key.objectkey.key.route_entry;
+    }
 
-            case SAI_ATTR_VALUE_TYPE_ACL_FIELD_DATA_OBJECT_ID:
+    switch (api)
+    {
+        case SAI_COMMON_API_BULK_CREATE:
 
-                if (attr.value.aclfield.enable)
+            {
+                if (sai_metadata_sai_route_api->create_route_entries == NULL)
                 {
-                    attr.value.aclfield.data.oid = asic_translate_vid_to_rid(current, temporary, attr.value.aclfield.data.oid);
+                    return SAI_STATUS_NOT_IMPLEMENTED;
                 }
 
-                break;
-
-            case SAI_ATTR_VALUE_TYPE_ACL_FIELD_DATA_OBJECT_LIST:
+                std::vector<uint32_t> attr_counts;
+                std::vector<const sai_attribute_t*> attr_lists;
 
-                if (attr.value.aclfield.enable)
-                {
-                    asic_translate_list_vid_to_rid(current, temporary, attr.value.aclfield.data.objlist);
-                }
+                get_bulk_attr_lists(attributes, attr_counts, attr_lists);
 
-                break;
+                return sai_metadata_sai_route_api->create_route_entries(
+                        object_count,
+                        entries.data(),
+                        attr_counts.data(),
+                        attr_lists.data(),
+                        SAI_BULK_OP_ERROR_MODE_STOP_ON_ERROR,
+                        object_statuses.data());
+            }
 
-            case SAI_ATTR_VALUE_TYPE_ACL_ACTION_DATA_OBJECT_ID:
+        case SAI_COMMON_API_BULK_REMOVE:
 
-                if (attr.value.aclaction.enable)
-                {
-                    attr.value.aclaction.parameter.oid = asic_translate_vid_to_rid(current, temporary, attr.value.aclaction.parameter.oid);
-                }
+            if (sai_metadata_sai_route_api->remove_route_entries == NULL)
+            {
+                return SAI_STATUS_NOT_IMPLEMENTED;
+            }
 
-                break;
+            return sai_metadata_sai_route_api->remove_route_entries(
+                    object_count,
+                    entries.data(),
+                    SAI_BULK_OP_ERROR_MODE_STOP_ON_ERROR,
+                    object_statuses.data());
 
-            case SAI_ATTR_VALUE_TYPE_ACL_ACTION_DATA_OBJECT_LIST:
+        case SAI_COMMON_API_BULK_SET:
 
-                if (attr.value.aclaction.enable)
+            {
+                if (sai_metadata_sai_route_api->set_route_entries_attribute == NULL)
                 {
-                    asic_translate_list_vid_to_rid(current, temporary, attr.value.aclaction.parameter.objlist);
+                    return SAI_STATUS_NOT_IMPLEMENTED;
                 }
 
-                break;
+                /*
+                 * Comparison logic generates set operation for each
+                 * attribute, but let's make sure since bulk set api accepts
+                 * exactly one attribute per object.
+                 */
 
-            default:
+                std::vector<sai_attribute_t> attrs(object_count);
 
-                if (meta->isoidattribute)
+                for (uint32_t idx = 0; idx < object_count; ++idx)
                 {
-                    SWSS_LOG_THROW("attribute %s is oid attribute, but not handled, FIXME", meta->attridname);
+                    if (attributes[idx]->get_attr_count() != 1)
+                    {
+                        return SAI_STATUS_NOT_SUPPORTED;
+                    }
+
+                    attrs[idx] = attributes[idx]->get_attr_list()[0];
                 }
 
-                break;
-        }
+                return sai_metadata_sai_route_api->set_route_entries_attribute(
+                        object_count,
+                        entries.data(),
+                        attrs.data(),
+                        SAI_BULK_OP_ERROR_MODE_STOP_ON_ERROR,
+                        object_statuses.data());
+            }
+
+        default:
+            SWSS_LOG_THROW("api %d is not supported in bulk route", api);
     }
 }
 
-sai_status_t asic_handle_generic(
+sai_status_t asic_bulk_next_hop_group_member(
         _In_ AsicView &current,
         _In_ AsicView &temporary,
-        _In_ sai_object_meta_key_t &meta_key,
+        _In_ const std::vector<sai_object_meta_key_t> &meta_keys,
         _In_ sai_common_api_t api,
-        _In_ uint32_t attr_count,
-        _In_ const sai_attribute_t *attr_list)
+        _In_ const std::vector<std::shared_ptr<SaiAttributeList>> &attributes,
+        _Out_ std::vector<sai_status_t> &object_statuses)
 {
     SWSS_LOG_ENTER();
 
-    SWSS_LOG_DEBUG("generic %s for %s",
-            sai_serialize_common_api(api).c_str(),
-            sai_serialize_object_type(meta_key.objecttype).c_str());
+    uint32_t object_count = (uint32_t)meta_keys.size();
 
-    /*
-     * If we will use split for generics we can avoid meta key if we will
-     * generate inside metadata generic pointers for all oid objects + switch
-     * special method.
-     *
-     * And this needs to be executed in sai_meta_apis_query.
-     */
+    std::vector<sai_object_id_t> vids(object_count);
+    std::vector<sai_object_id_t> rids(object_count, SAI_NULL_OBJECT_ID);
 
-    auto info = sai_metadata_get_object_type_info(meta_key.objecttype);
+    for (uint32_t idx = 0; idx < object_count; ++idx)
+    {
+        vids[idx] = meta_keys[idx].objectkey.key.object_id;
+    }
 
-    sai_object_id_t object_id = meta_key.objectkey.key.object_id;
+    sai_status_t status;
 
     switch (api)
     {
-        case SAI_COMMON_API_CREATE:
+        case SAI_COMMON_API_BULK_CREATE:
+
             {
-                /*
-                 * We need to get switch ID, but we know we have one switch so
-                 * we could use shortcut here, but let's do this proper way.
-                 */
+                if (sai_metadata_sai_next_hop_group_api->create_next_hop_group_members == NULL)
+                {
+                    return SAI_STATUS_NOT_IMPLEMENTED;
+                }
 
-                sai_object_id_t switch_vid = redis_sai_switch_id_query(object_id);
+                sai_object_id_t switch_vid = redis_sai_switch_id_query(vids.at(0));
 
                 sai_object_id_t switch_rid = asic_translate_vid_to_rid(current, temporary, switch_vid);
 
-                sai_status_t status = info->create(&meta_key, switch_rid, attr_count, attr_list);
-
-                sai_object_id_t real_object_id = meta_key.objectkey.key.object_id;
-
-                if (status == SAI_STATUS_SUCCESS)
-                {
-                    current.ridToVid[real_object_id] = object_id;
-                    current.vidToRid[object_id] = real_object_id;
-
-                    temporary.ridToVid[real_object_id] = object_id;
-                    temporary.vidToRid[object_id] = real_object_id;
+                std::vector<uint32_t> attr_counts;
+                std::vector<const sai_attribute_t*> attr_lists;
 
-                    std::string str_vid = sai_serialize_object_id(object_id);
-                    std::string str_rid = sai_serialize_object_id(real_object_id);
+                get_bulk_attr_lists(attributes, attr_counts, attr_lists);
 
-                    SWSS_LOG_INFO("saved VID %s to RID %s", str_vid.c_str(), str_rid.c_str());
+                status = sai_metadata_sai_next_hop_group_api->create_next_hop_group_members(
+                        switch_rid,
+                        object_count,
+                        attr_counts.data(),
+                        attr_lists.data(),
+                        SAI_BULK_OP_ERROR_MODE_STOP_ON_ERROR,
+                        rids.data(),
+                        object_statuses.data());
+
+                if (is_bulk_api_not_implemented(status) && is_bulk_not_executed(object_statuses))
+                {
+                    return status;
                 }
-                else
+
+                for (uint32_t idx = 0; idx < object_count; ++idx)
                 {
-                    SWSS_LOG_ERROR("failed to create %s %s",
-                            sai_serialize_object_type(meta_key.objecttype).c_str(),
-                            sai_serialize_status(status).c_str());
+                    if (object_statuses[idx] != SAI_STATUS_SUCCESS)
+                    {
+                        continue;
+                    }
+
+                    current.ridToVid[rids[idx]] = vids[idx];
+                    current.vidToRid[vids[idx]] = rids[idx];
+
+                    temporary.ridToVid[rids[idx]] = vids[idx];
+                    temporary.vidToRid[vids[idx]] = rids[idx];
                 }
 
                 return status;
             }
 
-        case SAI_COMMON_API_REMOVE:
-            {
-                sai_object_id_t rid = asic_translate_vid_to_rid(current, temporary, object_id);
-
-                meta_key.objectkey.key.object_id = rid;
-
-                std::string str_vid = sai_serialize_object_id(object_id);
-                std::string str_rid = sai_serialize_object_id(rid);
+        case SAI_COMMON_API_BULK_REMOVE:
 
-                /*
-                 * Since object was removed, then we also need to remove it
-                 * from removedVidToRid map just in case if there is some bug.
-                 */
+            {
+                if (sai_metadata_sai_next_hop_group_api->remove_next_hop_group_members == NULL)
+                {
+                    return SAI_STATUS_NOT_IMPLEMENTED;
+                }
 
-                current.removedVidToRid.erase(object_id);
+                for (uint32_t idx = 0; idx < object_count; ++idx)
+                {
+                    rids[idx] = asic_translate_vid_to_rid(current, temporary, vids[idx]);
+                }
 
-                sai_status_t status = info->remove(&meta_key);
+                status = sai_metadata_sai_next_hop_group_api->remove_next_hop_group_members(
+                        object_count,
+                        rids.data(),
+                        SAI_BULK_OP_ERROR_MODE_STOP_ON_ERROR,
+                        object_statuses.data());
 
-                if (status != SAI_STATUS_SUCCESS)
+                if (is_bulk_api_not_implemented(status) && is_bulk_not_executed(object_statuses))
                 {
-                    // TODO get object attributes
+                    // objects will be removed one by one, which needs removed VIDs
 
-                    SWSS_LOG_ERROR("remove %s RID: %s VID %s failed: %s",
-                            sai_serialize_object_type(meta_key.objecttype).c_str(),
-                            str_rid.c_str(),
-                            str_vid.c_str(),
-                            sai_serialize_status(status).c_str());
+                    return status;
                 }
-                else
-                {
-                    /*
-                     * When we remove object which was existing on the switch
-                     * then we need to remove it from the SaiSwitch, because
-                     * later on it will lead to creating this object again
-                     * since isNonRemovable object will return true.
-                     */
 
-                    // XXX we have only 1 switch, so we can get away with this
+                // XXX we have only 1 switch, so we can get away with this
 
-                    auto sw = switches.begin()->second;
+                auto sw = switches.begin()->second;
 
-                    if (sw->isDiscoveredRid(rid))
+                for (uint32_t idx = 0; idx < object_count; ++idx)
+                {
+                    current.removedVidToRid.erase(vids[idx]);
+
+                    if (object_statuses[idx] == SAI_STATUS_SUCCESS && sw->isDiscoveredRid(rids[idx]))
                     {
-                        sw->removeExistingObjectReference(rid);
+                        sw->removeExistingObjectReference(rids[idx]);
                     }
                 }
 
                 return status;
             }
 
-        case SAI_COMMON_API_SET:
-            {
-                sai_object_id_t rid = asic_translate_vid_to_rid(current, temporary, object_id);
-
-                meta_key.objectkey.key.object_id = rid;
-
-                sai_status_t status = info->set(&meta_key, attr_list);
+        case SAI_COMMON_API_BULK_SET:
 
-                if (is_set_attribute_workaround(meta_key.objecttype, attr_list->id, status))
-                {
-                    return SAI_STATUS_SUCCESS;
-                }
+            /*
+             * There is no bulk set api for next hop group members.
+             */
 
-                return status;
-            }
+            return SAI_STATUS_NOT_IMPLEMENTED;
 
         default:
-            SWSS_LOG_ERROR("other apis not implemented");
-            return SAI_STATUS_FAILURE;
+            SWSS_LOG_THROW("api %d is not supported in bulk next hop group member", api);
     }
 }
 
-void asic_translate_vid_to_rid_non_object_id(
-        _In_ const AsicView &current,
-        _In_ const AsicView &temporary,
-        _In_ sai_object_meta_key_t &meta_key)
+sai_status_t asic_bulk_per_object(
+        _In_ AsicView &current,
+        _In_ AsicView &temporary,
+        _In_ const std::vector<sai_object_meta_key_t> &meta_keys,
+        _In_ sai_common_api_t api,
+        _In_ const std::vector<std::shared_ptr<SaiAttributeList>> &attributes,
+        _Out_ std::vector<sai_status_t> &object_statuses)
 {
     SWSS_LOG_ENTER();
 
-    auto info = sai_metadata_get_object_type_info(meta_key.objecttype);
-
-    if (info->isobjectid)
-    {
-        meta_key.objectkey.key.object_id =
-            asic_translate_vid_to_rid(current, temporary, meta_key.objectkey.key.object_id);
-
-        return;
-    }
+    sai_common_api_t single_api;
 
-    for (size_t idx = 0; idx < info->structmemberscount; ++idx)
+    switch (api)
     {
-        const sai_struct_member_info_t *m = info->structmembers[idx];
+        case SAI_COMMON_API_BULK_CREATE:
+            single_api = SAI_COMMON_API_CREATE;
+            break;
 
-        if (m->membervaluetype == SAI_ATTR_VALUE_TYPE_OBJECT_ID)
-        {
-            sai_object_id_t vid = m->getoid(&meta_key);
+        case SAI_COMMON_API_BULK_REMOVE:
+            single_api = SAI_COMMON_API_REMOVE;
+            break;
 
-            sai_object_id_t rid = asic_translate_vid_to_rid(current, temporary, vid);
+        case SAI_COMMON_API_BULK_SET:
+            single_api = SAI_COMMON_API_SET;
+            break;
 
-            m->setoid(&meta_key, rid);
-        }
+        default:
+            SWSS_LOG_THROW("api %d is not supported in bulk", api);
     }
-}
 
-sai_status_t asic_handle_non_object_id(
-        _In_ const AsicView &current,
-        _In_ const AsicView &temporary,
-        _In_ sai_object_meta_key_t &meta_key,
-        _In_ sai_common_api_t api,
-        _In_ uint32_t attr_count,
-        _In_ const sai_attribute_t *attr_list)
-{
-    SWSS_LOG_ENTER();
+    for (size_t idx = 0; idx < meta_keys.size(); ++idx)
+    {
+        sai_object_meta_key_t meta_key = meta_keys[idx];
 
-    asic_translate_vid_to_rid_non_object_id(current, temporary, meta_key);
+        sai_attribute_t *attr_list = attributes[idx]->get_attr_list();
+        uint32_t attr_count = attributes[idx]->get_attr_count();
 
-    auto info = sai_metadata_get_object_type_info(meta_key.objecttype);
+        auto info = sai_metadata_get_object_type_info(meta_key.objecttype);
 
-    switch (api)
-    {
-        case SAI_COMMON_API_CREATE:
-            return info->create(&meta_key, SAI_NULL_OBJECT_ID, attr_count, attr_list);
+        sai_status_t status;
 
-        case SAI_COMMON_API_REMOVE:
-            return info->remove(&meta_key);
+        if (info->isnonobjectid)
+        {
+            status = asic_handle_non_object_id(current, temporary, meta_key, single_api, attr_count, attr_list);
+        }
+        else
+        {
+            status = asic_handle_generic(current, temporary, meta_key, single_api, attr_count, attr_list);
+        }
 
-        case SAI_COMMON_API_SET:
-            return info->set(&meta_key, attr_list);
+        object_statuses[idx] = status;
 
-        default:
-            SWSS_LOG_ERROR("other apis not implemented");
-            return SAI_STATUS_FAILURE;
+        if (status != SAI_STATUS_SUCCESS)
+        {
+            return status;
+        }
     }
+
+    return SAI_STATUS_SUCCESS;
 }
 
-sai_status_t asic_process_event(
+/**
+ * @brief Execute operations of the same type on the same object type.
+ *
+ * Vendor bulk api is used when it's available, otherwise operations are
+ * executed one by one. Execution stops on first failed operation and
+ * exception is thrown, same as when operations are executed one by one.
+ *
+ * @param[in] current Current view.
+ * @param[in] temporary Temporary view.
+ * @param[in] operations Operations to execute.
+ * @param[in] first Index of first operation in bulk.
+ * @param[in] count Number of operations in bulk.
+ *
+ * @return Status of bulk execution.
+ */
+sai_status_t asic_process_bulk_events(
         _In_ AsicView &current,
         _In_ AsicView &temporary,
-        _In_ const swss::KeyOpFieldsValuesTuple &kco)
+        _In_ const std::vector<AsicOperation> &operations,
+        _In_ size_t first,
+        _In_ size_t count)
 {
     SWSS_LOG_ENTER();
 
-    /*
-     * Since we have stored our keys in asic view, we can actually keep api
-     * type right away so we don't have to serialize and deserialize everything
-     * twice. We can take a look into that if update execution time will not be
-     * sufficient.
-     */
+    const std::string &op = kfvOp(*operations[first].op);
 
-    const std::string &key = kfvKey(kco);
-    const std::string &op = kfvOp(kco);
+    sai_common_api_t api = asic_get_bulk_api(op);
 
-    sai_object_meta_key_t meta_key;
-    sai_deserialize_object_meta_key(key, meta_key);
+    std::vector<sai_object_meta_key_t> meta_keys(count);
 
-    SWSS_LOG_INFO("key: %s op: %s", key.c_str(), op.c_str());
+    std::vector<std::shared_ptr<SaiAttributeList>> attributes(count);
 
-    if (enableRefernceCountLogs)
+    for (size_t idx = 0; idx < count; ++idx)
     {
-        SWSS_LOG_NOTICE("ASIC OP BEFORE : key: %s op: %s", key.c_str(), op.c_str());
+        const auto &kco = *operations[first + idx].op;
 
-        dump_object_reference();
-        current.dumpRef("current before");
-        temporary.dumpRef("temp before");
+        sai_deserialize_object_meta_key(kfvKey(kco), meta_keys[idx]);
+
+        attributes[idx] = std::make_shared<SaiAttributeList>(meta_keys[idx].objecttype, kfvFieldsValues(kco), false);
+
+        asic_translate_vid_to_rid_list(
+                current,
+                temporary,
+                meta_keys[idx].objecttype,
+                attributes[idx]->get_attr_count(),
+                attributes[idx]->get_attr_list());
     }
 
-    sai_common_api_t api = SAI_COMMON_API_MAX;
+    sai_object_type_t object_type = meta_keys.at(0).objecttype;
 
-    // TODO convert those in common to use sai_common_api
-    if (op == "set")
-    {
-        /*
-         * Most common operation will probably be set so let put it first.
-         */
+    SWSS_LOG_INFO("bulk %s %s execute with %zu items",
+            op.c_str(),
+            sai_serialize_object_type(object_type).c_str(),
+            count);
 
-        api = SAI_COMMON_API_SET;
-    }
-    else if (op == "create")
-    {
-        api = SAI_COMMON_API_CREATE;
-    }
-    else if (op == "remove")
-    {
-        api = SAI_COMMON_API_REMOVE;
-    }
-    else
-    {
-        SWSS_LOG_ERROR("api %s is not implemented on %s", op.c_str(), key.c_str());
+    std::vector<sai_status_t> object_statuses(count, SAI_STATUS_NOT_EXECUTED);
 
-        return SAI_STATUS_NOT_SUPPORTED;
-    }
+    sai_status_t status = SAI_STATUS_NOT_IMPLEMENTED;
 
-    std::stringstream ss;
+    auto key = std::make_pair(object_type, api);
 
-    sai_object_type_t object_type = meta_key.objecttype;
+    if (bulkApiNotImplemented.find(key) == bulkApiNotImplemented.end())
+    {
+        switch (object_type)
+        {
+            case SAI_OBJECT_TYPE_ROUTE_ENTRY:
+                status = asic_bulk_route_entry(current, temporary, meta_keys, api, attributes, object_statuses);
+                break;
 
-    const std::vector<swss::FieldValueTuple> &values = kfvFieldsValues(kco);
+            case SAI_OBJECT_TYPE_NEXT_HOP_GROUP_MEMBER:
+                status = asic_bulk_next_hop_group_member(current, temporary, meta_keys, api, attributes, object_statuses);
+                break;
 
-    SaiAttributeList list(object_type, values, false);
+            default:
 
-    sai_attribute_t *attr_list = list.get_attr_list();
-    uint32_t attr_count = list.get_attr_count();
+                /*
+                 * SAI headers we compile against don't define bulk api for
+                 * neighbor and FDB entries, so those are always executed one
+                 * by one.
+                 */
 
-    asic_translate_vid_to_rid_list(current, temporary, object_type, attr_count, attr_list);
+                status = SAI_STATUS_NOT_IMPLEMENTED;
+                break;
+        }
 
-    sai_status_t status;
+        if (is_bulk_api_not_implemented(status) && !is_bulk_not_executed(object_statuses))
+        {
+            /*
+             * Some objects were already executed by vendor, so executing
+             * whole bulk again one by one would repeat them, failed object
+             * is reported below.
+             */
 
-    auto info = sai_metadata_get_object_type_info(object_type);
+            SWSS_LOG_ERROR("vendor bulk api %d for %s returned %s after executing some objects",
+                    api,
+                    sai_serialize_object_type(object_type).c_str(),
+                    sai_serialize_status(status).c_str());
+        }
+        else if (is_bulk_api_not_implemented(status))
+        {
+            SWSS_LOG_NOTICE("vendor bulk api %d for %s is not implemented, executing one by one",
+                    api,
+                    sai_serialize_object_type(object_type).c_str());
 
-    if (object_type == SAI_OBJECT_TYPE_SWITCH)
-    {
-        check_notifications_pointers(attr_count, attr_list);
-    }
+            if (status == SAI_STATUS_NOT_IMPLEMENTED)
+            {
+                bulkApiNotImplemented.insert(key);
+            }
 
-    if (info->isnonobjectid)
-    {
-        status = asic_handle_non_object_id(current, temporary, meta_key, api, attr_count, attr_list);
+            status = asic_bulk_per_object(current, temporary, meta_keys, api, attributes, object_statuses);
+        }
     }
     else
     {
-        status = asic_handle_generic(current, temporary, meta_key, api, attr_count, attr_list);
-    }
-
-    if (enableRefernceCountLogs)
-    {
-        SWSS_LOG_NOTICE("ASIC OP AFTER : key: %s op: %s", key.c_str(), op.c_str());
-
-        dump_object_reference();
-        current.dumpRef("current after");
-        temporary.dumpRef("temp after");
+        status = asic_bulk_per_object(current, temporary, meta_keys, api, attributes, object_statuses);
     }
 
     if (status == SAI_STATUS_SUCCESS)
@@ -8407,18 +10150,33 @@ sai_status_t asic_process_event(
         return status;
     }
 
-    for (const auto &v: values)
+    for (size_t idx = 0; idx < count; ++idx)
     {
-        SWSS_LOG_ERROR("field: %s, value: %s", fvField(v).c_str(), fvValue(v).c_str());
+        if (object_statuses[idx] == SAI_STATUS_SUCCESS || object_statuses[idx] == SAI_STATUS_NOT_EXECUTED)
+        {
+            continue;
+        }
+
+        const auto &kco = *operations[first + idx].op;
+
+        SWSS_LOG_ERROR("bulk %s failed on %s: %s",
+                op.c_str(),
+                kfvKey(kco).c_str(),
+                sai_serialize_status(object_statuses[idx]).c_str());
+
+        for (const auto &v: kfvFieldsValues(kco))
+        {
+            SWSS_LOG_ERROR("field: %s, value: %s", fvField(v).c_str(), fvValue(v).c_str());
+        }
     }
 
     /*
      * ASIC here will be in inconsistent state, we need to terminate.
      */
 
-    SWSS_LOG_THROW("failed to execute api: %s, key: %s, status: %s",
+    SWSS_LOG_THROW("failed to execute bulk api: %s on %s, status: %s",
             op.c_str(),
-            key.c_str(),
+            sai_serialize_object_type(object_type).c_str(),
             sai_serialize_status(status).c_str());
 }
 
@@ -8498,9 +10256,11 @@ void executeOperationsOnAsic(
 
         SWSS_LOG_NOTICE("optimized operations!");
 
+        const auto operations = currentView.asicGetWithOptimizedRemoveOperations();
+
         std::map<std::string,int> opByObjectType;
 
-        for (const auto &op: currentView.asicGetWithOptimizedRemoveOperations())
+        for (const auto &op: operations)
         {
             const std::string &key = kfvKey(*op.op);
             const std::string &opp = kfvOp(*op.op);
@@ -8516,8 +10276,9 @@ void executeOperationsOnAsic(
             SWSS_LOG_NOTICE("operations on %s: %d", kvp.first.c_str(), kvp.second);
         }
 
-        //for (const auto &op: currentView.asicGetOperations())
-        for (const auto &op: currentView.asicGetWithOptimizedRemoveOperations())
+        size_t bulks = 0;
+
+        for (size_t idx = 0; idx < operations.size(); )
         {
             /*
              * It is possible that this method will throw exception in that case we
@@ -8527,14 +10288,31 @@ void executeOperationsOnAsic(
              * will lead to unexpected behaviour.
              */
 
-            sai_status_t status = asic_process_event(currentView, temporaryView, *op.op);
+            size_t count = asic_get_bulk_operations_count(operations, idx);
+
+            sai_status_t status;
+
+            if (count > 1)
+            {
+                status = asic_process_bulk_events(currentView, temporaryView, operations, idx, count);
+
+                bulks++;
+            }
+            else
+            {
+                status = asic_process_event(currentView, temporaryView, *operations[idx].op);
+            }
 
             if (status != SAI_STATUS_SUCCESS)
             {
                 SWSS_LOG_THROW("status of last operation was: %s, ASIC will be in inconsistent state, exiting",
                         sai_serialize_status(status).c_str());
             }
+
+            idx += count;
         }
+
+        SWSS_LOG_NOTICE("executed %zu operations, %zu bulks", operations.size(), bulks);
     }
     catch (const std::exception &e)
     {
@@ -0,0 +1,301 @@
+#include <inttypes.h>
+
+#include "syncd.h"
+#include "sairediscommon.h"
+#include "swss/redisreply.h"
+
+#include "sai_vs.h"
+#include "sai_vs_state.h"
+
+#include <map>
+#include <string>
+#include <chrono>
+#include <thread>
+
+/*
+ * Measures FDB learn burst on virtual switch: MACs are learned by vslib in
+ * the same way as from received packets, vslib calls syncd FDB event
+ * callback, events are processed in bulk notification lane, translated to
+ * VIDs and written to ASIC view.
+ *
+ * NOTE: ASIC_DB is flushed, so this must not be executed on running system.
+ */
+
+#define FDB_LEARN_BENCHMARK_DEFAULT_COUNT (32768)
+
+#define FDB_LEARN_BENCHMARK_TIMEOUT_SECONDS (120)
+
+extern std::map<std::string, std::string> gProfileMap;
+extern sai_service_method_table_t test_services;
+
+extern void on_fdb_event(
+        _In_ uint32_t count,
+        _In_ const sai_fdb_event_notification_data_t *data);
+
+extern void getAsicViewWriterStats(
+        _Out_ size_t &commandCount,
+        _Out_ size_t &roundTripCount);
+
+#define ASSERT_SUCCESS(format,...) \
+    if ((status)!=SAI_STATUS_SUCCESS) \
+        SWSS_LOG_THROW(format ": %s", ##__VA_ARGS__, sai_serialize_status(status).c_str());
+
+/**
+ * @brief Get number of commands processed by redis server so far.
+ */
+uint64_t getRedisCommandsProcessed()
+{
+    SWSS_LOG_ENTER();
+
+    swss::RedisReply r(dbAsic.get(), "INFO stats", REDIS_REPLY_STRING);
+
+    std::string info = r.getContext()->str;
+
+    const std::string field = "total_commands_processed:";
+
+    auto pos = info.find(field);
+
+    if (pos == std::string::npos)
+    {
+        SWSS_LOG_THROW("%s not found in redis INFO", field.c_str());
+    }
+
+    return std::stoull(info.substr(pos + field.size()));
+}
+
+/**
+ * @brief Get number of ASIC view writes and round trips done by processing
+ * thread, writer is flushed under g_mutex so counters are read under it too.
+ */
+void getAsicViewWrites(
+        _Out_ size_t &commandCount,
+        _Out_ size_t &roundTripCount)
+{
+    SWSS_LOG_ENTER();
+
+    std::lock_guard<std::mutex> lock(g_mutex);
+
+    getAsicViewWriterStats(commandCount, roundTripCount);
+}
+
+/**
+ * @brief Learn MAC the same way as vslib does on received packet.
+ */
+void learnFdbEntry(
+        _In_ const fdb_info_t &fi)
+{
+    SWSS_LOG_ENTER();
+
+    std::lock_guard<std::recursive_mutex> lock(g_recursive_mutex);
+
+    processFdbInfo(fi, SAI_FDB_EVENT_LEARNED);
+}
+
+void runFdbLearnBenchmark(
+        _In_ uint32_t count)
+{
+    SWSS_LOG_ENTER();
+
+    swss::RedisReply flush(dbAsic.get(), "FLUSHALL", REDIS_REPLY_STATUS);
+
+    flush.checkStatusOK();
+
+    gProfileMap[SAI_KEY_VS_SWITCH_TYPE] = SAI_VALUE_VS_SWITCH_TYPE_BCM56850;
+
+    sai_status_t status = sai_api_initialize(0, &test_services);
+
+    ASSERT_SUCCESS("failed to initialize api");
+
+    sai_apis_t apis;
+
+    sai_metadata_apis_query(sai_api_query, &apis);
+
+    sai_attribute_t attrs[2];
+
+    attrs[0].id = SAI_SWITCH_ATTR_INIT_SWITCH;
+    attrs[0].value.booldata = true;
+
+    attrs[1].id = SAI_SWITCH_ATTR_FDB_EVENT_NOTIFY;
+    attrs[1].value.ptr = (void*)&on_fdb_event;
+
+    sai_object_id_t switchRid;
+
+    status = sai_metadata_sai_switch_api->create_switch(&switchRid, 2, attrs);
+
+    ASSERT_SUCCESS("failed to create switch");
+
+    attrs[0].id = SAI_SWITCH_ATTR_DEFAULT_VLAN_ID;
+    attrs[1].id = SAI_SWITCH_ATTR_DEFAULT_1Q_BRIDGE_ID;
+
+    status = sai_metadata_sai_switch_api->get_switch_attribute(switchRid, 2, attrs);
+
+    ASSERT_SUCCESS("failed to get default vlan and bridge");
+
+    sai_object_id_t vlanRid = attrs[0].value.oid;
+    sai_object_id_t bridgeRid = attrs[1].value.oid;
+
+    std::vector<sai_object_id_t> bridgePorts(1024);
+
+    attrs[0].id = SAI_BRIDGE_ATTR_PORT_LIST;
+    attrs[0].value.objlist.count = (uint32_t)bridgePorts.size();
+    attrs[0].value.objlist.list = bridgePorts.data();
+
+    status = sai_metadata_sai_bridge_api->get_bridge_attribute(bridgeRid, 1, attrs);
+
+    ASSERT_SUCCESS("failed to get bridge ports");
+
+    if (attrs[0].value.objlist.count == 0)
+    {
+        SWSS_LOG_THROW("default bridge has no bridge ports");
+    }
+
+    sai_object_id_t bridgePortRid = bridgePorts[0];
+
+    attrs[0].id = SAI_BRIDGE_PORT_ATTR_PORT_ID;
+
+    status = sai_metadata_sai_bridge_api->get_bridge_port_attribute(bridgePortRid, 1, attrs);
+
+    ASSERT_SUCCESS("failed to get bridge port port");
+
+    sai_object_id_t portRid = attrs[0].value.oid;
+
+    /*
+     * Objects used by FDB events must be known to syncd, like after switch
+     * discovery. Switch VID is first switch VID assigned by sairedis.
+     */
+
+    sai_object_id_t switchVid = 0x21000000000000;
+
+    redisSetRidAndVidPairs({ std::make_pair(switchRid, switchVid) });
+
+    translate_rid_to_vid(vlanRid, switchVid);
+    translate_rid_to_vid(bridgePortRid, switchVid);
+
+    startNotificationsProcessingThread();
+
+    fdb_info_t fi;
+
+    memset(&fi, 0, sizeof(fi));
+
+    fi.port_id = portRid;
+    fi.vlan_id = DEFAULT_VLAN_NUMBER;
+    fi.bridge_port_id = bridgePortRid;
+    fi.fdb_entry.switch_id = switchRid;
+    fi.fdb_entry.bv_id = vlanRid;
+    fi.fdb_entry.mac_address[0] = 0x02;
+
+    size_t commandsBefore;
+    size_t roundTripsBefore;
+
+    getAsicViewWrites(commandsBefore, roundTripsBefore);
+
+    uint64_t redisCommandsBefore = getRedisCommandsProcessed();
+
+    auto start = std::chrono::steady_clock::now();
+
+    for (uint32_t idx = 0; idx < count; idx++)
+    {
+        fi.fdb_entry.mac_address[3] = (uint8_t)(idx >> 16);
+        fi.fdb_entry.mac_address[4] = (uint8_t)(idx >> 8);
+        fi.fdb_entry.mac_address[5] = (uint8_t)idx;
+
+        learnFdbEntry(fi);
+    }
+
+    auto learned = std::chrono::steady_clock::now();
+
+    // each learned MAC is written to ASIC view by single HMSET
+
+    size_t commands = 0;
+    size_t roundTrips = 0;
+
+    while (true)
+    {
+        getAsicViewWrites(commands, roundTrips);
+
+        if (commands - commandsBefore >= count)
+        {
+            break;
+        }
+
+        if (std::chrono::steady_clock::now() - start > std::chrono::seconds(FDB_LEARN_BENCHMARK_TIMEOUT_SECONDS))
+        {
+            SWSS_LOG_THROW("only %zu of %u FDB entries were written to ASIC view", commands - commandsBefore, count);
+        }
+
+        std::this_thread::sleep_for(std::chrono::milliseconds(1));
+    }
+
+    auto written = std::chrono::steady_clock::now();
+
+    uint64_t redisCommands = getRedisCommandsProcessed() - redisCommandsBefore;
+
+    stopNotificationsProcessingThread();
+
+    auto keys = redis_scan_keys(ASIC_STATE_TABLE + std::string(":") + sai_serialize_object_type(SAI_OBJECT_TYPE_FDB_ENTRY) + ":*");
+
+    if (keys.size() != count)
+    {
+        SWSS_LOG_THROW("expected %u FDB entries in ASIC view, found %zu", count, keys.size());
+    }
+
+    typedef std::chrono::duration<double, std::milli> ms;
+
+    double total = ms(written - start).count();
+
+    printf("learned %u MACs in %.3f ms (%.0f MACs/s), vslib callbacks took %.3f ms\n",
+            count,
+            total,
+            count * 1000.0 / total,
+            ms(learned - start).count());
+
+    printf("ASIC view writer: %zu commands in %zu redis round trips\n",
+            commands - commandsBefore,
+            roundTrips - roundTripsBefore);
+
+    // includes RID to VID lookups and FDB event notifications sent to orchagent
+
+    printf("redis commands processed: %" PRIu64 " (%.2f per MAC)\n",
+            redisCommands,
+            (double)redisCommands / count);
+
+    sai_metadata_sai_switch_api->remove_switch(switchRid);
+
+    sai_api_uninitialize();
+}
+
+int main(int argc, char **argv)
+{
+    swss::Logger::getInstance().setMinPrio(swss::Logger::SWSS_NOTICE);
+
+    SWSS_LOG_ENTER();
+
+    uint32_t count = FDB_LEARN_BENCHMARK_DEFAULT_COUNT;
+
+    if (argc > 1)
+    {
+        count = (uint32_t)std::stoul(argv[1]);
+    }
+
+    dbAsic = std::make_shared<swss::DBConnector>("ASIC_DB", 0);
+    g_redisClient = std::make_shared<swss::RedisClient>(dbAsic.get());
+
+    auto dbNtf = std::make_shared<swss::DBConnector>("ASIC_DB", 0);
+
+    notifications = std::make_shared<swss::NotificationProducer>(dbNtf.get(), "NOTIFICATIONS");
+
+    try
+    {
+        runFdbLearnBenchmark(count);
+    }
+    catch (const std::exception &e)
+    {
+        SWSS_LOG_ERROR("exception: %s", e.what());
+
+        printf("benchmark failed: %s\n", e.what());
+
+        return EXIT_FAILURE;
+    }
+
+    return EXIT_SUCCESS;
+}
@@ -1,7 +1,9 @@
 #include "syncd_flex_counter.h"
 #include "syncd.h"
+#include "WorkerPool.h"
 #include "swss/redisapi.h"
 #include <inttypes.h>
+#include <dlfcn.h>
 
 /* Global map with FlexCounter instances for different polling interval */
 static std::map<std::string, std::shared_ptr<FlexCounter>> g_flex_counters_map;
@@ -12,70 +14,391 @@ static std::set<sai_ingress_priority_group_stat_t> supportedPriorityGroupCounter
 static std::set<sai_router_interface_stat_t> supportedRifCounters;
 static std::set<sai_buffer_pool_stat_t> supportedBufferPoolCounters;
 
+/*
+ * Bulk stats API is not declared by SAI headers used to build syncd, so it's
+ * resolved from vendor SAI library at runtime, signature follows SAI
+ * sai_bulk_object_get_stats.
+ */
+#define SAI_BULK_OBJECT_GET_STATS_SYMBOL "sai_bulk_object_get_stats"
+
+typedef sai_status_t (*sai_bulk_object_get_stats_fn)(
+        _In_ sai_object_id_t switch_id,
+        _In_ sai_object_type_t object_type,
+        _In_ uint32_t object_count,
+        _In_ const sai_object_key_t *object_key,
+        _In_ uint32_t number_of_counters,
+        _In_ const sai_stat_id_t *counter_ids,
+        _In_ sai_stats_mode_t mode,
+        _Inout_ sai_status_t *object_statuses,
+        _Out_ uint64_t *counters);
+
+typedef enum _bulk_stats_support_t
+{
+    BULK_STATS_UNKNOWN,
+
+    BULK_STATS_SUPPORTED,
+
+    BULK_STATS_NOT_SUPPORTED,
+
+} bulk_stats_support_t;
+
+// Bulk stats support, detected when first object of given type is registered
+static std::atomic<int> portBulkStatsSupport(BULK_STATS_UNKNOWN);
+static std::atomic<int> queueBulkStatsSupport(BULK_STATS_UNKNOWN);
+
+/*
+ * Registration probe uses read mode only, so it doesn't clear counters. Read
+ * and clear support is detected by first poll using that mode.
+ */
+static std::atomic<int> queueBulkReadAndClearStatsSupport(BULK_STATS_UNKNOWN);
+
+static sai_bulk_object_get_stats_fn getBulkObjectGetStats()
+{
+    SWSS_LOG_ENTER();
+
+    static sai_bulk_object_get_stats_fn fn =
+        reinterpret_cast<sai_bulk_object_get_stats_fn>(dlsym(RTLD_DEFAULT, SAI_BULK_OBJECT_GET_STATS_SYMBOL));
+
+    return fn;
+}
+
+/*
+ * Group objects sharing switch and counter ids, so each group is polled by
+ * single bulk call. Groups are rebuilt only when polled objects change.
+ */
+template <typename T, typename StatType>
+void FlexCounter::buildBulkStatsGroups(
+        _In_ const std::map<sai_object_id_t, std::shared_ptr<T>> &counterIdsMap,
+        _In_ sai_object_id_t T::*ridMember,
+        _In_ std::vector<StatType> T::*counterIdsMember,
+        _Out_ std::vector<std::shared_ptr<BulkStatsGroup>> &groups)
+{
+    SWSS_LOG_ENTER();
+
+    groups.clear();
+
+    typedef std::pair<sai_object_id_t, std::vector<StatType>> GroupKey;
+
+    std::map<GroupKey, std::shared_ptr<BulkStatsGroup>> index;
+
+    for (const auto &kv: counterIdsMap)
+    {
+        const T &counterIds = *kv.second;
+
+        sai_object_id_t rid = counterIds.*ridMember;
+
+        auto &group = index[GroupKey(sai_switch_id_query(rid), counterIds.*counterIdsMember)];
+
+        if (group == nullptr)
+        {
+            group = std::make_shared<BulkStatsGroup>();
+
+            group->switchRid = sai_switch_id_query(rid);
+
+            for (const auto &counterId: counterIds.*counterIdsMember)
+            {
+                group->counterIds.push_back(static_cast<sai_stat_id_t>(counterId));
+            }
+
+            groups.push_back(group);
+        }
+
+        sai_object_key_t objectKey;
+
+        objectKey.key.object_id = rid;
+
+        group->vids.push_back(kv.first);
+        group->objectKeys.push_back(objectKey);
+        group->entries.push_back(kv.second);
+    }
+
+    for (auto &group: groups)
+    {
+        group->statuses.resize(group->vids.size());
+        group->stats.resize(group->vids.size() * group->counterIds.size());
+    }
+}
+
+/*
+ * Query stats of prepared groups, one bulk call per group. Objects from
+ * groups for which bulk call failed completely are put to remaining map, so
+ * caller can poll them one by one. When support for given mode is not known
+ * yet, it's decided by result of this call.
+ */
+template <typename T>
+void FlexCounter::collectStatsBulk(
+        _In_ sai_object_type_t objectType,
+        _In_ const std::map<sai_object_id_t, std::shared_ptr<T>> &counterIdsMap,
+        _In_ const std::vector<std::shared_ptr<BulkStatsGroup>> &groups,
+        _In_ sai_stats_mode_t mode,
+        _In_ bool fullRefresh,
+        _In_ swss::Table &countersTable,
+        _Inout_ std::atomic<int> &support,
+        _Out_ std::map<sai_object_id_t, std::shared_ptr<T>> &remaining)
+{
+    SWSS_LOG_ENTER();
+
+    remaining.clear();
+
+    sai_bulk_object_get_stats_fn bulkGetStats = getBulkObjectGetStats();
+
+    if (bulkGetStats == nullptr)
+    {
+        remaining = counterIdsMap;
+        return;
+    }
+
+    for (const auto &group: groups)
+    {
+        const auto &counterIds = group->counterIds;
+        const auto &vids = group->vids;
+
+        auto &statuses = group->statuses;
+        auto &stats = group->stats;
+
+        std::fill(statuses.begin(), statuses.end(), SAI_STATUS_FAILURE);
+
+        sai_status_t status = bulkGetStats(
+                group->switchRid,
+                objectType,
+                static_cast<uint32_t>(vids.size()),
+                group->objectKeys.data(),
+                static_cast<uint32_t>(counterIds.size()),
+                counterIds.data(),
+                mode,
+                statuses.data(),
+                stats.data());
+
+        if (status != SAI_STATUS_SUCCESS &&
+                std::none_of(statuses.begin(), statuses.end(), [](sai_status_t s) { return s == SAI_STATUS_SUCCESS; }))
+        {
+            SWSS_LOG_WARN("%s: bulk get stats of %zu %s objects failed: %s, polling them one by one",
+                    m_instanceId.c_str(),
+                    vids.size(),
+                    sai_serialize_object_type(objectType).c_str(),
+                    sai_serialize_status(status).c_str());
+
+            for (const auto &vid: vids)
+            {
+                remaining.emplace(vid, counterIdsMap.at(vid));
+            }
+
+            int unknown = BULK_STATS_UNKNOWN;
+
+            if (support.compare_exchange_strong(unknown, BULK_STATS_NOT_SUPPORTED))
+            {
+                SWSS_LOG_NOTICE("%s: bulk stats are not supported in mode %d for %s, stats will be polled per object",
+                        m_instanceId.c_str(),
+                        mode,
+                        sai_serialize_object_type(objectType).c_str());
+            }
+
+            continue;
+        }
+
+        int unknown = BULK_STATS_UNKNOWN;
+
+        support.compare_exchange_strong(unknown, BULK_STATS_SUPPORTED);
+
+        for (size_t idx = 0; idx < vids.size(); idx++)
+        {
+            if (statuses[idx] != SAI_STATUS_SUCCESS)
+            {
+                SWSS_LOG_ERROR("%s: failed to get stats of %s 0x%" PRIx64 ": %d",
+                        m_instanceId.c_str(),
+                        sai_serialize_object_type(objectType).c_str(),
+                        vids[idx],
+                        statuses[idx]);
+                continue;
+            }
+
+            CountersCache &cache = *group->entries[idx];
+
+            for (size_t i = 0; i != counterIds.size(); i++)
+            {
+                cache.setCounterValue(i, stats[idx * counterIds.size() + i]);
+            }
+
+            cache.publish(countersTable, fullRefresh);
+        }
+    }
+}
+
+FlexCounter::CountersCache::CountersCache(
+        _In_ sai_object_id_t vid):
+    vidStr(sai_serialize_object_id(vid)),
+    fresh(false)
+{
+    SWSS_LOG_ENTER();
+}
+
+template <typename T>
+void FlexCounter::CountersCache::setCounterNames(
+        _In_ const std::vector<T> &counterIds,
+        _In_ std::string (*serialize)(_In_ const T))
+{
+    SWSS_LOG_ENTER();
+
+    values.clear();
+    values.reserve(counterIds.size());
+
+    for (const auto &counterId: counterIds)
+    {
+        values.emplace_back(serialize(counterId), "");
+    }
+
+    stats.assign(counterIds.size(), 0);
+}
+
+void FlexCounter::CountersCache::setCounterValue(
+        _In_ size_t index,
+        _In_ uint64_t value)
+{
+    // SWSS_LOG_ENTER() disabled for performance reasons
+
+    char buffer[32];
+
+    int len = snprintf(buffer, sizeof(buffer), "%" PRIu64, value);
+
+    // assign reuses string storage, so there is no allocation after first poll
+    values[index].second.assign(buffer, static_cast<size_t>(len));
+}
+
+void FlexCounter::CountersCache::publish(
+        _In_ swss::Table &countersTable,
+        _In_ bool fullRefresh)
+{
+    SWSS_LOG_ENTER();
+
+    fresh = true;
+
+    if (fullRefresh || published.size() != values.size())
+    {
+        published.resize(values.size());
+
+        for (size_t i = 0; i < values.size(); i++)
+        {
+            published[i].assign(values[i].second);
+        }
+
+        countersTable.set(vidStr, values, "");
+        return;
+    }
+
+    changed.clear();
+
+    for (size_t i = 0; i < values.size(); i++)
+    {
+        if (values[i].second != published[i])
+        {
+            published[i].assign(values[i].second);
+
+            changed.push_back(values[i]);
+        }
+    }
+
+    if (changed.size())
+    {
+        countersTable.set(vidStr, changed, "");
+    }
+}
+
 FlexCounter::PortCounterIds::PortCounterIds(
+        _In_ sai_object_id_t vid,
         _In_ sai_object_id_t port,
         _In_ const std::vector<sai_port_stat_t> &portIds):
+    CountersCache(vid),
     portId(port), portCounterIds(portIds)
 {
     SWSS_LOG_ENTER();
+
+    setCounterNames(portIds, sai_serialize_port_stat);
 }
 
 FlexCounter::SwitchCounterIds::SwitchCounterIds(
+        _In_ sai_object_id_t vid,
         _In_ sai_object_id_t oid,
         _In_ const std::vector<sai_switch_stat_t> &counterIds)
-    : switchId(oid),
+    : CountersCache(vid),
+      switchId(oid),
       switchCounterIds(counterIds)
 {
     SWSS_LOG_ENTER();
+
+    setCounterNames(counterIds, sai_serialize_switch_stat);
 }
 
 FlexCounter::QueueCounterIds::QueueCounterIds(
+        _In_ sai_object_id_t vid,
         _In_ sai_object_id_t queue,
         _In_ const std::vector<sai_queue_stat_t> &queueIds):
+    CountersCache(vid),
     queueId(queue), queueCounterIds(queueIds)
 {
     SWSS_LOG_ENTER();
+
+    setCounterNames(queueIds, sai_serialize_queue_stat);
 }
 
 FlexCounter::QueueAttrIds::QueueAttrIds(
+        _In_ sai_object_id_t vid,
         _In_ sai_object_id_t queue,
         _In_ const std::vector<sai_queue_attr_t> &queueIds):
+    CountersCache(vid),
     queueId(queue), queueAttrIds(queueIds)
 {
     SWSS_LOG_ENTER();
+
+    setCounterNames(queueIds, sai_serialize_queue_attr);
 }
 
 FlexCounter::IngressPriorityGroupAttrIds::IngressPriorityGroupAttrIds(
+        _In_ sai_object_id_t vid,
         _In_ sai_object_id_t priorityGroup,
         _In_ const std::vector<sai_ingress_priority_group_attr_t> &priorityGroupIds):
+    CountersCache(vid),
     priorityGroupId(priorityGroup), priorityGroupAttrIds(priorityGroupIds)
 {
     SWSS_LOG_ENTER();
+
+    setCounterNames(priorityGroupIds, sai_serialize_ingress_priority_group_attr);
 }
 
 FlexCounter::IngressPriorityGroupCounterIds::IngressPriorityGroupCounterIds(
+        _In_ sai_object_id_t vid,
         _In_ sai_object_id_t priorityGroup,
         _In_ const std::vector<sai_ingress_priority_group_stat_t> &priorityGroupIds):
+    CountersCache(vid),
     priorityGroupId(priorityGroup), priorityGroupCounterIds(priorityGroupIds)
 {
     SWSS_LOG_ENTER();
+
+    setCounterNames(priorityGroupIds, sai_serialize_ingress_priority_group_stat);
 }
 
 FlexCounter::RifCounterIds::RifCounterIds(
+        _In_ sai_object_id_t vid,
         _In_ sai_object_id_t rif,
         _In_ const std::vector<sai_router_interface_stat_t> &rifIds):
+    CountersCache(vid),
     rifId(rif), rifCounterIds(rifIds)
 {
     SWSS_LOG_ENTER();
+
+    setCounterNames(rifIds, sai_serialize_router_interface_stat);
 }
 
 FlexCounter::BufferPoolCounterIds::BufferPoolCounterIds(
+        _In_ sai_object_id_t vid,
         _In_ sai_object_id_t bufferPool,
         _In_ const std::vector<sai_buffer_pool_stat_t> &bufferPoolIds,
         _In_ sai_stats_mode_t statsMode):
+    CountersCache(vid),
     bufferPoolId(bufferPool), bufferPoolStatsMode(statsMode), bufferPoolCounterIds(bufferPoolIds)
 {
     SWSS_LOG_ENTER();
+
+    setCounterNames(bufferPoolIds, sai_serialize_buffer_pool_stat);
 }
 
 void FlexCounter::setPollInterval(
@@ -87,6 +410,7 @@ void FlexCounter::setPollInterval(
     FlexCounter &fc = getInstance(instanceId);
     std::lock_guard<std::mutex> lkMgr(fc.m_mtx);
     fc.m_pollInterval = pollInterval;
+    fc.m_configVersion++;
     if (pollInterval > 0)
     {
         fc.startFlexCounterThread();
@@ -128,12 +452,14 @@ void FlexCounter::updateFlexCounterStatsMode(
     {
         std::lock_guard<std::mutex> lkMgr(fc.m_mtx);
         fc.m_statsMode = SAI_STATS_MODE_READ;
+        fc.m_configVersion++;
         SWSS_LOG_DEBUG("Set STATS MODE %s for FC %s", mode.c_str(), fc.m_instanceId.c_str());
     }
     else if (mode == STATS_MODE_READ_AND_CLEAR)
     {
         std::lock_guard<std::mutex> lkMgr(fc.m_mtx);
         fc.m_statsMode = SAI_STATS_MODE_READ_AND_CLEAR;
+        fc.m_configVersion++;
         SWSS_LOG_DEBUG("Set STATS MODE %s for FC %s", mode.c_str(), fc.m_instanceId.c_str());
     }
     else
@@ -142,6 +468,82 @@ void FlexCounter::updateFlexCounterStatsMode(
     }
  }
 
+void FlexCounter::setPollWorkers(
+        _In_ uint32_t pollWorkers,
+        _In_ std::string instanceId)
+{
+    SWSS_LOG_ENTER();
+
+    if (pollWorkers == 0 || pollWorkers > FLEX_COUNTER_MAX_POLL_WORKERS)
+    {
+        SWSS_LOG_ERROR("Poll workers %u for FC %s out of range <1, %d>",
+                pollWorkers,
+                instanceId.c_str(),
+                FLEX_COUNTER_MAX_POLL_WORKERS);
+        return;
+    }
+
+    FlexCounter &fc = getInstance(instanceId);
+    std::lock_guard<std::mutex> lkMgr(fc.m_mtx);
+    fc.m_pollWorkers = pollWorkers;
+
+    SWSS_LOG_NOTICE("Set poll workers %u for FC %s", pollWorkers, instanceId.c_str());
+}
+
+void FlexCounter::updateDeltaPublish(
+        _In_ std::string status,
+        _In_ std::string instanceId)
+{
+    SWSS_LOG_ENTER();
+
+    FlexCounter &fc = getInstance(instanceId);
+    if (status == "enable")
+    {
+        std::lock_guard<std::mutex> lkMgr(fc.m_mtx);
+        fc.m_deltaPublish = true;
+    }
+    else if (status == "disable")
+    {
+        std::lock_guard<std::mutex> lkMgr(fc.m_mtx);
+        fc.m_deltaPublish = false;
+    }
+    else
+    {
+        SWSS_LOG_NOTICE("Input value %s is not supported for Flex counter delta publish, enter enable or disable", status.c_str());
+    }
+}
+
+void FlexCounter::setFullRefreshCycles(
+        _In_ uint32_t fullRefreshCycles,
+        _In_ std::string instanceId)
+{
+    SWSS_LOG_ENTER();
+
+    if (fullRefreshCycles == 0)
+    {
+        SWSS_LOG_ERROR("Full refresh cycles for FC %s must be non zero", instanceId.c_str());
+        return;
+    }
+
+    FlexCounter &fc = getInstance(instanceId);
+    std::lock_guard<std::mutex> lkMgr(fc.m_mtx);
+    fc.m_fullRefreshCycles = fullRefreshCycles;
+}
+
+void FlexCounter::setPollOffset(
+        _In_ uint32_t pollOffset,
+        _In_ std::string instanceId)
+{
+    SWSS_LOG_ENTER();
+
+    FlexCounter &fc = getInstance(instanceId);
+    std::lock_guard<std::mutex> lkMgr(fc.m_mtx);
+    fc.m_pollOffsetEnabled = true;
+    fc.m_pollOffset = pollOffset;
+
+    SWSS_LOG_NOTICE("Set poll offset %u ms for FC %s", pollOffset, instanceId.c_str());
+}
+
 void FlexCounter::addCollectCountersHandler(const std::string &key, const collect_counters_handler_t &handler)
 {
     SWSS_LOG_ENTER();
@@ -200,17 +602,28 @@ void FlexCounter::setPortCounterList(
         return;
     }
 
+    if (portBulkStatsSupport == BULK_STATS_UNKNOWN)
+    {
+        portBulkStatsSupport = fc.saiCheckBulkStatsSupported(
+                SAI_OBJECT_TYPE_PORT,
+                portId,
+                static_cast<uint32_t>(supportedIds.size()),
+                (const sai_stat_id_t *)supportedIds.data()) ? BULK_STATS_SUPPORTED : BULK_STATS_NOT_SUPPORTED;
+    }
+
     std::lock_guard<std::mutex> lkMgr(fc.m_mtx);
 
     auto it = fc.m_portCounterIdsMap.find(portVid);
     if (it != fc.m_portCounterIdsMap.end())
     {
-        (*it).second->portCounterIds = supportedIds;
+        it->second = std::make_shared<PortCounterIds>(portVid, it->second->portId, supportedIds);
+        fc.m_configVersion++;
         return;
     }
 
-    auto portCounterIds = std::make_shared<PortCounterIds>(portId, supportedIds);
+    auto portCounterIds = std::make_shared<PortCounterIds>(portVid, portId, supportedIds);
     fc.m_portCounterIdsMap.emplace(portVid, portCounterIds);
+    fc.m_configVersion++;
 
     fc.addCollectCountersHandler(PORT_COUNTER_ID_LIST, &FlexCounter::collectPortCounters);
 
@@ -253,12 +666,14 @@ void FlexCounter::setPortDebugCounterList(
     auto it = fc.m_portDebugCounterIdsMap.find(portVid);
     if (it != fc.m_portDebugCounterIdsMap.end())
     {
-        it->second->portCounterIds = supportedIds;
+        it->second = std::make_shared<PortCounterIds>(portVid, it->second->portId, supportedIds);
+        fc.m_configVersion++;
         return;
     }
 
-    auto portDebugCounterIds = std::make_shared<PortCounterIds>(portId, supportedIds);
+    auto portDebugCounterIds = std::make_shared<PortCounterIds>(portVid, portId, supportedIds);
     fc.m_portDebugCounterIdsMap.emplace(portVid, portDebugCounterIds);
+    fc.m_configVersion++;
 
     fc.addCollectCountersHandler(PORT_DEBUG_COUNTER_ID_LIST, &FlexCounter::collectPortDebugCounters);
 
@@ -325,17 +740,28 @@ void FlexCounter::setQueueCounterList(
         return;
     }
 
+    if (queueBulkStatsSupport == BULK_STATS_UNKNOWN)
+    {
+        queueBulkStatsSupport = fc.saiCheckBulkStatsSupported(
+                SAI_OBJECT_TYPE_QUEUE,
+                queueId,
+                static_cast<uint32_t>(supportedIds.size()),
+                (const sai_stat_id_t *)supportedIds.data()) ? BULK_STATS_SUPPORTED : BULK_STATS_NOT_SUPPORTED;
+    }
+
     std::lock_guard<std::mutex> lkMgr(fc.m_mtx);
 
     auto it = fc.m_queueCounterIdsMap.find(queueVid);
     if (it != fc.m_queueCounterIdsMap.end())
     {
-        (*it).second->queueCounterIds = supportedIds;
+        it->second = std::make_shared<QueueCounterIds>(queueVid, it->second->queueId, supportedIds);
+        fc.m_configVersion++;
         return;
     }
 
-    auto queueCounterIds = std::make_shared<QueueCounterIds>(queueId, supportedIds);
+    auto queueCounterIds = std::make_shared<QueueCounterIds>(queueVid, queueId, supportedIds);
     fc.m_queueCounterIdsMap.emplace(queueVid, queueCounterIds);
+    fc.m_configVersion++;
 
     fc.addCollectCountersHandler(QUEUE_COUNTER_ID_LIST, &FlexCounter::collectQueueCounters);
 
@@ -361,12 +787,14 @@ void FlexCounter::setQueueAttrList(
     auto it = fc.m_queueAttrIdsMap.find(queueVid);
     if (it != fc.m_queueAttrIdsMap.end())
     {
-        (*it).second->queueAttrIds = attrIds;
+        it->second = std::make_shared<QueueAttrIds>(queueVid, it->second->queueId, attrIds);
+        fc.m_configVersion++;
         return;
     }
 
-    auto queueAttrIds = std::make_shared<QueueAttrIds>(queueId, attrIds);
+    auto queueAttrIds = std::make_shared<QueueAttrIds>(queueVid, queueId, attrIds);
     fc.m_queueAttrIdsMap.emplace(queueVid, queueAttrIds);
+    fc.m_configVersion++;
 
     fc.addCollectCountersHandler(QUEUE_ATTR_ID_LIST, &FlexCounter::collectQueueAttrs);
 
@@ -438,12 +866,14 @@ void FlexCounter::setPriorityGroupCounterList(
     auto it = fc.m_priorityGroupCounterIdsMap.find(priorityGroupVid);
     if (it != fc.m_priorityGroupCounterIdsMap.end())
     {
-        (*it).second->priorityGroupCounterIds = supportedIds;
+        it->second = std::make_shared<IngressPriorityGroupCounterIds>(priorityGroupVid, it->second->priorityGroupId, supportedIds);
+        fc.m_configVersion++;
         return;
     }
 
-    auto priorityGroupCounterIds = std::make_shared<IngressPriorityGroupCounterIds>(priorityGroupId, supportedIds);
+    auto priorityGroupCounterIds = std::make_shared<IngressPriorityGroupCounterIds>(priorityGroupVid, priorityGroupId, supportedIds);
     fc.m_priorityGroupCounterIdsMap.emplace(priorityGroupVid, priorityGroupCounterIds);
+    fc.m_configVersion++;
 
     fc.addCollectCountersHandler(PG_COUNTER_ID_LIST, &FlexCounter::collectPriorityGroupCounters);
 
@@ -486,12 +916,14 @@ void FlexCounter::setSwitchDebugCounterList(
     auto it = fc.m_switchDebugCounterIdsMap.find(switchVid);
     if (it != fc.m_switchDebugCounterIdsMap.end())
     {
-        it->second->switchCounterIds = supportedIds;
+        it->second = std::make_shared<SwitchCounterIds>(switchVid, it->second->switchId, supportedIds);
+        fc.m_configVersion++;
         return;
     }
 
-    auto switchDebugCounterIds = std::make_shared<SwitchCounterIds>(switchId, supportedIds);
+    auto switchDebugCounterIds = std::make_shared<SwitchCounterIds>(switchVid, switchId, supportedIds);
     fc.m_switchDebugCounterIdsMap.emplace(switchVid, switchDebugCounterIds);
+    fc.m_configVersion++;
 
     fc.addCollectCountersHandler(SWITCH_DEBUG_COUNTER_ID_LIST, &FlexCounter::collectSwitchDebugCounters);
 
@@ -517,12 +949,14 @@ void FlexCounter::setPriorityGroupAttrList(
     auto it = fc.m_priorityGroupAttrIdsMap.find(priorityGroupVid);
     if (it != fc.m_priorityGroupAttrIdsMap.end())
     {
-        (*it).second->priorityGroupAttrIds = attrIds;
+        it->second = std::make_shared<IngressPriorityGroupAttrIds>(priorityGroupVid, it->second->priorityGroupId, attrIds);
+        fc.m_configVersion++;
         return;
     }
 
-    auto priorityGroupAttrIds = std::make_shared<IngressPriorityGroupAttrIds>(priorityGroupId, attrIds);
+    auto priorityGroupAttrIds = std::make_shared<IngressPriorityGroupAttrIds>(priorityGroupVid, priorityGroupId, attrIds);
     fc.m_priorityGroupAttrIdsMap.emplace(priorityGroupVid, priorityGroupAttrIds);
+    fc.m_configVersion++;
 
     fc.addCollectCountersHandler(PG_ATTR_ID_LIST, &FlexCounter::collectPriorityGroupAttrs);
 
@@ -577,12 +1011,14 @@ void FlexCounter::setRifCounterList(
     auto it = fc.m_rifCounterIdsMap.find(rifVid);
     if (it != fc.m_rifCounterIdsMap.end())
     {
-        (*it).second->rifCounterIds = supportedIds;
+        it->second = std::make_shared<RifCounterIds>(rifVid, it->second->rifId, supportedIds);
+        fc.m_configVersion++;
         return;
     }
 
-    auto rifCounterIds = std::make_shared<RifCounterIds>(rifId, supportedIds);
+    auto rifCounterIds = std::make_shared<RifCounterIds>(rifVid, rifId, supportedIds);
     fc.m_rifCounterIdsMap.emplace(rifVid, rifCounterIds);
+    fc.m_configVersion++;
 
     fc.addCollectCountersHandler(RIF_COUNTER_ID_LIST, &FlexCounter::collectRifCounters);
 
@@ -648,12 +1084,14 @@ void FlexCounter::setBufferPoolCounterList(
     auto it = fc.m_bufferPoolCounterIdsMap.find(bufferPoolVid);
     if (it != fc.m_bufferPoolCounterIdsMap.end())
     {
-        it->second->bufferPoolCounterIds = supportedIds;
+        it->second = std::make_shared<BufferPoolCounterIds>(bufferPoolVid, it->second->bufferPoolId, supportedIds, it->second->bufferPoolStatsMode);
+        fc.m_configVersion++;
         return;
     }
 
-    auto bufferPoolCounterIds = std::make_shared<BufferPoolCounterIds>(bufferPoolId, supportedIds, bufferPoolStatsMode);
+    auto bufferPoolCounterIds = std::make_shared<BufferPoolCounterIds>(bufferPoolVid, bufferPoolId, supportedIds, bufferPoolStatsMode);
     fc.m_bufferPoolCounterIdsMap.emplace(bufferPoolVid, bufferPoolCounterIds);
+    fc.m_configVersion++;
 
     fc.addCollectCountersHandler(BUFFER_POOL_COUNTER_ID_LIST, &FlexCounter::collectBufferPoolCounters);
 
@@ -672,6 +1110,8 @@ void FlexCounter::removePort(
 
     FlexCounter &fc = getInstance(instanceId);
 
+    // Wait for in progress poll, it may still use removed object
+    std::unique_lock<std::mutex> lkCollect(fc.m_collectMtx);
     std::unique_lock<std::mutex> lkMgr(fc.m_mtx);
 
     auto it = fc.m_portCounterIdsMap.find(portVid);
@@ -683,12 +1123,14 @@ void FlexCounter::removePort(
         if (fc.isEmpty())
         {
             lkMgr.unlock();
+            lkCollect.unlock();
             removeInstance(instanceId);
         }
         return;
     }
 
     fc.m_portCounterIdsMap.erase(it);
+    fc.m_configVersion++;
     if (fc.m_portCounterIdsMap.empty())
     {
         fc.removeCollectCountersHandler(PORT_COUNTER_ID_LIST);
@@ -698,6 +1140,7 @@ void FlexCounter::removePort(
     if (fc.isEmpty())
     {
         lkMgr.unlock();
+        lkCollect.unlock();
         removeInstance(instanceId);
     }
 }
@@ -710,6 +1153,8 @@ void FlexCounter::removePortDebugCounters(
 
     FlexCounter &fc = getInstance(instanceId);
 
+    // Wait for in progress poll, it may still use removed object
+    std::unique_lock<std::mutex> lkCollect(fc.m_collectMtx);
     std::unique_lock<std::mutex> lkMgr(fc.m_mtx);
 
     auto it = fc.m_portDebugCounterIdsMap.find(portVid);
@@ -721,12 +1166,14 @@ void FlexCounter::removePortDebugCounters(
         if (fc.isEmpty())
         {
             lkMgr.unlock();
+            lkCollect.unlock();
             removeInstance(instanceId);
         }
         return;
     }
 
     fc.m_portDebugCounterIdsMap.erase(it);
+    fc.m_configVersion++;
     if (fc.m_portDebugCounterIdsMap.empty())
     {
         fc.removeCollectCountersHandler(PORT_DEBUG_COUNTER_ID_LIST);
@@ -736,6 +1183,7 @@ void FlexCounter::removePortDebugCounters(
     if (fc.isEmpty())
     {
         lkMgr.unlock();
+        lkCollect.unlock();
         removeInstance(instanceId);
     }
 }
@@ -749,12 +1197,15 @@ void FlexCounter::removeQueue(
     bool found = false;
     FlexCounter &fc = getInstance(instanceId);
 
+    // Wait for in progress poll, it may still use removed object
+    std::unique_lock<std::mutex> lkCollect(fc.m_collectMtx);
     std::unique_lock<std::mutex> lkMgr(fc.m_mtx);
 
     auto counterIter = fc.m_queueCounterIdsMap.find(queueVid);
     if (counterIter != fc.m_queueCounterIdsMap.end())
     {
         fc.m_queueCounterIdsMap.erase(counterIter);
+        fc.m_configVersion++;
         if (fc.m_queueCounterIdsMap.empty())
         {
             fc.removeCollectCountersHandler(QUEUE_COUNTER_ID_LIST);
@@ -766,6 +1217,7 @@ void FlexCounter::removeQueue(
     if (attrIter != fc.m_queueAttrIdsMap.end())
     {
         fc.m_queueAttrIdsMap.erase(attrIter);
+        fc.m_configVersion++;
         if (fc.m_queueAttrIdsMap.empty())
         {
             fc.removeCollectCountersHandler(QUEUE_ATTR_ID_LIST);
@@ -783,6 +1235,7 @@ void FlexCounter::removeQueue(
     if (fc.isEmpty())
     {
         lkMgr.unlock();
+        lkCollect.unlock();
         removeInstance(instanceId);
     }
 }
@@ -796,12 +1249,15 @@ void FlexCounter::removePriorityGroup(
     bool found = false;
     FlexCounter &fc = getInstance(instanceId);
 
+    // Wait for in progress poll, it may still use removed object
+    std::unique_lock<std::mutex> lkCollect(fc.m_collectMtx);
     std::unique_lock<std::mutex> lkMgr(fc.m_mtx);
 
     auto counterIter = fc.m_priorityGroupCounterIdsMap.find(priorityGroupVid);
     if (counterIter != fc.m_priorityGroupCounterIdsMap.end())
     {
         fc.m_priorityGroupCounterIdsMap.erase(counterIter);
+        fc.m_configVersion++;
         if (fc.m_priorityGroupCounterIdsMap.empty())
         {
             fc.removeCollectCountersHandler(PG_COUNTER_ID_LIST);
@@ -813,6 +1269,7 @@ void FlexCounter::removePriorityGroup(
     if (attrIter != fc.m_priorityGroupAttrIdsMap.end())
     {
         fc.m_priorityGroupAttrIdsMap.erase(attrIter);
+        fc.m_configVersion++;
         if (fc.m_priorityGroupAttrIdsMap.empty())
         {
             fc.removeCollectCountersHandler(PG_ATTR_ID_LIST);
@@ -830,6 +1287,7 @@ void FlexCounter::removePriorityGroup(
     if (fc.isEmpty())
     {
         lkMgr.unlock();
+        lkCollect.unlock();
         removeInstance(instanceId);
     }
 }
@@ -842,6 +1300,8 @@ void FlexCounter::removeRif(
 
     FlexCounter &fc = getInstance(instanceId);
 
+    // Wait for in progress poll, it may still use removed object
+    std::unique_lock<std::mutex> lkCollect(fc.m_collectMtx);
     std::unique_lock<std::mutex> lkMgr(fc.m_mtx);
 
     auto it = fc.m_rifCounterIdsMap.find(rifVid);
@@ -853,12 +1313,14 @@ void FlexCounter::removeRif(
         if (fc.isEmpty())
         {
             lkMgr.unlock();
+            lkCollect.unlock();
             removeInstance(instanceId);
         }
         return;
     }
 
     fc.m_rifCounterIdsMap.erase(it);
+    fc.m_configVersion++;
     if (fc.m_rifCounterIdsMap.empty())
     {
         fc.removeCollectCountersHandler(RIF_COUNTER_ID_LIST);
@@ -868,6 +1330,7 @@ void FlexCounter::removeRif(
     if (fc.isEmpty())
     {
         lkMgr.unlock();
+        lkCollect.unlock();
         removeInstance(instanceId);
     }
 }
@@ -881,12 +1344,15 @@ void FlexCounter::removeBufferPool(
     bool found = false;
     FlexCounter &fc = getInstance(instanceId);
 
+    // Wait for in progress poll, it may still use removed object
+    std::unique_lock<std::mutex> lkCollect(fc.m_collectMtx);
     std::unique_lock<std::mutex> lkMgr(fc.m_mtx);
 
     auto it = fc.m_bufferPoolCounterIdsMap.find(bufferPoolVid);
     if (it != fc.m_bufferPoolCounterIdsMap.end())
     {
         fc.m_bufferPoolCounterIdsMap.erase(it);
+        fc.m_configVersion++;
         if (fc.m_bufferPoolCounterIdsMap.empty())
         {
             fc.removeCollectCountersHandler(BUFFER_POOL_COUNTER_ID_LIST);
@@ -904,6 +1370,7 @@ void FlexCounter::removeBufferPool(
     if (fc.isEmpty())
     {
         lkMgr.unlock();
+        lkCollect.unlock();
         removeInstance(instanceId);
     }
 }
@@ -916,6 +1383,8 @@ void FlexCounter::removeSwitchDebugCounters(
 
     FlexCounter &fc = getInstance(instanceId);
 
+    // Wait for in progress poll, it may still use removed object
+    std::unique_lock<std::mutex> lkCollect(fc.m_collectMtx);
     std::unique_lock<std::mutex> lkMgr(fc.m_mtx);
 
     auto it = fc.m_switchDebugCounterIdsMap.find(switchVid);
@@ -927,12 +1396,14 @@ void FlexCounter::removeSwitchDebugCounters(
         if (fc.isEmpty())
         {
             lkMgr.unlock();
+            lkCollect.unlock();
             removeInstance(instanceId);
         }
         return;
     }
 
     fc.m_switchDebugCounterIdsMap.erase(it);
+    fc.m_configVersion++;
     if (fc.m_switchDebugCounterIdsMap.empty())
     {
         fc.removeCollectCountersHandler(SWITCH_DEBUG_COUNTER_ID_LIST);
@@ -942,6 +1413,7 @@ void FlexCounter::removeSwitchDebugCounters(
     if (fc.isEmpty())
     {
         lkMgr.unlock();
+        lkCollect.unlock();
         removeInstance(instanceId);
     }
 }
@@ -956,6 +1428,11 @@ void FlexCounter::addPortCounterPlugin(
 
     std::lock_guard<std::mutex> lkMgr(fc.m_mtx);
 
+    if (fc.addNativePlugin(sha, SAI_OBJECT_TYPE_PORT))
+    {
+        return;
+    }
+
     if (fc.m_portPlugins.find(sha) != fc.m_portPlugins.end() ||
             fc.m_queuePlugins.find(sha) != fc.m_queuePlugins.end() ||
             fc.m_priorityGroupPlugins.find(sha) != fc.m_priorityGroupPlugins.end())
@@ -964,6 +1441,7 @@ void FlexCounter::addPortCounterPlugin(
     }
 
     fc.m_portPlugins.insert(sha);
+    fc.m_configVersion++;
     SWSS_LOG_NOTICE("Port counters plugin %s registered", sha.c_str());
 }
 
@@ -977,6 +1455,11 @@ void FlexCounter::addQueueCounterPlugin(
 
     std::lock_guard<std::mutex> lkMgr(fc.m_mtx);
 
+    if (fc.addNativePlugin(sha, SAI_OBJECT_TYPE_QUEUE))
+    {
+        return;
+    }
+
     if (fc.m_portPlugins.find(sha) != fc.m_portPlugins.end() ||
             fc.m_queuePlugins.find(sha) != fc.m_queuePlugins.end() ||
             fc.m_priorityGroupPlugins.find(sha) != fc.m_priorityGroupPlugins.end())
@@ -985,6 +1468,7 @@ void FlexCounter::addQueueCounterPlugin(
     }
 
     fc.m_queuePlugins.insert(sha);
+    fc.m_configVersion++;
     SWSS_LOG_NOTICE("Queue counters plugin %s registered", sha.c_str());
 }
 
@@ -998,6 +1482,11 @@ void FlexCounter::addPriorityGroupCounterPlugin(
 
     std::lock_guard<std::mutex> lkMgr(fc.m_mtx);
 
+    if (fc.addNativePlugin(sha, SAI_OBJECT_TYPE_INGRESS_PRIORITY_GROUP))
+    {
+        return;
+    }
+
     if (fc.m_portPlugins.find(sha) != fc.m_portPlugins.end() ||
             fc.m_queuePlugins.find(sha) != fc.m_queuePlugins.end() ||
             fc.m_priorityGroupPlugins.find(sha) != fc.m_priorityGroupPlugins.end())
@@ -1006,6 +1495,7 @@ void FlexCounter::addPriorityGroupCounterPlugin(
     }
 
     fc.m_priorityGroupPlugins.insert(sha);
+    fc.m_configVersion++;
     SWSS_LOG_NOTICE("Priority group counters plugin %s registered", sha.c_str());
 }
 
@@ -1019,15 +1509,50 @@ void FlexCounter::addBufferPoolCounterPlugin(
 
     std::lock_guard<std::mutex> lkMgr(fc.m_mtx);
 
+    if (fc.addNativePlugin(sha, SAI_OBJECT_TYPE_BUFFER_POOL))
+    {
+        return;
+    }
+
     if (fc.m_bufferPoolPlugins.find(sha) != fc.m_bufferPoolPlugins.end())
     {
         SWSS_LOG_ERROR("Plugin %s already registered", sha.c_str());
     }
 
     fc.m_bufferPoolPlugins.insert(sha);
+    fc.m_configVersion++;
     SWSS_LOG_NOTICE("Buffer pool counters plugin %s registered", sha.c_str());
 }
 
+bool FlexCounter::addNativePlugin(
+        _In_ const std::string &name,
+        _In_ sai_object_type_t objectType)
+{
+    SWSS_LOG_ENTER();
+
+    auto plugin = FlexCounterPlugin::create(name, objectType);
+
+    if (plugin == nullptr)
+    {
+        return false;
+    }
+
+    if (m_nativePlugins.find(name) != m_nativePlugins.end())
+    {
+        SWSS_LOG_ERROR("Native plugin %s already registered", name.c_str());
+        return true;
+    }
+
+    m_nativePlugins[name] = plugin;
+    m_configVersion++;
+
+    SWSS_LOG_NOTICE("%s counters native plugin %s registered",
+            sai_serialize_object_type(objectType).c_str(),
+            name.c_str());
+
+    return true;
+}
+
 void FlexCounter::removeCounterPlugin(
         _In_ std::string sha,
         _In_ std::string instanceId)
@@ -1042,6 +1567,8 @@ void FlexCounter::removeCounterPlugin(
     fc.m_portPlugins.erase(sha);
     fc.m_priorityGroupPlugins.erase(sha);
     fc.m_bufferPoolPlugins.erase(sha);
+    fc.m_nativePlugins.erase(sha);
+    fc.m_configVersion++;
 
     // Remove flex counter if all counter IDs and plugins are unregistered
     if (fc.isEmpty())
@@ -1064,6 +1591,8 @@ void FlexCounter::removeCounterPlugin(
     fc.m_portPlugins.clear();
     fc.m_priorityGroupPlugins.clear();
     fc.m_bufferPoolPlugins.clear();
+    fc.m_nativePlugins.clear();
+    fc.m_configVersion++;
 
     // Remove flex counter if all counter IDs and plugins are unregistered
     if (fc.isEmpty())
@@ -1086,6 +1615,11 @@ FlexCounter::~FlexCounter(void)
     SWSS_LOG_ENTER();
 
     endFlexCounterThread();
+
+    swss::DBConnector db("COUNTERS_DB", 0);
+    swss::Table statsTable(&db, FLEX_COUNTER_POLL_STATS_TABLE);
+
+    statsTable.del(m_instanceId);
 }
 
 bool FlexCounter::isEmpty()
@@ -1117,7 +1651,8 @@ bool FlexCounter::allPluginsEmpty()
     return m_priorityGroupPlugins.empty() &&
            m_queuePlugins.empty() &&
            m_portPlugins.empty() &&
-           m_bufferPoolPlugins.empty();
+           m_bufferPoolPlugins.empty() &&
+           m_nativePlugins.empty();
 }
 
 bool FlexCounter::isPortCounterSupported(sai_port_stat_t counter) const
@@ -1180,31 +1715,180 @@ void FlexCounter::removeInstance(std::string instanceId)
     g_flex_counters_map.erase(instanceId);
 }
 
+void FlexCounter::takeSnapshot(
+        _Inout_ CountersSnapshot &snapshot)
+{
+    SWSS_LOG_ENTER();
+
+    if (snapshot.version != m_configVersion)
+    {
+        copyConfig(snapshot);
+    }
+
+    /*
+     * In delta mode all values are still written periodically, so values
+     * removed from counters table by someone else are restored.
+     */
+
+    snapshot.fullRefresh = !m_deltaPublish || (m_pollCycle % m_fullRefreshCycles == 0);
+
+    m_pollCycle++;
+}
+
+void FlexCounter::copyConfig(
+        _Out_ CountersSnapshot &snapshot)
+{
+    SWSS_LOG_ENTER();
+
+    snapshot.portCounterIdsMap = m_portCounterIdsMap;
+    snapshot.portDebugCounterIdsMap = m_portDebugCounterIdsMap;
+    snapshot.queueCounterIdsMap = m_queueCounterIdsMap;
+    snapshot.queueAttrIdsMap = m_queueAttrIdsMap;
+    snapshot.priorityGroupCounterIdsMap = m_priorityGroupCounterIdsMap;
+    snapshot.priorityGroupAttrIdsMap = m_priorityGroupAttrIdsMap;
+    snapshot.rifCounterIdsMap = m_rifCounterIdsMap;
+    snapshot.bufferPoolCounterIdsMap = m_bufferPoolCounterIdsMap;
+    snapshot.switchDebugCounterIdsMap = m_switchDebugCounterIdsMap;
+
+    snapshot.queuePlugins = m_queuePlugins;
+    snapshot.portPlugins = m_portPlugins;
+    snapshot.priorityGroupPlugins = m_priorityGroupPlugins;
+    snapshot.bufferPoolPlugins = m_bufferPoolPlugins;
+    snapshot.nativePlugins = m_nativePlugins;
+
+    snapshot.handlers = m_collectCountersHandlers;
+
+    snapshot.pollInterval = m_pollInterval;
+    snapshot.statsMode = m_statsMode;
+
+    snapshot.version = m_configVersion;
+}
+
+template <typename T>
+void FlexCounter::splitMap(
+        _In_ const std::map<sai_object_id_t, T> &source,
+        _In_ std::map<sai_object_id_t, T> CountersSnapshot::*member,
+        _Inout_ std::vector<CountersSnapshot> &parts,
+        _Inout_ size_t &next)
+{
+    SWSS_LOG_ENTER();
+
+    for (const auto &kv: source)
+    {
+        (parts[next].*member).emplace_hint((parts[next].*member).end(), kv.first, kv.second);
+
+        next = (next + 1) % parts.size();
+    }
+}
+
+void FlexCounter::splitSnapshot(
+        _In_ const CountersSnapshot &snapshot,
+        _Out_ std::vector<CountersSnapshot> &parts)
+{
+    SWSS_LOG_ENTER();
+
+    /*
+     * Objects of all types are dealt round robin, so each worker gets
+     * similar number of objects even when single type dominates (queues).
+     * Plugins are not split since they are executed once per cycle after
+     * all workers finished.
+     */
+
+    for (auto &part: parts)
+    {
+        part.handlers = snapshot.handlers;
+        part.pollInterval = snapshot.pollInterval;
+        part.statsMode = snapshot.statsMode;
+        part.fullRefresh = snapshot.fullRefresh;
+        part.version = snapshot.version;
+    }
+
+    size_t next = 0;
+
+    splitMap(snapshot.portCounterIdsMap, &CountersSnapshot::portCounterIdsMap, parts, next);
+    splitMap(snapshot.portDebugCounterIdsMap, &CountersSnapshot::portDebugCounterIdsMap, parts, next);
+    splitMap(snapshot.queueCounterIdsMap, &CountersSnapshot::queueCounterIdsMap, parts, next);
+    splitMap(snapshot.queueAttrIdsMap, &CountersSnapshot::queueAttrIdsMap, parts, next);
+    splitMap(snapshot.priorityGroupCounterIdsMap, &CountersSnapshot::priorityGroupCounterIdsMap, parts, next);
+    splitMap(snapshot.priorityGroupAttrIdsMap, &CountersSnapshot::priorityGroupAttrIdsMap, parts, next);
+    splitMap(snapshot.rifCounterIdsMap, &CountersSnapshot::rifCounterIdsMap, parts, next);
+    splitMap(snapshot.bufferPoolCounterIdsMap, &CountersSnapshot::bufferPoolCounterIdsMap, parts, next);
+    splitMap(snapshot.switchDebugCounterIdsMap, &CountersSnapshot::switchDebugCounterIdsMap, parts, next);
+}
+
+void FlexCounter::prepareBulkStats(
+        _Inout_ CountersSnapshot &snapshot)
+{
+    SWSS_LOG_ENTER();
+
+    snapshot.portBulkStatsGroups.clear();
+    snapshot.queueBulkStatsGroups.clear();
+
+    if (portBulkStatsSupport == BULK_STATS_SUPPORTED)
+    {
+        buildBulkStatsGroups(
+                snapshot.portCounterIdsMap,
+                &PortCounterIds::portId,
+                &PortCounterIds::portCounterIds,
+                snapshot.portBulkStatsGroups);
+    }
+
+    if (queueBulkStatsSupport == BULK_STATS_SUPPORTED)
+    {
+        buildBulkStatsGroups(
+                snapshot.queueCounterIdsMap,
+                &QueueCounterIds::queueId,
+                &QueueCounterIds::queueCounterIds,
+                snapshot.queueBulkStatsGroups);
+    }
+}
+
 void FlexCounter::collectCounters(
+        _In_ const CountersSnapshot &snapshot,
         _In_ swss::Table &countersTable)
 {
     SWSS_LOG_ENTER();
 
-    for (const auto &it : m_collectCountersHandlers)
+    for (const auto &it : snapshot.handlers)
     {
-        (this->*(it.second))(countersTable);
+        (this->*(it.second))(snapshot, countersTable);
     }
 
     countersTable.flush();
 }
 
-void FlexCounter::collectPortCounters(_In_ swss::Table &countersTable)
+void FlexCounter::collectPortCounters(
+        _In_ const CountersSnapshot &snapshot,
+        _In_ swss::Table &countersTable)
 {
     SWSS_LOG_ENTER();
 
+    const auto *portCounterIdsMap = &snapshot.portCounterIdsMap;
+
+    std::map<sai_object_id_t, std::shared_ptr<PortCounterIds>> remaining;
+
+    if (portBulkStatsSupport == BULK_STATS_SUPPORTED)
+    {
+        collectStatsBulk(
+                SAI_OBJECT_TYPE_PORT,
+                snapshot.portCounterIdsMap,
+                snapshot.portBulkStatsGroups,
+                SAI_STATS_MODE_READ,
+                snapshot.fullRefresh,
+                countersTable,
+                portBulkStatsSupport,
+                remaining);
+
+        portCounterIdsMap = &remaining;
+    }
+
     // Collect stats for every registered port
-    for (const auto &kv: m_portCounterIdsMap)
+    for (const auto &kv: *portCounterIdsMap)
     {
-        const auto &portVid = kv.first;
         const auto &portId = kv.second->portId;
         const auto &portCounterIds = kv.second->portCounterIds;
 
-        std::vector<uint64_t> portStats(portCounterIds.size());
+        std::vector<uint64_t> &portStats = kv.second->stats;
 
         // Get port stats
         sai_status_t status = sai_metadata_sai_port_api->get_port_stats(
@@ -1218,34 +1902,30 @@ void FlexCounter::collectPortCounters(_In_ swss::Table &countersTable)
             continue;
         }
 
-        // Push all counter values to a single vector
-        std::vector<swss::FieldValueTuple> values;
-
+        // Update cached values, field names are set at registration
         for (size_t i = 0; i != portCounterIds.size(); i++)
         {
-            const std::string &counterName = sai_serialize_port_stat(portCounterIds[i]);
-            values.emplace_back(counterName, std::to_string(portStats[i]));
+            kv.second->setCounterValue(i, portStats[i]);
         }
 
         // Write counters to DB
-        std::string portVidStr = sai_serialize_object_id(portVid);
-
-        countersTable.set(portVidStr, values, "");
+        kv.second->publish(countersTable, snapshot.fullRefresh);
     }
 }
 
-void FlexCounter::collectPortDebugCounters(_In_ swss::Table &countersTable)
+void FlexCounter::collectPortDebugCounters(
+        _In_ const CountersSnapshot &snapshot,
+        _In_ swss::Table &countersTable)
 {
     SWSS_LOG_ENTER();
 
     // Collect stats for every registered port
-    for (const auto &kv: m_portDebugCounterIdsMap)
+    for (const auto &kv: snapshot.portDebugCounterIdsMap)
     {
-        const auto &portVid = kv.first;
         const auto &portId = kv.second->portId;
         const auto &portCounterIds = kv.second->portCounterIds;
 
-        std::vector<uint64_t> portStats(portCounterIds.size());
+        std::vector<uint64_t> &portStats = kv.second->stats;
 
         // Get port stats
         sai_status_t status = sai_metadata_sai_port_api->get_port_stats_ext(
@@ -1260,34 +1940,54 @@ void FlexCounter::collectPortDebugCounters(_In_ swss::Table &countersTable)
             continue;
         }
 
-        // Push all counter values to a single vector
-        std::vector<swss::FieldValueTuple> values;
-
+        // Update cached values, field names are set at registration
         for (size_t i = 0; i != portCounterIds.size(); i++)
         {
-            const std::string &counterName = sai_serialize_port_stat(portCounterIds[i]);
-            values.emplace_back(counterName, std::to_string(portStats[i]));
+            kv.second->setCounterValue(i, portStats[i]);
         }
 
         // Write counters to DB
-        std::string portVidStr = sai_serialize_object_id(portVid);
-
-        countersTable.set(portVidStr, values, "");
+        kv.second->publish(countersTable, snapshot.fullRefresh);
     }
 }
 
-void FlexCounter::collectQueueCounters(_In_ swss::Table &countersTable)
+void FlexCounter::collectQueueCounters(
+        _In_ const CountersSnapshot &snapshot,
+        _In_ swss::Table &countersTable)
 {
     SWSS_LOG_ENTER();
 
+    const auto *queueCounterIdsMap = &snapshot.queueCounterIdsMap;
+
+    std::map<sai_object_id_t, std::shared_ptr<QueueCounterIds>> remaining;
+
+    auto &modeSupport = (snapshot.statsMode == SAI_STATS_MODE_READ_AND_CLEAR) ?
+        queueBulkReadAndClearStatsSupport : queueBulkStatsSupport;
+
+    if (queueBulkStatsSupport == BULK_STATS_SUPPORTED && modeSupport != BULK_STATS_NOT_SUPPORTED)
+    {
+        // Bulk call reads and clears in one step, depending on stats mode
+        collectStatsBulk(
+                SAI_OBJECT_TYPE_QUEUE,
+                snapshot.queueCounterIdsMap,
+                snapshot.queueBulkStatsGroups,
+                snapshot.statsMode,
+                snapshot.fullRefresh,
+                countersTable,
+                modeSupport,
+                remaining);
+
+        queueCounterIdsMap = &remaining;
+    }
+
     // Collect stats for every registered queue
-    for (const auto &kv: m_queueCounterIdsMap)
+    for (const auto &kv: *queueCounterIdsMap)
     {
         const auto &queueVid = kv.first;
         const auto &queueId = kv.second->queueId;
         const auto &queueCounterIds = kv.second->queueCounterIds;
 
-        std::vector<uint64_t> queueStats(queueCounterIds.size());
+        std::vector<uint64_t> &queueStats = kv.second->stats;
 
         // Get queue stats
         sai_status_t status = -1;
@@ -1297,7 +1997,7 @@ void FlexCounter::collectQueueCounters(_In_ swss::Table &countersTable)
         //         queueId,
         //         static_cast<uint32_t>(queueCounterIds.size()),
         //         queueCounterIds.data(),
-        //         m_statsMode,
+        //         snapshot.statsMode,
         //         queueStats.data());
         status = sai_metadata_sai_queue_api->get_queue_stats(
                 queueId,
@@ -1309,7 +2009,7 @@ void FlexCounter::collectQueueCounters(_In_ swss::Table &countersTable)
             SWSS_LOG_ERROR("%s: failed to get stats of queue 0x%" PRIx64 ": %d", m_instanceId.c_str(), queueVid, status);
             continue;
         }
-        if (m_statsMode == SAI_STATS_MODE_READ_AND_CLEAR){
+        if (snapshot.statsMode == SAI_STATS_MODE_READ_AND_CLEAR){
             status = sai_metadata_sai_queue_api->clear_queue_stats(
                     queueId,
                     static_cast<uint32_t>(queueCounterIds.size()),
@@ -1321,28 +2021,25 @@ void FlexCounter::collectQueueCounters(_In_ swss::Table &countersTable)
             }
         }
 
-        // Push all counter values to a single vector
-        std::vector<swss::FieldValueTuple> values;
-
+        // Update cached values, field names are set at registration
         for (size_t i = 0; i != queueCounterIds.size(); i++)
         {
-            const std::string &counterName = sai_serialize_queue_stat(queueCounterIds[i]);
-            values.emplace_back(counterName, std::to_string(queueStats[i]));
+            kv.second->setCounterValue(i, queueStats[i]);
         }
 
         // Write counters to DB
-        std::string queueVidStr = sai_serialize_object_id(queueVid);
-
-        countersTable.set(queueVidStr, values, "");
+        kv.second->publish(countersTable, snapshot.fullRefresh);
     }
 }
 
-void FlexCounter::collectQueueAttrs(_In_ swss::Table &countersTable)
+void FlexCounter::collectQueueAttrs(
+        _In_ const CountersSnapshot &snapshot,
+        _In_ swss::Table &countersTable)
 {
     SWSS_LOG_ENTER();
 
     // Collect attrs for every registered queue
-    for (const auto &kv: m_queueAttrIdsMap)
+    for (const auto &kv: snapshot.queueAttrIdsMap)
     {
         const auto &queueVid = kv.first;
         const auto &queueId = kv.second->queueId;
@@ -1367,35 +2064,33 @@ void FlexCounter::collectQueueAttrs(_In_ swss::Table &countersTable)
             continue;
         }
 
-        // Push all counter values to a single vector
-        std::vector<swss::FieldValueTuple> values;
-
+        // Update cached values, field names are set at registration
         for (size_t i = 0; i != queueAttrIds.size(); i++)
         {
-            const std::string &counterName = sai_serialize_queue_attr(queueAttrIds[i]);
             auto meta = sai_metadata_get_attr_metadata(SAI_OBJECT_TYPE_QUEUE, queueAttr[i].id);
 
-            values.emplace_back(counterName, sai_serialize_attr_value(*meta, queueAttr[i]));
+            kv.second->values[i].second = sai_serialize_attr_value(*meta, queueAttr[i]);
         }
-        // Write counters to DB
-        std::string queueVidStr = sai_serialize_object_id(queueVid);
 
-        countersTable.set(queueVidStr, values, "");
+        // Write counters to DB
+        kv.second->publish(countersTable, snapshot.fullRefresh);
     }
 }
 
-void FlexCounter::collectPriorityGroupCounters(_In_ swss::Table &countersTable)
+void FlexCounter::collectPriorityGroupCounters(
+        _In_ const CountersSnapshot &snapshot,
+        _In_ swss::Table &countersTable)
 {
     SWSS_LOG_ENTER();
 
     // Collect stats for every registered ingress priority group
-    for (const auto &kv: m_priorityGroupCounterIdsMap)
+    for (const auto &kv: snapshot.priorityGroupCounterIdsMap)
     {
         const auto &priorityGroupVid = kv.first;
         const auto &priorityGroupId = kv.second->priorityGroupId;
         const auto &priorityGroupCounterIds = kv.second->priorityGroupCounterIds;
 
-        std::vector<uint64_t> priorityGroupStats(priorityGroupCounterIds.size());
+        std::vector<uint64_t> &priorityGroupStats = kv.second->stats;
 
         // Get PG stats
         sai_status_t status = -1;
@@ -1410,7 +2105,7 @@ void FlexCounter::collectPriorityGroupCounters(_In_ swss::Table &countersTable)
             SWSS_LOG_ERROR("%s: failed to get %ld/%ld stats of PG 0x%" PRIx64 ": %d", m_instanceId.c_str(), priorityGroupCounterIds.size(), priorityGroupStats.size(), priorityGroupVid, status);
             continue;
         }
-        if (m_statsMode == SAI_STATS_MODE_READ_AND_CLEAR){
+        if (snapshot.statsMode == SAI_STATS_MODE_READ_AND_CLEAR){
             status = sai_metadata_sai_buffer_api->clear_ingress_priority_group_stats(
                             priorityGroupId,
                             static_cast<uint32_t>(priorityGroupCounterIds.size()),
@@ -1422,34 +2117,30 @@ void FlexCounter::collectPriorityGroupCounters(_In_ swss::Table &countersTable)
             }
         }
 
-        // Push all counter values to a single vector
-        std::vector<swss::FieldValueTuple> values;
-
+        // Update cached values, field names are set at registration
         for (size_t i = 0; i != priorityGroupCounterIds.size(); i++)
         {
-            const std::string &counterName = sai_serialize_ingress_priority_group_stat(priorityGroupCounterIds[i]);
-            values.emplace_back(counterName, std::to_string(priorityGroupStats[i]));
+            kv.second->setCounterValue(i, priorityGroupStats[i]);
         }
 
         // Write counters to DB
-        std::string priorityGroupVidStr = sai_serialize_object_id(priorityGroupVid);
-
-        countersTable.set(priorityGroupVidStr, values, "");
+        kv.second->publish(countersTable, snapshot.fullRefresh);
     }
 }
 
-void FlexCounter::collectSwitchDebugCounters(_In_ swss::Table &countersTable)
+void FlexCounter::collectSwitchDebugCounters(
+        _In_ const CountersSnapshot &snapshot,
+        _In_ swss::Table &countersTable)
 {
     SWSS_LOG_ENTER();
 
     // Collect stats for every registered port
-    for (const auto &kv: m_switchDebugCounterIdsMap)
+    for (const auto &kv: snapshot.switchDebugCounterIdsMap)
     {
-        const auto &switchVid = kv.first;
         const auto &switchId = kv.second->switchId;
         const auto &switchCounterIds = kv.second->switchCounterIds;
 
-        std::vector<uint64_t> switchStats(switchCounterIds.size());
+        std::vector<uint64_t> &switchStats = kv.second->stats;
 
         // Get port stats
         sai_status_t status = sai_metadata_sai_switch_api->get_switch_stats_ext(
@@ -1464,28 +2155,25 @@ void FlexCounter::collectSwitchDebugCounters(_In_ swss::Table &countersTable)
             continue;
         }
 
-        // Push all counter values to a single vector
-        std::vector<swss::FieldValueTuple> values;
-
+        // Update cached values, field names are set at registration
         for (size_t i = 0; i != switchCounterIds.size(); i++)
         {
-            const std::string &counterName = sai_serialize_switch_stat(switchCounterIds[i]);
-            values.emplace_back(counterName, std::to_string(switchStats[i]));
+            kv.second->setCounterValue(i, switchStats[i]);
         }
 
         // Write counters to DB
-        std::string switchVidStr = sai_serialize_object_id(switchVid);
-
-        countersTable.set(switchVidStr, values, "");
+        kv.second->publish(countersTable, snapshot.fullRefresh);
     }
 }
 
-void FlexCounter::collectPriorityGroupAttrs(_In_ swss::Table &countersTable)
+void FlexCounter::collectPriorityGroupAttrs(
+        _In_ const CountersSnapshot &snapshot,
+        _In_ swss::Table &countersTable)
 {
     SWSS_LOG_ENTER();
 
     // Collect attrs for every registered priority group
-    for (const auto &kv: m_priorityGroupAttrIdsMap)
+    for (const auto &kv: snapshot.priorityGroupAttrIdsMap)
     {
         const auto &priorityGroupVid = kv.first;
         const auto &priorityGroupId = kv.second->priorityGroupId;
@@ -1510,35 +2198,32 @@ void FlexCounter::collectPriorityGroupAttrs(_In_ swss::Table &countersTable)
             continue;
         }
 
-        // Push all counter values to a single vector
-        std::vector<swss::FieldValueTuple> values;
-
+        // Update cached values, field names are set at registration
         for (size_t i = 0; i != priorityGroupAttrIds.size(); i++)
         {
-            const std::string &counterName = sai_serialize_ingress_priority_group_attr(priorityGroupAttrIds[i]);
             auto meta = sai_metadata_get_attr_metadata(SAI_OBJECT_TYPE_INGRESS_PRIORITY_GROUP, priorityGroupAttr[i].id);
 
-            values.emplace_back(counterName, sai_serialize_attr_value(*meta, priorityGroupAttr[i]));
+            kv.second->values[i].second = sai_serialize_attr_value(*meta, priorityGroupAttr[i]);
         }
-        // Write counters to DB
-        std::string priorityGroupVidStr = sai_serialize_object_id(priorityGroupVid);
 
-        countersTable.set(priorityGroupVidStr, values, "");
+        // Write counters to DB
+        kv.second->publish(countersTable, snapshot.fullRefresh);
     }
 }
 
-void FlexCounter::collectRifCounters(_In_ swss::Table &countersTable)
+void FlexCounter::collectRifCounters(
+        _In_ const CountersSnapshot &snapshot,
+        _In_ swss::Table &countersTable)
 {
     SWSS_LOG_ENTER();
 
     // Collect stats for every registered router interface
-    for (const auto &kv: m_rifCounterIdsMap)
+    for (const auto &kv: snapshot.rifCounterIdsMap)
     {
-        const auto &rifVid = kv.first;
         const auto &rifId = kv.second->rifId;
         const auto &rifCounterIds = kv.second->rifCounterIds;
 
-        std::vector<uint64_t> rifStats(rifCounterIds.size());
+        std::vector<uint64_t> &rifStats = kv.second->stats;
 
         // Get rif stats
         sai_status_t status = sai_metadata_sai_router_interface_api->get_router_interface_stats(
@@ -1552,35 +2237,31 @@ void FlexCounter::collectRifCounters(_In_ swss::Table &countersTable)
             continue;
         }
 
-        // Push all counter values to a single vector
-        std::vector<swss::FieldValueTuple> values;
-
+        // Update cached values, field names are set at registration
         for (size_t i = 0; i != rifCounterIds.size(); i++)
         {
-            const std::string &counterName = sai_serialize_router_interface_stat(rifCounterIds[i]);
-            values.emplace_back(counterName, std::to_string(rifStats[i]));
+            kv.second->setCounterValue(i, rifStats[i]);
         }
 
         // Write counters to DB
-        std::string rifVidStr = sai_serialize_object_id(rifVid);
-
-        countersTable.set(rifVidStr, values, "");
+        kv.second->publish(countersTable, snapshot.fullRefresh);
     }
 }
 
-void FlexCounter::collectBufferPoolCounters(_In_ swss::Table &countersTable)
+void FlexCounter::collectBufferPoolCounters(
+        _In_ const CountersSnapshot &snapshot,
+        _In_ swss::Table &countersTable)
 {
     SWSS_LOG_ENTER();
 
     // Collect stats for every registered buffer pool
-    for (const auto &it : m_bufferPoolCounterIdsMap)
+    for (const auto &it : snapshot.bufferPoolCounterIdsMap)
     {
-        const auto &bufferPoolVid = it.first;
         const auto &bufferPoolId = it.second->bufferPoolId;
         const auto &bufferPoolCounterIds = it.second->bufferPoolCounterIds;
         const auto &bufferPoolStatsMode = it.second->bufferPoolStatsMode;
 
-        std::vector<uint64_t> bufferPoolStats(bufferPoolCounterIds.size());
+        std::vector<uint64_t> &bufferPoolStats = it.second->stats;
 
         // Get buffer pool stats
         sai_status_t status = -1;
@@ -1600,7 +2281,7 @@ void FlexCounter::collectBufferPoolCounters(_In_ swss::Table &countersTable)
                     sai_serialize_status(status).c_str());
             continue;
         }
-        if (m_statsMode == SAI_STATS_MODE_READ_AND_CLEAR || bufferPoolStatsMode == SAI_STATS_MODE_READ_AND_CLEAR)
+        if (snapshot.statsMode == SAI_STATS_MODE_READ_AND_CLEAR || bufferPoolStatsMode == SAI_STATS_MODE_READ_AND_CLEAR)
         {
             status = sai_metadata_sai_buffer_api->clear_buffer_pool_stats(
                             bufferPoolId,
@@ -1618,19 +2299,38 @@ void FlexCounter::collectBufferPoolCounters(_In_ swss::Table &countersTable)
             }
         }
 
-        // Write counter values to DB table
-        std::vector<swss::FieldValueTuple> fvTuples;
+        // Write counter values to DB table, field names are set at registration
         for (size_t i = 0; i < bufferPoolCounterIds.size(); ++i)
         {
-            fvTuples.emplace_back(sai_serialize_buffer_pool_stat(bufferPoolCounterIds[i]), std::to_string(bufferPoolStats[i]));
+            it.second->setCounterValue(i, bufferPoolStats[i]);
         }
 
-        countersTable.set(sai_serialize_object_id(bufferPoolVid), fvTuples);
+        it.second->publish(countersTable, snapshot.fullRefresh);
+    }
+}
+
+template <typename T>
+static void getFreshValues(
+        _In_ const std::map<sai_object_id_t, std::shared_ptr<T>> &counterIdsMap,
+        _Out_ std::vector<flex_counter_values_t> &objects)
+{
+    SWSS_LOG_ENTER();
+
+    for (const auto &kv: counterIdsMap)
+    {
+        if (kv.second->fresh)
+        {
+            objects.push_back({ &kv.second->vidStr, &kv.second->values, &kv.second->stats });
+
+            kv.second->fresh = false;
+        }
     }
 }
 
 void FlexCounter::runPlugins(
-        _In_ swss::DBConnector& db)
+        _In_ const CountersSnapshot &snapshot,
+        _In_ swss::DBConnector& db,
+        _In_ swss::RedisPipeline& pipeline)
 {
     SWSS_LOG_ENTER();
 
@@ -1638,54 +2338,180 @@ void FlexCounter::runPlugins(
     {
         std::to_string(COUNTERS_DB),
         COUNTERS_TABLE,
-        std::to_string(m_pollInterval * 1000)
+        std::to_string(snapshot.pollInterval * 1000)
     };
 
     std::vector<std::string> portList;
-    portList.reserve(m_portCounterIdsMap.size());
-    for (const auto& kv : m_portCounterIdsMap)
+    portList.reserve(snapshot.portCounterIdsMap.size());
+    for (const auto& kv : snapshot.portCounterIdsMap)
     {
-        portList.push_back(sai_serialize_object_id(kv.first));
+        portList.push_back(kv.second->vidStr);
     }
-    for (const auto& sha : m_portPlugins)
+    for (const auto& sha : snapshot.portPlugins)
     {
         runRedisScript(db, sha, portList, argv);
     }
 
     std::vector<std::string> queueList;
-    queueList.reserve(m_queueCounterIdsMap.size());
-    for (const auto& kv : m_queueCounterIdsMap)
+    queueList.reserve(snapshot.queueCounterIdsMap.size());
+    for (const auto& kv : snapshot.queueCounterIdsMap)
     {
-        queueList.push_back(sai_serialize_object_id(kv.first));
+        queueList.push_back(kv.second->vidStr);
     }
-    for (const auto& sha : m_queuePlugins)
+    for (const auto& sha : snapshot.queuePlugins)
     {
         runRedisScript(db, sha, queueList, argv);
     }
 
     std::vector<std::string> priorityGroupList;
-    priorityGroupList.reserve(m_priorityGroupCounterIdsMap.size());
-    for (const auto& kv : m_priorityGroupCounterIdsMap)
+    priorityGroupList.reserve(snapshot.priorityGroupCounterIdsMap.size());
+    for (const auto& kv : snapshot.priorityGroupCounterIdsMap)
     {
-        priorityGroupList.push_back(sai_serialize_object_id(kv.first));
+        priorityGroupList.push_back(kv.second->vidStr);
     }
-    for (const auto& sha : m_priorityGroupPlugins)
+    for (const auto& sha : snapshot.priorityGroupPlugins)
     {
         runRedisScript(db, sha, priorityGroupList, argv);
     }
 
     std::vector<std::string> bufferPoolVids;
-    bufferPoolVids.reserve(m_bufferPoolCounterIdsMap.size());
-    for (const auto& it : m_bufferPoolCounterIdsMap)
+    bufferPoolVids.reserve(snapshot.bufferPoolCounterIdsMap.size());
+    for (const auto& it : snapshot.bufferPoolCounterIdsMap)
     {
-        bufferPoolVids.push_back(sai_serialize_object_id(it.first));
+        bufferPoolVids.push_back(it.second->vidStr);
     }
-    for (const auto& sha : m_bufferPoolPlugins)
+    for (const auto& sha : snapshot.bufferPoolPlugins)
     {
         runRedisScript(db, sha, bufferPoolVids, argv);
     }
+
+    if (snapshot.nativePlugins.empty())
+    {
+        return;
+    }
+
+    std::map<sai_object_type_t, std::vector<flex_counter_values_t>> objects;
+
+    getFreshValues(snapshot.portCounterIdsMap, objects[SAI_OBJECT_TYPE_PORT]);
+    getFreshValues(snapshot.queueCounterIdsMap, objects[SAI_OBJECT_TYPE_QUEUE]);
+    getFreshValues(snapshot.priorityGroupCounterIdsMap, objects[SAI_OBJECT_TYPE_INGRESS_PRIORITY_GROUP]);
+    getFreshValues(snapshot.bufferPoolCounterIdsMap, objects[SAI_OBJECT_TYPE_BUFFER_POOL]);
+
+    for (const auto& kv : snapshot.nativePlugins)
+    {
+        kv.second->run(objects[kv.second->getObjectType()], db, pipeline);
+    }
+
+    pipeline.flush();
+}
+
+void FlexCounter::publishPollStats(
+        _In_ const PollStats &stats,
+        _In_ swss::RedisPipeline& pipeline)
+{
+    SWSS_LOG_ENTER();
+
+    swss::Table statsTable(&pipeline, FLEX_COUNTER_POLL_STATS_TABLE, true);
+
+    std::vector<swss::FieldValueTuple> values;
+
+    values.emplace_back("POLL_COUNT", std::to_string(stats.pollCount));
+    values.emplace_back("LAST_DURATION_MS", std::to_string(stats.lastDuration));
+    values.emplace_back("MAX_DURATION_MS", std::to_string(stats.maxDuration));
+    values.emplace_back("OVERRUN_COUNT", std::to_string(stats.overrunCount));
+    values.emplace_back("SKIPPED_CYCLES", std::to_string(stats.skippedCycles));
+
+    statsTable.set(m_instanceId, values, "");
+
+    pipeline.flush();
+}
+
+std::chrono::steady_clock::time_point FlexCounter::alignDeadline(
+        _In_ std::chrono::steady_clock::time_point time,
+        _In_ uint32_t pollInterval,
+        _In_ uint32_t pollOffset)
+{
+    SWSS_LOG_ENTER();
+
+    /*
+     * Returns first point not before given time, which is pollOffset
+     * milliseconds after multiple of pollInterval since steady clock epoch.
+     * All groups share the same clock, so their phases stay fixed relative
+     * to each other.
+     */
+
+    auto interval = std::chrono::milliseconds(pollInterval);
+    auto offset = std::chrono::milliseconds(pollOffset % pollInterval);
+
+    auto sinceEpoch = std::chrono::duration_cast<std::chrono::milliseconds>(time.time_since_epoch());
+
+    auto aligned = (sinceEpoch / interval) * interval + offset;
+
+    std::chrono::steady_clock::time_point deadline(aligned);
+
+    while (deadline < time)
+    {
+        deadline += interval;
+    }
+
+    return deadline;
 }
 
+uint64_t FlexCounter::nextDeadline(
+        _Inout_ std::chrono::steady_clock::time_point &deadline,
+        _In_ std::chrono::steady_clock::time_point finish,
+        _In_ uint32_t pollInterval)
+{
+    SWSS_LOG_ENTER();
+
+    /*
+     * Moves deadline by one interval. When poll finished after new deadline,
+     * deadline is moved further to first interval boundary not before poll
+     * finish and number of skipped boundaries is returned.
+     */
+
+    auto interval = std::chrono::milliseconds(pollInterval);
+
+    deadline += interval;
+
+    if (finish <= deadline)
+    {
+        return 0;
+    }
+
+    auto overrun = std::chrono::duration_cast<std::chrono::nanoseconds>(finish - deadline);
+
+    uint64_t skipped = static_cast<uint64_t>(overrun / interval);
+
+    if (overrun % interval != std::chrono::nanoseconds::zero())
+    {
+        skipped++;
+    }
+
+    deadline += skipped * interval;
+
+    return skipped;
+}
+
+/*
+ * Connection used by single poll worker. Each worker writes counters through
+ * its own pipeline, since connections can't be shared between threads.
+ */
+struct FlexCounterWorkerContext
+{
+    FlexCounterWorkerContext():
+        db("COUNTERS_DB", 0),
+        pipeline(&db),
+        countersTable(&pipeline, COUNTERS_TABLE, true)
+    {
+        SWSS_LOG_ENTER();
+    }
+
+    swss::DBConnector db;
+    swss::RedisPipeline pipeline;
+    swss::Table countersTable;
+};
+
 void FlexCounter::flexCounterThread(void)
 {
     SWSS_LOG_ENTER();
@@ -1694,38 +2520,211 @@ void FlexCounter::flexCounterThread(void)
     swss::RedisPipeline pipeline(&db);
     swss::Table countersTable(&pipeline, COUNTERS_TABLE, true);
 
+    std::shared_ptr<WorkerPool> workerPool;
+    std::vector<std::shared_ptr<FlexCounterWorkerContext>> workerContexts;
+
+    PollStats stats = {};
+
+    // Reused between cycles, refreshed by takeSnapshot on configuration change
+    CountersSnapshot snapshot;
+
+    // Snapshot parts polled by workers and bulk groups are rebuilt only
+    // when snapshot or number of workers changed
+    std::vector<CountersSnapshot> parts;
+    uint64_t preparedVersion = 0;
+    uint32_t preparedWorkers = 0;
+
+    /*
+     * Polls are scheduled at absolute deadlines, deadline is moved by whole
+     * intervals, so poll start doesn't drift. When poll takes longer than
+     * interval, missed deadlines are skipped and counted.
+     */
+
+    std::chrono::steady_clock::time_point deadline;
+    bool scheduled = false;
+    uint32_t scheduledInterval = 0;
+    bool scheduledOffsetEnabled = false;
+    uint32_t scheduledOffset = 0;
+
     while (1)
     {
-        auto start = std::chrono::steady_clock::now();
+        {
+            std::unique_lock<std::mutex> lkMgr(m_mtx);
 
-        std::unique_lock<std::mutex> lkMgr(m_mtx);
+            if (!m_runFlexCounterThread)
+            {
+                return;
+            }
+            while (!m_enable || allIdsEmpty() || (m_pollInterval == 0))
+            {
+                if (!m_runFlexCounterThread)
+                {
+                    return;
+                }
 
-        if (!m_runFlexCounterThread)
-        {
-            return;
+                scheduled = false;
+
+                m_pollCond.wait(lkMgr);
+            }
         }
-        while (!m_enable || allIdsEmpty() || (m_pollInterval == 0))
+
+        auto start = std::chrono::steady_clock::now();
+
+        /*
+         * Instance lock is held only while snapshot is taken, so counter
+         * configuration is not blocked by the poll. Removals still wait for
+         * the poll to finish on collect lock.
+         */
+
+        std::unique_lock<std::mutex> lkCollect(m_collectMtx);
+
+        uint32_t pollWorkers = 1;
+        bool waitForPhase = false;
+
         {
+            std::unique_lock<std::mutex> lkMgr(m_mtx);
+
             if (!m_runFlexCounterThread)
             {
                 return;
             }
-            m_pollCond.wait(lkMgr);
+
+            if (!m_enable || allIdsEmpty() || (m_pollInterval == 0))
+            {
+                continue;
+            }
+
+            if (scheduled &&
+                    (scheduledInterval != m_pollInterval ||
+                     scheduledOffsetEnabled != m_pollOffsetEnabled ||
+                     scheduledOffset != m_pollOffset))
+            {
+                scheduled = false;
+            }
+
+            if (!scheduled)
+            {
+                scheduled = true;
+                scheduledInterval = m_pollInterval;
+                scheduledOffsetEnabled = m_pollOffsetEnabled;
+                scheduledOffset = m_pollOffset;
+
+                // with offset, first poll waits for group phase
+
+                waitForPhase = m_pollOffsetEnabled;
+
+                deadline = waitForPhase ? alignDeadline(start, m_pollInterval, m_pollOffset) : start;
+            }
+
+            if (!waitForPhase)
+            {
+                takeSnapshot(snapshot);
+
+                pollWorkers = m_pollWorkers;
+            }
+        }
+
+        if (waitForPhase)
+        {
+            lkCollect.unlock();
+
+            std::unique_lock<std::mutex> lk(m_mtxSleep);
+            m_cvSleep.wait_until(lk, deadline);
+            continue;
+        }
+
+        if (preparedVersion != snapshot.version || preparedWorkers != pollWorkers)
+        {
+            preparedVersion = snapshot.version;
+            preparedWorkers = pollWorkers;
+
+            parts.clear();
+
+            if (pollWorkers <= 1)
+            {
+                prepareBulkStats(snapshot);
+            }
+            else
+            {
+                parts.resize(pollWorkers);
+
+                splitSnapshot(snapshot, parts);
+
+                for (auto &part: parts)
+                {
+                    prepareBulkStats(part);
+                }
+            }
         }
 
-        collectCounters(countersTable);
-        runPlugins(db);
+        if (pollWorkers <= 1)
+        {
+            workerPool = nullptr;
+            workerContexts.clear();
+
+            collectCounters(snapshot, countersTable);
+        }
+        else
+        {
+            if (workerPool == nullptr || workerPool->getWorkerCount() != pollWorkers)
+            {
+                SWSS_LOG_NOTICE("Starting %u poll workers for FC %s", pollWorkers, m_instanceId.c_str());
+
+                workerPool = std::make_shared<WorkerPool>(pollWorkers);
+
+                workerContexts.clear();
+
+                for (uint32_t idx = 0; idx < pollWorkers; idx++)
+                {
+                    workerContexts.push_back(std::make_shared<FlexCounterWorkerContext>());
+                }
+            }
+
+            for (auto &part: parts)
+            {
+                part.fullRefresh = snapshot.fullRefresh;
+            }
+
+            auto worker = [&](size_t idx)
+            {
+                collectCounters(parts.at(idx), workerContexts.at(idx)->countersTable);
+            };
+
+            workerPool->run(worker);
+        }
+
+        lkCollect.unlock();
+
+        // All counters of this cycle are written, plugins see complete set
+        runPlugins(snapshot, db, pipeline);
 
         auto finish = std::chrono::steady_clock::now();
         uint32_t delay = static_cast<uint32_t>(
                 std::chrono::duration_cast<std::chrono::milliseconds>(finish - start).count());
-        uint32_t correction = delay % m_pollInterval;
 
-        lkMgr.unlock();
+        stats.pollCount++;
+        stats.lastDuration = delay;
+        stats.maxDuration = std::max(stats.maxDuration, delay);
+
+        uint64_t skipped = nextDeadline(deadline, finish, snapshot.pollInterval);
+
+        if (skipped != 0)
+        {
+            stats.overrunCount++;
+            stats.skippedCycles += skipped;
+
+            SWSS_LOG_WARN("FC %s poll took %u ms, interval is %u ms, skipped %" PRIu64 " cycles",
+                    m_instanceId.c_str(),
+                    delay,
+                    snapshot.pollInterval,
+                    skipped);
+        }
+
+        publishPollStats(stats, pipeline);
 
         SWSS_LOG_DEBUG("End of flex counter thread FC %s, took %d ms", m_instanceId.c_str(), delay);
         std::unique_lock<std::mutex> lk(m_mtxSleep);
-        m_cvSleep.wait_for(lk, std::chrono::milliseconds(m_pollInterval - correction));
+        m_cvSleep.wait_until(lk, deadline);
     }
 }
 
@@ -2020,3 +3019,57 @@ std::vector<sai_switch_stat_t> FlexCounter::saiCheckSupportedSwitchDebugCounters
 
     return supportedSwitchDebugCounters;
 }
+
+bool FlexCounter::saiCheckBulkStatsSupported(
+        _In_ sai_object_type_t objectType,
+        _In_ sai_object_id_t rid,
+        _In_ uint32_t numberOfCounters,
+        _In_ const sai_stat_id_t *counterIds)
+{
+    SWSS_LOG_ENTER();
+
+    sai_bulk_object_get_stats_fn bulkGetStats = getBulkObjectGetStats();
+
+    if (bulkGetStats == nullptr)
+    {
+        SWSS_LOG_NOTICE("%s is not provided by SAI, %s stats will be polled per object",
+                SAI_BULK_OBJECT_GET_STATS_SYMBOL,
+                sai_serialize_object_type(objectType).c_str());
+
+        return false;
+    }
+
+    sai_object_key_t objectKey;
+
+    objectKey.key.object_id = rid;
+
+    sai_status_t objectStatus = SAI_STATUS_FAILURE;
+
+    std::vector<uint64_t> values(numberOfCounters);
+
+    // Read only, so probe doesn't clear any counter
+    sai_status_t status = bulkGetStats(
+            sai_switch_id_query(rid),
+            objectType,
+            1,
+            &objectKey,
+            numberOfCounters,
+            counterIds,
+            SAI_STATS_MODE_READ,
+            &objectStatus,
+            values.data());
+
+    if (status != SAI_STATUS_SUCCESS || objectStatus != SAI_STATUS_SUCCESS)
+    {
+        SWSS_LOG_NOTICE("Bulk stats are not supported on %s RID %s: %s, stats will be polled per object",
+                sai_serialize_object_type(objectType).c_str(),
+                sai_serialize_object_id(rid).c_str(),
+                sai_serialize_status(status != SAI_STATUS_SUCCESS ? status : objectStatus).c_str());
+
+        return false;
+    }
+
+    SWSS_LOG_NOTICE("Bulk stats are supported for %s", sai_serialize_object_type(objectType).c_str());
+
+    return true;
+}
@@ -6,6 +6,7 @@ extern "C" {
 }
 
 #include <atomic>
+#include <chrono>
 #include <vector>
 #include <set>
 #include <condition_variable>
@@ -13,6 +14,45 @@ extern "C" {
 #include "swss/table.h"
 #include "swss/logger.h"
 
+#include "FlexCounterPlugin.h"
+
+/**
+ * @brief Group field selecting number of workers polling group counters.
+ */
+#define POLL_WORKERS_FIELD "POLL_WORKERS"
+
+#define FLEX_COUNTER_MAX_POLL_WORKERS (16)
+
+/**
+ * @brief Group field enabling publishing of changed counter values only.
+ *
+ * Accepted values are "enable" and "disable" (default).
+ */
+#define DELTA_PUBLISH_FIELD "DELTA_PUBLISH"
+
+/**
+ * @brief Group field selecting after how many poll cycles all counter values
+ * are published again when delta publishing is enabled.
+ */
+#define FULL_REFRESH_CYCLES_FIELD "FULL_REFRESH_CYCLES"
+
+#define FLEX_COUNTER_DEFAULT_FULL_REFRESH_CYCLES (60)
+
+/**
+ * @brief Group field selecting poll phase offset in milliseconds.
+ *
+ * When set, polls start at fixed points in time shifted by offset from poll
+ * interval boundary, so groups using different offsets don't query the
+ * switch at the same time.
+ */
+#define POLL_OFFSET_FIELD "POLL_OFFSET"
+
+/**
+ * @brief Table in COUNTERS_DB holding poll statistics of each group, key is
+ * group name.
+ */
+#define FLEX_COUNTER_POLL_STATS_TABLE "FLEX_COUNTER_POLL_STATS"
+
 class FlexCounter
 {
     public:
@@ -71,6 +111,18 @@ class FlexCounter
         static void updateFlexCounterStatsMode(
                  _In_ std::string mode,
                  _In_ std::string instanceId);
+        static void setPollWorkers(
+                _In_ uint32_t pollWorkers,
+                _In_ std::string instanceId);
+        static void updateDeltaPublish(
+                _In_ std::string status,
+                _In_ std::string instanceId);
+        static void setFullRefreshCycles(
+                _In_ uint32_t fullRefreshCycles,
+                _In_ std::string instanceId);
+        static void setPollOffset(
+                _In_ uint32_t pollOffset,
+                _In_ std::string instanceId);
 
         static void removePort(
                 _In_ sai_object_id_t portVid,
@@ -117,10 +169,75 @@ class FlexCounter
                 _In_ const FlexCounter&) = delete;
         ~FlexCounter(void);
 
+        /**
+         * @brief Get first poll deadline of group using poll offset.
+         *
+         * @return First point not before given time, which is offset
+         * milliseconds after multiple of poll interval.
+         */
+        static std::chrono::steady_clock::time_point alignDeadline(
+                _In_ std::chrono::steady_clock::time_point time,
+                _In_ uint32_t pollInterval,
+                _In_ uint32_t pollOffset);
+
+        /**
+         * @brief Move deadline to next poll.
+         *
+         * @return Number of interval boundaries skipped since poll which
+         * finished at given time overran its interval, zero otherwise.
+         */
+        static uint64_t nextDeadline(
+                _Inout_ std::chrono::steady_clock::time_point &deadline,
+                _In_ std::chrono::steady_clock::time_point finish,
+                _In_ uint32_t pollInterval);
+
     private:
-        struct QueueCounterIds
+        /**
+         * @brief Data serialized once at object registration.
+         *
+         * Values are updated in place on each poll, so steady state poll
+         * doesn't allocate counter names, keys and value buffers.
+         */
+        struct CountersCache
+        {
+            CountersCache(
+                    _In_ sai_object_id_t vid);
+
+            template <typename T>
+            void setCounterNames(
+                    _In_ const std::vector<T> &counterIds,
+                    _In_ std::string (*serialize)(_In_ const T));
+
+            void setCounterValue(
+                    _In_ size_t index,
+                    _In_ uint64_t value);
+
+            /**
+             * @brief Write values to counters table.
+             *
+             * When full refresh is not requested, only values changed since
+             * last publish are written.
+             */
+            void publish(
+                    _In_ swss::Table &countersTable,
+                    _In_ bool fullRefresh);
+
+            std::string vidStr;
+            std::vector<swss::FieldValueTuple> values;
+            std::vector<uint64_t> stats;
+
+            // Values written to counters table by last publish
+            std::vector<std::string> published;
+            std::vector<swss::FieldValueTuple> changed;
+
+            // Values were collected since native plugins were executed
+            bool fresh;
+        };
+
+        struct QueueCounterIds: public CountersCache
         {
             QueueCounterIds(
+                    _In_ sai_object_id_t vid,
                     _In_ sai_object_id_t queue,
                     _In_ const std::vector<sai_queue_stat_t> &queueIds);
 
@@ -128,9 +245,10 @@ class FlexCounter
             std::vector<sai_queue_stat_t> queueCounterIds;
         };
 
-        struct QueueAttrIds
+        struct QueueAttrIds: public CountersCache
         {
             QueueAttrIds(
+                    _In_ sai_object_id_t vid,
                     _In_ sai_object_id_t queue,
                     _In_ const std::vector<sai_queue_attr_t> &queueIds);
 
@@ -138,9 +256,10 @@ class FlexCounter
             std::vector<sai_queue_attr_t> queueAttrIds;
         };
 
-        struct IngressPriorityGroupCounterIds
+        struct IngressPriorityGroupCounterIds: public CountersCache
         {
             IngressPriorityGroupCounterIds(
+                    _In_ sai_object_id_t vid,
                     _In_ sai_object_id_t priorityGroup,
                     _In_ const std::vector<sai_ingress_priority_group_stat_t> &priorityGroupIds);
 
@@ -148,9 +267,10 @@ class FlexCounter
             std::vector<sai_ingress_priority_group_stat_t> priorityGroupCounterIds;
         };
 
-        struct IngressPriorityGroupAttrIds
+        struct IngressPriorityGroupAttrIds: public CountersCache
         {
             IngressPriorityGroupAttrIds(
+                    _In_ sai_object_id_t vid,
                     _In_ sai_object_id_t priorityGroup,
                     _In_ const std::vector<sai_ingress_priority_group_attr_t> &priorityGroupIds);
 
@@ -158,9 +278,10 @@ class FlexCounter
             std::vector<sai_ingress_priority_group_attr_t> priorityGroupAttrIds;
         };
 
-        struct BufferPoolCounterIds
+        struct BufferPoolCounterIds: public CountersCache
         {
             BufferPoolCounterIds(
+                _In_ sai_object_id_t vid,
                 _In_ sai_object_id_t bufferPool,
                 _In_ const std::vector<sai_buffer_pool_stat_t> &bufferPoolIds,
                 _In_ sai_stats_mode_t statsMode);
@@ -170,9 +291,10 @@ class FlexCounter
             std::vector<sai_buffer_pool_stat_t> bufferPoolCounterIds;
         };
 
-        struct PortCounterIds
+        struct PortCounterIds: public CountersCache
         {
             PortCounterIds(
+                    _In_ sai_object_id_t vid,
                     _In_ sai_object_id_t port,
                     _In_ const std::vector<sai_port_stat_t> &portIds);
 
@@ -180,9 +302,10 @@ class FlexCounter
             std::vector<sai_port_stat_t> portCounterIds;
         };
 
-        struct SwitchCounterIds
+        struct SwitchCounterIds: public CountersCache
         {
             SwitchCounterIds(
+                _In_ sai_object_id_t vid,
                 _In_ sai_object_id_t oid,
                 _In_ const std::vector<sai_switch_stat_t> &counterIds);
 
@@ -190,9 +313,10 @@ class FlexCounter
             std::vector<sai_switch_stat_t> switchCounterIds;
         };
 
-        struct RifCounterIds
+        struct RifCounterIds: public CountersCache
         {
             RifCounterIds(
+                    _In_ sai_object_id_t vid,
                     _In_ sai_object_id_t rif,
                     _In_ const std::vector<sai_router_interface_stat_t> &rifIds);
 
@@ -200,12 +324,125 @@ class FlexCounter
             std::vector<sai_router_interface_stat_t> rifCounterIds;
         };
 
+        /**
+         * @brief Objects polled by single bulk stats call.
+         *
+         * Groups are built when polled objects change, buffers are reused
+         * by each poll.
+         */
+        struct BulkStatsGroup
+        {
+            sai_object_id_t switchRid;
+            std::vector<sai_stat_id_t> counterIds;
+            std::vector<sai_object_id_t> vids;
+            std::vector<sai_object_key_t> objectKeys;
+            std::vector<std::shared_ptr<CountersCache>> entries;
+            std::vector<sai_status_t> statuses;
+            std::vector<uint64_t> stats;
+        };
+
+        struct CountersSnapshot;
+
+        typedef void (FlexCounter::*collect_counters_handler_t)(
+                _In_ const CountersSnapshot &snapshot,
+                _In_ swss::Table &countersTable);
+        typedef std::unordered_map<std::string, collect_counters_handler_t> collect_counters_handler_unordered_map_t;
+
+        /**
+         * @brief Objects and plugins polled in single cycle.
+         *
+         * Entries are shared with instance maps, they are never modified in
+         * place, so snapshot stays valid when instance lock is released.
+         * Poll thread keeps the snapshot between cycles and copies instance
+         * maps again only when configuration version changed.
+         */
+        struct CountersSnapshot
+        {
+            std::map<sai_object_id_t, std::shared_ptr<PortCounterIds>> portCounterIdsMap;
+            std::map<sai_object_id_t, std::shared_ptr<PortCounterIds>> portDebugCounterIdsMap;
+            std::map<sai_object_id_t, std::shared_ptr<QueueCounterIds>> queueCounterIdsMap;
+            std::map<sai_object_id_t, std::shared_ptr<QueueAttrIds>> queueAttrIdsMap;
+            std::map<sai_object_id_t, std::shared_ptr<IngressPriorityGroupCounterIds>> priorityGroupCounterIdsMap;
+            std::map<sai_object_id_t, std::shared_ptr<IngressPriorityGroupAttrIds>> priorityGroupAttrIdsMap;
+            std::map<sai_object_id_t, std::shared_ptr<RifCounterIds>> rifCounterIdsMap;
+            std::map<sai_object_id_t, std::shared_ptr<BufferPoolCounterIds>> bufferPoolCounterIdsMap;
+            std::map<sai_object_id_t, std::shared_ptr<SwitchCounterIds>> switchDebugCounterIdsMap;
+
+            std::set<std::string> queuePlugins;
+            std::set<std::string> portPlugins;
+            std::set<std::string> priorityGroupPlugins;
+            std::set<std::string> bufferPoolPlugins;
+            std::map<std::string, std::shared_ptr<FlexCounterPlugin>> nativePlugins;
+
+            collect_counters_handler_unordered_map_t handlers;
+
+            // Built by poll thread for snapshot it polls
+            std::vector<std::shared_ptr<BulkStatsGroup>> portBulkStatsGroups;
+            std::vector<std::shared_ptr<BulkStatsGroup>> queueBulkStatsGroups;
+
+            uint32_t pollInterval;
+            sai_stats_mode_t statsMode;
+            bool fullRefresh;
+
+            // Configuration version snapshot was taken from
+            uint64_t version = 0;
+        };
+
+        struct PollStats
+        {
+            uint64_t pollCount;
+            uint32_t lastDuration;
+            uint32_t maxDuration;
+            uint64_t overrunCount;
+            uint64_t skippedCycles;
+        };
+
         FlexCounter(std::string instanceId);
         static FlexCounter& getInstance(std::string instanceId);
         static void removeInstance(std::string instanceId);
 
-        void collectCounters(_In_ swss::Table &countersTable);
-        void runPlugins(_In_ swss::DBConnector& db);
+        void takeSnapshot(_Inout_ CountersSnapshot &snapshot);
+        void copyConfig(_Out_ CountersSnapshot &snapshot);
+        template <typename T>
+        static void splitMap(
+                _In_ const std::map<sai_object_id_t, T> &source,
+                _In_ std::map<sai_object_id_t, T> CountersSnapshot::*member,
+                _Inout_ std::vector<CountersSnapshot> &parts,
+                _Inout_ size_t &next);
+        void splitSnapshot(
+                _In_ const CountersSnapshot &snapshot,
+                _Out_ std::vector<CountersSnapshot> &parts);
+        template <typename T, typename StatType>
+        static void buildBulkStatsGroups(
+                _In_ const std::map<sai_object_id_t, std::shared_ptr<T>> &counterIdsMap,
+                _In_ sai_object_id_t T::*ridMember,
+                _In_ std::vector<StatType> T::*counterIdsMember,
+                _Out_ std::vector<std::shared_ptr<BulkStatsGroup>> &groups);
+        void prepareBulkStats(
+                _Inout_ CountersSnapshot &snapshot);
+        template <typename T>
+        void collectStatsBulk(
+                _In_ sai_object_type_t objectType,
+                _In_ const std::map<sai_object_id_t, std::shared_ptr<T>> &counterIdsMap,
+                _In_ const std::vector<std::shared_ptr<BulkStatsGroup>> &groups,
+                _In_ sai_stats_mode_t mode,
+                _In_ bool fullRefresh,
+                _In_ swss::Table &countersTable,
+                _Inout_ std::atomic<int> &support,
+                _Out_ std::map<sai_object_id_t, std::shared_ptr<T>> &remaining);
+        void collectCounters(
+                _In_ const CountersSnapshot &snapshot,
+                _In_ swss::Table &countersTable);
+        void runPlugins(
+                _In_ const CountersSnapshot &snapshot,
+                _In_ swss::DBConnector& db,
+                _In_ swss::RedisPipeline& pipeline);
+        bool addNativePlugin(
+                _In_ const std::string &name,
+                _In_ sai_object_type_t objectType);
+        void publishPollStats(
+                _In_ const PollStats &stats,
+                _In_ swss::RedisPipeline& pipeline);
         void flexCounterThread(void);
         void startFlexCounterThread(void);
         void endFlexCounterThread(void);
@@ -224,6 +461,11 @@ class FlexCounter
         std::vector<sai_switch_stat_t> saiCheckSupportedSwitchDebugCounters(
                 _In_ sai_object_id_t switchId,
                 _In_ const std::vector<sai_switch_stat_t> &counterIds);
+        bool saiCheckBulkStatsSupported(
+                _In_ sai_object_type_t objectType,
+                _In_ sai_object_id_t rid,
+                _In_ uint32_t numberOfCounters,
+                _In_ const sai_stat_id_t *counterIds);
 
         bool isPortCounterSupported(sai_port_stat_t counter) const;
         bool isQueueCounterSupported(sai_queue_stat_t counter) const;
@@ -234,18 +476,15 @@ class FlexCounter
         bool allIdsEmpty();
         bool allPluginsEmpty();
 
-        typedef void (FlexCounter::*collect_counters_handler_t)(_In_ swss::Table &countersTable);
-        typedef std::unordered_map<std::string, collect_counters_handler_t> collect_counters_handler_unordered_map_t;
-
-        void collectPortCounters(_In_ swss::Table &countersTable);
-        void collectPortDebugCounters(_In_ swss::Table &countersTable);
-        void collectQueueCounters(_In_ swss::Table &countersTable);
-        void collectQueueAttrs(_In_ swss::Table &countersTable);
-        void collectPriorityGroupCounters(_In_ swss::Table &countersTable);
-        void collectPriorityGroupAttrs(_In_ swss::Table &countersTable);
-        void collectRifCounters(_In_ swss::Table &countersTable);
-        void collectBufferPoolCounters(_In_ swss::Table &countersTable);
-        void collectSwitchDebugCounters(_In_ swss::Table &countersTable);
+        void collectPortCounters(_In_ const CountersSnapshot &snapshot, _In_ swss::Table &countersTable);
+        void collectPortDebugCounters(_In_ const CountersSnapshot &snapshot, _In_ swss::Table &countersTable);
+        void collectQueueCounters(_In_ const CountersSnapshot &snapshot, _In_ swss::Table &countersTable);
+        void collectQueueAttrs(_In_ const CountersSnapshot &snapshot, _In_ swss::Table &countersTable);
+        void collectPriorityGroupCounters(_In_ const CountersSnapshot &snapshot, _In_ swss::Table &countersTable);
+        void collectPriorityGroupAttrs(_In_ const CountersSnapshot &snapshot, _In_ swss::Table &countersTable);
+        void collectRifCounters(_In_ const CountersSnapshot &snapshot, _In_ swss::Table &countersTable);
+        void collectBufferPoolCounters(_In_ const CountersSnapshot &snapshot, _In_ swss::Table &countersTable);
+        void collectSwitchDebugCounters(_In_ const CountersSnapshot &snapshot, _In_ swss::Table &countersTable);
 
         void addCollectCountersHandler(const std::string &key, const collect_counters_handler_t &handler);
         void removeCollectCountersHandler(const std::string &key);
@@ -267,6 +506,9 @@ class FlexCounter
         std::set<std::string> m_priorityGroupPlugins;
         std::set<std::string> m_bufferPoolPlugins;
 
+        // Plugins executed by syncd, key is plugin name
+        std::map<std::string, std::shared_ptr<FlexCounterPlugin>> m_nativePlugins;
+
         bool m_runFlexCounterThread = false;
         std::shared_ptr<std::thread> m_flexCounterThread = nullptr;
         std::mutex m_mtxSleep;
@@ -275,10 +517,27 @@ class FlexCounter
         std::mutex m_mtx;
         std::condition_variable m_pollCond;
         uint32_t m_pollInterval = 0;
+        uint32_t m_pollWorkers = 1;
+        bool m_deltaPublish = false;
+        uint32_t m_fullRefreshCycles = FLEX_COUNTER_DEFAULT_FULL_REFRESH_CYCLES;
+        uint64_t m_pollCycle = 0;
+
+        // Incremented on each change of polled objects, plugins or group settings
+        uint64_t m_configVersion = 1;
+
+        bool m_pollOffsetEnabled = false;
+        uint32_t m_pollOffset = 0;
         std::string m_instanceId;
         sai_stats_mode_t m_statsMode;
         bool m_enable = false;
 
+        /*
+         * Held by flex counter thread while counters are polled, objects
+         * removal takes it to make sure removed object is not polled after
+         * remove returns. Must be acquired before m_mtx.
+         */
+        std::mutex m_collectMtx;
+
         collect_counters_handler_unordered_map_t m_collectCountersHandlers;
 };
 
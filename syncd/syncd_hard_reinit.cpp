@@ -5,6 +5,9 @@
 #include <vector>
 #include <unordered_map>
 #include <tuple>
+#include <thread>
+#include <algorithm>
+#include <exception>
 
 /*
  * To support multiple switches here we need to refactor this to a class
@@ -80,30 +83,6 @@ sai_object_type_t getObjectTypeFromVid(
     return objectType;
 }
 
-std::shared_ptr<SaiAttributeList> redisGetAttributesFromAsicKey(
-        _In_ const std::string &key)
-{
-    SWSS_LOG_ENTER();
-
-    sai_object_type_t objectType = getObjectTypeFromAsicKey(key);
-
-    std::vector<swss::FieldValueTuple> values;
-
-    auto hash = g_redisClient->hgetall(key);
-
-    for (auto &kv: hash)
-    {
-        const std::string &skey = kv.first;
-        const std::string &svalue = kv.second;
-
-        swss::FieldValueTuple fvt(skey, svalue);
-
-        values.push_back(fvt);
-    }
-
-    return std::make_shared<SaiAttributeList>(objectType, values, false);
-}
-
 sai_object_type_t getObjectTypeFromAsicKey(
         _In_ const std::string &key)
 {
@@ -168,7 +147,7 @@ void redisSetVidAndRidMap(
 
     /*
      * TODO clear can be done after recreating all switches unless vid/rid map
-     * will be per switch. An all this must be ATOMIC.
+     * will be per switch.
      *
      * This needs to be addressed when we want to support multiple switches.
      */
@@ -176,14 +155,16 @@ void redisSetVidAndRidMap(
     redisClearVidToRidMap();
     redisClearRidToVidMap();
 
+    std::vector<std::pair<sai_object_id_t, sai_object_id_t>> ridVidPairs;
+
+    ridVidPairs.reserve(map.size());
+
     for (auto &kv: map)
     {
-        std::string strVid = sai_serialize_object_id(kv.first);
-        std::string strRid = sai_serialize_object_id(kv.second);
-
-        g_redisClient->hset(VIDTORID, strVid, strRid);
-        g_redisClient->hset(RIDTOVID, strRid, strVid);
+        ridVidPairs.push_back(std::make_pair(kv.second, kv.first));
     }
+
+    redisSetRidAndVidPairs(ridVidPairs);
 }
 
 void checkAllIds()
@@ -1138,11 +1119,119 @@ void processNatEntries()
     }
 }
 
-std::vector<std::string> redisGetAsicStateKeys()
+/**
+ * @brief Number of HGETALL commands sent in single pipelined batch.
+ */
+#define ASIC_STATE_HGETALL_BATCH_SIZE (1000)
+
+/**
+ * @brief Maximum number of threads deserializing attributes.
+ */
+#define ASIC_STATE_MAX_WORKERS (8)
+
+std::vector<std::vector<swss::FieldValueTuple>> redisGetAsicStateValues(
+        _In_ const std::vector<std::string> &keys)
 {
     SWSS_LOG_ENTER();
 
-    return g_redisClient->keys(ASIC_STATE_TABLE + std::string(":*"));
+    std::vector<std::vector<swss::FieldValueTuple>> values(keys.size());
+
+    redisContext *ctx = dbAsic->getContext();
+
+    for (size_t start = 0; start < keys.size(); start += ASIC_STATE_HGETALL_BATCH_SIZE)
+    {
+        size_t end = std::min(keys.size(), start + ASIC_STATE_HGETALL_BATCH_SIZE);
+
+        for (size_t idx = start; idx < end; idx++)
+        {
+            redis_append_command(ctx, { "HGETALL", keys[idx] });
+        }
+
+        for (size_t idx = start; idx < end; idx++)
+        {
+            swss::RedisReply r(redis_get_reply(ctx));
+
+            r.checkReplyType(REDIS_REPLY_ARRAY);
+
+            redisReply *reply = r.getContext();
+
+            auto &fvs = values[idx];
+
+            fvs.reserve(reply->elements / 2);
+
+            for (size_t e = 0; e + 1 < reply->elements; e += 2)
+            {
+                fvs.emplace_back(
+                        std::string(reply->element[e]->str, reply->element[e]->len),
+                        std::string(reply->element[e + 1]->str, reply->element[e + 1]->len));
+            }
+        }
+    }
+
+    return values;
+}
+
+std::vector<std::shared_ptr<SaiAttributeList>> deserializeAsicStateValues(
+        _In_ const std::vector<std::string> &keys,
+        _In_ const std::vector<std::vector<swss::FieldValueTuple>> &values)
+{
+    SWSS_LOG_ENTER();
+
+    std::vector<std::shared_ptr<SaiAttributeList>> lists(keys.size());
+
+    size_t workers = std::min<size_t>(ASIC_STATE_MAX_WORKERS, std::max(1u, std::thread::hardware_concurrency()));
+
+    workers = std::max<size_t>(1, std::min(workers, keys.size() / ASIC_STATE_HGETALL_BATCH_SIZE));
+
+    std::vector<std::exception_ptr> errors(workers);
+
+    /*
+     * Each worker deserializes interleaved slice of keys and writes only to
+     * its own slots, so no synchronization is needed besides join.
+     */
+
+    auto worker = [&](size_t id)
+    {
+        try
+        {
+            for (size_t idx = id; idx < keys.size(); idx += workers)
+            {
+                sai_object_type_t objectType = getObjectTypeFromAsicKey(keys[idx]);
+
+                lists[idx] = std::make_shared<SaiAttributeList>(objectType, values[idx], false);
+            }
+        }
+        catch (...)
+        {
+            errors[id] = std::current_exception();
+        }
+    };
+
+    std::vector<std::thread> threads;
+
+    for (size_t id = 1; id < workers; id++)
+    {
+        threads.emplace_back(worker, id);
+    }
+
+    worker(0);
+
+    for (auto &t: threads)
+    {
+        t.join();
+    }
+
+    for (auto &e: errors)
+    {
+        if (e)
+        {
+            std::rethrow_exception(e);
+        }
+    }
+
+    SWSS_LOG_NOTICE("deserialized %zu asic state entries using %zu workers", keys.size(), workers);
+
+    return lists;
 }
 
 void readAsicState()
@@ -1160,60 +1249,92 @@ void readAsicState()
      * a class with hard reinit, per switch.
      */
 
-    g_vidToRidMap = redisGetVidToRidMap();
-    g_ridToVidMap = redisGetRidToVidMap();
+    {
+        SWSS_LOG_TIMER("read asic state: vid and rid maps");
+
+        g_vidToRidMap = redisGetVidToRidMap();
+        g_ridToVidMap = redisGetRidToVidMap();
+    }
 
-    std::vector<std::string> asicStateKeys = redisGetAsicStateKeys();
+    std::vector<std::string> asicStateKeys;
 
-    for (const auto &key: asicStateKeys)
     {
-        /*
-         * TODO if key will be meta_key anyway we could use deserialize here.
-         */
+        SWSS_LOG_TIMER("read asic state: scan keys");
+
+        asicStateKeys = redis_scan_keys(ASIC_STATE_TABLE + std::string(":*"));
+    }
+
+    std::vector<std::vector<swss::FieldValueTuple>> asicStateValues;
+
+    {
+        SWSS_LOG_TIMER("read asic state: fetch attributes");
+
+        asicStateValues = redisGetAsicStateValues(asicStateKeys);
+    }
+
+    std::vector<std::shared_ptr<SaiAttributeList>> asicStateLists;
+
+    {
+        SWSS_LOG_TIMER("read asic state: deserialize attributes");
+
+        asicStateLists = deserializeAsicStateValues(asicStateKeys, asicStateValues);
+    }
 
-        sai_object_type_t objectType = getObjectTypeFromAsicKey(key);
-        const std::string &strObjectId = getObjectIdFromAsicKey(key);
+    {
+        SWSS_LOG_TIMER("read asic state: index objects");
 
-        auto info = sai_metadata_get_object_type_info(objectType);
+        g_attributesLists.reserve(asicStateKeys.size());
 
-        switch (objectType)
+        for (size_t idx = 0; idx < asicStateKeys.size(); idx++)
         {
-            case SAI_OBJECT_TYPE_ROUTE_ENTRY:
-                g_routes[strObjectId] = key;
-                break;
+            const std::string &key = asicStateKeys[idx];
 
-            case SAI_OBJECT_TYPE_FDB_ENTRY:
-                g_fdbs[strObjectId] = key;
-                break;
+            /*
+             * TODO if key will be meta_key anyway we could use deserialize here.
+             */
 
-            case SAI_OBJECT_TYPE_NEIGHBOR_ENTRY:
-                g_neighbors[strObjectId] = key;
-                break;
+            sai_object_type_t objectType = getObjectTypeFromAsicKey(key);
+            const std::string &strObjectId = getObjectIdFromAsicKey(key);
 
-            case SAI_OBJECT_TYPE_NAT_ENTRY:
-                g_nat_entries[strObjectId] = key;
-                break;
+            auto info = sai_metadata_get_object_type_info(objectType);
 
-            case SAI_OBJECT_TYPE_SWITCH:
-                g_switches[strObjectId] = key;
-                g_oids[strObjectId] = key;
-                break;
+            switch (objectType)
+            {
+                case SAI_OBJECT_TYPE_ROUTE_ENTRY:
+                    g_routes[strObjectId] = key;
+                    break;
 
-            default:
+                case SAI_OBJECT_TYPE_FDB_ENTRY:
+                    g_fdbs[strObjectId] = key;
+                    break;
 
-                if (info->isnonobjectid)
-                {
-                    SWSS_LOG_THROW("passing non object id %s as generic object", info->objecttypename);
-                }
+                case SAI_OBJECT_TYPE_NEIGHBOR_ENTRY:
+                    g_neighbors[strObjectId] = key;
+                    break;
 
-                g_oids[strObjectId] = key;
-                break;
-        }
+                case SAI_OBJECT_TYPE_NAT_ENTRY:
+                    g_nat_entries[strObjectId] = key;
+                    break;
 
-        g_attributesLists[key] = redisGetAttributesFromAsicKey(key);
-    }
+                case SAI_OBJECT_TYPE_SWITCH:
+                    g_switches[strObjectId] = key;
+                    g_oids[strObjectId] = key;
+                    break;
 
+                default:
 
+                    if (info->isnonobjectid)
+                    {
+                        SWSS_LOG_THROW("passing non object id %s as generic object", info->objecttypename);
+                    }
+
+                    g_oids[strObjectId] = key;
+                    break;
+            }
+
+            g_attributesLists[key] = asicStateLists[idx];
+        }
+    }
 }
 
 void hardReinit()
@@ -4,9 +4,13 @@
 #include <inttypes.h>
 #include <queue>
 #include <memory>
+#include <chrono>
+#include <functional>
 #include <condition_variable>
 
-#include "NotificationQueue.h"
+#include "NotificationLane.h"
+#include "FdbIndex.h"
+#include "RedisBatchWriter.h"
 
 void send_notification(
         _In_ std::string op,
@@ -17,6 +21,15 @@ void send_notification(
 
     SWSS_LOG_INFO("%s %s", op.c_str(), data.c_str());
 
+    /*
+     * Notifications are sent from all processing lanes and from main thread
+     * on exception, producer is not thread safe.
+     */
+
+    static std::mutex sendMutex;
+
+    std::lock_guard<std::mutex> lock(sendMutex);
+
     notifications->send(op, data, entry);
 
     SWSS_LOG_DEBUG("notification send successfull");
@@ -39,7 +52,13 @@ void process_on_switch_state_change(
 {
     SWSS_LOG_ENTER();
 
-    sai_object_id_t switch_vid = translate_rid_to_vid(switch_rid, SAI_NULL_OBJECT_ID);
+    sai_object_id_t switch_vid;
+
+    {
+        std::lock_guard<std::mutex> lock(g_mutex);
+
+        switch_vid = translate_rid_to_vid(switch_rid, SAI_NULL_OBJECT_ID);
+    }
 
     std::string s = sai_serialize_switch_oper_status(switch_vid, switch_oper_status);
 
@@ -68,6 +87,55 @@ sai_fdb_entry_type_t getFdbEntryType(
     return (sai_fdb_entry_type_t)ret;
 }
 
+/**
+ * @brief Local index of FDB entries present in ASIC view.
+ *
+ * Updated on learn, move and age events, on FDB create, set and remove
+ * received from orch agent and rebuilt from ASIC view on start and after
+ * apply view.
+ */
+static FdbIndex g_fdbIndex;
+
+/**
+ * @brief Pipelined writer of ASIC view changes caused by FDB events.
+ *
+ * Writer has its own connection, since main ASIC DB connection is used by
+ * other clients while commands are pending.
+ */
+static std::shared_ptr<RedisBatchWriter> g_asicViewWriter;
+
+static RedisBatchWriter& getAsicViewWriter()
+{
+    SWSS_LOG_ENTER();
+
+    if (g_asicViewWriter == nullptr)
+    {
+        g_asicViewWriter = std::make_shared<RedisBatchWriter>(std::make_shared<swss::DBConnector>("ASIC_DB", 0));
+    }
+
+    return *g_asicViewWriter;
+}
+
+void flushAsicViewWrites()
+{
+    SWSS_LOG_ENTER();
+
+    if (g_asicViewWriter)
+    {
+        g_asicViewWriter->flush();
+    }
+}
+
+void getAsicViewWriterStats(
+        _Out_ size_t &commandCount,
+        _Out_ size_t &roundTripCount)
+{
+    SWSS_LOG_ENTER();
+
+    commandCount = g_asicViewWriter ? g_asicViewWriter->getCommandCount() : 0;
+    roundTripCount = g_asicViewWriter ? g_asicViewWriter->getFlushCount() : 0;
+}
+
 void redisPutFdbEntryToAsicView(
         _In_ const sai_fdb_event_notification_data_t *fdb)
 {
@@ -102,7 +170,8 @@ void redisPutFdbEntryToAsicView(
     if (fdb->event_type == SAI_FDB_EVENT_AGED)
     {
         SWSS_LOG_DEBUG("remove fdb entry %s for SAI_FDB_EVENT_AGED",key.c_str());
-        g_redisClient->del(key);
+        getAsicViewWriter().del({ key });
+        g_fdbIndex.remove(key);
         return;
     }
 
@@ -110,8 +179,8 @@ void redisPutFdbEntryToAsicView(
     {
         sai_object_id_t bv_id = fdb->fdb_entry.bv_id;
         sai_object_id_t port_oid = 0;
-        int flush_static = 0;
-        
+        bool flush_static = false;
+
         for (uint32_t i = 0; i < fdb->attr_count; i++)
         {
             if(fdb->attr[i].id == SAI_FDB_ENTRY_ATTR_BRIDGE_PORT_ID)
@@ -120,126 +189,48 @@ void redisPutFdbEntryToAsicView(
             }
             else if(fdb->attr[i].id == SAI_FDB_ENTRY_ATTR_TYPE)
             {
-                flush_static = (fdb->attr[i].value.s32 == SAI_FDB_ENTRY_TYPE_STATIC) ? 1 : 0;
+                flush_static = (fdb->attr[i].value.s32 == SAI_FDB_ENTRY_TYPE_STATIC);
             }
         }
-        
-                
-        if (!port_oid && !bv_id)
-        {
-            /* we got a flush all fdb event here */
-            /* example of a flush all fdb event   */
-            /*
-            [{
-            "fdb_entry":"{
-                \"bv_id\":\"oid:0x0\",
-                \"mac\":\"00:00:00:00:00:00\",
-                \"switch_id\":\"oid:0x21000000000000\"}",
-            "fdb_event":"SAI_FDB_EVENT_FLUSHED",
-                "list":[
-                    {"id":"SAI_FDB_ENTRY_ATTR_BRIDGE_PORT_ID","value":"oid:0x0"},
-                    {"id":"SAI_FDB_ENTRY_ATTR_TYPE","value":"SAI_FDB_ENTRY_TYPE_DYNAMIC"},
-                    {"id":"SAI_FDB_ENTRY_ATTR_PACKET_ACTION","value":"SAI_PACKET_ACTION_FORWARD"}
-                ]
-            }]
-            */
-            SWSS_LOG_NOTICE("received a flush all fdb event");
-            std::string pattern = ASIC_STATE_TABLE + std::string(":SAI_OBJECT_TYPE_FDB_ENTRY:*");
-            swss::RedisCommand command;
-            command.format(
-                "EVALSHA %s 3 %s %s %s",
-                fdbFlushSha.c_str(),
-                pattern.c_str(),
-                "",
-                std::to_string(flush_static).c_str());
-            swss::RedisReply r(dbAsic.get(), command);
-        }
-        else if (port_oid && !bv_id)
-        {
-            /* we got a flush port fdb event here        */
-            /* not supported yet, this is a place holder */
-            /* example of a flush port fdb event         */
-            /*
-            [{
-            "fdb_entry":"{
-                \"bv_id\":\"oid:0x0\",
-                \"mac\":\"00:00:00:00:00:00\",
-                \"switch_id\":\"oid:0x21000000000000\"}",
-            "fdb_event":"SAI_FDB_EVENT_FLUSHED",
-                "list":[
-                    {"id":"SAI_FDB_ENTRY_ATTR_BRIDGE_PORT_ID","value":"oid:0x3a0000000009cf"},
-                    {"id":"SAI_FDB_ENTRY_ATTR_TYPE","value":"SAI_FDB_ENTRY_TYPE_DYNAMIC"},
-                    {"id":"SAI_FDB_ENTRY_ATTR_PACKET_ACTION","value":"SAI_PACKET_ACTION_FORWARD"}
-                ]
-            }]
-            */
-            SWSS_LOG_NOTICE("received a flush port fdb event, port_oid = 0x%lx, bv_id = 0x%lx", port_oid, bv_id);
-            std::string pattern = ASIC_STATE_TABLE + std::string(":SAI_OBJECT_TYPE_FDB_ENTRY:*");
-            std::string port_str = sai_serialize_object_id(port_oid);
-            SWSS_LOG_NOTICE("pattern %s port_str %s", pattern.c_str(), port_str.c_str());
-            swss::RedisCommand command;
-            command.format(
-                "EVALSHA %s 3 %s %s %s",
-                fdbFlushSha.c_str(),
-                pattern.c_str(),
-                port_str.c_str(),
-                std::to_string(flush_static).c_str());
-            swss::RedisReply r(dbAsic.get(), command);
-        }
-        else if (!port_oid && bv_id)
-        {
-            /* we got a flush vlan fdb event here        */
-            /* not supported yet, this is a place holder */
-            /* example of a flush vlan event             */
-            /*
-            [{
-            "fdb_entry":"{
-                \"bridge_id\":\"oid:0x23000000000000\",
-                \"mac\":\"00:00:00:00:00:00\",
-                \"switch_id\":\"oid:0x21000000000000\"}",
-            "fdb_event":"SAI_FDB_EVENT_FLUSHED",
-                "list":[
-                    {"id":"SAI_FDB_ENTRY_ATTR_BRIDGE_PORT_ID","value":"oid:0x0"},
-                    {"id":"SAI_FDB_ENTRY_ATTR_TYPE","value":"SAI_FDB_ENTRY_TYPE_DYNAMIC"},
-                    {"id":"SAI_FDB_ENTRY_ATTR_PACKET_ACTION","value":"SAI_PACKET_ACTION_FORWARD"}
-                ]
-            }]
-            */
-            SWSS_LOG_NOTICE("received a flush vlan fdb event, port_oid = 0x%lx, bv_id = 0x%lx", port_oid, bv_id);
-            std::string pattern = ASIC_STATE_TABLE + std::string(":SAI_OBJECT_TYPE_FDB_ENTRY:*") + sai_serialize_object_id(bv_id) + std::string("*");
-            swss::RedisCommand command;
-            command.format(
-                "EVALSHA %s 3 %s %s %s",
-                fdbFlushSha.c_str(),
-                pattern.c_str(),
-                "",
-                std::to_string(flush_static).c_str());
-            swss::RedisReply r(dbAsic.get(), command);            
-        }
-        else
+
+        /*
+         * Flush event can be issued for all entries (bv_id and bridge port
+         * are both null), for port, for vlan or for port and vlan. Example
+         * of a flush port fdb event:
+         *
+         * [{
+         * "fdb_entry":"{
+         *     \"bv_id\":\"oid:0x0\",
+         *     \"mac\":\"00:00:00:00:00:00\",
+         *     \"switch_id\":\"oid:0x21000000000000\"}",
+         * "fdb_event":"SAI_FDB_EVENT_FLUSHED",
+         *     "list":[
+         *         {"id":"SAI_FDB_ENTRY_ATTR_BRIDGE_PORT_ID","value":"oid:0x3a0000000009cf"},
+         *         {"id":"SAI_FDB_ENTRY_ATTR_TYPE","value":"SAI_FDB_ENTRY_TYPE_DYNAMIC"},
+         *         {"id":"SAI_FDB_ENTRY_ATTR_PACKET_ACTION","value":"SAI_PACKET_ACTION_FORWARD"}
+         *     ]
+         * }]
+         *
+         * Affected keys are taken from local FDB index, so ASIC view in redis
+         * don't need to be scanned.
+         */
+
+        auto keys = g_fdbIndex.getFlushKeys(bv_id, port_oid, flush_static);
+
+        SWSS_LOG_NOTICE("received a flush fdb event, port_oid = 0x%lx, bv_id = 0x%lx, static = %d, removing %zu entries",
+                port_oid,
+                bv_id,
+                flush_static,
+                keys.size());
+
+        for (const auto& k: keys)
         {
-            SWSS_LOG_NOTICE("received a flush fdb event, port_oid = 0x%lx, bv_id = 0x%lx", port_oid, bv_id);
-            std::string pattern = ASIC_STATE_TABLE + std::string(":SAI_OBJECT_TYPE_FDB_ENTRY:*") + sai_serialize_object_id(bv_id) + std::string("*");
-            std::string port_str = sai_serialize_object_id(port_oid);
-            swss::RedisCommand command;
-            command.format(
-                "EVALSHA %s 3 %s %s %s",
-                fdbFlushSha.c_str(),
-                pattern.c_str(),
-                port_str.c_str(),
-                std::to_string(flush_static).c_str());
-            swss::RedisReply r(dbAsic.get(), command);
+            g_fdbIndex.remove(k);
         }
 
-        return;
-    }
-
-    for (const auto &e: entry)
-    {
-        const std::string &strField = fvField(e);
-        const std::string &strValue = fvValue(e);
+        getAsicViewWriter().del(keys);
 
-        g_redisClient->hset(key, strField, strValue);
+        return;
     }
 
     // currently we need to add type manually since fdb event don't contain type
@@ -261,10 +252,84 @@ void redisPutFdbEntryToAsicView(
          */
     }
 
-    std::string strAttrId = sai_serialize_attr_id(*meta);
-    std::string strAttrValue = sai_serialize_attr_value(*meta, attr);
+    entry.emplace_back(sai_serialize_attr_id(*meta), sai_serialize_attr_value(*meta, attr));
+
+    getAsicViewWriter().hmset(key, entry);
+
+    g_fdbIndex.insert(key, fdb->fdb_entry.bv_id, fdb->attr_count, fdb->attr);
+    g_fdbIndex.set(key, attr);
+}
+
+void fdbIndexUpdate(
+        _In_ sai_common_api_t api,
+        _In_ const std::string &strFdbEntry,
+        _In_ const std::vector<swss::FieldValueTuple> &values)
+{
+    SWSS_LOG_ENTER();
+
+    std::string key = ASIC_STATE_TABLE + (":" + sai_serialize_object_type(SAI_OBJECT_TYPE_FDB_ENTRY) + ":" + strFdbEntry);
+
+    switch (api)
+    {
+        case SAI_COMMON_API_CREATE:
+        case SAI_COMMON_API_BULK_CREATE:
+        {
+            sai_fdb_entry_t fdb_entry;
+            sai_deserialize_fdb_entry(strFdbEntry, fdb_entry);
+
+            SaiAttributeList list(SAI_OBJECT_TYPE_FDB_ENTRY, values, false);
+
+            g_fdbIndex.insert(key, fdb_entry.bv_id, list.get_attr_count(), list.get_attr_list());
+            break;
+        }
+
+        case SAI_COMMON_API_REMOVE:
+        case SAI_COMMON_API_BULK_REMOVE:
+            g_fdbIndex.remove(key);
+            break;
+
+        case SAI_COMMON_API_SET:
+        case SAI_COMMON_API_BULK_SET:
+        {
+            SaiAttributeList list(SAI_OBJECT_TYPE_FDB_ENTRY, values, false);
+
+            for (uint32_t idx = 0; idx < list.get_attr_count(); idx++)
+            {
+                g_fdbIndex.set(key, list.get_attr_list()[idx]);
+            }
+
+            break;
+        }
+
+        default:
+            break;
+    }
+}
+
+void fdbIndexRebuild()
+{
+    SWSS_LOG_ENTER();
+
+    SWSS_LOG_TIMER("fdb index rebuild");
+
+    g_fdbIndex.clear();
+
+    std::string pattern = ASIC_STATE_TABLE + (":" + sai_serialize_object_type(SAI_OBJECT_TYPE_FDB_ENTRY) + ":*");
+
+    auto keys = redis_scan_keys(pattern);
+
+    auto values = redisGetAsicStateValues(keys);
+
+    for (size_t idx = 0; idx < keys.size(); idx++)
+    {
+        const std::string &key = keys[idx];
+
+        const std::string strFdbEntry = key.substr(key.find(":", key.find(":") + 1) + 1);
 
-    g_redisClient->hset(key, strAttrId, strAttrValue);
+        fdbIndexUpdate(SAI_COMMON_API_CREATE, strFdbEntry, values[idx]);
+    }
+
+    SWSS_LOG_NOTICE("indexed %zu fdb entries from ASIC view", g_fdbIndex.size());
 }
 
 /**
@@ -367,7 +432,15 @@ bool contains_fdb_flush_event(
     return false;
 }
 
-void process_on_fdb_event(
+/**
+ * @brief Translate FDB event to VIDs and update ASIC view.
+ *
+ * Must be called under g_mutex, since FDB index and ASIC view are shared with
+ * main loop.
+ *
+ * @return True if notification contains valid OIDs and can be sent.
+ */
+bool translate_fdb_event(
         _In_ uint32_t count,
         _In_ sai_fdb_event_notification_data_t *data)
 {
@@ -406,16 +479,7 @@ void process_on_fdb_event(
         redisPutFdbEntryToAsicView(fdb);
     }
 
-    if (sendntf)
-    {
-        std::string s = sai_serialize_fdb_event_ntf(count, data);
-
-        send_notification("fdb_event", s);
-    }
-    else
-    {
-        SWSS_LOG_ERROR("FDB notification was not sent since it contain invalid OIDs, bug?");
-    }
+    return sendntf;
 }
 
 void process_on_queue_deadlock_event(
@@ -426,6 +490,8 @@ void process_on_queue_deadlock_event(
 
     SWSS_LOG_DEBUG("queue deadlock notification count: %u", count);
 
+    std::unique_lock<std::mutex> lock(g_mutex);
+
     for (uint32_t i = 0; i < count; i++)
     {
         sai_queue_deadlock_notification_data_t *deadlock_data = &data[i];
@@ -442,6 +508,8 @@ void process_on_queue_deadlock_event(
         deadlock_data->queue_id = translate_rid_to_vid(deadlock_data->queue_id, SAI_NULL_OBJECT_ID);
     }
 
+    lock.unlock();
+
     std::string s = sai_serialize_queue_deadlock_ntf(count, data);
 
     send_notification("queue_deadlock", s);
@@ -455,6 +523,8 @@ void process_on_port_state_change(
 
     SWSS_LOG_DEBUG("port notification count: %u", count);
 
+    std::unique_lock<std::mutex> lock(g_mutex);
+
     for (uint32_t i = 0; i < count; i++)
     {
         sai_port_oper_status_notification_t *oper_stat = &data[i];
@@ -471,6 +541,8 @@ void process_on_port_state_change(
         oper_stat->port_id = translate_rid_to_vid(oper_stat->port_id, SAI_NULL_OBJECT_ID);
     }
 
+    lock.unlock();
+
     std::string s = sai_serialize_port_oper_status_ntf(count, data);
 
     send_notification("port_state_change", s);
@@ -481,7 +553,13 @@ void process_on_switch_shutdown_request(
 {
     SWSS_LOG_ENTER();
 
-    sai_object_id_t switch_vid = translate_rid_to_vid(switch_rid, SAI_NULL_OBJECT_ID);
+    sai_object_id_t switch_vid;
+
+    {
+        std::lock_guard<std::mutex> lock(g_mutex);
+
+        switch_vid = translate_rid_to_vid(switch_rid, SAI_NULL_OBJECT_ID);
+    }
 
     std::string s = sai_serialize_switch_shutdown_request(switch_vid);
 
@@ -501,24 +579,46 @@ void handle_switch_state_change(
     process_on_switch_state_change(switch_id, switch_oper_status);
 }
 
-void handle_fdb_event(
-        _In_ const std::string &data)
+void handle_fdb_events(
+        _In_ const std::vector<Notification*> &batch)
 {
     SWSS_LOG_ENTER();
 
-    uint32_t count;
-    sai_fdb_event_notification_data_t *fdbevent = NULL;
+    for (auto ntf: batch)
+    {
+        if (contains_fdb_flush_event((uint32_t)ntf->m_fdbEvents.size(), ntf->m_fdbEvents.data()))
+        {
+            SWSS_LOG_NOTICE("got fdb flush event: %s", ntf->getData().c_str());
+        }
+    }
 
-    sai_deserialize_fdb_event_ntf(data, count, &fdbevent);
+    std::vector<bool> sendntf(batch.size());
 
-    if (contains_fdb_flush_event(count, fdbevent))
     {
-        SWSS_LOG_NOTICE("got fdb flush event: %s", data.c_str());
+        std::lock_guard<std::mutex> lock(g_mutex);
+
+        for (size_t idx = 0; idx < batch.size(); idx++)
+        {
+            Notification &ntf = *batch[idx];
+
+            SWSS_LOG_INFO("fdb event count: %zu", ntf.m_fdbEvents.size());
+
+            sendntf[idx] = translate_fdb_event((uint32_t)ntf.m_fdbEvents.size(), ntf.m_fdbEvents.data());
+        }
+
+        flushAsicViewWrites();
     }
 
-    process_on_fdb_event(count, fdbevent);
+    for (size_t idx = 0; idx < batch.size(); idx++)
+    {
+        if (!sendntf[idx])
+        {
+            SWSS_LOG_ERROR("FDB notification was not sent since it contain invalid OIDs, bug?");
+            continue;
+        }
 
-    sai_deserialize_free_fdb_event_ntf(count, fdbevent);
+        send_notification("fdb_event", batch[idx]->getData());
+    }
 }
 
 void handle_queue_deadlock(
@@ -537,18 +637,11 @@ void handle_queue_deadlock(
 }
 
 void handle_port_state_change(
-        _In_ const std::string &data)
+        _In_ Notification &ntf)
 {
     SWSS_LOG_ENTER();
 
-    uint32_t count;
-    sai_port_oper_status_notification_t *portoperstatus = NULL;
-
-    sai_deserialize_port_oper_status_ntf(data, count, &portoperstatus);
-
-    process_on_port_state_change(count, portoperstatus);
-
-    sai_deserialize_free_port_oper_status_ntf(count, portoperstatus);
+    process_on_port_state_change((uint32_t)ntf.m_portStates.size(), ntf.m_portStates.data());
 }
 
 void handle_switch_shutdown_request(
@@ -564,26 +657,20 @@ void handle_switch_shutdown_request(
 }
 
 void processNotification(
-        _In_ const swss::KeyOpFieldsValuesTuple &item)
+        _In_ Notification &item)
 {
-    std::lock_guard<std::mutex> lock(g_mutex);
-
     SWSS_LOG_ENTER();
 
-    std::string notification = kfvKey(item);
-    std::string data = kfvOp(item);
+    const std::string &notification = item.m_name;
+    const std::string &data = item.m_data;
 
     if (notification == "switch_state_change")
     {
         handle_switch_state_change(data);
     }
-    else if (notification == "fdb_event")
-    {
-        handle_fdb_event(data);
-    }
     else if (notification == "port_state_change")
     {
-        handle_port_state_change(data);
+        handle_port_state_change(item);
     }
     else if (notification == "switch_shutdown_request")
     {
@@ -599,35 +686,44 @@ void processNotification(
     }
 }
 
-// condition variable will be used to notify processing thread
-// that some notification arrived
+void handle_notifications(
+        _In_ const std::vector<Notification*> &batch)
+{
+    SWSS_LOG_ENTER();
 
-std::condition_variable cv;
+    for (auto ntf: batch)
+    {
+        processNotification(*ntf);
+    }
+}
 
 /*
- * Make sure that notification queue pointer is populated before we start
- * thread, and before we create_switch, since at switch_create we can start
+ * Make sure that notification queue pointers are populated before we start
+ * threads, and before we create_switch, since at switch_create we can start
  * receiving fdb_notifications which will arrive on different thread and
  * will call getQueueSize() when queue pointer could be null (this=0x0).
+ *
+ * Fast lane don't receive FDB events, so its limit only sets capacity.
  */
 
-static auto g_notificationQueue = std::make_shared<NotificationQueue>();
+static NotificationLane g_fastLane("fast", NOTIFICATION_QUEUE_RESERVED_SIZE, handle_notifications);
 
-void enqueue_notification(
-        _In_ std::string op,
-        _In_ std::string data,
-        _In_ std::vector<swss::FieldValueTuple> &entry)
+static NotificationLane g_bulkLane("bulk", DEFAULT_NOTIFICATION_QUEUE_SIZE_LIMIT, handle_fdb_events);
+
+static NotificationLane& getNotificationLane(
+        _In_ const std::string &name)
 {
     SWSS_LOG_ENTER();
 
-    SWSS_LOG_INFO("%s %s", op.c_str(), data.c_str());
+    return (name == "fdb_event") ? g_bulkLane : g_fastLane;
+}
 
-    swss::KeyOpFieldsValuesTuple item(op, data, entry);
+void enqueue_notification(
+        _In_ Notification *ntf)
+{
+    SWSS_LOG_ENTER();
 
-    if (g_notificationQueue->enqueue(item))
-    {
-        cv.notify_all();
-    }
+    getNotificationLane(ntf->m_name).enqueue(ntf);
 }
 
 void enqueue_notification(
@@ -636,9 +732,13 @@ void enqueue_notification(
 {
     SWSS_LOG_ENTER();
 
-    std::vector<swss::FieldValueTuple> entry;
+    SWSS_LOG_INFO("%s %s", op.c_str(), data.c_str());
+
+    Notification *ntf = getNotificationLane(op).allocate();
 
-    enqueue_notification(op, data, entry);
+    ntf->setSerialized(op, data);
+
+    enqueue_notification(ntf);
 }
 
 void on_switch_state_change(
@@ -658,9 +758,15 @@ void on_fdb_event(
 {
     SWSS_LOG_ENTER();
 
-    std::string s = sai_serialize_fdb_event_ntf(count, data);
+    SWSS_LOG_INFO("fdb_event count: %u", count);
+
+    // data is serialized by processing thread, after RID to VID translation
+
+    Notification *ntf = g_bulkLane.allocate();
 
-    enqueue_notification("fdb_event", s);
+    ntf->setFdbEvent(count, data);
+
+    enqueue_notification(ntf);
 }
 
 void on_queue_deadlock(
@@ -680,9 +786,13 @@ void on_port_state_change(
 {
     SWSS_LOG_ENTER();
 
-    std::string s = sai_serialize_port_oper_status_ntf(count, data);
+    SWSS_LOG_INFO("port_state_change count: %u", count);
+
+    Notification *ntf = g_fastLane.allocate();
 
-    enqueue_notification("port_state_change", s);
+    ntf->setPortStateChange(count, data);
+
+    enqueue_notification(ntf);
 }
 
 void on_switch_shutdown_request(
@@ -692,7 +802,7 @@ void on_switch_shutdown_request(
 
     std::string s = sai_serialize_switch_shutdown_request(switch_id);
 
-    enqueue_notification("switch_shutdown_request", "");
+    enqueue_notification("switch_shutdown_request", s);
 }
 
 void on_packet_event(
@@ -707,60 +817,20 @@ void on_packet_event(
     SWSS_LOG_ERROR("not implemented");
 }
 
-// determine whether notification thread is running
-
-volatile bool runThread;
-
-std::mutex ntf_mutex;
-std::unique_lock<std::mutex> ulock(ntf_mutex);
-
-void ntf_process_function()
-{
-    SWSS_LOG_ENTER();
-
-    while (runThread)
-    {
-        cv.wait(ulock);
-
-        // this is notifications processing thread context, which is different
-        // from SAI notifications context, we can safe use g_mutex here,
-        // processing each notification is under same mutex as processing main
-        // events, counters and reinit
-
-        swss::KeyOpFieldsValuesTuple item;
-
-        while (g_notificationQueue->tryDequeue(item))
-        {
-            processNotification(item);
-        }
-    }
-}
-
-std::shared_ptr<std::thread> ntf_process_thread;
-
 void startNotificationsProcessingThread()
 {
     SWSS_LOG_ENTER();
 
-    runThread = true;
-
-    ntf_process_thread = std::make_shared<std::thread>(ntf_process_function);
+    g_fastLane.start();
+    g_bulkLane.start();
 }
 
 void stopNotificationsProcessingThread()
 {
     SWSS_LOG_ENTER();
 
-    runThread = false;
-
-    cv.notify_all();
-
-    if (ntf_process_thread != nullptr)
-    {
-        ntf_process_thread->join();
-    }
-
-    ntf_process_thread = nullptr;
+    g_fastLane.stop();
+    g_bulkLane.stop();
 }
 
 sai_switch_state_change_notification_fn     on_switch_state_change_ntf = on_switch_state_change;
@@ -1,4 +1,5 @@
 #include <arpa/inet.h>
+#include <inttypes.h>
 
 extern "C" {
 #include <sai.h>
@@ -13,12 +14,18 @@ extern "C" {
 #include "sai_redis.h"
 #include "meta/sai_serialize.h"
 #include "syncd.h"
+#include "FdbIndex.h"
+#include "NotificationQueue.h"
+#include "NotificationLane.h"
+#include "syncd_flex_counter.h"
+#include "PortRatesPlugin.h"
 
 #include <map>
 #include <unordered_map>
 #include <vector>
 #include <thread>
 #include <tuple>
+#include <cmath>
 
 // TODO remove when SAI will introduce bulk APIs to those objects
 sai_status_t redis_bulk_create_fdb_entry(
@@ -140,11 +147,10 @@ void test_enable_recording()
     ASSERT_SUCCESS("Failed to enable recording");
 }
 
-class SaiAttrWrapper;
-extern std::unordered_map<std::string,
-       std::unordered_map<sai_attr_id_t,
-       std::shared_ptr<SaiAttrWrapper>>> ObjectAttrHash;
+extern void create_object(const sai_object_meta_key_t& meta_key);
 extern void object_reference_insert(sai_object_id_t oid);
+extern void redisPutFdbEntryToAsicView(const sai_fdb_event_notification_data_t *fdb);
+extern void flushAsicViewWrites();
 
 sai_object_id_t create_dummy_object_id(
         _In_ sai_object_type_t objecttype)
@@ -240,8 +246,7 @@ void test_bulk_next_hop_group_member_create()
     sai_object_id_t hopgroup = create_dummy_object_id(SAI_OBJECT_TYPE_NEXT_HOP_GROUP);
     object_reference_insert(hopgroup);
     sai_object_meta_key_t meta_key_hopgruop = { .objecttype = SAI_OBJECT_TYPE_NEXT_HOP_GROUP, .objectkey = { .key = { .object_id = hopgroup } } };
-    std::string hopgroup_key = sai_serialize_object_meta_key(meta_key_hopgruop);
-    ObjectAttrHash[hopgroup_key] = { };
+    create_object(meta_key_hopgruop);
     sai_object_id_t hopgroup_vid = translate_rid_to_vid(hopgroup, switch_id);
 
     for (uint32_t i = 0; i <  count; ++i)
@@ -250,8 +255,7 @@ void test_bulk_next_hop_group_member_create()
         sai_object_id_t hop = create_dummy_object_id(SAI_OBJECT_TYPE_NEXT_HOP);
         object_reference_insert(hop);
         sai_object_meta_key_t meta_key_hop = { .objecttype = SAI_OBJECT_TYPE_NEXT_HOP, .objectkey = { .key = { .object_id = hop } } };
-        std::string hop_key = sai_serialize_object_meta_key(meta_key_hop);
-        ObjectAttrHash[hop_key] = { };
+        create_object(meta_key_hop);
         sai_object_id_t hop_vid = translate_rid_to_vid(hop, switch_id);
 
         std::vector<sai_attribute_t> list(2);
@@ -343,22 +347,19 @@ void test_bulk_fdb_create()
         sai_object_id_t vr = create_dummy_object_id(SAI_OBJECT_TYPE_VIRTUAL_ROUTER);
         object_reference_insert(vr);
         sai_object_meta_key_t meta_key_vr = { .objecttype = SAI_OBJECT_TYPE_VIRTUAL_ROUTER, .objectkey = { .key = { .object_id = vr } } };
-        std::string vr_key = sai_serialize_object_meta_key(meta_key_vr);
-        ObjectAttrHash[vr_key] = { };
+        create_object(meta_key_vr);
 
         // bridge port
         sai_object_id_t bridge_port = create_dummy_object_id(SAI_OBJECT_TYPE_BRIDGE_PORT);
         object_reference_insert(bridge_port);
         sai_object_meta_key_t meta_key_bridge_port = { .objecttype = SAI_OBJECT_TYPE_BRIDGE_PORT, .objectkey = { .key = { .object_id = bridge_port } } };
-        std::string bridge_port_key = sai_serialize_object_meta_key(meta_key_bridge_port);
-        ObjectAttrHash[bridge_port_key] = { };
+        create_object(meta_key_bridge_port);
 
         // bridge
         sai_object_id_t bridge = create_dummy_object_id(SAI_OBJECT_TYPE_BRIDGE);
         object_reference_insert(bridge);
         sai_object_meta_key_t meta_key_bridge = { .objecttype = SAI_OBJECT_TYPE_BRIDGE, .objectkey = { .key = { .object_id = bridge } } };
-        std::string bridge_key = sai_serialize_object_meta_key(meta_key_bridge);
-        ObjectAttrHash[bridge_key] = { };
+        create_object(meta_key_bridge);
 
         sai_fdb_entry_t fdb_entry;
         fdb_entry.switch_id = switch_id;
@@ -456,15 +457,13 @@ void test_bulk_route_set()
         sai_object_id_t vr = create_dummy_object_id(SAI_OBJECT_TYPE_VIRTUAL_ROUTER);
         object_reference_insert(vr);
         sai_object_meta_key_t meta_key_vr = { .objecttype = SAI_OBJECT_TYPE_VIRTUAL_ROUTER, .objectkey = { .key = { .object_id = vr } } };
-        std::string vr_key = sai_serialize_object_meta_key(meta_key_vr);
-        ObjectAttrHash[vr_key] = { };
+        create_object(meta_key_vr);
 
         // next hop
         sai_object_id_t hop = create_dummy_object_id(SAI_OBJECT_TYPE_NEXT_HOP);
         object_reference_insert(hop);
         sai_object_meta_key_t meta_key_hop = { .objecttype = SAI_OBJECT_TYPE_NEXT_HOP, .objectkey = { .key = { .object_id = hop } } };
-        std::string hop_key = sai_serialize_object_meta_key(meta_key_hop);
-        ObjectAttrHash[hop_key] = { };
+        create_object(meta_key_hop);
 
         route_entry.destination.addr_family = SAI_IP_ADDR_FAMILY_IPV4;
         route_entry.destination.addr.ip4 = htonl(0x0a000000 | i);
@@ -545,6 +544,498 @@ void test_bulk_route_set()
     ASSERT_SUCCESS("Failed to bulk remove route entry");
 }
 
+void test_fdb_index()
+{
+    SWSS_LOG_ENTER();
+
+    FdbIndex index;
+
+    sai_object_id_t bv1 = 0x26000000000001;
+    sai_object_id_t bv2 = 0x26000000000002;
+    sai_object_id_t bp1 = 0x3a000000000001;
+    sai_object_id_t bp2 = 0x3a000000000002;
+
+    sai_attribute_t attrs[2];
+
+    attrs[0].id = SAI_FDB_ENTRY_ATTR_BRIDGE_PORT_ID;
+    attrs[1].id = SAI_FDB_ENTRY_ATTR_TYPE;
+
+    // key, bv_id, bridge port, type
+
+    std::vector<std::tuple<std::string, sai_object_id_t, sai_object_id_t, sai_fdb_entry_type_t>> entries = {
+        std::make_tuple("a", bv1, bp1, SAI_FDB_ENTRY_TYPE_DYNAMIC),
+        std::make_tuple("b", bv1, bp2, SAI_FDB_ENTRY_TYPE_DYNAMIC),
+        std::make_tuple("c", bv2, bp1, SAI_FDB_ENTRY_TYPE_DYNAMIC),
+        std::make_tuple("d", bv2, bp2, SAI_FDB_ENTRY_TYPE_STATIC),
+    };
+
+    for (const auto& e: entries)
+    {
+        attrs[0].value.oid = std::get<2>(e);
+        attrs[1].value.s32 = std::get<3>(e);
+
+        index.insert(std::get<0>(e), std::get<1>(e), 2, attrs);
+    }
+
+    auto check = [&](sai_object_id_t bvId, sai_object_id_t bpId, bool flushStatic, std::set<std::string> expected)
+    {
+        auto keys = index.getFlushKeys(bvId, bpId, flushStatic);
+
+        std::set<std::string> got(keys.begin(), keys.end());
+
+        if (got != expected || got.size() != keys.size())
+        {
+            SWSS_LOG_THROW("unexpected flush keys for bv_id 0x%" PRIx64 " bridge port 0x%" PRIx64, bvId, bpId);
+        }
+    };
+
+    check(SAI_NULL_OBJECT_ID, SAI_NULL_OBJECT_ID, false, {"a", "b", "c"});
+    check(SAI_NULL_OBJECT_ID, SAI_NULL_OBJECT_ID, true, {"a", "b", "c", "d"});
+    check(bv1, SAI_NULL_OBJECT_ID, false, {"a", "b"});
+    check(SAI_NULL_OBJECT_ID, bp2, false, {"b"});
+    check(SAI_NULL_OBJECT_ID, bp2, true, {"b", "d"});
+    check(bv2, bp1, false, {"c"});
+    check(0x26000000000003, SAI_NULL_OBJECT_ID, true, {});
+
+    // fdb move
+
+    attrs[0].value.oid = bp2;
+
+    index.set("a", attrs[0]);
+
+    check(SAI_NULL_OBJECT_ID, bp1, false, {"c"});
+    check(SAI_NULL_OBJECT_ID, bp2, false, {"a", "b"});
+
+    index.remove("b");
+
+    check(bv1, SAI_NULL_OBJECT_ID, false, {"a"});
+
+    if (index.size() != 3)
+    {
+        SWSS_LOG_THROW("expected 3 entries in fdb index, got %zu", index.size());
+    }
+}
+
+void test_fdb_event_asic_view_writes()
+{
+    SWSS_LOG_ENTER();
+
+    clearDB();
+
+    swss::DBConnector db("ASIC_DB", 0, true);
+    swss::RedisClient client(&db);
+
+    const uint32_t count = 100;
+
+    sai_object_id_t switchId = 0x21000000000000;
+    sai_object_id_t bv1 = 0x26000000000001;
+    sai_object_id_t bv2 = 0x26000000000002;
+    sai_object_id_t bp = 0x3a000000000001;
+
+    sai_attribute_t attrs[2];
+
+    attrs[0].id = SAI_FDB_ENTRY_ATTR_BRIDGE_PORT_ID;
+    attrs[0].value.oid = bp;
+    attrs[1].id = SAI_FDB_ENTRY_ATTR_PACKET_ACTION;
+    attrs[1].value.s32 = SAI_PACKET_ACTION_FORWARD;
+
+    auto fdbEvent = [&](sai_fdb_event_t type, sai_object_id_t bvId, uint32_t idx)
+    {
+        sai_fdb_event_notification_data_t data;
+
+        memset(&data, 0, sizeof(data));
+
+        data.event_type = type;
+        data.fdb_entry.switch_id = switchId;
+        data.fdb_entry.bv_id = bvId;
+        data.fdb_entry.mac_address[0] = 0x02;
+        data.fdb_entry.mac_address[4] = (uint8_t)(idx >> 8);
+        data.fdb_entry.mac_address[5] = (uint8_t)idx;
+        data.attr_count = 2;
+        data.attr = attrs;
+
+        return data;
+    };
+
+    auto key = [&](const sai_fdb_event_notification_data_t &data)
+    {
+        return std::string(ASIC_STATE_TABLE) + ":" +
+            sai_serialize_object_type(SAI_OBJECT_TYPE_FDB_ENTRY) + ":" +
+            sai_serialize_fdb_entry(data.fdb_entry);
+    };
+
+    std::vector<std::string> keys;
+
+    for (uint32_t idx = 0; idx < count; idx++)
+    {
+        auto data = fdbEvent(SAI_FDB_EVENT_LEARNED, idx < count / 2 ? bv1 : bv2, idx);
+
+        redisPutFdbEntryToAsicView(&data);
+
+        keys.push_back(key(data));
+    }
+
+    // learned entries are pending in writer until batch is flushed
+
+    if (client.keys(std::string(ASIC_STATE_TABLE) + ":*").size())
+    {
+        SWSS_LOG_THROW("fdb entries written to ASIC view before flush");
+    }
+
+    flushAsicViewWrites();
+
+    std::map<std::string, std::string> expected = {
+        { "SAI_FDB_ENTRY_ATTR_BRIDGE_PORT_ID", sai_serialize_object_id(bp) },
+        { "SAI_FDB_ENTRY_ATTR_PACKET_ACTION", "SAI_PACKET_ACTION_FORWARD" },
+        { "SAI_FDB_ENTRY_ATTR_TYPE", "SAI_FDB_ENTRY_TYPE_DYNAMIC" },
+    };
+
+    for (const auto &k: keys)
+    {
+        auto hash = client.hgetall(k);
+
+        std::map<std::string, std::string> values(hash.begin(), hash.end());
+
+        if (values != expected)
+        {
+            SWSS_LOG_THROW("unexpected ASIC view values of %s", k.c_str());
+        }
+    }
+
+    // aged entry and entries flushed on bv1 are removed
+
+    auto aged = fdbEvent(SAI_FDB_EVENT_AGED, bv2, count - 1);
+
+    redisPutFdbEntryToAsicView(&aged);
+
+    auto flush = fdbEvent(SAI_FDB_EVENT_FLUSHED, bv1, 0);
+
+    memset(flush.fdb_entry.mac_address, 0, sizeof(flush.fdb_entry.mac_address));
+
+    attrs[0].value.oid = SAI_NULL_OBJECT_ID;
+    attrs[1].id = SAI_FDB_ENTRY_ATTR_TYPE;
+    attrs[1].value.s32 = SAI_FDB_ENTRY_TYPE_DYNAMIC;
+
+    redisPutFdbEntryToAsicView(&flush);
+
+    flushAsicViewWrites();
+
+    for (uint32_t idx = 0; idx < count; idx++)
+    {
+        bool removed = idx < count / 2 || idx == count - 1;
+
+        if (removed == (client.hgetall(keys[idx]).size() != 0))
+        {
+            SWSS_LOG_THROW("fdb entry %s expected %s ASIC view", keys[idx].c_str(), removed ? "removed from" : "present in");
+        }
+    }
+}
+
+void test_notification_queue_fdb_coalescing()
+{
+    SWSS_LOG_ENTER();
+
+    NotificationQueue queue(2);
+
+    auto fdbEvent = [&](sai_fdb_event_t type, sai_object_id_t bvId, uint8_t mac)
+    {
+        sai_fdb_event_notification_data_t data;
+
+        memset(&data, 0, sizeof(data));
+
+        data.event_type = type;
+        data.fdb_entry.bv_id = bvId;
+        data.fdb_entry.mac_address[5] = mac;
+
+        Notification *ntf = queue.allocate();
+
+        ntf->setFdbEvent(1, &data);
+
+        return ntf;
+    };
+
+    sai_object_id_t bv = 0x26000000000001;
+
+    queue.enqueue(fdbEvent(SAI_FDB_EVENT_LEARNED, bv, 1));
+    queue.enqueue(fdbEvent(SAI_FDB_EVENT_LEARNED, bv, 2));
+
+    // queue is full, following events are coalesced
+
+    queue.enqueue(fdbEvent(SAI_FDB_EVENT_LEARNED, bv, 3));
+    queue.enqueue(fdbEvent(SAI_FDB_EVENT_AGED, bv, 3));
+    queue.enqueue(fdbEvent(SAI_FDB_EVENT_LEARNED, bv, 4));
+    queue.enqueue(fdbEvent(SAI_FDB_EVENT_LEARNED, bv, 3));
+    queue.enqueue(fdbEvent(SAI_FDB_EVENT_FLUSHED, SAI_NULL_OBJECT_ID, 0));
+    queue.enqueue(fdbEvent(SAI_FDB_EVENT_LEARNED, bv, 3));
+
+    Notification *other = queue.allocate();
+
+    other->setSerialized("switch_shutdown_request", "");
+
+    queue.enqueue(other);
+
+    std::vector<std::pair<sai_fdb_event_t, uint8_t>> expected = {
+        { SAI_FDB_EVENT_LEARNED, 1 },
+        { SAI_FDB_EVENT_LEARNED, 2 },
+        { SAI_FDB_EVENT_LEARNED, 3 },
+        { SAI_FDB_EVENT_LEARNED, 4 },
+        { SAI_FDB_EVENT_FLUSHED, 0 },
+        { SAI_FDB_EVENT_LEARNED, 3 },
+    };
+
+    Notification *item;
+
+    size_t fdbEvents = 0;
+    size_t otherEvents = 0;
+
+    while (queue.tryDequeue(item))
+    {
+        if (item->m_name != "fdb_event")
+        {
+            otherEvents++;
+        }
+        else if (item->m_fdbEvents.size() != 1 || fdbEvents >= expected.size() ||
+                item->m_fdbEvents[0].event_type != expected[fdbEvents].first ||
+                item->m_fdbEvents[0].fdb_entry.mac_address[5] != expected[fdbEvents].second)
+        {
+            SWSS_LOG_THROW("unexpected fdb event %zu: %s", fdbEvents, item->getData().c_str());
+        }
+        else
+        {
+            fdbEvents++;
+        }
+
+        queue.release(item);
+    }
+
+    if (fdbEvents != expected.size() || otherEvents != 1 || queue.getCoalescedCount() != 2)
+    {
+        SWSS_LOG_THROW("expected %zu fdb events and 1 other event, got %zu and %zu, coalesced %zu",
+                expected.size(), fdbEvents, otherEvents, queue.getCoalescedCount());
+    }
+}
+
+static std::mutex g_laneTestMutex;
+static std::condition_variable g_laneTestCond;
+static bool g_laneTestBulkStarted = false;
+static bool g_laneTestBulkReleased = false;
+static size_t g_laneTestFastDelivered = 0;
+
+static void test_lane_bulk_process(
+        _In_ const std::vector<Notification*> &batch)
+{
+    SWSS_LOG_ENTER();
+
+    std::unique_lock<std::mutex> lock(g_laneTestMutex);
+
+    g_laneTestBulkStarted = true;
+
+    g_laneTestCond.notify_all();
+
+    g_laneTestCond.wait(lock, [] { return g_laneTestBulkReleased; });
+}
+
+static void test_lane_fast_process(
+        _In_ const std::vector<Notification*> &batch)
+{
+    SWSS_LOG_ENTER();
+
+    std::lock_guard<std::mutex> lock(g_laneTestMutex);
+
+    g_laneTestFastDelivered += batch.size();
+
+    g_laneTestCond.notify_all();
+}
+
+void test_notification_lane_fast_delivery()
+{
+    SWSS_LOG_ENTER();
+
+    const size_t count = 10;
+
+    NotificationLane fastLane("test fast", 64, test_lane_fast_process);
+    NotificationLane bulkLane("test bulk", 64, test_lane_bulk_process);
+
+    fastLane.start();
+    bulkLane.start();
+
+    Notification *fdb = bulkLane.allocate();
+
+    fdb->setSerialized("fdb_event", "");
+
+    bulkLane.enqueue(fdb);
+
+    std::unique_lock<std::mutex> lock(g_laneTestMutex);
+
+    if (!g_laneTestCond.wait_for(lock, std::chrono::seconds(5), [] { return g_laneTestBulkStarted; }))
+    {
+        SWSS_LOG_THROW("bulk lane didn't start processing");
+    }
+
+    lock.unlock();
+
+    // bulk lane is now blocked in processing, fast lane must still deliver
+
+    for (size_t idx = 0; idx < count; idx++)
+    {
+        Notification *ntf = fastLane.allocate();
+
+        ntf->setSerialized("switch_shutdown_request", "");
+
+        fastLane.enqueue(ntf);
+    }
+
+    lock.lock();
+
+    bool delivered = g_laneTestCond.wait_for(lock, std::chrono::seconds(5), [&] { return g_laneTestFastDelivered == count; });
+
+    g_laneTestBulkReleased = true;
+
+    g_laneTestCond.notify_all();
+
+    lock.unlock();
+
+    bulkLane.stop();
+    fastLane.stop();
+
+    if (!delivered)
+    {
+        SWSS_LOG_THROW("fast lane delivered %zu of %zu notifications while bulk lane was busy",
+                g_laneTestFastDelivered,
+                count);
+    }
+}
+
+void test_port_rates_plugin()
+{
+    SWSS_LOG_ENTER();
+
+    swss::DBConnector db("COUNTERS_DB", 0);
+    swss::RedisClient client(&db);
+    swss::Table ratesTable(&db, PORT_RATES_TABLE);
+
+    const std::string vid = "oid:0x1000000000002";
+    const std::string key = std::string(PORT_RATES_TABLE) + ":" + vid;
+
+    client.del(key);
+
+    PortRatesPlugin plugin;
+
+    // values are not used by plugin, only names and stats
+    std::vector<swss::FieldValueTuple> values = {
+        { sai_serialize_port_stat(SAI_PORT_STAT_IF_IN_OCTETS), "" },
+        { sai_serialize_port_stat(SAI_PORT_STAT_IF_IN_UCAST_PKTS), "" },
+        { sai_serialize_port_stat(SAI_PORT_STAT_IF_IN_NON_UCAST_PKTS), "" },
+        { sai_serialize_port_stat(SAI_PORT_STAT_IF_IN_ERRORS), "" },
+        { sai_serialize_port_stat(SAI_PORT_STAT_IF_OUT_OCTETS), "" },
+        { sai_serialize_port_stat(SAI_PORT_STAT_IF_OUT_UCAST_PKTS), "" },
+        { sai_serialize_port_stat(SAI_PORT_STAT_IF_OUT_NON_UCAST_PKTS), "" },
+    };
+
+    std::vector<uint64_t> stats;
+
+    std::vector<flex_counter_values_t> objects = { { &vid, &values, &stats } };
+
+    auto at = [](int64_t ms) { return std::chrono::steady_clock::time_point(std::chrono::milliseconds(ms)); };
+
+    auto check = [&](const std::string& field, double expected)
+    {
+        auto value = client.hget(key, field);
+
+        if (value == nullptr || std::abs(std::stod(*value) - expected) > 0.001)
+        {
+            SWSS_LOG_THROW("expected %s %f, got '%s'", field.c_str(), expected, value ? value->c_str() : "");
+        }
+    };
+
+    // first snapshot only stores counters
+
+    stats = { 1000, 10, 0, 7, 2000, 20, 0 };
+
+    plugin.updateRates(objects, 0.5, at(10000), ratesTable);
+
+    if (client.hgetall(key).size())
+    {
+        SWSS_LOG_THROW("rates of %s written after first snapshot", vid.c_str());
+    }
+
+    // second snapshot 2 seconds later, rates are stored without smoothing
+
+    stats = { 5000, 20, 10, 7, 6000, 40, 0 };
+
+    plugin.updateRates(objects, 0.5, at(12000), ratesTable);
+
+    check("RX_BPS", 2000);
+    check("RX_PPS", 10);
+    check("TX_BPS", 2000);
+    check("TX_PPS", 10);
+
+    // third snapshot 1 second later is smoothed by alpha
+
+    stats = { 9000, 30, 10, 7, 6000, 40, 0 };
+
+    plugin.updateRates(objects, 0.5, at(13000), ratesTable);
+
+    check("RX_BPS", 0.5 * 4000 + 0.5 * 2000);
+    check("RX_PPS", 0.5 * 10 + 0.5 * 10);
+    check("TX_BPS", 0.5 * 0 + 0.5 * 2000);
+    check("TX_PPS", 0.5 * 0 + 0.5 * 10);
+
+    client.del(key);
+}
+
+void test_flex_counter_deadlines()
+{
+    SWSS_LOG_ENTER();
+
+    typedef std::chrono::steady_clock::time_point time_point;
+
+    auto at = [](int64_t ms) { return time_point(std::chrono::milliseconds(ms)); };
+
+    auto checkAlign = [&](int64_t time, uint32_t offset, int64_t expected)
+    {
+        auto deadline = FlexCounter::alignDeadline(at(time), 1000, offset);
+
+        if (deadline != at(expected))
+        {
+            SWSS_LOG_THROW("time %" PRId64 " offset %u aligned to %" PRId64 " ms, expected %" PRId64,
+                    time,
+                    offset,
+                    (int64_t)std::chrono::duration_cast<std::chrono::milliseconds>(deadline.time_since_epoch()).count(),
+                    expected);
+        }
+    };
+
+    checkAlign(10250, 300, 10300);
+    checkAlign(10300, 300, 10300);
+    checkAlign(10301, 300, 11300);
+    checkAlign(10250, 1300, 10300);
+    checkAlign(10000, 0, 10000);
+
+    auto checkNext = [&](int64_t finish, uint64_t expectedSkipped, int64_t expectedDeadline)
+    {
+        time_point deadline = at(10000);
+
+        uint64_t skipped = FlexCounter::nextDeadline(deadline, at(finish), 1000);
+
+        if (skipped != expectedSkipped || deadline != at(expectedDeadline))
+        {
+            SWSS_LOG_THROW("poll finished at %" PRId64 " skipped %" PRIu64 " cycles, expected %" PRIu64,
+                    finish,
+                    skipped,
+                    expectedSkipped);
+        }
+    };
+
+    // poll started at 10000 ms with 1000 ms interval
+
+    checkNext(10500, 0, 11000);
+    checkNext(11000, 0, 11000);
+    checkNext(11001, 1, 12000);
+    checkNext(13000, 2, 13000);
+    checkNext(13500, 3, 14000);
+}
+
 int main()
 {
     swss::Logger::getInstance().setMinPrio(swss::Logger::SWSS_DEBUG);
@@ -563,6 +1054,18 @@ int main()
 
         test_bulk_fdb_create();
 
+        test_fdb_index();
+
+        test_fdb_event_asic_view_writes();
+
+        test_notification_queue_fdb_coalescing();
+
+        test_notification_lane_fast_delivery();
+
+        test_flex_counter_deadlines();
+
+        test_port_rates_plugin();
+
         test_bulk_route_set();
 
         sai_api_uninitialize();
@@ -191,6 +191,31 @@ sub test_brcm_lag_comparison_logic
     play "lag_comparison_logic.rec", 0;
 }
 
+sub test_brcm_lag_comparison_tie
+{
+    fresh_start;
+
+    # temporary lag members use ports from both current lags, first member
+    # (by object id) uses port from lag with 2 members, so that lag should
+    # be matched, and only lag with 1 member removed and 1 member created
+
+    play "lag_tie_1.rec";
+    play "lag_tie_2.rec", 3;
+}
+
+sub test_brcm_buffer_pool_default_create_only
+{
+    fresh_start;
+
+    # temporary buffer pool has explicit default threshold mode, and it
+    # should be matched with current pool which has all other attributes
+    # equal but threshold mode not set, instead of pool which has only
+    # create only attributes equal, so only 1 pool is removed
+
+    play "buffer_pool_default_create_only_1.rec";
+    play "buffer_pool_default_create_only_2.rec", 1;
+}
+
 sub test_brcm_nhg_comparison_logic
 {
     fresh_start;
@@ -562,6 +587,8 @@ test_brcm_full_testbed_config;
 test_brcm_remove_next_hop;
 test_brcm_nhg_comparison_logic;
 test_brcm_lag_comparison_logic;
+test_brcm_lag_comparison_tie;
+test_brcm_buffer_pool_default_create_only;
 test_brcm_speed_init_apply;
 test_brcm_start_empty;
 test_brcm_start_empty_to_empty;